@@ -0,0 +1,48 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/transport-catalogue/domain.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/domain.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/domain.cpp.o.d"
+  "/root/repo/transport-catalogue/geo.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/geo.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/geo.cpp.o.d"
+  "/root/repo/_fast_build/transport-catalogue/graph.pb.cc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/graph.pb.cc.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/graph.pb.cc.o.d"
+  "/root/repo/transport-catalogue/input_reader.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/input_reader.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/input_reader.cpp.o.d"
+  "/root/repo/transport-catalogue/json.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/json.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/json.cpp.o.d"
+  "/root/repo/transport-catalogue/json_builder.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/json_builder.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/json_builder.cpp.o.d"
+  "/root/repo/transport-catalogue/json_reader.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/json_reader.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/json_reader.cpp.o.d"
+  "/root/repo/transport-catalogue/main.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/main.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/main.cpp.o.d"
+  "/root/repo/transport-catalogue/map_renderer.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/map_renderer.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/map_renderer.cpp.o.d"
+  "/root/repo/_fast_build/transport-catalogue/map_renderer.pb.cc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/map_renderer.pb.cc.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/map_renderer.pb.cc.o.d"
+  "/root/repo/transport-catalogue/raptor_router.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/raptor_router.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/raptor_router.cpp.o.d"
+  "/root/repo/transport-catalogue/request_handler.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/request_handler.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/request_handler.cpp.o.d"
+  "/root/repo/transport-catalogue/serialization.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/serialization.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/serialization.cpp.o.d"
+  "/root/repo/transport-catalogue/stat_reader.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/stat_reader.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/stat_reader.cpp.o.d"
+  "/root/repo/transport-catalogue/svg.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/svg.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/svg.cpp.o.d"
+  "/root/repo/_fast_build/transport-catalogue/svg.pb.cc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/svg.pb.cc.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/svg.pb.cc.o.d"
+  "/root/repo/transport-catalogue/transport_catalogue.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_catalogue.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_catalogue.cpp.o.d"
+  "/root/repo/_fast_build/transport-catalogue/transport_catalogue.pb.cc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_catalogue.pb.cc.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_catalogue.pb.cc.o.d"
+  "/root/repo/transport-catalogue/transport_router.cpp" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_router.cpp.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_router.cpp.o.d"
+  "/root/repo/_fast_build/transport-catalogue/transport_router.pb.cc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_router.pb.cc.o" "gcc" "transport-catalogue/CMakeFiles/transport_catalogue.dir/transport_router.pb.cc.o.d"
+  )
+
+# Pairs of files generated by the same build rule.
+set(CMAKE_MULTIPLE_OUTPUT_PAIRS
+  "/root/repo/_fast_build/transport-catalogue/graph.pb.cc" "/root/repo/_fast_build/transport-catalogue/graph.pb.h"
+  "/root/repo/_fast_build/transport-catalogue/map_renderer.pb.cc" "/root/repo/_fast_build/transport-catalogue/map_renderer.pb.h"
+  "/root/repo/_fast_build/transport-catalogue/svg.pb.cc" "/root/repo/_fast_build/transport-catalogue/svg.pb.h"
+  "/root/repo/_fast_build/transport-catalogue/transport_catalogue.pb.cc" "/root/repo/_fast_build/transport-catalogue/transport_catalogue.pb.h"
+  "/root/repo/_fast_build/transport-catalogue/transport_router.pb.cc" "/root/repo/_fast_build/transport-catalogue/transport_router.pb.h"
+  )
+
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
@@ -0,0 +1,1406 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: graph.proto
+
+#include "graph.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace proto_schema {
+namespace graph {
+PROTOBUF_CONSTEXPR Edge::Edge(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/0u
+  , /*decltype(_impl_.to_)*/0u
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct EdgeDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR EdgeDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~EdgeDefaultTypeInternal() {}
+  union {
+    Edge _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 EdgeDefaultTypeInternal _Edge_default_instance_;
+PROTOBUF_CONSTEXPR IncidentEdges::IncidentEdges(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edge_id_)*/{}
+  , /*decltype(_impl_._edge_id_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct IncidentEdgesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR IncidentEdgesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~IncidentEdgesDefaultTypeInternal() {}
+  union {
+    IncidentEdges _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 IncidentEdgesDefaultTypeInternal _IncidentEdges_default_instance_;
+PROTOBUF_CONSTEXPR RoutingGraph::RoutingGraph(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.edges_)*/{}
+  , /*decltype(_impl_.incident_edges_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoutingGraphDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoutingGraphDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoutingGraphDefaultTypeInternal() {}
+  union {
+    RoutingGraph _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutingGraphDefaultTypeInternal _RoutingGraph_default_instance_;
+PROTOBUF_CONSTEXPR Shortcut::Shortcut(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.from_)*/0u
+  , /*decltype(_impl_.to_)*/0u
+  , /*decltype(_impl_.weight_)*/0
+  , /*decltype(_impl_.first_edge_)*/0u
+  , /*decltype(_impl_.second_edge_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ShortcutDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ShortcutDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ShortcutDefaultTypeInternal() {}
+  union {
+    Shortcut _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ShortcutDefaultTypeInternal _Shortcut_default_instance_;
+PROTOBUF_CONSTEXPR ContractionHierarchy::ContractionHierarchy(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.ranks_)*/{}
+  , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.shortcuts_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ContractionHierarchyDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContractionHierarchyDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContractionHierarchyDefaultTypeInternal() {}
+  union {
+    ContractionHierarchy _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
+}  // namespace graph
+}  // namespace proto_schema
+static ::_pb::Metadata file_level_metadata_graph_2eproto[5];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_graph_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_graph_2eproto = nullptr;
+
+const uint32_t TableStruct_graph_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Edge, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Edge, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Edge, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Edge, _impl_.weight_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::IncidentEdges, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::IncidentEdges, _impl_.edge_id_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::RoutingGraph, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::RoutingGraph, _impl_.edges_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::RoutingGraph, _impl_.incident_edges_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Shortcut, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Shortcut, _impl_.from_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Shortcut, _impl_.to_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Shortcut, _impl_.weight_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Shortcut, _impl_.first_edge_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::Shortcut, _impl_.second_edge_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::ContractionHierarchy, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::ContractionHierarchy, _impl_.ranks_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::graph::ContractionHierarchy, _impl_.shortcuts_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::proto_schema::graph::Edge)},
+  { 9, -1, -1, sizeof(::proto_schema::graph::IncidentEdges)},
+  { 16, -1, -1, sizeof(::proto_schema::graph::RoutingGraph)},
+  { 24, -1, -1, sizeof(::proto_schema::graph::Shortcut)},
+  { 35, -1, -1, sizeof(::proto_schema::graph::ContractionHierarchy)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto_schema::graph::_Edge_default_instance_._instance,
+  &::proto_schema::graph::_IncidentEdges_default_instance_._instance,
+  &::proto_schema::graph::_RoutingGraph_default_instance_._instance,
+  &::proto_schema::graph::_Shortcut_default_instance_._instance,
+  &::proto_schema::graph::_ContractionHierarchy_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_graph_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\013graph.proto\022\022proto_schema.graph\"0\n\004Edg"
+  "e\022\014\n\004from\030\001 \001(\r\022\n\n\002to\030\002 \001(\r\022\016\n\006weight\030\003 "
+  "\001(\001\" \n\rIncidentEdges\022\017\n\007edge_id\030\001 \003(\r\"r\n"
+  "\014RoutingGraph\022\'\n\005edges\030\001 \003(\0132\030.proto_sch"
+  "ema.graph.Edge\0229\n\016incident_edges\030\002 \003(\0132!"
+  ".proto_schema.graph.IncidentEdges\"]\n\010Sho"
+  "rtcut\022\014\n\004from\030\001 \001(\r\022\n\n\002to\030\002 \001(\r\022\016\n\006weigh"
+  "t\030\003 \001(\001\022\022\n\nfirst_edge\030\004 \001(\r\022\023\n\013second_ed"
+  "ge\030\005 \001(\r\"V\n\024ContractionHierarchy\022\r\n\005rank"
+  "s\030\001 \003(\r\022/\n\tshortcuts\030\002 \003(\0132\034.proto_schem"
+  "a.graph.Shortcutb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_graph_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_graph_2eproto = {
+    false, false, 424, descriptor_table_protodef_graph_2eproto,
+    "graph.proto",
+    &descriptor_table_graph_2eproto_once, nullptr, 0, 5,
+    schemas, file_default_instances, TableStruct_graph_2eproto::offsets,
+    file_level_metadata_graph_2eproto, file_level_enum_descriptors_graph_2eproto,
+    file_level_service_descriptors_graph_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_graph_2eproto_getter() {
+  return &descriptor_table_graph_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_graph_2eproto(&descriptor_table_graph_2eproto);
+namespace proto_schema {
+namespace graph {
+
+// ===================================================================
+
+class Edge::_Internal {
+ public:
+};
+
+Edge::Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.graph.Edge)
+}
+Edge::Edge(const Edge& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Edge* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.weight_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_, &from._impl_.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.weight_) -
+    reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.weight_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.graph.Edge)
+}
+
+inline void Edge::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){0u}
+    , decltype(_impl_.to_){0u}
+    , decltype(_impl_.weight_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Edge::~Edge() {
+  // @@protoc_insertion_point(destructor:proto_schema.graph.Edge)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Edge::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Edge::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Edge::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.graph.Edge)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.from_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.weight_) -
+      reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.weight_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Edge::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 from = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 to = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double weight = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Edge::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.graph.Edge)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
+  }
+
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.graph.Edge)
+  return target;
+}
+
+size_t Edge::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.graph.Edge)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
+  }
+
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Edge::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Edge::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Edge::GetClassData() const { return &_class_data_; }
+
+
+void Edge::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Edge*>(&to_msg);
+  auto& from = static_cast<const Edge&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.graph.Edge)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_from() != 0) {
+    _this->_internal_set_from(from._internal_from());
+  }
+  if (from._internal_to() != 0) {
+    _this->_internal_set_to(from._internal_to());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = from._internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    _this->_internal_set_weight(from._internal_weight());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Edge::CopyFrom(const Edge& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.graph.Edge)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Edge::IsInitialized() const {
+  return true;
+}
+
+void Edge::InternalSwap(Edge* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Edge, _impl_.weight_)
+      + sizeof(Edge::_impl_.weight_)
+      - PROTOBUF_FIELD_OFFSET(Edge, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Edge::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[0]);
+}
+
+// ===================================================================
+
+class IncidentEdges::_Internal {
+ public:
+};
+
+IncidentEdges::IncidentEdges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.graph.IncidentEdges)
+}
+IncidentEdges::IncidentEdges(const IncidentEdges& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  IncidentEdges* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_id_){from._impl_.edge_id_}
+    , /*decltype(_impl_._edge_id_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.graph.IncidentEdges)
+}
+
+inline void IncidentEdges::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edge_id_){arena}
+    , /*decltype(_impl_._edge_id_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+IncidentEdges::~IncidentEdges() {
+  // @@protoc_insertion_point(destructor:proto_schema.graph.IncidentEdges)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void IncidentEdges::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edge_id_.~RepeatedField();
+}
+
+void IncidentEdges::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void IncidentEdges::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.graph.IncidentEdges)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.edge_id_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* IncidentEdges::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 edge_id = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_edge_id(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_edge_id(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* IncidentEdges::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.graph.IncidentEdges)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 edge_id = 1;
+  {
+    int byte_size = _impl_._edge_id_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_edge_id(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.graph.IncidentEdges)
+  return target;
+}
+
+size_t IncidentEdges::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.graph.IncidentEdges)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 edge_id = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.edge_id_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._edge_id_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData IncidentEdges::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    IncidentEdges::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*IncidentEdges::GetClassData() const { return &_class_data_; }
+
+
+void IncidentEdges::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<IncidentEdges*>(&to_msg);
+  auto& from = static_cast<const IncidentEdges&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.graph.IncidentEdges)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.edge_id_.MergeFrom(from._impl_.edge_id_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void IncidentEdges::CopyFrom(const IncidentEdges& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.graph.IncidentEdges)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool IncidentEdges::IsInitialized() const {
+  return true;
+}
+
+void IncidentEdges::InternalSwap(IncidentEdges* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.edge_id_.InternalSwap(&other->_impl_.edge_id_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata IncidentEdges::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[1]);
+}
+
+// ===================================================================
+
+class RoutingGraph::_Internal {
+ public:
+};
+
+RoutingGraph::RoutingGraph(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.graph.RoutingGraph)
+}
+RoutingGraph::RoutingGraph(const RoutingGraph& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutingGraph* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edges_){from._impl_.edges_}
+    , decltype(_impl_.incident_edges_){from._impl_.incident_edges_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.graph.RoutingGraph)
+}
+
+inline void RoutingGraph::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.edges_){arena}
+    , decltype(_impl_.incident_edges_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoutingGraph::~RoutingGraph() {
+  // @@protoc_insertion_point(destructor:proto_schema.graph.RoutingGraph)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoutingGraph::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.edges_.~RepeatedPtrField();
+  _impl_.incident_edges_.~RepeatedPtrField();
+}
+
+void RoutingGraph::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoutingGraph::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.graph.RoutingGraph)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.edges_.Clear();
+  _impl_.incident_edges_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoutingGraph::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto_schema.graph.Edge edges = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_edges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto_schema.graph.IncidentEdges incident_edges = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_incident_edges(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoutingGraph::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.graph.RoutingGraph)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.graph.Edge edges = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_edges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_edges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto_schema.graph.IncidentEdges incident_edges = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_incident_edges_size()); i < n; i++) {
+    const auto& repfield = this->_internal_incident_edges(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.graph.RoutingGraph)
+  return target;
+}
+
+size_t RoutingGraph::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.graph.RoutingGraph)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.graph.Edge edges = 1;
+  total_size += 1UL * this->_internal_edges_size();
+  for (const auto& msg : this->_impl_.edges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .proto_schema.graph.IncidentEdges incident_edges = 2;
+  total_size += 1UL * this->_internal_incident_edges_size();
+  for (const auto& msg : this->_impl_.incident_edges_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutingGraph::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoutingGraph::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutingGraph::GetClassData() const { return &_class_data_; }
+
+
+void RoutingGraph::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutingGraph*>(&to_msg);
+  auto& from = static_cast<const RoutingGraph&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.graph.RoutingGraph)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.edges_.MergeFrom(from._impl_.edges_);
+  _this->_impl_.incident_edges_.MergeFrom(from._impl_.incident_edges_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoutingGraph::CopyFrom(const RoutingGraph& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.graph.RoutingGraph)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoutingGraph::IsInitialized() const {
+  return true;
+}
+
+void RoutingGraph::InternalSwap(RoutingGraph* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.edges_.InternalSwap(&other->_impl_.edges_);
+  _impl_.incident_edges_.InternalSwap(&other->_impl_.incident_edges_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoutingGraph::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[2]);
+}
+
+// ===================================================================
+
+class Shortcut::_Internal {
+ public:
+};
+
+Shortcut::Shortcut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.graph.Shortcut)
+}
+Shortcut::Shortcut(const Shortcut& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Shortcut* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){}
+    , decltype(_impl_.to_){}
+    , decltype(_impl_.weight_){}
+    , decltype(_impl_.first_edge_){}
+    , decltype(_impl_.second_edge_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.from_, &from._impl_.from_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.second_edge_) -
+    reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.second_edge_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.graph.Shortcut)
+}
+
+inline void Shortcut::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.from_){0u}
+    , decltype(_impl_.to_){0u}
+    , decltype(_impl_.weight_){0}
+    , decltype(_impl_.first_edge_){0u}
+    , decltype(_impl_.second_edge_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Shortcut::~Shortcut() {
+  // @@protoc_insertion_point(destructor:proto_schema.graph.Shortcut)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Shortcut::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Shortcut::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Shortcut::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.graph.Shortcut)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.from_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.second_edge_) -
+      reinterpret_cast<char*>(&_impl_.from_)) + sizeof(_impl_.second_edge_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Shortcut::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 from = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.from_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 to = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.to_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double weight = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.weight_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 first_edge = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.first_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 second_edge = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.second_edge_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Shortcut::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.graph.Shortcut)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_from(), target);
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_to(), target);
+  }
+
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_weight(), target);
+  }
+
+  // uint32 first_edge = 4;
+  if (this->_internal_first_edge() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_first_edge(), target);
+  }
+
+  // uint32 second_edge = 5;
+  if (this->_internal_second_edge() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_second_edge(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.graph.Shortcut)
+  return target;
+}
+
+size_t Shortcut::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.graph.Shortcut)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 from = 1;
+  if (this->_internal_from() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from());
+  }
+
+  // uint32 to = 2;
+  if (this->_internal_to() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to());
+  }
+
+  // double weight = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = this->_internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 first_edge = 4;
+  if (this->_internal_first_edge() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_first_edge());
+  }
+
+  // uint32 second_edge = 5;
+  if (this->_internal_second_edge() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_second_edge());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Shortcut::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Shortcut::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Shortcut::GetClassData() const { return &_class_data_; }
+
+
+void Shortcut::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Shortcut*>(&to_msg);
+  auto& from = static_cast<const Shortcut&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.graph.Shortcut)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_from() != 0) {
+    _this->_internal_set_from(from._internal_from());
+  }
+  if (from._internal_to() != 0) {
+    _this->_internal_set_to(from._internal_to());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_weight = from._internal_weight();
+  uint64_t raw_weight;
+  memcpy(&raw_weight, &tmp_weight, sizeof(tmp_weight));
+  if (raw_weight != 0) {
+    _this->_internal_set_weight(from._internal_weight());
+  }
+  if (from._internal_first_edge() != 0) {
+    _this->_internal_set_first_edge(from._internal_first_edge());
+  }
+  if (from._internal_second_edge() != 0) {
+    _this->_internal_set_second_edge(from._internal_second_edge());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Shortcut::CopyFrom(const Shortcut& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.graph.Shortcut)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Shortcut::IsInitialized() const {
+  return true;
+}
+
+void Shortcut::InternalSwap(Shortcut* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Shortcut, _impl_.second_edge_)
+      + sizeof(Shortcut::_impl_.second_edge_)
+      - PROTOBUF_FIELD_OFFSET(Shortcut, _impl_.from_)>(
+          reinterpret_cast<char*>(&_impl_.from_),
+          reinterpret_cast<char*>(&other->_impl_.from_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Shortcut::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[3]);
+}
+
+// ===================================================================
+
+class ContractionHierarchy::_Internal {
+ public:
+};
+
+ContractionHierarchy::ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.graph.ContractionHierarchy)
+}
+ContractionHierarchy::ContractionHierarchy(const ContractionHierarchy& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ContractionHierarchy* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranks_){from._impl_.ranks_}
+    , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+    , decltype(_impl_.shortcuts_){from._impl_.shortcuts_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.graph.ContractionHierarchy)
+}
+
+inline void ContractionHierarchy::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.ranks_){arena}
+    , /*decltype(_impl_._ranks_cached_byte_size_)*/{0}
+    , decltype(_impl_.shortcuts_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ContractionHierarchy::~ContractionHierarchy() {
+  // @@protoc_insertion_point(destructor:proto_schema.graph.ContractionHierarchy)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ContractionHierarchy::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.ranks_.~RepeatedField();
+  _impl_.shortcuts_.~RepeatedPtrField();
+}
+
+void ContractionHierarchy::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ContractionHierarchy::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.graph.ContractionHierarchy)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.ranks_.Clear();
+  _impl_.shortcuts_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ContractionHierarchy::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 ranks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_ranks(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_ranks(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto_schema.graph.Shortcut shortcuts = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_shortcuts(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ContractionHierarchy::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.graph.ContractionHierarchy)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 ranks = 1;
+  {
+    int byte_size = _impl_._ranks_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_ranks(), byte_size, target);
+    }
+  }
+
+  // repeated .proto_schema.graph.Shortcut shortcuts = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_shortcuts_size()); i < n; i++) {
+    const auto& repfield = this->_internal_shortcuts(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.graph.ContractionHierarchy)
+  return target;
+}
+
+size_t ContractionHierarchy::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.graph.ContractionHierarchy)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 ranks = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.ranks_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._ranks_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated .proto_schema.graph.Shortcut shortcuts = 2;
+  total_size += 1UL * this->_internal_shortcuts_size();
+  for (const auto& msg : this->_impl_.shortcuts_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ContractionHierarchy::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ContractionHierarchy::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ContractionHierarchy::GetClassData() const { return &_class_data_; }
+
+
+void ContractionHierarchy::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ContractionHierarchy*>(&to_msg);
+  auto& from = static_cast<const ContractionHierarchy&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.graph.ContractionHierarchy)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.ranks_.MergeFrom(from._impl_.ranks_);
+  _this->_impl_.shortcuts_.MergeFrom(from._impl_.shortcuts_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ContractionHierarchy::CopyFrom(const ContractionHierarchy& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.graph.ContractionHierarchy)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ContractionHierarchy::IsInitialized() const {
+  return true;
+}
+
+void ContractionHierarchy::InternalSwap(ContractionHierarchy* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.ranks_.InternalSwap(&other->_impl_.ranks_);
+  _impl_.shortcuts_.InternalSwap(&other->_impl_.shortcuts_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ContractionHierarchy::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_graph_2eproto_getter, &descriptor_table_graph_2eproto_once,
+      file_level_metadata_graph_2eproto[4]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace graph
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_schema::graph::Edge*
+Arena::CreateMaybeMessage< ::proto_schema::graph::Edge >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::graph::Edge >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::graph::IncidentEdges*
+Arena::CreateMaybeMessage< ::proto_schema::graph::IncidentEdges >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::graph::IncidentEdges >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::graph::RoutingGraph*
+Arena::CreateMaybeMessage< ::proto_schema::graph::RoutingGraph >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::graph::RoutingGraph >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::graph::Shortcut*
+Arena::CreateMaybeMessage< ::proto_schema::graph::Shortcut >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::graph::Shortcut >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::graph::ContractionHierarchy*
+Arena::CreateMaybeMessage< ::proto_schema::graph::ContractionHierarchy >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::graph::ContractionHierarchy >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1380 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: graph.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_graph_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_graph_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_graph_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_graph_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_graph_2eproto;
+namespace proto_schema {
+namespace graph {
+class ContractionHierarchy;
+struct ContractionHierarchyDefaultTypeInternal;
+extern ContractionHierarchyDefaultTypeInternal _ContractionHierarchy_default_instance_;
+class Edge;
+struct EdgeDefaultTypeInternal;
+extern EdgeDefaultTypeInternal _Edge_default_instance_;
+class IncidentEdges;
+struct IncidentEdgesDefaultTypeInternal;
+extern IncidentEdgesDefaultTypeInternal _IncidentEdges_default_instance_;
+class RoutingGraph;
+struct RoutingGraphDefaultTypeInternal;
+extern RoutingGraphDefaultTypeInternal _RoutingGraph_default_instance_;
+class Shortcut;
+struct ShortcutDefaultTypeInternal;
+extern ShortcutDefaultTypeInternal _Shortcut_default_instance_;
+}  // namespace graph
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_schema::graph::ContractionHierarchy* Arena::CreateMaybeMessage<::proto_schema::graph::ContractionHierarchy>(Arena*);
+template<> ::proto_schema::graph::Edge* Arena::CreateMaybeMessage<::proto_schema::graph::Edge>(Arena*);
+template<> ::proto_schema::graph::IncidentEdges* Arena::CreateMaybeMessage<::proto_schema::graph::IncidentEdges>(Arena*);
+template<> ::proto_schema::graph::RoutingGraph* Arena::CreateMaybeMessage<::proto_schema::graph::RoutingGraph>(Arena*);
+template<> ::proto_schema::graph::Shortcut* Arena::CreateMaybeMessage<::proto_schema::graph::Shortcut>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_schema {
+namespace graph {
+
+// ===================================================================
+
+class Edge final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.graph.Edge) */ {
+ public:
+  inline Edge() : Edge(nullptr) {}
+  ~Edge() override;
+  explicit PROTOBUF_CONSTEXPR Edge(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Edge(const Edge& from);
+  Edge(Edge&& from) noexcept
+    : Edge() {
+    *this = ::std::move(from);
+  }
+
+  inline Edge& operator=(const Edge& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Edge& operator=(Edge&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Edge& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Edge* internal_default_instance() {
+    return reinterpret_cast<const Edge*>(
+               &_Edge_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Edge& a, Edge& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Edge* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Edge* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Edge* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Edge>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Edge& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Edge& from) {
+    Edge::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Edge* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.graph.Edge";
+  }
+  protected:
+  explicit Edge(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFromFieldNumber = 1,
+    kToFieldNumber = 2,
+    kWeightFieldNumber = 3,
+  };
+  // uint32 from = 1;
+  void clear_from();
+  uint32_t from() const;
+  void set_from(uint32_t value);
+  private:
+  uint32_t _internal_from() const;
+  void _internal_set_from(uint32_t value);
+  public:
+
+  // uint32 to = 2;
+  void clear_to();
+  uint32_t to() const;
+  void set_to(uint32_t value);
+  private:
+  uint32_t _internal_to() const;
+  void _internal_set_to(uint32_t value);
+  public:
+
+  // double weight = 3;
+  void clear_weight();
+  double weight() const;
+  void set_weight(double value);
+  private:
+  double _internal_weight() const;
+  void _internal_set_weight(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.graph.Edge)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t from_;
+    uint32_t to_;
+    double weight_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// -------------------------------------------------------------------
+
+class IncidentEdges final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.graph.IncidentEdges) */ {
+ public:
+  inline IncidentEdges() : IncidentEdges(nullptr) {}
+  ~IncidentEdges() override;
+  explicit PROTOBUF_CONSTEXPR IncidentEdges(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  IncidentEdges(const IncidentEdges& from);
+  IncidentEdges(IncidentEdges&& from) noexcept
+    : IncidentEdges() {
+    *this = ::std::move(from);
+  }
+
+  inline IncidentEdges& operator=(const IncidentEdges& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline IncidentEdges& operator=(IncidentEdges&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const IncidentEdges& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const IncidentEdges* internal_default_instance() {
+    return reinterpret_cast<const IncidentEdges*>(
+               &_IncidentEdges_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(IncidentEdges& a, IncidentEdges& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(IncidentEdges* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(IncidentEdges* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  IncidentEdges* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<IncidentEdges>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const IncidentEdges& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const IncidentEdges& from) {
+    IncidentEdges::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(IncidentEdges* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.graph.IncidentEdges";
+  }
+  protected:
+  explicit IncidentEdges(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEdgeIdFieldNumber = 1,
+  };
+  // repeated uint32 edge_id = 1;
+  int edge_id_size() const;
+  private:
+  int _internal_edge_id_size() const;
+  public:
+  void clear_edge_id();
+  private:
+  uint32_t _internal_edge_id(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_edge_id() const;
+  void _internal_add_edge_id(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_edge_id();
+  public:
+  uint32_t edge_id(int index) const;
+  void set_edge_id(int index, uint32_t value);
+  void add_edge_id(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      edge_id() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_edge_id();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.graph.IncidentEdges)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > edge_id_;
+    mutable std::atomic<int> _edge_id_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoutingGraph final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.graph.RoutingGraph) */ {
+ public:
+  inline RoutingGraph() : RoutingGraph(nullptr) {}
+  ~RoutingGraph() override;
+  explicit PROTOBUF_CONSTEXPR RoutingGraph(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoutingGraph(const RoutingGraph& from);
+  RoutingGraph(RoutingGraph&& from) noexcept
+    : RoutingGraph() {
+    *this = ::std::move(from);
+  }
+
+  inline RoutingGraph& operator=(const RoutingGraph& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoutingGraph& operator=(RoutingGraph&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoutingGraph& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoutingGraph* internal_default_instance() {
+    return reinterpret_cast<const RoutingGraph*>(
+               &_RoutingGraph_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RoutingGraph& a, RoutingGraph& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoutingGraph* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoutingGraph* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoutingGraph* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoutingGraph>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoutingGraph& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoutingGraph& from) {
+    RoutingGraph::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoutingGraph* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.graph.RoutingGraph";
+  }
+  protected:
+  explicit RoutingGraph(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kEdgesFieldNumber = 1,
+    kIncidentEdgesFieldNumber = 2,
+  };
+  // repeated .proto_schema.graph.Edge edges = 1;
+  int edges_size() const;
+  private:
+  int _internal_edges_size() const;
+  public:
+  void clear_edges();
+  ::proto_schema::graph::Edge* mutable_edges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Edge >*
+      mutable_edges();
+  private:
+  const ::proto_schema::graph::Edge& _internal_edges(int index) const;
+  ::proto_schema::graph::Edge* _internal_add_edges();
+  public:
+  const ::proto_schema::graph::Edge& edges(int index) const;
+  ::proto_schema::graph::Edge* add_edges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Edge >&
+      edges() const;
+
+  // repeated .proto_schema.graph.IncidentEdges incident_edges = 2;
+  int incident_edges_size() const;
+  private:
+  int _internal_incident_edges_size() const;
+  public:
+  void clear_incident_edges();
+  ::proto_schema::graph::IncidentEdges* mutable_incident_edges(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::IncidentEdges >*
+      mutable_incident_edges();
+  private:
+  const ::proto_schema::graph::IncidentEdges& _internal_incident_edges(int index) const;
+  ::proto_schema::graph::IncidentEdges* _internal_add_incident_edges();
+  public:
+  const ::proto_schema::graph::IncidentEdges& incident_edges(int index) const;
+  ::proto_schema::graph::IncidentEdges* add_incident_edges();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::IncidentEdges >&
+      incident_edges() const;
+
+  // @@protoc_insertion_point(class_scope:proto_schema.graph.RoutingGraph)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Edge > edges_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::IncidentEdges > incident_edges_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Shortcut final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.graph.Shortcut) */ {
+ public:
+  inline Shortcut() : Shortcut(nullptr) {}
+  ~Shortcut() override;
+  explicit PROTOBUF_CONSTEXPR Shortcut(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Shortcut(const Shortcut& from);
+  Shortcut(Shortcut&& from) noexcept
+    : Shortcut() {
+    *this = ::std::move(from);
+  }
+
+  inline Shortcut& operator=(const Shortcut& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Shortcut& operator=(Shortcut&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Shortcut& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Shortcut* internal_default_instance() {
+    return reinterpret_cast<const Shortcut*>(
+               &_Shortcut_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Shortcut& a, Shortcut& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Shortcut* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Shortcut* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Shortcut* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Shortcut>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Shortcut& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Shortcut& from) {
+    Shortcut::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Shortcut* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.graph.Shortcut";
+  }
+  protected:
+  explicit Shortcut(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kFromFieldNumber = 1,
+    kToFieldNumber = 2,
+    kWeightFieldNumber = 3,
+    kFirstEdgeFieldNumber = 4,
+    kSecondEdgeFieldNumber = 5,
+  };
+  // uint32 from = 1;
+  void clear_from();
+  uint32_t from() const;
+  void set_from(uint32_t value);
+  private:
+  uint32_t _internal_from() const;
+  void _internal_set_from(uint32_t value);
+  public:
+
+  // uint32 to = 2;
+  void clear_to();
+  uint32_t to() const;
+  void set_to(uint32_t value);
+  private:
+  uint32_t _internal_to() const;
+  void _internal_set_to(uint32_t value);
+  public:
+
+  // double weight = 3;
+  void clear_weight();
+  double weight() const;
+  void set_weight(double value);
+  private:
+  double _internal_weight() const;
+  void _internal_set_weight(double value);
+  public:
+
+  // uint32 first_edge = 4;
+  void clear_first_edge();
+  uint32_t first_edge() const;
+  void set_first_edge(uint32_t value);
+  private:
+  uint32_t _internal_first_edge() const;
+  void _internal_set_first_edge(uint32_t value);
+  public:
+
+  // uint32 second_edge = 5;
+  void clear_second_edge();
+  uint32_t second_edge() const;
+  void set_second_edge(uint32_t value);
+  private:
+  uint32_t _internal_second_edge() const;
+  void _internal_set_second_edge(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.graph.Shortcut)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t from_;
+    uint32_t to_;
+    double weight_;
+    uint32_t first_edge_;
+    uint32_t second_edge_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ContractionHierarchy final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.graph.ContractionHierarchy) */ {
+ public:
+  inline ContractionHierarchy() : ContractionHierarchy(nullptr) {}
+  ~ContractionHierarchy() override;
+  explicit PROTOBUF_CONSTEXPR ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ContractionHierarchy(const ContractionHierarchy& from);
+  ContractionHierarchy(ContractionHierarchy&& from) noexcept
+    : ContractionHierarchy() {
+    *this = ::std::move(from);
+  }
+
+  inline ContractionHierarchy& operator=(const ContractionHierarchy& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ContractionHierarchy& operator=(ContractionHierarchy&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ContractionHierarchy& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ContractionHierarchy* internal_default_instance() {
+    return reinterpret_cast<const ContractionHierarchy*>(
+               &_ContractionHierarchy_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ContractionHierarchy& a, ContractionHierarchy& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ContractionHierarchy* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ContractionHierarchy* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ContractionHierarchy* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ContractionHierarchy>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ContractionHierarchy& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ContractionHierarchy& from) {
+    ContractionHierarchy::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ContractionHierarchy* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.graph.ContractionHierarchy";
+  }
+  protected:
+  explicit ContractionHierarchy(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRanksFieldNumber = 1,
+    kShortcutsFieldNumber = 2,
+  };
+  // repeated uint32 ranks = 1;
+  int ranks_size() const;
+  private:
+  int _internal_ranks_size() const;
+  public:
+  void clear_ranks();
+  private:
+  uint32_t _internal_ranks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_ranks() const;
+  void _internal_add_ranks(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_ranks();
+  public:
+  uint32_t ranks(int index) const;
+  void set_ranks(int index, uint32_t value);
+  void add_ranks(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      ranks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_ranks();
+
+  // repeated .proto_schema.graph.Shortcut shortcuts = 2;
+  int shortcuts_size() const;
+  private:
+  int _internal_shortcuts_size() const;
+  public:
+  void clear_shortcuts();
+  ::proto_schema::graph::Shortcut* mutable_shortcuts(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Shortcut >*
+      mutable_shortcuts();
+  private:
+  const ::proto_schema::graph::Shortcut& _internal_shortcuts(int index) const;
+  ::proto_schema::graph::Shortcut* _internal_add_shortcuts();
+  public:
+  const ::proto_schema::graph::Shortcut& shortcuts(int index) const;
+  ::proto_schema::graph::Shortcut* add_shortcuts();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Shortcut >&
+      shortcuts() const;
+
+  // @@protoc_insertion_point(class_scope:proto_schema.graph.ContractionHierarchy)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > ranks_;
+    mutable std::atomic<int> _ranks_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Shortcut > shortcuts_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_graph_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Edge
+
+// uint32 from = 1;
+inline void Edge::clear_from() {
+  _impl_.from_ = 0u;
+}
+inline uint32_t Edge::_internal_from() const {
+  return _impl_.from_;
+}
+inline uint32_t Edge::from() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Edge.from)
+  return _internal_from();
+}
+inline void Edge::_internal_set_from(uint32_t value) {
+  
+  _impl_.from_ = value;
+}
+inline void Edge::set_from(uint32_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Edge.from)
+}
+
+// uint32 to = 2;
+inline void Edge::clear_to() {
+  _impl_.to_ = 0u;
+}
+inline uint32_t Edge::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint32_t Edge::to() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Edge.to)
+  return _internal_to();
+}
+inline void Edge::_internal_set_to(uint32_t value) {
+  
+  _impl_.to_ = value;
+}
+inline void Edge::set_to(uint32_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Edge.to)
+}
+
+// double weight = 3;
+inline void Edge::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline double Edge::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double Edge::weight() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Edge.weight)
+  return _internal_weight();
+}
+inline void Edge::_internal_set_weight(double value) {
+  
+  _impl_.weight_ = value;
+}
+inline void Edge::set_weight(double value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Edge.weight)
+}
+
+// -------------------------------------------------------------------
+
+// IncidentEdges
+
+// repeated uint32 edge_id = 1;
+inline int IncidentEdges::_internal_edge_id_size() const {
+  return _impl_.edge_id_.size();
+}
+inline int IncidentEdges::edge_id_size() const {
+  return _internal_edge_id_size();
+}
+inline void IncidentEdges::clear_edge_id() {
+  _impl_.edge_id_.Clear();
+}
+inline uint32_t IncidentEdges::_internal_edge_id(int index) const {
+  return _impl_.edge_id_.Get(index);
+}
+inline uint32_t IncidentEdges::edge_id(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.IncidentEdges.edge_id)
+  return _internal_edge_id(index);
+}
+inline void IncidentEdges::set_edge_id(int index, uint32_t value) {
+  _impl_.edge_id_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.IncidentEdges.edge_id)
+}
+inline void IncidentEdges::_internal_add_edge_id(uint32_t value) {
+  _impl_.edge_id_.Add(value);
+}
+inline void IncidentEdges::add_edge_id(uint32_t value) {
+  _internal_add_edge_id(value);
+  // @@protoc_insertion_point(field_add:proto_schema.graph.IncidentEdges.edge_id)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+IncidentEdges::_internal_edge_id() const {
+  return _impl_.edge_id_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+IncidentEdges::edge_id() const {
+  // @@protoc_insertion_point(field_list:proto_schema.graph.IncidentEdges.edge_id)
+  return _internal_edge_id();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+IncidentEdges::_internal_mutable_edge_id() {
+  return &_impl_.edge_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+IncidentEdges::mutable_edge_id() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.graph.IncidentEdges.edge_id)
+  return _internal_mutable_edge_id();
+}
+
+// -------------------------------------------------------------------
+
+// RoutingGraph
+
+// repeated .proto_schema.graph.Edge edges = 1;
+inline int RoutingGraph::_internal_edges_size() const {
+  return _impl_.edges_.size();
+}
+inline int RoutingGraph::edges_size() const {
+  return _internal_edges_size();
+}
+inline void RoutingGraph::clear_edges() {
+  _impl_.edges_.Clear();
+}
+inline ::proto_schema::graph::Edge* RoutingGraph::mutable_edges(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.graph.RoutingGraph.edges)
+  return _impl_.edges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Edge >*
+RoutingGraph::mutable_edges() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.graph.RoutingGraph.edges)
+  return &_impl_.edges_;
+}
+inline const ::proto_schema::graph::Edge& RoutingGraph::_internal_edges(int index) const {
+  return _impl_.edges_.Get(index);
+}
+inline const ::proto_schema::graph::Edge& RoutingGraph::edges(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.RoutingGraph.edges)
+  return _internal_edges(index);
+}
+inline ::proto_schema::graph::Edge* RoutingGraph::_internal_add_edges() {
+  return _impl_.edges_.Add();
+}
+inline ::proto_schema::graph::Edge* RoutingGraph::add_edges() {
+  ::proto_schema::graph::Edge* _add = _internal_add_edges();
+  // @@protoc_insertion_point(field_add:proto_schema.graph.RoutingGraph.edges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Edge >&
+RoutingGraph::edges() const {
+  // @@protoc_insertion_point(field_list:proto_schema.graph.RoutingGraph.edges)
+  return _impl_.edges_;
+}
+
+// repeated .proto_schema.graph.IncidentEdges incident_edges = 2;
+inline int RoutingGraph::_internal_incident_edges_size() const {
+  return _impl_.incident_edges_.size();
+}
+inline int RoutingGraph::incident_edges_size() const {
+  return _internal_incident_edges_size();
+}
+inline void RoutingGraph::clear_incident_edges() {
+  _impl_.incident_edges_.Clear();
+}
+inline ::proto_schema::graph::IncidentEdges* RoutingGraph::mutable_incident_edges(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.graph.RoutingGraph.incident_edges)
+  return _impl_.incident_edges_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::IncidentEdges >*
+RoutingGraph::mutable_incident_edges() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.graph.RoutingGraph.incident_edges)
+  return &_impl_.incident_edges_;
+}
+inline const ::proto_schema::graph::IncidentEdges& RoutingGraph::_internal_incident_edges(int index) const {
+  return _impl_.incident_edges_.Get(index);
+}
+inline const ::proto_schema::graph::IncidentEdges& RoutingGraph::incident_edges(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.RoutingGraph.incident_edges)
+  return _internal_incident_edges(index);
+}
+inline ::proto_schema::graph::IncidentEdges* RoutingGraph::_internal_add_incident_edges() {
+  return _impl_.incident_edges_.Add();
+}
+inline ::proto_schema::graph::IncidentEdges* RoutingGraph::add_incident_edges() {
+  ::proto_schema::graph::IncidentEdges* _add = _internal_add_incident_edges();
+  // @@protoc_insertion_point(field_add:proto_schema.graph.RoutingGraph.incident_edges)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::IncidentEdges >&
+RoutingGraph::incident_edges() const {
+  // @@protoc_insertion_point(field_list:proto_schema.graph.RoutingGraph.incident_edges)
+  return _impl_.incident_edges_;
+}
+
+// -------------------------------------------------------------------
+
+// Shortcut
+
+// uint32 from = 1;
+inline void Shortcut::clear_from() {
+  _impl_.from_ = 0u;
+}
+inline uint32_t Shortcut::_internal_from() const {
+  return _impl_.from_;
+}
+inline uint32_t Shortcut::from() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Shortcut.from)
+  return _internal_from();
+}
+inline void Shortcut::_internal_set_from(uint32_t value) {
+  
+  _impl_.from_ = value;
+}
+inline void Shortcut::set_from(uint32_t value) {
+  _internal_set_from(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Shortcut.from)
+}
+
+// uint32 to = 2;
+inline void Shortcut::clear_to() {
+  _impl_.to_ = 0u;
+}
+inline uint32_t Shortcut::_internal_to() const {
+  return _impl_.to_;
+}
+inline uint32_t Shortcut::to() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Shortcut.to)
+  return _internal_to();
+}
+inline void Shortcut::_internal_set_to(uint32_t value) {
+  
+  _impl_.to_ = value;
+}
+inline void Shortcut::set_to(uint32_t value) {
+  _internal_set_to(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Shortcut.to)
+}
+
+// double weight = 3;
+inline void Shortcut::clear_weight() {
+  _impl_.weight_ = 0;
+}
+inline double Shortcut::_internal_weight() const {
+  return _impl_.weight_;
+}
+inline double Shortcut::weight() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Shortcut.weight)
+  return _internal_weight();
+}
+inline void Shortcut::_internal_set_weight(double value) {
+  
+  _impl_.weight_ = value;
+}
+inline void Shortcut::set_weight(double value) {
+  _internal_set_weight(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Shortcut.weight)
+}
+
+// uint32 first_edge = 4;
+inline void Shortcut::clear_first_edge() {
+  _impl_.first_edge_ = 0u;
+}
+inline uint32_t Shortcut::_internal_first_edge() const {
+  return _impl_.first_edge_;
+}
+inline uint32_t Shortcut::first_edge() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Shortcut.first_edge)
+  return _internal_first_edge();
+}
+inline void Shortcut::_internal_set_first_edge(uint32_t value) {
+  
+  _impl_.first_edge_ = value;
+}
+inline void Shortcut::set_first_edge(uint32_t value) {
+  _internal_set_first_edge(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Shortcut.first_edge)
+}
+
+// uint32 second_edge = 5;
+inline void Shortcut::clear_second_edge() {
+  _impl_.second_edge_ = 0u;
+}
+inline uint32_t Shortcut::_internal_second_edge() const {
+  return _impl_.second_edge_;
+}
+inline uint32_t Shortcut::second_edge() const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.Shortcut.second_edge)
+  return _internal_second_edge();
+}
+inline void Shortcut::_internal_set_second_edge(uint32_t value) {
+  
+  _impl_.second_edge_ = value;
+}
+inline void Shortcut::set_second_edge(uint32_t value) {
+  _internal_set_second_edge(value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.Shortcut.second_edge)
+}
+
+// -------------------------------------------------------------------
+
+// ContractionHierarchy
+
+// repeated uint32 ranks = 1;
+inline int ContractionHierarchy::_internal_ranks_size() const {
+  return _impl_.ranks_.size();
+}
+inline int ContractionHierarchy::ranks_size() const {
+  return _internal_ranks_size();
+}
+inline void ContractionHierarchy::clear_ranks() {
+  _impl_.ranks_.Clear();
+}
+inline uint32_t ContractionHierarchy::_internal_ranks(int index) const {
+  return _impl_.ranks_.Get(index);
+}
+inline uint32_t ContractionHierarchy::ranks(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.ContractionHierarchy.ranks)
+  return _internal_ranks(index);
+}
+inline void ContractionHierarchy::set_ranks(int index, uint32_t value) {
+  _impl_.ranks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.graph.ContractionHierarchy.ranks)
+}
+inline void ContractionHierarchy::_internal_add_ranks(uint32_t value) {
+  _impl_.ranks_.Add(value);
+}
+inline void ContractionHierarchy::add_ranks(uint32_t value) {
+  _internal_add_ranks(value);
+  // @@protoc_insertion_point(field_add:proto_schema.graph.ContractionHierarchy.ranks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::_internal_ranks() const {
+  return _impl_.ranks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ContractionHierarchy::ranks() const {
+  // @@protoc_insertion_point(field_list:proto_schema.graph.ContractionHierarchy.ranks)
+  return _internal_ranks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::_internal_mutable_ranks() {
+  return &_impl_.ranks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ContractionHierarchy::mutable_ranks() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.graph.ContractionHierarchy.ranks)
+  return _internal_mutable_ranks();
+}
+
+// repeated .proto_schema.graph.Shortcut shortcuts = 2;
+inline int ContractionHierarchy::_internal_shortcuts_size() const {
+  return _impl_.shortcuts_.size();
+}
+inline int ContractionHierarchy::shortcuts_size() const {
+  return _internal_shortcuts_size();
+}
+inline void ContractionHierarchy::clear_shortcuts() {
+  _impl_.shortcuts_.Clear();
+}
+inline ::proto_schema::graph::Shortcut* ContractionHierarchy::mutable_shortcuts(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.graph.ContractionHierarchy.shortcuts)
+  return _impl_.shortcuts_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Shortcut >*
+ContractionHierarchy::mutable_shortcuts() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.graph.ContractionHierarchy.shortcuts)
+  return &_impl_.shortcuts_;
+}
+inline const ::proto_schema::graph::Shortcut& ContractionHierarchy::_internal_shortcuts(int index) const {
+  return _impl_.shortcuts_.Get(index);
+}
+inline const ::proto_schema::graph::Shortcut& ContractionHierarchy::shortcuts(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.graph.ContractionHierarchy.shortcuts)
+  return _internal_shortcuts(index);
+}
+inline ::proto_schema::graph::Shortcut* ContractionHierarchy::_internal_add_shortcuts() {
+  return _impl_.shortcuts_.Add();
+}
+inline ::proto_schema::graph::Shortcut* ContractionHierarchy::add_shortcuts() {
+  ::proto_schema::graph::Shortcut* _add = _internal_add_shortcuts();
+  // @@protoc_insertion_point(field_add:proto_schema.graph.ContractionHierarchy.shortcuts)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::graph::Shortcut >&
+ContractionHierarchy::shortcuts() const {
+  // @@protoc_insertion_point(field_list:proto_schema.graph.ContractionHierarchy.shortcuts)
+  return _impl_.shortcuts_;
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace graph
+}  // namespace proto_schema
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_graph_2eproto
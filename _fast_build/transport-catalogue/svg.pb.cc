@@ -0,0 +1,976 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: svg.proto
+
+#include "svg.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace proto_schema {
+namespace svg {
+PROTOBUF_CONSTEXPR Rgb::Rgb(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.red_)*/0
+  , /*decltype(_impl_.green_)*/0
+  , /*decltype(_impl_.blue_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RgbDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RgbDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RgbDefaultTypeInternal() {}
+  union {
+    Rgb _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RgbDefaultTypeInternal _Rgb_default_instance_;
+PROTOBUF_CONSTEXPR Rgba::Rgba(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.rgb_)*/nullptr
+  , /*decltype(_impl_.alpha_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RgbaDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RgbaDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RgbaDefaultTypeInternal() {}
+  union {
+    Rgba _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RgbaDefaultTypeInternal _Rgba_default_instance_;
+PROTOBUF_CONSTEXPR Color::Color(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.type_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}
+  , /*decltype(_impl_._oneof_case_)*/{}} {}
+struct ColorDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ColorDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ColorDefaultTypeInternal() {}
+  union {
+    Color _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ColorDefaultTypeInternal _Color_default_instance_;
+}  // namespace svg
+}  // namespace proto_schema
+static ::_pb::Metadata file_level_metadata_svg_2eproto[3];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_svg_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_svg_2eproto = nullptr;
+
+const uint32_t TableStruct_svg_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgb, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgb, _impl_.red_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgb, _impl_.green_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgb, _impl_.blue_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgba, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgba, _impl_.rgb_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Rgba, _impl_.alpha_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Color, _internal_metadata_),
+  ~0u,  // no _extensions_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Color, _impl_._oneof_case_[0]),
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  ::_pbi::kInvalidFieldOffsetTag,
+  PROTOBUF_FIELD_OFFSET(::proto_schema::svg::Color, _impl_.type_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::proto_schema::svg::Rgb)},
+  { 9, -1, -1, sizeof(::proto_schema::svg::Rgba)},
+  { 17, -1, -1, sizeof(::proto_schema::svg::Color)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto_schema::svg::_Rgb_default_instance_._instance,
+  &::proto_schema::svg::_Rgba_default_instance_._instance,
+  &::proto_schema::svg::_Color_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_svg_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\tsvg.proto\022\020proto_schema.svg\"/\n\003Rgb\022\013\n\003"
+  "red\030\001 \001(\005\022\r\n\005green\030\002 \001(\005\022\014\n\004blue\030\003 \001(\005\"9"
+  "\n\004Rgba\022\"\n\003rgb\030\001 \001(\0132\025.proto_schema.svg.R"
+  "gb\022\r\n\005alpha\030\002 \001(\001\"n\n\005Color\022$\n\003rgb\030\001 \001(\0132"
+  "\025.proto_schema.svg.RgbH\000\022&\n\004rgba\030\002 \001(\0132\026"
+  ".proto_schema.svg.RgbaH\000\022\017\n\005named\030\003 \001(\tH"
+  "\000B\006\n\004typeb\006proto3"
+  ;
+static ::_pbi::once_flag descriptor_table_svg_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_svg_2eproto = {
+    false, false, 257, descriptor_table_protodef_svg_2eproto,
+    "svg.proto",
+    &descriptor_table_svg_2eproto_once, nullptr, 0, 3,
+    schemas, file_default_instances, TableStruct_svg_2eproto::offsets,
+    file_level_metadata_svg_2eproto, file_level_enum_descriptors_svg_2eproto,
+    file_level_service_descriptors_svg_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_svg_2eproto_getter() {
+  return &descriptor_table_svg_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_svg_2eproto(&descriptor_table_svg_2eproto);
+namespace proto_schema {
+namespace svg {
+
+// ===================================================================
+
+class Rgb::_Internal {
+ public:
+};
+
+Rgb::Rgb(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.svg.Rgb)
+}
+Rgb::Rgb(const Rgb& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Rgb* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.red_){}
+    , decltype(_impl_.green_){}
+    , decltype(_impl_.blue_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.red_, &from._impl_.red_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.blue_) -
+    reinterpret_cast<char*>(&_impl_.red_)) + sizeof(_impl_.blue_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.svg.Rgb)
+}
+
+inline void Rgb::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.red_){0}
+    , decltype(_impl_.green_){0}
+    , decltype(_impl_.blue_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Rgb::~Rgb() {
+  // @@protoc_insertion_point(destructor:proto_schema.svg.Rgb)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Rgb::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Rgb::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Rgb::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.svg.Rgb)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.red_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.blue_) -
+      reinterpret_cast<char*>(&_impl_.red_)) + sizeof(_impl_.blue_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Rgb::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // int32 red = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.red_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 green = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.green_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 blue = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.blue_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Rgb::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.svg.Rgb)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // int32 red = 1;
+  if (this->_internal_red() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(1, this->_internal_red(), target);
+  }
+
+  // int32 green = 2;
+  if (this->_internal_green() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_green(), target);
+  }
+
+  // int32 blue = 3;
+  if (this->_internal_blue() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(3, this->_internal_blue(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.svg.Rgb)
+  return target;
+}
+
+size_t Rgb::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.svg.Rgb)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // int32 red = 1;
+  if (this->_internal_red() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_red());
+  }
+
+  // int32 green = 2;
+  if (this->_internal_green() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_green());
+  }
+
+  // int32 blue = 3;
+  if (this->_internal_blue() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_blue());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Rgb::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Rgb::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Rgb::GetClassData() const { return &_class_data_; }
+
+
+void Rgb::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Rgb*>(&to_msg);
+  auto& from = static_cast<const Rgb&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.svg.Rgb)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_red() != 0) {
+    _this->_internal_set_red(from._internal_red());
+  }
+  if (from._internal_green() != 0) {
+    _this->_internal_set_green(from._internal_green());
+  }
+  if (from._internal_blue() != 0) {
+    _this->_internal_set_blue(from._internal_blue());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Rgb::CopyFrom(const Rgb& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.svg.Rgb)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Rgb::IsInitialized() const {
+  return true;
+}
+
+void Rgb::InternalSwap(Rgb* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Rgb, _impl_.blue_)
+      + sizeof(Rgb::_impl_.blue_)
+      - PROTOBUF_FIELD_OFFSET(Rgb, _impl_.red_)>(
+          reinterpret_cast<char*>(&_impl_.red_),
+          reinterpret_cast<char*>(&other->_impl_.red_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Rgb::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_svg_2eproto_getter, &descriptor_table_svg_2eproto_once,
+      file_level_metadata_svg_2eproto[0]);
+}
+
+// ===================================================================
+
+class Rgba::_Internal {
+ public:
+  static const ::proto_schema::svg::Rgb& rgb(const Rgba* msg);
+};
+
+const ::proto_schema::svg::Rgb&
+Rgba::_Internal::rgb(const Rgba* msg) {
+  return *msg->_impl_.rgb_;
+}
+Rgba::Rgba(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.svg.Rgba)
+}
+Rgba::Rgba(const Rgba& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Rgba* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rgb_){nullptr}
+    , decltype(_impl_.alpha_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_rgb()) {
+    _this->_impl_.rgb_ = new ::proto_schema::svg::Rgb(*from._impl_.rgb_);
+  }
+  _this->_impl_.alpha_ = from._impl_.alpha_;
+  // @@protoc_insertion_point(copy_constructor:proto_schema.svg.Rgba)
+}
+
+inline void Rgba::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.rgb_){nullptr}
+    , decltype(_impl_.alpha_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Rgba::~Rgba() {
+  // @@protoc_insertion_point(destructor:proto_schema.svg.Rgba)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Rgba::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.rgb_;
+}
+
+void Rgba::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Rgba::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.svg.Rgba)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.rgb_ != nullptr) {
+    delete _impl_.rgb_;
+  }
+  _impl_.rgb_ = nullptr;
+  _impl_.alpha_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Rgba::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.svg.Rgb rgb = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double alpha = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.alpha_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Rgba::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.svg.Rgba)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.svg.Rgb rgb = 1;
+  if (this->_internal_has_rgb()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::rgb(this),
+        _Internal::rgb(this).GetCachedSize(), target, stream);
+  }
+
+  // double alpha = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_alpha = this->_internal_alpha();
+  uint64_t raw_alpha;
+  memcpy(&raw_alpha, &tmp_alpha, sizeof(tmp_alpha));
+  if (raw_alpha != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_alpha(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.svg.Rgba)
+  return target;
+}
+
+size_t Rgba::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.svg.Rgba)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_schema.svg.Rgb rgb = 1;
+  if (this->_internal_has_rgb()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.rgb_);
+  }
+
+  // double alpha = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_alpha = this->_internal_alpha();
+  uint64_t raw_alpha;
+  memcpy(&raw_alpha, &tmp_alpha, sizeof(tmp_alpha));
+  if (raw_alpha != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Rgba::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Rgba::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Rgba::GetClassData() const { return &_class_data_; }
+
+
+void Rgba::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Rgba*>(&to_msg);
+  auto& from = static_cast<const Rgba&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.svg.Rgba)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_rgb()) {
+    _this->_internal_mutable_rgb()->::proto_schema::svg::Rgb::MergeFrom(
+        from._internal_rgb());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_alpha = from._internal_alpha();
+  uint64_t raw_alpha;
+  memcpy(&raw_alpha, &tmp_alpha, sizeof(tmp_alpha));
+  if (raw_alpha != 0) {
+    _this->_internal_set_alpha(from._internal_alpha());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Rgba::CopyFrom(const Rgba& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.svg.Rgba)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Rgba::IsInitialized() const {
+  return true;
+}
+
+void Rgba::InternalSwap(Rgba* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Rgba, _impl_.alpha_)
+      + sizeof(Rgba::_impl_.alpha_)
+      - PROTOBUF_FIELD_OFFSET(Rgba, _impl_.rgb_)>(
+          reinterpret_cast<char*>(&_impl_.rgb_),
+          reinterpret_cast<char*>(&other->_impl_.rgb_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Rgba::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_svg_2eproto_getter, &descriptor_table_svg_2eproto_once,
+      file_level_metadata_svg_2eproto[1]);
+}
+
+// ===================================================================
+
+class Color::_Internal {
+ public:
+  static const ::proto_schema::svg::Rgb& rgb(const Color* msg);
+  static const ::proto_schema::svg::Rgba& rgba(const Color* msg);
+};
+
+const ::proto_schema::svg::Rgb&
+Color::_Internal::rgb(const Color* msg) {
+  return *msg->_impl_.type_.rgb_;
+}
+const ::proto_schema::svg::Rgba&
+Color::_Internal::rgba(const Color* msg) {
+  return *msg->_impl_.type_.rgba_;
+}
+void Color::set_allocated_rgb(::proto_schema::svg::Rgb* rgb) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (rgb) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb);
+    if (message_arena != submessage_arena) {
+      rgb = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb, submessage_arena);
+    }
+    set_has_rgb();
+    _impl_.type_.rgb_ = rgb;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.svg.Color.rgb)
+}
+void Color::set_allocated_rgba(::proto_schema::svg::Rgba* rgba) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  clear_type();
+  if (rgba) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgba);
+    if (message_arena != submessage_arena) {
+      rgba = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgba, submessage_arena);
+    }
+    set_has_rgba();
+    _impl_.type_.rgba_ = rgba;
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.svg.Color.rgba)
+}
+Color::Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.svg.Color)
+}
+Color::Color(const Color& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Color* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  clear_has_type();
+  switch (from.type_case()) {
+    case kRgb: {
+      _this->_internal_mutable_rgb()->::proto_schema::svg::Rgb::MergeFrom(
+          from._internal_rgb());
+      break;
+    }
+    case kRgba: {
+      _this->_internal_mutable_rgba()->::proto_schema::svg::Rgba::MergeFrom(
+          from._internal_rgba());
+      break;
+    }
+    case kNamed: {
+      _this->_internal_set_named(from._internal_named());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_schema.svg.Color)
+}
+
+inline void Color::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.type_){}
+    , /*decltype(_impl_._cached_size_)*/{}
+    , /*decltype(_impl_._oneof_case_)*/{}
+  };
+  clear_has_type();
+}
+
+Color::~Color() {
+  // @@protoc_insertion_point(destructor:proto_schema.svg.Color)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Color::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (has_type()) {
+    clear_type();
+  }
+}
+
+void Color::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Color::clear_type() {
+// @@protoc_insertion_point(one_of_clear_start:proto_schema.svg.Color)
+  switch (type_case()) {
+    case kRgb: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.rgb_;
+      }
+      break;
+    }
+    case kRgba: {
+      if (GetArenaForAllocation() == nullptr) {
+        delete _impl_.type_.rgba_;
+      }
+      break;
+    }
+    case kNamed: {
+      _impl_.type_.named_.Destroy();
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _impl_._oneof_case_[0] = TYPE_NOT_SET;
+}
+
+
+void Color::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.svg.Color)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  clear_type();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Color::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.svg.Rgb rgb = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgb(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.svg.Rgba rgba = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_rgba(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // string named = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          auto str = _internal_mutable_named();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proto_schema.svg.Color.named"));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Color::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.svg.Color)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.svg.Rgb rgb = 1;
+  if (_internal_has_rgb()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::rgb(this),
+        _Internal::rgb(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.svg.Rgba rgba = 2;
+  if (_internal_has_rgba()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::rgba(this),
+        _Internal::rgba(this).GetCachedSize(), target, stream);
+  }
+
+  // string named = 3;
+  if (_internal_has_named()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_named().data(), static_cast<int>(this->_internal_named().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_schema.svg.Color.named");
+    target = stream->WriteStringMaybeAliased(
+        3, this->_internal_named(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.svg.Color)
+  return target;
+}
+
+size_t Color::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.svg.Color)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  switch (type_case()) {
+    // .proto_schema.svg.Rgb rgb = 1;
+    case kRgb: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.rgb_);
+      break;
+    }
+    // .proto_schema.svg.Rgba rgba = 2;
+    case kRgba: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+          *_impl_.type_.rgba_);
+      break;
+    }
+    // string named = 3;
+    case kNamed: {
+      total_size += 1 +
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+          this->_internal_named());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Color::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Color::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Color::GetClassData() const { return &_class_data_; }
+
+
+void Color::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Color*>(&to_msg);
+  auto& from = static_cast<const Color&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.svg.Color)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  switch (from.type_case()) {
+    case kRgb: {
+      _this->_internal_mutable_rgb()->::proto_schema::svg::Rgb::MergeFrom(
+          from._internal_rgb());
+      break;
+    }
+    case kRgba: {
+      _this->_internal_mutable_rgba()->::proto_schema::svg::Rgba::MergeFrom(
+          from._internal_rgba());
+      break;
+    }
+    case kNamed: {
+      _this->_internal_set_named(from._internal_named());
+      break;
+    }
+    case TYPE_NOT_SET: {
+      break;
+    }
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Color::CopyFrom(const Color& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.svg.Color)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Color::IsInitialized() const {
+  return true;
+}
+
+void Color::InternalSwap(Color* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  swap(_impl_.type_, other->_impl_.type_);
+  swap(_impl_._oneof_case_[0], other->_impl_._oneof_case_[0]);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Color::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_svg_2eproto_getter, &descriptor_table_svg_2eproto_once,
+      file_level_metadata_svg_2eproto[2]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace svg
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_schema::svg::Rgb*
+Arena::CreateMaybeMessage< ::proto_schema::svg::Rgb >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::svg::Rgb >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::svg::Rgba*
+Arena::CreateMaybeMessage< ::proto_schema::svg::Rgba >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::svg::Rgba >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::svg::Color*
+Arena::CreateMaybeMessage< ::proto_schema::svg::Color >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::svg::Color >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,1063 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: svg.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_svg_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_svg_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_svg_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_svg_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_svg_2eproto;
+namespace proto_schema {
+namespace svg {
+class Color;
+struct ColorDefaultTypeInternal;
+extern ColorDefaultTypeInternal _Color_default_instance_;
+class Rgb;
+struct RgbDefaultTypeInternal;
+extern RgbDefaultTypeInternal _Rgb_default_instance_;
+class Rgba;
+struct RgbaDefaultTypeInternal;
+extern RgbaDefaultTypeInternal _Rgba_default_instance_;
+}  // namespace svg
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_schema::svg::Color* Arena::CreateMaybeMessage<::proto_schema::svg::Color>(Arena*);
+template<> ::proto_schema::svg::Rgb* Arena::CreateMaybeMessage<::proto_schema::svg::Rgb>(Arena*);
+template<> ::proto_schema::svg::Rgba* Arena::CreateMaybeMessage<::proto_schema::svg::Rgba>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_schema {
+namespace svg {
+
+// ===================================================================
+
+class Rgb final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.svg.Rgb) */ {
+ public:
+  inline Rgb() : Rgb(nullptr) {}
+  ~Rgb() override;
+  explicit PROTOBUF_CONSTEXPR Rgb(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Rgb(const Rgb& from);
+  Rgb(Rgb&& from) noexcept
+    : Rgb() {
+    *this = ::std::move(from);
+  }
+
+  inline Rgb& operator=(const Rgb& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Rgb& operator=(Rgb&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Rgb& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Rgb* internal_default_instance() {
+    return reinterpret_cast<const Rgb*>(
+               &_Rgb_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Rgb& a, Rgb& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Rgb* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Rgb* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Rgb* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Rgb>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Rgb& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Rgb& from) {
+    Rgb::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Rgb* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.svg.Rgb";
+  }
+  protected:
+  explicit Rgb(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRedFieldNumber = 1,
+    kGreenFieldNumber = 2,
+    kBlueFieldNumber = 3,
+  };
+  // int32 red = 1;
+  void clear_red();
+  int32_t red() const;
+  void set_red(int32_t value);
+  private:
+  int32_t _internal_red() const;
+  void _internal_set_red(int32_t value);
+  public:
+
+  // int32 green = 2;
+  void clear_green();
+  int32_t green() const;
+  void set_green(int32_t value);
+  private:
+  int32_t _internal_green() const;
+  void _internal_set_green(int32_t value);
+  public:
+
+  // int32 blue = 3;
+  void clear_blue();
+  int32_t blue() const;
+  void set_blue(int32_t value);
+  private:
+  int32_t _internal_blue() const;
+  void _internal_set_blue(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.svg.Rgb)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    int32_t red_;
+    int32_t green_;
+    int32_t blue_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_svg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Rgba final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.svg.Rgba) */ {
+ public:
+  inline Rgba() : Rgba(nullptr) {}
+  ~Rgba() override;
+  explicit PROTOBUF_CONSTEXPR Rgba(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Rgba(const Rgba& from);
+  Rgba(Rgba&& from) noexcept
+    : Rgba() {
+    *this = ::std::move(from);
+  }
+
+  inline Rgba& operator=(const Rgba& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Rgba& operator=(Rgba&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Rgba& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Rgba* internal_default_instance() {
+    return reinterpret_cast<const Rgba*>(
+               &_Rgba_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Rgba& a, Rgba& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Rgba* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Rgba* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Rgba* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Rgba>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Rgba& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Rgba& from) {
+    Rgba::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Rgba* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.svg.Rgba";
+  }
+  protected:
+  explicit Rgba(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRgbFieldNumber = 1,
+    kAlphaFieldNumber = 2,
+  };
+  // .proto_schema.svg.Rgb rgb = 1;
+  bool has_rgb() const;
+  private:
+  bool _internal_has_rgb() const;
+  public:
+  void clear_rgb();
+  const ::proto_schema::svg::Rgb& rgb() const;
+  PROTOBUF_NODISCARD ::proto_schema::svg::Rgb* release_rgb();
+  ::proto_schema::svg::Rgb* mutable_rgb();
+  void set_allocated_rgb(::proto_schema::svg::Rgb* rgb);
+  private:
+  const ::proto_schema::svg::Rgb& _internal_rgb() const;
+  ::proto_schema::svg::Rgb* _internal_mutable_rgb();
+  public:
+  void unsafe_arena_set_allocated_rgb(
+      ::proto_schema::svg::Rgb* rgb);
+  ::proto_schema::svg::Rgb* unsafe_arena_release_rgb();
+
+  // double alpha = 2;
+  void clear_alpha();
+  double alpha() const;
+  void set_alpha(double value);
+  private:
+  double _internal_alpha() const;
+  void _internal_set_alpha(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.svg.Rgba)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto_schema::svg::Rgb* rgb_;
+    double alpha_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_svg_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Color final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.svg.Color) */ {
+ public:
+  inline Color() : Color(nullptr) {}
+  ~Color() override;
+  explicit PROTOBUF_CONSTEXPR Color(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Color(const Color& from);
+  Color(Color&& from) noexcept
+    : Color() {
+    *this = ::std::move(from);
+  }
+
+  inline Color& operator=(const Color& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Color& operator=(Color&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Color& default_instance() {
+    return *internal_default_instance();
+  }
+  enum TypeCase {
+    kRgb = 1,
+    kRgba = 2,
+    kNamed = 3,
+    TYPE_NOT_SET = 0,
+  };
+
+  static inline const Color* internal_default_instance() {
+    return reinterpret_cast<const Color*>(
+               &_Color_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Color& a, Color& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Color* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Color* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Color* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Color>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Color& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Color& from) {
+    Color::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Color* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.svg.Color";
+  }
+  protected:
+  explicit Color(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRgbFieldNumber = 1,
+    kRgbaFieldNumber = 2,
+    kNamedFieldNumber = 3,
+  };
+  // .proto_schema.svg.Rgb rgb = 1;
+  bool has_rgb() const;
+  private:
+  bool _internal_has_rgb() const;
+  public:
+  void clear_rgb();
+  const ::proto_schema::svg::Rgb& rgb() const;
+  PROTOBUF_NODISCARD ::proto_schema::svg::Rgb* release_rgb();
+  ::proto_schema::svg::Rgb* mutable_rgb();
+  void set_allocated_rgb(::proto_schema::svg::Rgb* rgb);
+  private:
+  const ::proto_schema::svg::Rgb& _internal_rgb() const;
+  ::proto_schema::svg::Rgb* _internal_mutable_rgb();
+  public:
+  void unsafe_arena_set_allocated_rgb(
+      ::proto_schema::svg::Rgb* rgb);
+  ::proto_schema::svg::Rgb* unsafe_arena_release_rgb();
+
+  // .proto_schema.svg.Rgba rgba = 2;
+  bool has_rgba() const;
+  private:
+  bool _internal_has_rgba() const;
+  public:
+  void clear_rgba();
+  const ::proto_schema::svg::Rgba& rgba() const;
+  PROTOBUF_NODISCARD ::proto_schema::svg::Rgba* release_rgba();
+  ::proto_schema::svg::Rgba* mutable_rgba();
+  void set_allocated_rgba(::proto_schema::svg::Rgba* rgba);
+  private:
+  const ::proto_schema::svg::Rgba& _internal_rgba() const;
+  ::proto_schema::svg::Rgba* _internal_mutable_rgba();
+  public:
+  void unsafe_arena_set_allocated_rgba(
+      ::proto_schema::svg::Rgba* rgba);
+  ::proto_schema::svg::Rgba* unsafe_arena_release_rgba();
+
+  // string named = 3;
+  bool has_named() const;
+  private:
+  bool _internal_has_named() const;
+  public:
+  void clear_named();
+  const std::string& named() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_named(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_named();
+  PROTOBUF_NODISCARD std::string* release_named();
+  void set_allocated_named(std::string* named);
+  private:
+  const std::string& _internal_named() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_named(const std::string& value);
+  std::string* _internal_mutable_named();
+  public:
+
+  void clear_type();
+  TypeCase type_case() const;
+  // @@protoc_insertion_point(class_scope:proto_schema.svg.Color)
+ private:
+  class _Internal;
+  void set_has_rgb();
+  void set_has_rgba();
+  void set_has_named();
+
+  inline bool has_type() const;
+  inline void clear_has_type();
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    union TypeUnion {
+      constexpr TypeUnion() : _constinit_{} {}
+        ::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized _constinit_;
+      ::proto_schema::svg::Rgb* rgb_;
+      ::proto_schema::svg::Rgba* rgba_;
+      ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr named_;
+    } type_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+    uint32_t _oneof_case_[1];
+
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_svg_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Rgb
+
+// int32 red = 1;
+inline void Rgb::clear_red() {
+  _impl_.red_ = 0;
+}
+inline int32_t Rgb::_internal_red() const {
+  return _impl_.red_;
+}
+inline int32_t Rgb::red() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Rgb.red)
+  return _internal_red();
+}
+inline void Rgb::_internal_set_red(int32_t value) {
+  
+  _impl_.red_ = value;
+}
+inline void Rgb::set_red(int32_t value) {
+  _internal_set_red(value);
+  // @@protoc_insertion_point(field_set:proto_schema.svg.Rgb.red)
+}
+
+// int32 green = 2;
+inline void Rgb::clear_green() {
+  _impl_.green_ = 0;
+}
+inline int32_t Rgb::_internal_green() const {
+  return _impl_.green_;
+}
+inline int32_t Rgb::green() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Rgb.green)
+  return _internal_green();
+}
+inline void Rgb::_internal_set_green(int32_t value) {
+  
+  _impl_.green_ = value;
+}
+inline void Rgb::set_green(int32_t value) {
+  _internal_set_green(value);
+  // @@protoc_insertion_point(field_set:proto_schema.svg.Rgb.green)
+}
+
+// int32 blue = 3;
+inline void Rgb::clear_blue() {
+  _impl_.blue_ = 0;
+}
+inline int32_t Rgb::_internal_blue() const {
+  return _impl_.blue_;
+}
+inline int32_t Rgb::blue() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Rgb.blue)
+  return _internal_blue();
+}
+inline void Rgb::_internal_set_blue(int32_t value) {
+  
+  _impl_.blue_ = value;
+}
+inline void Rgb::set_blue(int32_t value) {
+  _internal_set_blue(value);
+  // @@protoc_insertion_point(field_set:proto_schema.svg.Rgb.blue)
+}
+
+// -------------------------------------------------------------------
+
+// Rgba
+
+// .proto_schema.svg.Rgb rgb = 1;
+inline bool Rgba::_internal_has_rgb() const {
+  return this != internal_default_instance() && _impl_.rgb_ != nullptr;
+}
+inline bool Rgba::has_rgb() const {
+  return _internal_has_rgb();
+}
+inline void Rgba::clear_rgb() {
+  if (GetArenaForAllocation() == nullptr && _impl_.rgb_ != nullptr) {
+    delete _impl_.rgb_;
+  }
+  _impl_.rgb_ = nullptr;
+}
+inline const ::proto_schema::svg::Rgb& Rgba::_internal_rgb() const {
+  const ::proto_schema::svg::Rgb* p = _impl_.rgb_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::svg::Rgb&>(
+      ::proto_schema::svg::_Rgb_default_instance_);
+}
+inline const ::proto_schema::svg::Rgb& Rgba::rgb() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Rgba.rgb)
+  return _internal_rgb();
+}
+inline void Rgba::unsafe_arena_set_allocated_rgb(
+    ::proto_schema::svg::Rgb* rgb) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.rgb_);
+  }
+  _impl_.rgb_ = rgb;
+  if (rgb) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.svg.Rgba.rgb)
+}
+inline ::proto_schema::svg::Rgb* Rgba::release_rgb() {
+  
+  ::proto_schema::svg::Rgb* temp = _impl_.rgb_;
+  _impl_.rgb_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::svg::Rgb* Rgba::unsafe_arena_release_rgb() {
+  // @@protoc_insertion_point(field_release:proto_schema.svg.Rgba.rgb)
+  
+  ::proto_schema::svg::Rgb* temp = _impl_.rgb_;
+  _impl_.rgb_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::svg::Rgb* Rgba::_internal_mutable_rgb() {
+  
+  if (_impl_.rgb_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::svg::Rgb>(GetArenaForAllocation());
+    _impl_.rgb_ = p;
+  }
+  return _impl_.rgb_;
+}
+inline ::proto_schema::svg::Rgb* Rgba::mutable_rgb() {
+  ::proto_schema::svg::Rgb* _msg = _internal_mutable_rgb();
+  // @@protoc_insertion_point(field_mutable:proto_schema.svg.Rgba.rgb)
+  return _msg;
+}
+inline void Rgba::set_allocated_rgb(::proto_schema::svg::Rgb* rgb) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.rgb_;
+  }
+  if (rgb) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(rgb);
+    if (message_arena != submessage_arena) {
+      rgb = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, rgb, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.rgb_ = rgb;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.svg.Rgba.rgb)
+}
+
+// double alpha = 2;
+inline void Rgba::clear_alpha() {
+  _impl_.alpha_ = 0;
+}
+inline double Rgba::_internal_alpha() const {
+  return _impl_.alpha_;
+}
+inline double Rgba::alpha() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Rgba.alpha)
+  return _internal_alpha();
+}
+inline void Rgba::_internal_set_alpha(double value) {
+  
+  _impl_.alpha_ = value;
+}
+inline void Rgba::set_alpha(double value) {
+  _internal_set_alpha(value);
+  // @@protoc_insertion_point(field_set:proto_schema.svg.Rgba.alpha)
+}
+
+// -------------------------------------------------------------------
+
+// Color
+
+// .proto_schema.svg.Rgb rgb = 1;
+inline bool Color::_internal_has_rgb() const {
+  return type_case() == kRgb;
+}
+inline bool Color::has_rgb() const {
+  return _internal_has_rgb();
+}
+inline void Color::set_has_rgb() {
+  _impl_._oneof_case_[0] = kRgb;
+}
+inline void Color::clear_rgb() {
+  if (_internal_has_rgb()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.rgb_;
+    }
+    clear_has_type();
+  }
+}
+inline ::proto_schema::svg::Rgb* Color::release_rgb() {
+  // @@protoc_insertion_point(field_release:proto_schema.svg.Color.rgb)
+  if (_internal_has_rgb()) {
+    clear_has_type();
+    ::proto_schema::svg::Rgb* temp = _impl_.type_.rgb_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.rgb_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto_schema::svg::Rgb& Color::_internal_rgb() const {
+  return _internal_has_rgb()
+      ? *_impl_.type_.rgb_
+      : reinterpret_cast< ::proto_schema::svg::Rgb&>(::proto_schema::svg::_Rgb_default_instance_);
+}
+inline const ::proto_schema::svg::Rgb& Color::rgb() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Color.rgb)
+  return _internal_rgb();
+}
+inline ::proto_schema::svg::Rgb* Color::unsafe_arena_release_rgb() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto_schema.svg.Color.rgb)
+  if (_internal_has_rgb()) {
+    clear_has_type();
+    ::proto_schema::svg::Rgb* temp = _impl_.type_.rgb_;
+    _impl_.type_.rgb_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Color::unsafe_arena_set_allocated_rgb(::proto_schema::svg::Rgb* rgb) {
+  clear_type();
+  if (rgb) {
+    set_has_rgb();
+    _impl_.type_.rgb_ = rgb;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.svg.Color.rgb)
+}
+inline ::proto_schema::svg::Rgb* Color::_internal_mutable_rgb() {
+  if (!_internal_has_rgb()) {
+    clear_type();
+    set_has_rgb();
+    _impl_.type_.rgb_ = CreateMaybeMessage< ::proto_schema::svg::Rgb >(GetArenaForAllocation());
+  }
+  return _impl_.type_.rgb_;
+}
+inline ::proto_schema::svg::Rgb* Color::mutable_rgb() {
+  ::proto_schema::svg::Rgb* _msg = _internal_mutable_rgb();
+  // @@protoc_insertion_point(field_mutable:proto_schema.svg.Color.rgb)
+  return _msg;
+}
+
+// .proto_schema.svg.Rgba rgba = 2;
+inline bool Color::_internal_has_rgba() const {
+  return type_case() == kRgba;
+}
+inline bool Color::has_rgba() const {
+  return _internal_has_rgba();
+}
+inline void Color::set_has_rgba() {
+  _impl_._oneof_case_[0] = kRgba;
+}
+inline void Color::clear_rgba() {
+  if (_internal_has_rgba()) {
+    if (GetArenaForAllocation() == nullptr) {
+      delete _impl_.type_.rgba_;
+    }
+    clear_has_type();
+  }
+}
+inline ::proto_schema::svg::Rgba* Color::release_rgba() {
+  // @@protoc_insertion_point(field_release:proto_schema.svg.Color.rgba)
+  if (_internal_has_rgba()) {
+    clear_has_type();
+    ::proto_schema::svg::Rgba* temp = _impl_.type_.rgba_;
+    if (GetArenaForAllocation() != nullptr) {
+      temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+    }
+    _impl_.type_.rgba_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline const ::proto_schema::svg::Rgba& Color::_internal_rgba() const {
+  return _internal_has_rgba()
+      ? *_impl_.type_.rgba_
+      : reinterpret_cast< ::proto_schema::svg::Rgba&>(::proto_schema::svg::_Rgba_default_instance_);
+}
+inline const ::proto_schema::svg::Rgba& Color::rgba() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Color.rgba)
+  return _internal_rgba();
+}
+inline ::proto_schema::svg::Rgba* Color::unsafe_arena_release_rgba() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:proto_schema.svg.Color.rgba)
+  if (_internal_has_rgba()) {
+    clear_has_type();
+    ::proto_schema::svg::Rgba* temp = _impl_.type_.rgba_;
+    _impl_.type_.rgba_ = nullptr;
+    return temp;
+  } else {
+    return nullptr;
+  }
+}
+inline void Color::unsafe_arena_set_allocated_rgba(::proto_schema::svg::Rgba* rgba) {
+  clear_type();
+  if (rgba) {
+    set_has_rgba();
+    _impl_.type_.rgba_ = rgba;
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.svg.Color.rgba)
+}
+inline ::proto_schema::svg::Rgba* Color::_internal_mutable_rgba() {
+  if (!_internal_has_rgba()) {
+    clear_type();
+    set_has_rgba();
+    _impl_.type_.rgba_ = CreateMaybeMessage< ::proto_schema::svg::Rgba >(GetArenaForAllocation());
+  }
+  return _impl_.type_.rgba_;
+}
+inline ::proto_schema::svg::Rgba* Color::mutable_rgba() {
+  ::proto_schema::svg::Rgba* _msg = _internal_mutable_rgba();
+  // @@protoc_insertion_point(field_mutable:proto_schema.svg.Color.rgba)
+  return _msg;
+}
+
+// string named = 3;
+inline bool Color::_internal_has_named() const {
+  return type_case() == kNamed;
+}
+inline bool Color::has_named() const {
+  return _internal_has_named();
+}
+inline void Color::set_has_named() {
+  _impl_._oneof_case_[0] = kNamed;
+}
+inline void Color::clear_named() {
+  if (_internal_has_named()) {
+    _impl_.type_.named_.Destroy();
+    clear_has_type();
+  }
+}
+inline const std::string& Color::named() const {
+  // @@protoc_insertion_point(field_get:proto_schema.svg.Color.named)
+  return _internal_named();
+}
+template <typename ArgT0, typename... ArgT>
+inline void Color::set_named(ArgT0&& arg0, ArgT... args) {
+  if (!_internal_has_named()) {
+    clear_type();
+    set_has_named();
+    _impl_.type_.named_.InitDefault();
+  }
+  _impl_.type_.named_.Set( static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto_schema.svg.Color.named)
+}
+inline std::string* Color::mutable_named() {
+  std::string* _s = _internal_mutable_named();
+  // @@protoc_insertion_point(field_mutable:proto_schema.svg.Color.named)
+  return _s;
+}
+inline const std::string& Color::_internal_named() const {
+  if (_internal_has_named()) {
+    return _impl_.type_.named_.Get();
+  }
+  return ::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited();
+}
+inline void Color::_internal_set_named(const std::string& value) {
+  if (!_internal_has_named()) {
+    clear_type();
+    set_has_named();
+    _impl_.type_.named_.InitDefault();
+  }
+  _impl_.type_.named_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Color::_internal_mutable_named() {
+  if (!_internal_has_named()) {
+    clear_type();
+    set_has_named();
+    _impl_.type_.named_.InitDefault();
+  }
+  return _impl_.type_.named_.Mutable(      GetArenaForAllocation());
+}
+inline std::string* Color::release_named() {
+  // @@protoc_insertion_point(field_release:proto_schema.svg.Color.named)
+  if (_internal_has_named()) {
+    clear_has_type();
+    return _impl_.type_.named_.Release();
+  } else {
+    return nullptr;
+  }
+}
+inline void Color::set_allocated_named(std::string* named) {
+  if (has_type()) {
+    clear_type();
+  }
+  if (named != nullptr) {
+    set_has_named();
+    _impl_.type_.named_.InitAllocated(named, GetArenaForAllocation());
+  }
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.svg.Color.named)
+}
+
+inline bool Color::has_type() const {
+  return type_case() != TYPE_NOT_SET;
+}
+inline void Color::clear_has_type() {
+  _impl_._oneof_case_[0] = TYPE_NOT_SET;
+}
+inline Color::TypeCase Color::type_case() const {
+  return Color::TypeCase(_impl_._oneof_case_[0]);
+}
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace svg
+}  // namespace proto_schema
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_svg_2eproto
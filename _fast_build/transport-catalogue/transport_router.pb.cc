@@ -0,0 +1,2207 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transport_router.proto
+
+#include "transport_router.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace proto_schema {
+namespace router {
+PROTOBUF_CONSTEXPR RoutingSettings::RoutingSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_velocity_kmh_)*/0
+  , /*decltype(_impl_.bus_wait_time_min_)*/0u
+  , /*decltype(_impl_.router_type_)*/0
+  , /*decltype(_impl_.route_cache_capacity_)*/uint64_t{0u}
+  , /*decltype(_impl_.collapse_parallel_edges_)*/false
+  , /*decltype(_impl_.vertex_order_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoutingSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoutingSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoutingSettingsDefaultTypeInternal() {}
+  union {
+    RoutingSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutingSettingsDefaultTypeInternal _RoutingSettings_default_instance_;
+PROTOBUF_CONSTEXPR RoutingItems::RoutingItems(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_ids_)*/{}
+  , /*decltype(_impl_._bus_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.stop_ids_)*/{}
+  , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.span_counts_)*/{}
+  , /*decltype(_impl_._span_counts_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.travel_times_)*/{}
+  , /*decltype(_impl_.distances_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RoutingItemsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RoutingItemsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RoutingItemsDefaultTypeInternal() {}
+  union {
+    RoutingItems _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RoutingItemsDefaultTypeInternal _RoutingItems_default_instance_;
+PROTOBUF_CONSTEXPR RouterState::RouterState(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.prev_edges_)*/{}
+  , /*decltype(_impl_._prev_edges_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.weights_)*/{}
+  , /*decltype(_impl_.vertex_count_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RouterStateDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouterStateDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouterStateDefaultTypeInternal() {}
+  union {
+    RouterState _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouterStateDefaultTypeInternal _RouterState_default_instance_;
+PROTOBUF_CONSTEXPR LandmarkTables::LandmarkTables(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.landmarks_)*/{}
+  , /*decltype(_impl_._landmarks_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.from_landmarks_)*/{}
+  , /*decltype(_impl_.to_landmarks_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LandmarkTablesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LandmarkTablesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LandmarkTablesDefaultTypeInternal() {}
+  union {
+    LandmarkTables _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LandmarkTablesDefaultTypeInternal _LandmarkTables_default_instance_;
+PROTOBUF_CONSTEXPR ReachabilityIndex::ReachabilityIndex(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.components_)*/{}
+  , /*decltype(_impl_._components_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.weak_components_)*/{}
+  , /*decltype(_impl_._weak_components_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ReachabilityIndexDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ReachabilityIndexDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ReachabilityIndexDefaultTypeInternal() {}
+  union {
+    ReachabilityIndex _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ReachabilityIndexDefaultTypeInternal _ReachabilityIndex_default_instance_;
+PROTOBUF_CONSTEXPR Router::Router(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.vertex_ids_)*/{}
+  , /*decltype(_impl_._vertex_ids_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.graph_)*/nullptr
+  , /*decltype(_impl_.state_)*/nullptr
+  , /*decltype(_impl_.hierarchy_)*/nullptr
+  , /*decltype(_impl_.landmarks_)*/nullptr
+  , /*decltype(_impl_.routing_items_)*/nullptr
+  , /*decltype(_impl_.reachability_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RouterDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RouterDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RouterDefaultTypeInternal() {}
+  union {
+    Router _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RouterDefaultTypeInternal _Router_default_instance_;
+}  // namespace router
+}  // namespace proto_schema
+static ::_pb::Metadata file_level_metadata_transport_5frouter_2eproto[6];
+static const ::_pb::EnumDescriptor* file_level_enum_descriptors_transport_5frouter_2eproto[2];
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5frouter_2eproto = nullptr;
+
+const uint32_t TableStruct_transport_5frouter_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _impl_.bus_wait_time_min_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _impl_.bus_velocity_kmh_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _impl_.router_type_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _impl_.collapse_parallel_edges_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _impl_.route_cache_capacity_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingSettings, _impl_.vertex_order_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingItems, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingItems, _impl_.bus_ids_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingItems, _impl_.stop_ids_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingItems, _impl_.span_counts_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingItems, _impl_.travel_times_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RoutingItems, _impl_.distances_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RouterState, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RouterState, _impl_.vertex_count_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RouterState, _impl_.prev_edges_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::RouterState, _impl_.weights_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::LandmarkTables, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::LandmarkTables, _impl_.landmarks_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::LandmarkTables, _impl_.from_landmarks_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::LandmarkTables, _impl_.to_landmarks_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::ReachabilityIndex, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::ReachabilityIndex, _impl_.components_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::ReachabilityIndex, _impl_.weak_components_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.graph_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.state_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.hierarchy_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.landmarks_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.routing_items_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.vertex_ids_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::router::Router, _impl_.reachability_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::proto_schema::router::RoutingSettings)},
+  { 12, -1, -1, sizeof(::proto_schema::router::RoutingItems)},
+  { 23, -1, -1, sizeof(::proto_schema::router::RouterState)},
+  { 32, -1, -1, sizeof(::proto_schema::router::LandmarkTables)},
+  { 41, -1, -1, sizeof(::proto_schema::router::ReachabilityIndex)},
+  { 49, -1, -1, sizeof(::proto_schema::router::Router)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto_schema::router::_RoutingSettings_default_instance_._instance,
+  &::proto_schema::router::_RoutingItems_default_instance_._instance,
+  &::proto_schema::router::_RouterState_default_instance_._instance,
+  &::proto_schema::router::_LandmarkTables_default_instance_._instance,
+  &::proto_schema::router::_ReachabilityIndex_default_instance_._instance,
+  &::proto_schema::router::_Router_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_transport_5frouter_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\026transport_router.proto\022\023proto_schema.r"
+  "outer\032\013graph.proto\"\363\001\n\017RoutingSettings\022\031"
+  "\n\021bus_wait_time_min\030\001 \001(\r\022\030\n\020bus_velocit"
+  "y_kmh\030\002 \001(\001\0224\n\013router_type\030\003 \001(\0162\037.proto"
+  "_schema.router.RouterType\022\037\n\027collapse_pa"
+  "rallel_edges\030\004 \001(\010\022\034\n\024route_cache_capaci"
+  "ty\030\005 \001(\004\0226\n\014vertex_order\030\006 \001(\0162 .proto_s"
+  "chema.router.VertexOrder\"o\n\014RoutingItems"
+  "\022\017\n\007bus_ids\030\001 \003(\r\022\020\n\010stop_ids\030\002 \003(\r\022\023\n\013s"
+  "pan_counts\030\003 \003(\r\022\024\n\014travel_times\030\004 \003(\001\022\021"
+  "\n\tdistances\030\005 \003(\001\"N\n\013RouterState\022\024\n\014vert"
+  "ex_count\030\001 \001(\r\022\022\n\nprev_edges\030\003 \003(\r\022\017\n\007we"
+  "ights\030\004 \003(\002J\004\010\002\020\003\"Q\n\016LandmarkTables\022\021\n\tl"
+  "andmarks\030\001 \003(\r\022\026\n\016from_landmarks\030\002 \003(\001\022\024"
+  "\n\014to_landmarks\030\003 \003(\001\"@\n\021ReachabilityInde"
+  "x\022\022\n\ncomponents\030\001 \003(\r\022\027\n\017weak_components"
+  "\030\002 \003(\r\"\361\002\n\006Router\022/\n\005graph\030\001 \001(\0132 .proto"
+  "_schema.graph.RoutingGraph\022/\n\005state\030\003 \001("
+  "\0132 .proto_schema.router.RouterState\022;\n\th"
+  "ierarchy\030\004 \001(\0132(.proto_schema.graph.Cont"
+  "ractionHierarchy\0226\n\tlandmarks\030\005 \001(\0132#.pr"
+  "oto_schema.router.LandmarkTables\0228\n\rrout"
+  "ing_items\030\006 \001(\0132!.proto_schema.router.Ro"
+  "utingItems\022\022\n\nvertex_ids\030\007 \003(\r\022<\n\014reacha"
+  "bility\030\010 \001(\0132&.proto_schema.router.Reach"
+  "abilityIndexJ\004\010\002\020\003*e\n\nRouterType\022\r\n\tALL_"
+  "PAIRS\020\000\022\014\n\010DIJKSTRA\020\001\022\031\n\025CONTRACTION_HIE"
+  "RARCHY\020\002\022\n\n\006A_STAR\020\003\022\007\n\003ALT\020\004\022\n\n\006RAPTOR\020"
+  "\005*1\n\013VertexOrder\022\017\n\013STOPS_TABLE\020\000\022\021\n\rHIL"
+  "BERT_CURVE\020\001b\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_transport_5frouter_2eproto_deps[1] = {
+  &::descriptor_table_graph_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_transport_5frouter_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transport_5frouter_2eproto = {
+    false, false, 1180, descriptor_table_protodef_transport_5frouter_2eproto,
+    "transport_router.proto",
+    &descriptor_table_transport_5frouter_2eproto_once, descriptor_table_transport_5frouter_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_transport_5frouter_2eproto::offsets,
+    file_level_metadata_transport_5frouter_2eproto, file_level_enum_descriptors_transport_5frouter_2eproto,
+    file_level_service_descriptors_transport_5frouter_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transport_5frouter_2eproto_getter() {
+  return &descriptor_table_transport_5frouter_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5frouter_2eproto(&descriptor_table_transport_5frouter_2eproto);
+namespace proto_schema {
+namespace router {
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterType_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transport_5frouter_2eproto);
+  return file_level_enum_descriptors_transport_5frouter_2eproto[0];
+}
+bool RouterType_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+    case 2:
+    case 3:
+    case 4:
+    case 5:
+      return true;
+    default:
+      return false;
+  }
+}
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VertexOrder_descriptor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&descriptor_table_transport_5frouter_2eproto);
+  return file_level_enum_descriptors_transport_5frouter_2eproto[1];
+}
+bool VertexOrder_IsValid(int value) {
+  switch (value) {
+    case 0:
+    case 1:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// ===================================================================
+
+class RoutingSettings::_Internal {
+ public:
+};
+
+RoutingSettings::RoutingSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.router.RoutingSettings)
+}
+RoutingSettings::RoutingSettings(const RoutingSettings& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutingSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_velocity_kmh_){}
+    , decltype(_impl_.bus_wait_time_min_){}
+    , decltype(_impl_.router_type_){}
+    , decltype(_impl_.route_cache_capacity_){}
+    , decltype(_impl_.collapse_parallel_edges_){}
+    , decltype(_impl_.vertex_order_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.bus_velocity_kmh_, &from._impl_.bus_velocity_kmh_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.vertex_order_) -
+    reinterpret_cast<char*>(&_impl_.bus_velocity_kmh_)) + sizeof(_impl_.vertex_order_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.router.RoutingSettings)
+}
+
+inline void RoutingSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_velocity_kmh_){0}
+    , decltype(_impl_.bus_wait_time_min_){0u}
+    , decltype(_impl_.router_type_){0}
+    , decltype(_impl_.route_cache_capacity_){uint64_t{0u}}
+    , decltype(_impl_.collapse_parallel_edges_){false}
+    , decltype(_impl_.vertex_order_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoutingSettings::~RoutingSettings() {
+  // @@protoc_insertion_point(destructor:proto_schema.router.RoutingSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoutingSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void RoutingSettings::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoutingSettings::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.router.RoutingSettings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.bus_velocity_kmh_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.vertex_order_) -
+      reinterpret_cast<char*>(&_impl_.bus_velocity_kmh_)) + sizeof(_impl_.vertex_order_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoutingSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 bus_wait_time_min = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.bus_wait_time_min_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double bus_velocity_kmh = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.bus_velocity_kmh_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.RouterType router_type = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_router_type(static_cast<::proto_schema::router::RouterType>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool collapse_parallel_edges = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.collapse_parallel_edges_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint64 route_cache_capacity = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.route_cache_capacity_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.VertexOrder vertex_order = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 48)) {
+          uint64_t val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_vertex_order(static_cast<::proto_schema::router::VertexOrder>(val));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoutingSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.router.RoutingSettings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 bus_wait_time_min = 1;
+  if (this->_internal_bus_wait_time_min() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_bus_wait_time_min(), target);
+  }
+
+  // double bus_velocity_kmh = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bus_velocity_kmh = this->_internal_bus_velocity_kmh();
+  uint64_t raw_bus_velocity_kmh;
+  memcpy(&raw_bus_velocity_kmh, &tmp_bus_velocity_kmh, sizeof(tmp_bus_velocity_kmh));
+  if (raw_bus_velocity_kmh != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_bus_velocity_kmh(), target);
+  }
+
+  // .proto_schema.router.RouterType router_type = 3;
+  if (this->_internal_router_type() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_router_type(), target);
+  }
+
+  // bool collapse_parallel_edges = 4;
+  if (this->_internal_collapse_parallel_edges() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(4, this->_internal_collapse_parallel_edges(), target);
+  }
+
+  // uint64 route_cache_capacity = 5;
+  if (this->_internal_route_cache_capacity() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt64ToArray(5, this->_internal_route_cache_capacity(), target);
+  }
+
+  // .proto_schema.router.VertexOrder vertex_order = 6;
+  if (this->_internal_vertex_order() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteEnumToArray(
+      6, this->_internal_vertex_order(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.router.RoutingSettings)
+  return target;
+}
+
+size_t RoutingSettings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.router.RoutingSettings)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double bus_velocity_kmh = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bus_velocity_kmh = this->_internal_bus_velocity_kmh();
+  uint64_t raw_bus_velocity_kmh;
+  memcpy(&raw_bus_velocity_kmh, &tmp_bus_velocity_kmh, sizeof(tmp_bus_velocity_kmh));
+  if (raw_bus_velocity_kmh != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 bus_wait_time_min = 1;
+  if (this->_internal_bus_wait_time_min() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_bus_wait_time_min());
+  }
+
+  // .proto_schema.router.RouterType router_type = 3;
+  if (this->_internal_router_type() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_router_type());
+  }
+
+  // uint64 route_cache_capacity = 5;
+  if (this->_internal_route_cache_capacity() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt64SizePlusOne(this->_internal_route_cache_capacity());
+  }
+
+  // bool collapse_parallel_edges = 4;
+  if (this->_internal_collapse_parallel_edges() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // .proto_schema.router.VertexOrder vertex_order = 6;
+  if (this->_internal_vertex_order() != 0) {
+    total_size += 1 +
+      ::_pbi::WireFormatLite::EnumSize(this->_internal_vertex_order());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutingSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoutingSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutingSettings::GetClassData() const { return &_class_data_; }
+
+
+void RoutingSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutingSettings*>(&to_msg);
+  auto& from = static_cast<const RoutingSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.router.RoutingSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_bus_velocity_kmh = from._internal_bus_velocity_kmh();
+  uint64_t raw_bus_velocity_kmh;
+  memcpy(&raw_bus_velocity_kmh, &tmp_bus_velocity_kmh, sizeof(tmp_bus_velocity_kmh));
+  if (raw_bus_velocity_kmh != 0) {
+    _this->_internal_set_bus_velocity_kmh(from._internal_bus_velocity_kmh());
+  }
+  if (from._internal_bus_wait_time_min() != 0) {
+    _this->_internal_set_bus_wait_time_min(from._internal_bus_wait_time_min());
+  }
+  if (from._internal_router_type() != 0) {
+    _this->_internal_set_router_type(from._internal_router_type());
+  }
+  if (from._internal_route_cache_capacity() != 0) {
+    _this->_internal_set_route_cache_capacity(from._internal_route_cache_capacity());
+  }
+  if (from._internal_collapse_parallel_edges() != 0) {
+    _this->_internal_set_collapse_parallel_edges(from._internal_collapse_parallel_edges());
+  }
+  if (from._internal_vertex_order() != 0) {
+    _this->_internal_set_vertex_order(from._internal_vertex_order());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoutingSettings::CopyFrom(const RoutingSettings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.router.RoutingSettings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoutingSettings::IsInitialized() const {
+  return true;
+}
+
+void RoutingSettings::InternalSwap(RoutingSettings* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.vertex_order_)
+      + sizeof(RoutingSettings::_impl_.vertex_order_)
+      - PROTOBUF_FIELD_OFFSET(RoutingSettings, _impl_.bus_velocity_kmh_)>(
+          reinterpret_cast<char*>(&_impl_.bus_velocity_kmh_),
+          reinterpret_cast<char*>(&other->_impl_.bus_velocity_kmh_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoutingSettings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[0]);
+}
+
+// ===================================================================
+
+class RoutingItems::_Internal {
+ public:
+};
+
+RoutingItems::RoutingItems(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.router.RoutingItems)
+}
+RoutingItems::RoutingItems(const RoutingItems& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RoutingItems* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_ids_){from._impl_.bus_ids_}
+    , /*decltype(_impl_._bus_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.stop_ids_){from._impl_.stop_ids_}
+    , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.span_counts_){from._impl_.span_counts_}
+    , /*decltype(_impl_._span_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.travel_times_){from._impl_.travel_times_}
+    , decltype(_impl_.distances_){from._impl_.distances_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.router.RoutingItems)
+}
+
+inline void RoutingItems::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_ids_){arena}
+    , /*decltype(_impl_._bus_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.stop_ids_){arena}
+    , /*decltype(_impl_._stop_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.span_counts_){arena}
+    , /*decltype(_impl_._span_counts_cached_byte_size_)*/{0}
+    , decltype(_impl_.travel_times_){arena}
+    , decltype(_impl_.distances_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RoutingItems::~RoutingItems() {
+  // @@protoc_insertion_point(destructor:proto_schema.router.RoutingItems)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RoutingItems::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bus_ids_.~RepeatedField();
+  _impl_.stop_ids_.~RepeatedField();
+  _impl_.span_counts_.~RepeatedField();
+  _impl_.travel_times_.~RepeatedField();
+  _impl_.distances_.~RepeatedField();
+}
+
+void RoutingItems::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RoutingItems::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.router.RoutingItems)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bus_ids_.Clear();
+  _impl_.stop_ids_.Clear();
+  _impl_.span_counts_.Clear();
+  _impl_.travel_times_.Clear();
+  _impl_.distances_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RoutingItems::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 bus_ids = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_bus_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_bus_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 stop_ids = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_stop_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_stop_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 span_counts = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_span_counts(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_span_counts(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double travel_times = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_travel_times(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 33) {
+          _internal_add_travel_times(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double distances = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_distances(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 41) {
+          _internal_add_distances(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RoutingItems::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.router.RoutingItems)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 bus_ids = 1;
+  {
+    int byte_size = _impl_._bus_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_bus_ids(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 stop_ids = 2;
+  {
+    int byte_size = _impl_._stop_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_stop_ids(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 span_counts = 3;
+  {
+    int byte_size = _impl_._span_counts_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_span_counts(), byte_size, target);
+    }
+  }
+
+  // repeated double travel_times = 4;
+  if (this->_internal_travel_times_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_travel_times(), target);
+  }
+
+  // repeated double distances = 5;
+  if (this->_internal_distances_size() > 0) {
+    target = stream->WriteFixedPacked(5, _internal_distances(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.router.RoutingItems)
+  return target;
+}
+
+size_t RoutingItems::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.router.RoutingItems)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 bus_ids = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.bus_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._bus_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 stop_ids = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.stop_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._stop_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 span_counts = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.span_counts_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._span_counts_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double travel_times = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_travel_times_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double distances = 5;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_distances_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RoutingItems::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RoutingItems::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RoutingItems::GetClassData() const { return &_class_data_; }
+
+
+void RoutingItems::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RoutingItems*>(&to_msg);
+  auto& from = static_cast<const RoutingItems&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.router.RoutingItems)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bus_ids_.MergeFrom(from._impl_.bus_ids_);
+  _this->_impl_.stop_ids_.MergeFrom(from._impl_.stop_ids_);
+  _this->_impl_.span_counts_.MergeFrom(from._impl_.span_counts_);
+  _this->_impl_.travel_times_.MergeFrom(from._impl_.travel_times_);
+  _this->_impl_.distances_.MergeFrom(from._impl_.distances_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RoutingItems::CopyFrom(const RoutingItems& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.router.RoutingItems)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RoutingItems::IsInitialized() const {
+  return true;
+}
+
+void RoutingItems::InternalSwap(RoutingItems* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bus_ids_.InternalSwap(&other->_impl_.bus_ids_);
+  _impl_.stop_ids_.InternalSwap(&other->_impl_.stop_ids_);
+  _impl_.span_counts_.InternalSwap(&other->_impl_.span_counts_);
+  _impl_.travel_times_.InternalSwap(&other->_impl_.travel_times_);
+  _impl_.distances_.InternalSwap(&other->_impl_.distances_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RoutingItems::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[1]);
+}
+
+// ===================================================================
+
+class RouterState::_Internal {
+ public:
+};
+
+RouterState::RouterState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.router.RouterState)
+}
+RouterState::RouterState(const RouterState& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RouterState* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prev_edges_){from._impl_.prev_edges_}
+    , /*decltype(_impl_._prev_edges_cached_byte_size_)*/{0}
+    , decltype(_impl_.weights_){from._impl_.weights_}
+    , decltype(_impl_.vertex_count_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _this->_impl_.vertex_count_ = from._impl_.vertex_count_;
+  // @@protoc_insertion_point(copy_constructor:proto_schema.router.RouterState)
+}
+
+inline void RouterState::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.prev_edges_){arena}
+    , /*decltype(_impl_._prev_edges_cached_byte_size_)*/{0}
+    , decltype(_impl_.weights_){arena}
+    , decltype(_impl_.vertex_count_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RouterState::~RouterState() {
+  // @@protoc_insertion_point(destructor:proto_schema.router.RouterState)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RouterState::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.prev_edges_.~RepeatedField();
+  _impl_.weights_.~RepeatedField();
+}
+
+void RouterState::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RouterState::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.router.RouterState)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.prev_edges_.Clear();
+  _impl_.weights_.Clear();
+  _impl_.vertex_count_ = 0u;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RouterState::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 vertex_count = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.vertex_count_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 prev_edges = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_prev_edges(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 24) {
+          _internal_add_prev_edges(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated float weights = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedFloatParser(_internal_mutable_weights(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 37) {
+          _internal_add_weights(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<float>(ptr));
+          ptr += sizeof(float);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RouterState::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.router.RouterState)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 vertex_count = 1;
+  if (this->_internal_vertex_count() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_vertex_count(), target);
+  }
+
+  // repeated uint32 prev_edges = 3;
+  {
+    int byte_size = _impl_._prev_edges_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          3, _internal_prev_edges(), byte_size, target);
+    }
+  }
+
+  // repeated float weights = 4;
+  if (this->_internal_weights_size() > 0) {
+    target = stream->WriteFixedPacked(4, _internal_weights(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.router.RouterState)
+  return target;
+}
+
+size_t RouterState::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.router.RouterState)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 prev_edges = 3;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.prev_edges_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._prev_edges_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated float weights = 4;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_weights_size());
+    size_t data_size = 4UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // uint32 vertex_count = 1;
+  if (this->_internal_vertex_count() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_vertex_count());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RouterState::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RouterState::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RouterState::GetClassData() const { return &_class_data_; }
+
+
+void RouterState::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RouterState*>(&to_msg);
+  auto& from = static_cast<const RouterState&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.router.RouterState)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.prev_edges_.MergeFrom(from._impl_.prev_edges_);
+  _this->_impl_.weights_.MergeFrom(from._impl_.weights_);
+  if (from._internal_vertex_count() != 0) {
+    _this->_internal_set_vertex_count(from._internal_vertex_count());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RouterState::CopyFrom(const RouterState& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.router.RouterState)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RouterState::IsInitialized() const {
+  return true;
+}
+
+void RouterState::InternalSwap(RouterState* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.prev_edges_.InternalSwap(&other->_impl_.prev_edges_);
+  _impl_.weights_.InternalSwap(&other->_impl_.weights_);
+  swap(_impl_.vertex_count_, other->_impl_.vertex_count_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RouterState::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[2]);
+}
+
+// ===================================================================
+
+class LandmarkTables::_Internal {
+ public:
+};
+
+LandmarkTables::LandmarkTables(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.router.LandmarkTables)
+}
+LandmarkTables::LandmarkTables(const LandmarkTables& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  LandmarkTables* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.landmarks_){from._impl_.landmarks_}
+    , /*decltype(_impl_._landmarks_cached_byte_size_)*/{0}
+    , decltype(_impl_.from_landmarks_){from._impl_.from_landmarks_}
+    , decltype(_impl_.to_landmarks_){from._impl_.to_landmarks_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.router.LandmarkTables)
+}
+
+inline void LandmarkTables::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.landmarks_){arena}
+    , /*decltype(_impl_._landmarks_cached_byte_size_)*/{0}
+    , decltype(_impl_.from_landmarks_){arena}
+    , decltype(_impl_.to_landmarks_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+LandmarkTables::~LandmarkTables() {
+  // @@protoc_insertion_point(destructor:proto_schema.router.LandmarkTables)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void LandmarkTables::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.landmarks_.~RepeatedField();
+  _impl_.from_landmarks_.~RepeatedField();
+  _impl_.to_landmarks_.~RepeatedField();
+}
+
+void LandmarkTables::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void LandmarkTables::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.router.LandmarkTables)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.landmarks_.Clear();
+  _impl_.from_landmarks_.Clear();
+  _impl_.to_landmarks_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* LandmarkTables::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 landmarks = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_landmarks(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_landmarks(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double from_landmarks = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_from_landmarks(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 17) {
+          _internal_add_from_landmarks(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated double to_landmarks = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedDoubleParser(_internal_mutable_to_landmarks(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 25) {
+          _internal_add_to_landmarks(::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr));
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* LandmarkTables::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.router.LandmarkTables)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 landmarks = 1;
+  {
+    int byte_size = _impl_._landmarks_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_landmarks(), byte_size, target);
+    }
+  }
+
+  // repeated double from_landmarks = 2;
+  if (this->_internal_from_landmarks_size() > 0) {
+    target = stream->WriteFixedPacked(2, _internal_from_landmarks(), target);
+  }
+
+  // repeated double to_landmarks = 3;
+  if (this->_internal_to_landmarks_size() > 0) {
+    target = stream->WriteFixedPacked(3, _internal_to_landmarks(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.router.LandmarkTables)
+  return target;
+}
+
+size_t LandmarkTables::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.router.LandmarkTables)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 landmarks = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.landmarks_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._landmarks_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated double from_landmarks = 2;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_from_landmarks_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  // repeated double to_landmarks = 3;
+  {
+    unsigned int count = static_cast<unsigned int>(this->_internal_to_landmarks_size());
+    size_t data_size = 8UL * count;
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData LandmarkTables::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    LandmarkTables::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*LandmarkTables::GetClassData() const { return &_class_data_; }
+
+
+void LandmarkTables::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<LandmarkTables*>(&to_msg);
+  auto& from = static_cast<const LandmarkTables&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.router.LandmarkTables)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.landmarks_.MergeFrom(from._impl_.landmarks_);
+  _this->_impl_.from_landmarks_.MergeFrom(from._impl_.from_landmarks_);
+  _this->_impl_.to_landmarks_.MergeFrom(from._impl_.to_landmarks_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void LandmarkTables::CopyFrom(const LandmarkTables& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.router.LandmarkTables)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool LandmarkTables::IsInitialized() const {
+  return true;
+}
+
+void LandmarkTables::InternalSwap(LandmarkTables* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.landmarks_.InternalSwap(&other->_impl_.landmarks_);
+  _impl_.from_landmarks_.InternalSwap(&other->_impl_.from_landmarks_);
+  _impl_.to_landmarks_.InternalSwap(&other->_impl_.to_landmarks_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata LandmarkTables::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[3]);
+}
+
+// ===================================================================
+
+class ReachabilityIndex::_Internal {
+ public:
+};
+
+ReachabilityIndex::ReachabilityIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.router.ReachabilityIndex)
+}
+ReachabilityIndex::ReachabilityIndex(const ReachabilityIndex& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ReachabilityIndex* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.components_){from._impl_.components_}
+    , /*decltype(_impl_._components_cached_byte_size_)*/{0}
+    , decltype(_impl_.weak_components_){from._impl_.weak_components_}
+    , /*decltype(_impl_._weak_components_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.router.ReachabilityIndex)
+}
+
+inline void ReachabilityIndex::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.components_){arena}
+    , /*decltype(_impl_._components_cached_byte_size_)*/{0}
+    , decltype(_impl_.weak_components_){arena}
+    , /*decltype(_impl_._weak_components_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ReachabilityIndex::~ReachabilityIndex() {
+  // @@protoc_insertion_point(destructor:proto_schema.router.ReachabilityIndex)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ReachabilityIndex::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.components_.~RepeatedField();
+  _impl_.weak_components_.~RepeatedField();
+}
+
+void ReachabilityIndex::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ReachabilityIndex::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.router.ReachabilityIndex)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.components_.Clear();
+  _impl_.weak_components_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ReachabilityIndex::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 components = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_components(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_components(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 weak_components = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_weak_components(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 16) {
+          _internal_add_weak_components(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ReachabilityIndex::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.router.ReachabilityIndex)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 components = 1;
+  {
+    int byte_size = _impl_._components_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_components(), byte_size, target);
+    }
+  }
+
+  // repeated uint32 weak_components = 2;
+  {
+    int byte_size = _impl_._weak_components_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          2, _internal_weak_components(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.router.ReachabilityIndex)
+  return target;
+}
+
+size_t ReachabilityIndex::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.router.ReachabilityIndex)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 components = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.components_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._components_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // repeated uint32 weak_components = 2;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.weak_components_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._weak_components_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ReachabilityIndex::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ReachabilityIndex::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ReachabilityIndex::GetClassData() const { return &_class_data_; }
+
+
+void ReachabilityIndex::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ReachabilityIndex*>(&to_msg);
+  auto& from = static_cast<const ReachabilityIndex&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.router.ReachabilityIndex)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.components_.MergeFrom(from._impl_.components_);
+  _this->_impl_.weak_components_.MergeFrom(from._impl_.weak_components_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ReachabilityIndex::CopyFrom(const ReachabilityIndex& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.router.ReachabilityIndex)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ReachabilityIndex::IsInitialized() const {
+  return true;
+}
+
+void ReachabilityIndex::InternalSwap(ReachabilityIndex* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.components_.InternalSwap(&other->_impl_.components_);
+  _impl_.weak_components_.InternalSwap(&other->_impl_.weak_components_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ReachabilityIndex::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[4]);
+}
+
+// ===================================================================
+
+class Router::_Internal {
+ public:
+  static const ::proto_schema::graph::RoutingGraph& graph(const Router* msg);
+  static const ::proto_schema::router::RouterState& state(const Router* msg);
+  static const ::proto_schema::graph::ContractionHierarchy& hierarchy(const Router* msg);
+  static const ::proto_schema::router::LandmarkTables& landmarks(const Router* msg);
+  static const ::proto_schema::router::RoutingItems& routing_items(const Router* msg);
+  static const ::proto_schema::router::ReachabilityIndex& reachability(const Router* msg);
+};
+
+const ::proto_schema::graph::RoutingGraph&
+Router::_Internal::graph(const Router* msg) {
+  return *msg->_impl_.graph_;
+}
+const ::proto_schema::router::RouterState&
+Router::_Internal::state(const Router* msg) {
+  return *msg->_impl_.state_;
+}
+const ::proto_schema::graph::ContractionHierarchy&
+Router::_Internal::hierarchy(const Router* msg) {
+  return *msg->_impl_.hierarchy_;
+}
+const ::proto_schema::router::LandmarkTables&
+Router::_Internal::landmarks(const Router* msg) {
+  return *msg->_impl_.landmarks_;
+}
+const ::proto_schema::router::RoutingItems&
+Router::_Internal::routing_items(const Router* msg) {
+  return *msg->_impl_.routing_items_;
+}
+const ::proto_schema::router::ReachabilityIndex&
+Router::_Internal::reachability(const Router* msg) {
+  return *msg->_impl_.reachability_;
+}
+void Router::clear_graph() {
+  if (GetArenaForAllocation() == nullptr && _impl_.graph_ != nullptr) {
+    delete _impl_.graph_;
+  }
+  _impl_.graph_ = nullptr;
+}
+void Router::clear_hierarchy() {
+  if (GetArenaForAllocation() == nullptr && _impl_.hierarchy_ != nullptr) {
+    delete _impl_.hierarchy_;
+  }
+  _impl_.hierarchy_ = nullptr;
+}
+Router::Router(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.router.Router)
+}
+Router::Router(const Router& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Router* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_ids_){from._impl_.vertex_ids_}
+    , /*decltype(_impl_._vertex_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.graph_){nullptr}
+    , decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.hierarchy_){nullptr}
+    , decltype(_impl_.landmarks_){nullptr}
+    , decltype(_impl_.routing_items_){nullptr}
+    , decltype(_impl_.reachability_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_graph()) {
+    _this->_impl_.graph_ = new ::proto_schema::graph::RoutingGraph(*from._impl_.graph_);
+  }
+  if (from._internal_has_state()) {
+    _this->_impl_.state_ = new ::proto_schema::router::RouterState(*from._impl_.state_);
+  }
+  if (from._internal_has_hierarchy()) {
+    _this->_impl_.hierarchy_ = new ::proto_schema::graph::ContractionHierarchy(*from._impl_.hierarchy_);
+  }
+  if (from._internal_has_landmarks()) {
+    _this->_impl_.landmarks_ = new ::proto_schema::router::LandmarkTables(*from._impl_.landmarks_);
+  }
+  if (from._internal_has_routing_items()) {
+    _this->_impl_.routing_items_ = new ::proto_schema::router::RoutingItems(*from._impl_.routing_items_);
+  }
+  if (from._internal_has_reachability()) {
+    _this->_impl_.reachability_ = new ::proto_schema::router::ReachabilityIndex(*from._impl_.reachability_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_schema.router.Router)
+}
+
+inline void Router::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.vertex_ids_){arena}
+    , /*decltype(_impl_._vertex_ids_cached_byte_size_)*/{0}
+    , decltype(_impl_.graph_){nullptr}
+    , decltype(_impl_.state_){nullptr}
+    , decltype(_impl_.hierarchy_){nullptr}
+    , decltype(_impl_.landmarks_){nullptr}
+    , decltype(_impl_.routing_items_){nullptr}
+    , decltype(_impl_.reachability_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Router::~Router() {
+  // @@protoc_insertion_point(destructor:proto_schema.router.Router)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Router::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.vertex_ids_.~RepeatedField();
+  if (this != internal_default_instance()) delete _impl_.graph_;
+  if (this != internal_default_instance()) delete _impl_.state_;
+  if (this != internal_default_instance()) delete _impl_.hierarchy_;
+  if (this != internal_default_instance()) delete _impl_.landmarks_;
+  if (this != internal_default_instance()) delete _impl_.routing_items_;
+  if (this != internal_default_instance()) delete _impl_.reachability_;
+}
+
+void Router::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Router::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.router.Router)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.vertex_ids_.Clear();
+  if (GetArenaForAllocation() == nullptr && _impl_.graph_ != nullptr) {
+    delete _impl_.graph_;
+  }
+  _impl_.graph_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.state_ != nullptr) {
+    delete _impl_.state_;
+  }
+  _impl_.state_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.hierarchy_ != nullptr) {
+    delete _impl_.hierarchy_;
+  }
+  _impl_.hierarchy_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.landmarks_ != nullptr) {
+    delete _impl_.landmarks_;
+  }
+  _impl_.landmarks_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.routing_items_ != nullptr) {
+    delete _impl_.routing_items_;
+  }
+  _impl_.routing_items_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.reachability_ != nullptr) {
+    delete _impl_.reachability_;
+  }
+  _impl_.reachability_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Router::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.graph.RoutingGraph graph = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_graph(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.RouterState state = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_state(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.graph.ContractionHierarchy hierarchy = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_hierarchy(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.LandmarkTables landmarks = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_landmarks(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.RoutingItems routing_items = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 50)) {
+          ptr = ctx->ParseMessage(_internal_mutable_routing_items(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 vertex_ids = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 58)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_vertex_ids(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 56) {
+          _internal_add_vertex_ids(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.ReachabilityIndex reachability = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 66)) {
+          ptr = ctx->ParseMessage(_internal_mutable_reachability(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Router::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.router.Router)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.graph.RoutingGraph graph = 1;
+  if (this->_internal_has_graph()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::graph(this),
+        _Internal::graph(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.router.RouterState state = 3;
+  if (this->_internal_has_state()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::state(this),
+        _Internal::state(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.graph.ContractionHierarchy hierarchy = 4;
+  if (this->_internal_has_hierarchy()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::hierarchy(this),
+        _Internal::hierarchy(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.router.LandmarkTables landmarks = 5;
+  if (this->_internal_has_landmarks()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::landmarks(this),
+        _Internal::landmarks(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.router.RoutingItems routing_items = 6;
+  if (this->_internal_has_routing_items()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(6, _Internal::routing_items(this),
+        _Internal::routing_items(this).GetCachedSize(), target, stream);
+  }
+
+  // repeated uint32 vertex_ids = 7;
+  {
+    int byte_size = _impl_._vertex_ids_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          7, _internal_vertex_ids(), byte_size, target);
+    }
+  }
+
+  // .proto_schema.router.ReachabilityIndex reachability = 8;
+  if (this->_internal_has_reachability()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(8, _Internal::reachability(this),
+        _Internal::reachability(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.router.Router)
+  return target;
+}
+
+size_t Router::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.router.Router)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 vertex_ids = 7;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.vertex_ids_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._vertex_ids_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // .proto_schema.graph.RoutingGraph graph = 1;
+  if (this->_internal_has_graph()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.graph_);
+  }
+
+  // .proto_schema.router.RouterState state = 3;
+  if (this->_internal_has_state()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.state_);
+  }
+
+  // .proto_schema.graph.ContractionHierarchy hierarchy = 4;
+  if (this->_internal_has_hierarchy()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.hierarchy_);
+  }
+
+  // .proto_schema.router.LandmarkTables landmarks = 5;
+  if (this->_internal_has_landmarks()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.landmarks_);
+  }
+
+  // .proto_schema.router.RoutingItems routing_items = 6;
+  if (this->_internal_has_routing_items()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.routing_items_);
+  }
+
+  // .proto_schema.router.ReachabilityIndex reachability = 8;
+  if (this->_internal_has_reachability()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.reachability_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Router::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Router::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Router::GetClassData() const { return &_class_data_; }
+
+
+void Router::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Router*>(&to_msg);
+  auto& from = static_cast<const Router&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.router.Router)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.vertex_ids_.MergeFrom(from._impl_.vertex_ids_);
+  if (from._internal_has_graph()) {
+    _this->_internal_mutable_graph()->::proto_schema::graph::RoutingGraph::MergeFrom(
+        from._internal_graph());
+  }
+  if (from._internal_has_state()) {
+    _this->_internal_mutable_state()->::proto_schema::router::RouterState::MergeFrom(
+        from._internal_state());
+  }
+  if (from._internal_has_hierarchy()) {
+    _this->_internal_mutable_hierarchy()->::proto_schema::graph::ContractionHierarchy::MergeFrom(
+        from._internal_hierarchy());
+  }
+  if (from._internal_has_landmarks()) {
+    _this->_internal_mutable_landmarks()->::proto_schema::router::LandmarkTables::MergeFrom(
+        from._internal_landmarks());
+  }
+  if (from._internal_has_routing_items()) {
+    _this->_internal_mutable_routing_items()->::proto_schema::router::RoutingItems::MergeFrom(
+        from._internal_routing_items());
+  }
+  if (from._internal_has_reachability()) {
+    _this->_internal_mutable_reachability()->::proto_schema::router::ReachabilityIndex::MergeFrom(
+        from._internal_reachability());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Router::CopyFrom(const Router& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.router.Router)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Router::IsInitialized() const {
+  return true;
+}
+
+void Router::InternalSwap(Router* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.vertex_ids_.InternalSwap(&other->_impl_.vertex_ids_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Router, _impl_.reachability_)
+      + sizeof(Router::_impl_.reachability_)
+      - PROTOBUF_FIELD_OFFSET(Router, _impl_.graph_)>(
+          reinterpret_cast<char*>(&_impl_.graph_),
+          reinterpret_cast<char*>(&other->_impl_.graph_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Router::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5frouter_2eproto_getter, &descriptor_table_transport_5frouter_2eproto_once,
+      file_level_metadata_transport_5frouter_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace router
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_schema::router::RoutingSettings*
+Arena::CreateMaybeMessage< ::proto_schema::router::RoutingSettings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::router::RoutingSettings >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::router::RoutingItems*
+Arena::CreateMaybeMessage< ::proto_schema::router::RoutingItems >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::router::RoutingItems >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::router::RouterState*
+Arena::CreateMaybeMessage< ::proto_schema::router::RouterState >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::router::RouterState >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::router::LandmarkTables*
+Arena::CreateMaybeMessage< ::proto_schema::router::LandmarkTables >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::router::LandmarkTables >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::router::ReachabilityIndex*
+Arena::CreateMaybeMessage< ::proto_schema::router::ReachabilityIndex >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::router::ReachabilityIndex >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::router::Router*
+Arena::CreateMaybeMessage< ::proto_schema::router::Router >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::router::Router >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
@@ -0,0 +1,2824 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transport_router.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transport_5frouter_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transport_5frouter_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_reflection.h>
+#include <google/protobuf/unknown_field_set.h>
+#include "graph.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transport_5frouter_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transport_5frouter_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5frouter_2eproto;
+namespace proto_schema {
+namespace router {
+class LandmarkTables;
+struct LandmarkTablesDefaultTypeInternal;
+extern LandmarkTablesDefaultTypeInternal _LandmarkTables_default_instance_;
+class ReachabilityIndex;
+struct ReachabilityIndexDefaultTypeInternal;
+extern ReachabilityIndexDefaultTypeInternal _ReachabilityIndex_default_instance_;
+class Router;
+struct RouterDefaultTypeInternal;
+extern RouterDefaultTypeInternal _Router_default_instance_;
+class RouterState;
+struct RouterStateDefaultTypeInternal;
+extern RouterStateDefaultTypeInternal _RouterState_default_instance_;
+class RoutingItems;
+struct RoutingItemsDefaultTypeInternal;
+extern RoutingItemsDefaultTypeInternal _RoutingItems_default_instance_;
+class RoutingSettings;
+struct RoutingSettingsDefaultTypeInternal;
+extern RoutingSettingsDefaultTypeInternal _RoutingSettings_default_instance_;
+}  // namespace router
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_schema::router::LandmarkTables* Arena::CreateMaybeMessage<::proto_schema::router::LandmarkTables>(Arena*);
+template<> ::proto_schema::router::ReachabilityIndex* Arena::CreateMaybeMessage<::proto_schema::router::ReachabilityIndex>(Arena*);
+template<> ::proto_schema::router::Router* Arena::CreateMaybeMessage<::proto_schema::router::Router>(Arena*);
+template<> ::proto_schema::router::RouterState* Arena::CreateMaybeMessage<::proto_schema::router::RouterState>(Arena*);
+template<> ::proto_schema::router::RoutingItems* Arena::CreateMaybeMessage<::proto_schema::router::RoutingItems>(Arena*);
+template<> ::proto_schema::router::RoutingSettings* Arena::CreateMaybeMessage<::proto_schema::router::RoutingSettings>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_schema {
+namespace router {
+
+enum RouterType : int {
+  ALL_PAIRS = 0,
+  DIJKSTRA = 1,
+  CONTRACTION_HIERARCHY = 2,
+  A_STAR = 3,
+  ALT = 4,
+  RAPTOR = 5,
+  RouterType_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  RouterType_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool RouterType_IsValid(int value);
+constexpr RouterType RouterType_MIN = ALL_PAIRS;
+constexpr RouterType RouterType_MAX = RAPTOR;
+constexpr int RouterType_ARRAYSIZE = RouterType_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* RouterType_descriptor();
+template<typename T>
+inline const std::string& RouterType_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, RouterType>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function RouterType_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    RouterType_descriptor(), enum_t_value);
+}
+inline bool RouterType_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, RouterType* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<RouterType>(
+    RouterType_descriptor(), name, value);
+}
+enum VertexOrder : int {
+  STOPS_TABLE = 0,
+  HILBERT_CURVE = 1,
+  VertexOrder_INT_MIN_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::min(),
+  VertexOrder_INT_MAX_SENTINEL_DO_NOT_USE_ = std::numeric_limits<int32_t>::max()
+};
+bool VertexOrder_IsValid(int value);
+constexpr VertexOrder VertexOrder_MIN = STOPS_TABLE;
+constexpr VertexOrder VertexOrder_MAX = HILBERT_CURVE;
+constexpr int VertexOrder_ARRAYSIZE = VertexOrder_MAX + 1;
+
+const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* VertexOrder_descriptor();
+template<typename T>
+inline const std::string& VertexOrder_Name(T enum_t_value) {
+  static_assert(::std::is_same<T, VertexOrder>::value ||
+    ::std::is_integral<T>::value,
+    "Incorrect type passed to function VertexOrder_Name.");
+  return ::PROTOBUF_NAMESPACE_ID::internal::NameOfEnum(
+    VertexOrder_descriptor(), enum_t_value);
+}
+inline bool VertexOrder_Parse(
+    ::PROTOBUF_NAMESPACE_ID::ConstStringParam name, VertexOrder* value) {
+  return ::PROTOBUF_NAMESPACE_ID::internal::ParseNamedEnum<VertexOrder>(
+    VertexOrder_descriptor(), name, value);
+}
+// ===================================================================
+
+class RoutingSettings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.router.RoutingSettings) */ {
+ public:
+  inline RoutingSettings() : RoutingSettings(nullptr) {}
+  ~RoutingSettings() override;
+  explicit PROTOBUF_CONSTEXPR RoutingSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoutingSettings(const RoutingSettings& from);
+  RoutingSettings(RoutingSettings&& from) noexcept
+    : RoutingSettings() {
+    *this = ::std::move(from);
+  }
+
+  inline RoutingSettings& operator=(const RoutingSettings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoutingSettings& operator=(RoutingSettings&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoutingSettings& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoutingSettings* internal_default_instance() {
+    return reinterpret_cast<const RoutingSettings*>(
+               &_RoutingSettings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(RoutingSettings& a, RoutingSettings& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoutingSettings* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoutingSettings* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoutingSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoutingSettings>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoutingSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoutingSettings& from) {
+    RoutingSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoutingSettings* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.router.RoutingSettings";
+  }
+  protected:
+  explicit RoutingSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBusVelocityKmhFieldNumber = 2,
+    kBusWaitTimeMinFieldNumber = 1,
+    kRouterTypeFieldNumber = 3,
+    kRouteCacheCapacityFieldNumber = 5,
+    kCollapseParallelEdgesFieldNumber = 4,
+    kVertexOrderFieldNumber = 6,
+  };
+  // double bus_velocity_kmh = 2;
+  void clear_bus_velocity_kmh();
+  double bus_velocity_kmh() const;
+  void set_bus_velocity_kmh(double value);
+  private:
+  double _internal_bus_velocity_kmh() const;
+  void _internal_set_bus_velocity_kmh(double value);
+  public:
+
+  // uint32 bus_wait_time_min = 1;
+  void clear_bus_wait_time_min();
+  uint32_t bus_wait_time_min() const;
+  void set_bus_wait_time_min(uint32_t value);
+  private:
+  uint32_t _internal_bus_wait_time_min() const;
+  void _internal_set_bus_wait_time_min(uint32_t value);
+  public:
+
+  // .proto_schema.router.RouterType router_type = 3;
+  void clear_router_type();
+  ::proto_schema::router::RouterType router_type() const;
+  void set_router_type(::proto_schema::router::RouterType value);
+  private:
+  ::proto_schema::router::RouterType _internal_router_type() const;
+  void _internal_set_router_type(::proto_schema::router::RouterType value);
+  public:
+
+  // uint64 route_cache_capacity = 5;
+  void clear_route_cache_capacity();
+  uint64_t route_cache_capacity() const;
+  void set_route_cache_capacity(uint64_t value);
+  private:
+  uint64_t _internal_route_cache_capacity() const;
+  void _internal_set_route_cache_capacity(uint64_t value);
+  public:
+
+  // bool collapse_parallel_edges = 4;
+  void clear_collapse_parallel_edges();
+  bool collapse_parallel_edges() const;
+  void set_collapse_parallel_edges(bool value);
+  private:
+  bool _internal_collapse_parallel_edges() const;
+  void _internal_set_collapse_parallel_edges(bool value);
+  public:
+
+  // .proto_schema.router.VertexOrder vertex_order = 6;
+  void clear_vertex_order();
+  ::proto_schema::router::VertexOrder vertex_order() const;
+  void set_vertex_order(::proto_schema::router::VertexOrder value);
+  private:
+  ::proto_schema::router::VertexOrder _internal_vertex_order() const;
+  void _internal_set_vertex_order(::proto_schema::router::VertexOrder value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.router.RoutingSettings)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double bus_velocity_kmh_;
+    uint32_t bus_wait_time_min_;
+    int router_type_;
+    uint64_t route_cache_capacity_;
+    bool collapse_parallel_edges_;
+    int vertex_order_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RoutingItems final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.router.RoutingItems) */ {
+ public:
+  inline RoutingItems() : RoutingItems(nullptr) {}
+  ~RoutingItems() override;
+  explicit PROTOBUF_CONSTEXPR RoutingItems(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RoutingItems(const RoutingItems& from);
+  RoutingItems(RoutingItems&& from) noexcept
+    : RoutingItems() {
+    *this = ::std::move(from);
+  }
+
+  inline RoutingItems& operator=(const RoutingItems& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RoutingItems& operator=(RoutingItems&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RoutingItems& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RoutingItems* internal_default_instance() {
+    return reinterpret_cast<const RoutingItems*>(
+               &_RoutingItems_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(RoutingItems& a, RoutingItems& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RoutingItems* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RoutingItems* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RoutingItems* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RoutingItems>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RoutingItems& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RoutingItems& from) {
+    RoutingItems::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RoutingItems* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.router.RoutingItems";
+  }
+  protected:
+  explicit RoutingItems(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBusIdsFieldNumber = 1,
+    kStopIdsFieldNumber = 2,
+    kSpanCountsFieldNumber = 3,
+    kTravelTimesFieldNumber = 4,
+    kDistancesFieldNumber = 5,
+  };
+  // repeated uint32 bus_ids = 1;
+  int bus_ids_size() const;
+  private:
+  int _internal_bus_ids_size() const;
+  public:
+  void clear_bus_ids();
+  private:
+  uint32_t _internal_bus_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_bus_ids() const;
+  void _internal_add_bus_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_bus_ids();
+  public:
+  uint32_t bus_ids(int index) const;
+  void set_bus_ids(int index, uint32_t value);
+  void add_bus_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      bus_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_bus_ids();
+
+  // repeated uint32 stop_ids = 2;
+  int stop_ids_size() const;
+  private:
+  int _internal_stop_ids_size() const;
+  public:
+  void clear_stop_ids();
+  private:
+  uint32_t _internal_stop_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_stop_ids() const;
+  void _internal_add_stop_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_stop_ids();
+  public:
+  uint32_t stop_ids(int index) const;
+  void set_stop_ids(int index, uint32_t value);
+  void add_stop_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      stop_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_stop_ids();
+
+  // repeated uint32 span_counts = 3;
+  int span_counts_size() const;
+  private:
+  int _internal_span_counts_size() const;
+  public:
+  void clear_span_counts();
+  private:
+  uint32_t _internal_span_counts(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_span_counts() const;
+  void _internal_add_span_counts(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_span_counts();
+  public:
+  uint32_t span_counts(int index) const;
+  void set_span_counts(int index, uint32_t value);
+  void add_span_counts(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      span_counts() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_span_counts();
+
+  // repeated double travel_times = 4;
+  int travel_times_size() const;
+  private:
+  int _internal_travel_times_size() const;
+  public:
+  void clear_travel_times();
+  private:
+  double _internal_travel_times(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_travel_times() const;
+  void _internal_add_travel_times(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_travel_times();
+  public:
+  double travel_times(int index) const;
+  void set_travel_times(int index, double value);
+  void add_travel_times(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      travel_times() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_travel_times();
+
+  // repeated double distances = 5;
+  int distances_size() const;
+  private:
+  int _internal_distances_size() const;
+  public:
+  void clear_distances();
+  private:
+  double _internal_distances(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_distances() const;
+  void _internal_add_distances(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_distances();
+  public:
+  double distances(int index) const;
+  void set_distances(int index, double value);
+  void add_distances(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      distances() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_distances();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.router.RoutingItems)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > bus_ids_;
+    mutable std::atomic<int> _bus_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > stop_ids_;
+    mutable std::atomic<int> _stop_ids_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > span_counts_;
+    mutable std::atomic<int> _span_counts_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > travel_times_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > distances_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RouterState final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.router.RouterState) */ {
+ public:
+  inline RouterState() : RouterState(nullptr) {}
+  ~RouterState() override;
+  explicit PROTOBUF_CONSTEXPR RouterState(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RouterState(const RouterState& from);
+  RouterState(RouterState&& from) noexcept
+    : RouterState() {
+    *this = ::std::move(from);
+  }
+
+  inline RouterState& operator=(const RouterState& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RouterState& operator=(RouterState&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RouterState& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RouterState* internal_default_instance() {
+    return reinterpret_cast<const RouterState*>(
+               &_RouterState_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(RouterState& a, RouterState& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RouterState* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RouterState* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RouterState* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RouterState>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RouterState& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RouterState& from) {
+    RouterState::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RouterState* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.router.RouterState";
+  }
+  protected:
+  explicit RouterState(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kPrevEdgesFieldNumber = 3,
+    kWeightsFieldNumber = 4,
+    kVertexCountFieldNumber = 1,
+  };
+  // repeated uint32 prev_edges = 3;
+  int prev_edges_size() const;
+  private:
+  int _internal_prev_edges_size() const;
+  public:
+  void clear_prev_edges();
+  private:
+  uint32_t _internal_prev_edges(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_prev_edges() const;
+  void _internal_add_prev_edges(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_prev_edges();
+  public:
+  uint32_t prev_edges(int index) const;
+  void set_prev_edges(int index, uint32_t value);
+  void add_prev_edges(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      prev_edges() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_prev_edges();
+
+  // repeated float weights = 4;
+  int weights_size() const;
+  private:
+  int _internal_weights_size() const;
+  public:
+  void clear_weights();
+  private:
+  float _internal_weights(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      _internal_weights() const;
+  void _internal_add_weights(float value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      _internal_mutable_weights();
+  public:
+  float weights(int index) const;
+  void set_weights(int index, float value);
+  void add_weights(float value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+      weights() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+      mutable_weights();
+
+  // uint32 vertex_count = 1;
+  void clear_vertex_count();
+  uint32_t vertex_count() const;
+  void set_vertex_count(uint32_t value);
+  private:
+  uint32_t _internal_vertex_count() const;
+  void _internal_set_vertex_count(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.router.RouterState)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > prev_edges_;
+    mutable std::atomic<int> _prev_edges_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< float > weights_;
+    uint32_t vertex_count_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class LandmarkTables final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.router.LandmarkTables) */ {
+ public:
+  inline LandmarkTables() : LandmarkTables(nullptr) {}
+  ~LandmarkTables() override;
+  explicit PROTOBUF_CONSTEXPR LandmarkTables(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  LandmarkTables(const LandmarkTables& from);
+  LandmarkTables(LandmarkTables&& from) noexcept
+    : LandmarkTables() {
+    *this = ::std::move(from);
+  }
+
+  inline LandmarkTables& operator=(const LandmarkTables& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline LandmarkTables& operator=(LandmarkTables&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const LandmarkTables& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const LandmarkTables* internal_default_instance() {
+    return reinterpret_cast<const LandmarkTables*>(
+               &_LandmarkTables_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(LandmarkTables& a, LandmarkTables& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(LandmarkTables* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(LandmarkTables* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  LandmarkTables* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<LandmarkTables>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const LandmarkTables& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const LandmarkTables& from) {
+    LandmarkTables::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(LandmarkTables* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.router.LandmarkTables";
+  }
+  protected:
+  explicit LandmarkTables(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLandmarksFieldNumber = 1,
+    kFromLandmarksFieldNumber = 2,
+    kToLandmarksFieldNumber = 3,
+  };
+  // repeated uint32 landmarks = 1;
+  int landmarks_size() const;
+  private:
+  int _internal_landmarks_size() const;
+  public:
+  void clear_landmarks();
+  private:
+  uint32_t _internal_landmarks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_landmarks() const;
+  void _internal_add_landmarks(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_landmarks();
+  public:
+  uint32_t landmarks(int index) const;
+  void set_landmarks(int index, uint32_t value);
+  void add_landmarks(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      landmarks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_landmarks();
+
+  // repeated double from_landmarks = 2;
+  int from_landmarks_size() const;
+  private:
+  int _internal_from_landmarks_size() const;
+  public:
+  void clear_from_landmarks();
+  private:
+  double _internal_from_landmarks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_from_landmarks() const;
+  void _internal_add_from_landmarks(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_from_landmarks();
+  public:
+  double from_landmarks(int index) const;
+  void set_from_landmarks(int index, double value);
+  void add_from_landmarks(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      from_landmarks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_from_landmarks();
+
+  // repeated double to_landmarks = 3;
+  int to_landmarks_size() const;
+  private:
+  int _internal_to_landmarks_size() const;
+  public:
+  void clear_to_landmarks();
+  private:
+  double _internal_to_landmarks(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      _internal_to_landmarks() const;
+  void _internal_add_to_landmarks(double value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      _internal_mutable_to_landmarks();
+  public:
+  double to_landmarks(int index) const;
+  void set_to_landmarks(int index, double value);
+  void add_to_landmarks(double value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+      to_landmarks() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+      mutable_to_landmarks();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.router.LandmarkTables)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > landmarks_;
+    mutable std::atomic<int> _landmarks_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > from_landmarks_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< double > to_landmarks_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ReachabilityIndex final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.router.ReachabilityIndex) */ {
+ public:
+  inline ReachabilityIndex() : ReachabilityIndex(nullptr) {}
+  ~ReachabilityIndex() override;
+  explicit PROTOBUF_CONSTEXPR ReachabilityIndex(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ReachabilityIndex(const ReachabilityIndex& from);
+  ReachabilityIndex(ReachabilityIndex&& from) noexcept
+    : ReachabilityIndex() {
+    *this = ::std::move(from);
+  }
+
+  inline ReachabilityIndex& operator=(const ReachabilityIndex& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ReachabilityIndex& operator=(ReachabilityIndex&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ReachabilityIndex& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ReachabilityIndex* internal_default_instance() {
+    return reinterpret_cast<const ReachabilityIndex*>(
+               &_ReachabilityIndex_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ReachabilityIndex& a, ReachabilityIndex& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ReachabilityIndex* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ReachabilityIndex* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ReachabilityIndex* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ReachabilityIndex>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ReachabilityIndex& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ReachabilityIndex& from) {
+    ReachabilityIndex::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ReachabilityIndex* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.router.ReachabilityIndex";
+  }
+  protected:
+  explicit ReachabilityIndex(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kComponentsFieldNumber = 1,
+    kWeakComponentsFieldNumber = 2,
+  };
+  // repeated uint32 components = 1;
+  int components_size() const;
+  private:
+  int _internal_components_size() const;
+  public:
+  void clear_components();
+  private:
+  uint32_t _internal_components(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_components() const;
+  void _internal_add_components(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_components();
+  public:
+  uint32_t components(int index) const;
+  void set_components(int index, uint32_t value);
+  void add_components(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      components() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_components();
+
+  // repeated uint32 weak_components = 2;
+  int weak_components_size() const;
+  private:
+  int _internal_weak_components_size() const;
+  public:
+  void clear_weak_components();
+  private:
+  uint32_t _internal_weak_components(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_weak_components() const;
+  void _internal_add_weak_components(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_weak_components();
+  public:
+  uint32_t weak_components(int index) const;
+  void set_weak_components(int index, uint32_t value);
+  void add_weak_components(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      weak_components() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_weak_components();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.router.ReachabilityIndex)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > components_;
+    mutable std::atomic<int> _components_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > weak_components_;
+    mutable std::atomic<int> _weak_components_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Router final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.router.Router) */ {
+ public:
+  inline Router() : Router(nullptr) {}
+  ~Router() override;
+  explicit PROTOBUF_CONSTEXPR Router(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Router(const Router& from);
+  Router(Router&& from) noexcept
+    : Router() {
+    *this = ::std::move(from);
+  }
+
+  inline Router& operator=(const Router& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Router& operator=(Router&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Router& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Router* internal_default_instance() {
+    return reinterpret_cast<const Router*>(
+               &_Router_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(Router& a, Router& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Router* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Router* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Router* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Router>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Router& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Router& from) {
+    Router::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Router* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.router.Router";
+  }
+  protected:
+  explicit Router(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kVertexIdsFieldNumber = 7,
+    kGraphFieldNumber = 1,
+    kStateFieldNumber = 3,
+    kHierarchyFieldNumber = 4,
+    kLandmarksFieldNumber = 5,
+    kRoutingItemsFieldNumber = 6,
+    kReachabilityFieldNumber = 8,
+  };
+  // repeated uint32 vertex_ids = 7;
+  int vertex_ids_size() const;
+  private:
+  int _internal_vertex_ids_size() const;
+  public:
+  void clear_vertex_ids();
+  private:
+  uint32_t _internal_vertex_ids(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_vertex_ids() const;
+  void _internal_add_vertex_ids(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_vertex_ids();
+  public:
+  uint32_t vertex_ids(int index) const;
+  void set_vertex_ids(int index, uint32_t value);
+  void add_vertex_ids(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      vertex_ids() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_vertex_ids();
+
+  // .proto_schema.graph.RoutingGraph graph = 1;
+  bool has_graph() const;
+  private:
+  bool _internal_has_graph() const;
+  public:
+  void clear_graph();
+  const ::proto_schema::graph::RoutingGraph& graph() const;
+  PROTOBUF_NODISCARD ::proto_schema::graph::RoutingGraph* release_graph();
+  ::proto_schema::graph::RoutingGraph* mutable_graph();
+  void set_allocated_graph(::proto_schema::graph::RoutingGraph* graph);
+  private:
+  const ::proto_schema::graph::RoutingGraph& _internal_graph() const;
+  ::proto_schema::graph::RoutingGraph* _internal_mutable_graph();
+  public:
+  void unsafe_arena_set_allocated_graph(
+      ::proto_schema::graph::RoutingGraph* graph);
+  ::proto_schema::graph::RoutingGraph* unsafe_arena_release_graph();
+
+  // .proto_schema.router.RouterState state = 3;
+  bool has_state() const;
+  private:
+  bool _internal_has_state() const;
+  public:
+  void clear_state();
+  const ::proto_schema::router::RouterState& state() const;
+  PROTOBUF_NODISCARD ::proto_schema::router::RouterState* release_state();
+  ::proto_schema::router::RouterState* mutable_state();
+  void set_allocated_state(::proto_schema::router::RouterState* state);
+  private:
+  const ::proto_schema::router::RouterState& _internal_state() const;
+  ::proto_schema::router::RouterState* _internal_mutable_state();
+  public:
+  void unsafe_arena_set_allocated_state(
+      ::proto_schema::router::RouterState* state);
+  ::proto_schema::router::RouterState* unsafe_arena_release_state();
+
+  // .proto_schema.graph.ContractionHierarchy hierarchy = 4;
+  bool has_hierarchy() const;
+  private:
+  bool _internal_has_hierarchy() const;
+  public:
+  void clear_hierarchy();
+  const ::proto_schema::graph::ContractionHierarchy& hierarchy() const;
+  PROTOBUF_NODISCARD ::proto_schema::graph::ContractionHierarchy* release_hierarchy();
+  ::proto_schema::graph::ContractionHierarchy* mutable_hierarchy();
+  void set_allocated_hierarchy(::proto_schema::graph::ContractionHierarchy* hierarchy);
+  private:
+  const ::proto_schema::graph::ContractionHierarchy& _internal_hierarchy() const;
+  ::proto_schema::graph::ContractionHierarchy* _internal_mutable_hierarchy();
+  public:
+  void unsafe_arena_set_allocated_hierarchy(
+      ::proto_schema::graph::ContractionHierarchy* hierarchy);
+  ::proto_schema::graph::ContractionHierarchy* unsafe_arena_release_hierarchy();
+
+  // .proto_schema.router.LandmarkTables landmarks = 5;
+  bool has_landmarks() const;
+  private:
+  bool _internal_has_landmarks() const;
+  public:
+  void clear_landmarks();
+  const ::proto_schema::router::LandmarkTables& landmarks() const;
+  PROTOBUF_NODISCARD ::proto_schema::router::LandmarkTables* release_landmarks();
+  ::proto_schema::router::LandmarkTables* mutable_landmarks();
+  void set_allocated_landmarks(::proto_schema::router::LandmarkTables* landmarks);
+  private:
+  const ::proto_schema::router::LandmarkTables& _internal_landmarks() const;
+  ::proto_schema::router::LandmarkTables* _internal_mutable_landmarks();
+  public:
+  void unsafe_arena_set_allocated_landmarks(
+      ::proto_schema::router::LandmarkTables* landmarks);
+  ::proto_schema::router::LandmarkTables* unsafe_arena_release_landmarks();
+
+  // .proto_schema.router.RoutingItems routing_items = 6;
+  bool has_routing_items() const;
+  private:
+  bool _internal_has_routing_items() const;
+  public:
+  void clear_routing_items();
+  const ::proto_schema::router::RoutingItems& routing_items() const;
+  PROTOBUF_NODISCARD ::proto_schema::router::RoutingItems* release_routing_items();
+  ::proto_schema::router::RoutingItems* mutable_routing_items();
+  void set_allocated_routing_items(::proto_schema::router::RoutingItems* routing_items);
+  private:
+  const ::proto_schema::router::RoutingItems& _internal_routing_items() const;
+  ::proto_schema::router::RoutingItems* _internal_mutable_routing_items();
+  public:
+  void unsafe_arena_set_allocated_routing_items(
+      ::proto_schema::router::RoutingItems* routing_items);
+  ::proto_schema::router::RoutingItems* unsafe_arena_release_routing_items();
+
+  // .proto_schema.router.ReachabilityIndex reachability = 8;
+  bool has_reachability() const;
+  private:
+  bool _internal_has_reachability() const;
+  public:
+  void clear_reachability();
+  const ::proto_schema::router::ReachabilityIndex& reachability() const;
+  PROTOBUF_NODISCARD ::proto_schema::router::ReachabilityIndex* release_reachability();
+  ::proto_schema::router::ReachabilityIndex* mutable_reachability();
+  void set_allocated_reachability(::proto_schema::router::ReachabilityIndex* reachability);
+  private:
+  const ::proto_schema::router::ReachabilityIndex& _internal_reachability() const;
+  ::proto_schema::router::ReachabilityIndex* _internal_mutable_reachability();
+  public:
+  void unsafe_arena_set_allocated_reachability(
+      ::proto_schema::router::ReachabilityIndex* reachability);
+  ::proto_schema::router::ReachabilityIndex* unsafe_arena_release_reachability();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.router.Router)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > vertex_ids_;
+    mutable std::atomic<int> _vertex_ids_cached_byte_size_;
+    ::proto_schema::graph::RoutingGraph* graph_;
+    ::proto_schema::router::RouterState* state_;
+    ::proto_schema::graph::ContractionHierarchy* hierarchy_;
+    ::proto_schema::router::LandmarkTables* landmarks_;
+    ::proto_schema::router::RoutingItems* routing_items_;
+    ::proto_schema::router::ReachabilityIndex* reachability_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5frouter_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// RoutingSettings
+
+// uint32 bus_wait_time_min = 1;
+inline void RoutingSettings::clear_bus_wait_time_min() {
+  _impl_.bus_wait_time_min_ = 0u;
+}
+inline uint32_t RoutingSettings::_internal_bus_wait_time_min() const {
+  return _impl_.bus_wait_time_min_;
+}
+inline uint32_t RoutingSettings::bus_wait_time_min() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingSettings.bus_wait_time_min)
+  return _internal_bus_wait_time_min();
+}
+inline void RoutingSettings::_internal_set_bus_wait_time_min(uint32_t value) {
+  
+  _impl_.bus_wait_time_min_ = value;
+}
+inline void RoutingSettings::set_bus_wait_time_min(uint32_t value) {
+  _internal_set_bus_wait_time_min(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingSettings.bus_wait_time_min)
+}
+
+// double bus_velocity_kmh = 2;
+inline void RoutingSettings::clear_bus_velocity_kmh() {
+  _impl_.bus_velocity_kmh_ = 0;
+}
+inline double RoutingSettings::_internal_bus_velocity_kmh() const {
+  return _impl_.bus_velocity_kmh_;
+}
+inline double RoutingSettings::bus_velocity_kmh() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingSettings.bus_velocity_kmh)
+  return _internal_bus_velocity_kmh();
+}
+inline void RoutingSettings::_internal_set_bus_velocity_kmh(double value) {
+  
+  _impl_.bus_velocity_kmh_ = value;
+}
+inline void RoutingSettings::set_bus_velocity_kmh(double value) {
+  _internal_set_bus_velocity_kmh(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingSettings.bus_velocity_kmh)
+}
+
+// .proto_schema.router.RouterType router_type = 3;
+inline void RoutingSettings::clear_router_type() {
+  _impl_.router_type_ = 0;
+}
+inline ::proto_schema::router::RouterType RoutingSettings::_internal_router_type() const {
+  return static_cast< ::proto_schema::router::RouterType >(_impl_.router_type_);
+}
+inline ::proto_schema::router::RouterType RoutingSettings::router_type() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingSettings.router_type)
+  return _internal_router_type();
+}
+inline void RoutingSettings::_internal_set_router_type(::proto_schema::router::RouterType value) {
+  
+  _impl_.router_type_ = value;
+}
+inline void RoutingSettings::set_router_type(::proto_schema::router::RouterType value) {
+  _internal_set_router_type(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingSettings.router_type)
+}
+
+// bool collapse_parallel_edges = 4;
+inline void RoutingSettings::clear_collapse_parallel_edges() {
+  _impl_.collapse_parallel_edges_ = false;
+}
+inline bool RoutingSettings::_internal_collapse_parallel_edges() const {
+  return _impl_.collapse_parallel_edges_;
+}
+inline bool RoutingSettings::collapse_parallel_edges() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingSettings.collapse_parallel_edges)
+  return _internal_collapse_parallel_edges();
+}
+inline void RoutingSettings::_internal_set_collapse_parallel_edges(bool value) {
+  
+  _impl_.collapse_parallel_edges_ = value;
+}
+inline void RoutingSettings::set_collapse_parallel_edges(bool value) {
+  _internal_set_collapse_parallel_edges(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingSettings.collapse_parallel_edges)
+}
+
+// uint64 route_cache_capacity = 5;
+inline void RoutingSettings::clear_route_cache_capacity() {
+  _impl_.route_cache_capacity_ = uint64_t{0u};
+}
+inline uint64_t RoutingSettings::_internal_route_cache_capacity() const {
+  return _impl_.route_cache_capacity_;
+}
+inline uint64_t RoutingSettings::route_cache_capacity() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingSettings.route_cache_capacity)
+  return _internal_route_cache_capacity();
+}
+inline void RoutingSettings::_internal_set_route_cache_capacity(uint64_t value) {
+  
+  _impl_.route_cache_capacity_ = value;
+}
+inline void RoutingSettings::set_route_cache_capacity(uint64_t value) {
+  _internal_set_route_cache_capacity(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingSettings.route_cache_capacity)
+}
+
+// .proto_schema.router.VertexOrder vertex_order = 6;
+inline void RoutingSettings::clear_vertex_order() {
+  _impl_.vertex_order_ = 0;
+}
+inline ::proto_schema::router::VertexOrder RoutingSettings::_internal_vertex_order() const {
+  return static_cast< ::proto_schema::router::VertexOrder >(_impl_.vertex_order_);
+}
+inline ::proto_schema::router::VertexOrder RoutingSettings::vertex_order() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingSettings.vertex_order)
+  return _internal_vertex_order();
+}
+inline void RoutingSettings::_internal_set_vertex_order(::proto_schema::router::VertexOrder value) {
+  
+  _impl_.vertex_order_ = value;
+}
+inline void RoutingSettings::set_vertex_order(::proto_schema::router::VertexOrder value) {
+  _internal_set_vertex_order(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingSettings.vertex_order)
+}
+
+// -------------------------------------------------------------------
+
+// RoutingItems
+
+// repeated uint32 bus_ids = 1;
+inline int RoutingItems::_internal_bus_ids_size() const {
+  return _impl_.bus_ids_.size();
+}
+inline int RoutingItems::bus_ids_size() const {
+  return _internal_bus_ids_size();
+}
+inline void RoutingItems::clear_bus_ids() {
+  _impl_.bus_ids_.Clear();
+}
+inline uint32_t RoutingItems::_internal_bus_ids(int index) const {
+  return _impl_.bus_ids_.Get(index);
+}
+inline uint32_t RoutingItems::bus_ids(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingItems.bus_ids)
+  return _internal_bus_ids(index);
+}
+inline void RoutingItems::set_bus_ids(int index, uint32_t value) {
+  _impl_.bus_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingItems.bus_ids)
+}
+inline void RoutingItems::_internal_add_bus_ids(uint32_t value) {
+  _impl_.bus_ids_.Add(value);
+}
+inline void RoutingItems::add_bus_ids(uint32_t value) {
+  _internal_add_bus_ids(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RoutingItems.bus_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutingItems::_internal_bus_ids() const {
+  return _impl_.bus_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutingItems::bus_ids() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RoutingItems.bus_ids)
+  return _internal_bus_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutingItems::_internal_mutable_bus_ids() {
+  return &_impl_.bus_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutingItems::mutable_bus_ids() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RoutingItems.bus_ids)
+  return _internal_mutable_bus_ids();
+}
+
+// repeated uint32 stop_ids = 2;
+inline int RoutingItems::_internal_stop_ids_size() const {
+  return _impl_.stop_ids_.size();
+}
+inline int RoutingItems::stop_ids_size() const {
+  return _internal_stop_ids_size();
+}
+inline void RoutingItems::clear_stop_ids() {
+  _impl_.stop_ids_.Clear();
+}
+inline uint32_t RoutingItems::_internal_stop_ids(int index) const {
+  return _impl_.stop_ids_.Get(index);
+}
+inline uint32_t RoutingItems::stop_ids(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingItems.stop_ids)
+  return _internal_stop_ids(index);
+}
+inline void RoutingItems::set_stop_ids(int index, uint32_t value) {
+  _impl_.stop_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingItems.stop_ids)
+}
+inline void RoutingItems::_internal_add_stop_ids(uint32_t value) {
+  _impl_.stop_ids_.Add(value);
+}
+inline void RoutingItems::add_stop_ids(uint32_t value) {
+  _internal_add_stop_ids(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RoutingItems.stop_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutingItems::_internal_stop_ids() const {
+  return _impl_.stop_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutingItems::stop_ids() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RoutingItems.stop_ids)
+  return _internal_stop_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutingItems::_internal_mutable_stop_ids() {
+  return &_impl_.stop_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutingItems::mutable_stop_ids() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RoutingItems.stop_ids)
+  return _internal_mutable_stop_ids();
+}
+
+// repeated uint32 span_counts = 3;
+inline int RoutingItems::_internal_span_counts_size() const {
+  return _impl_.span_counts_.size();
+}
+inline int RoutingItems::span_counts_size() const {
+  return _internal_span_counts_size();
+}
+inline void RoutingItems::clear_span_counts() {
+  _impl_.span_counts_.Clear();
+}
+inline uint32_t RoutingItems::_internal_span_counts(int index) const {
+  return _impl_.span_counts_.Get(index);
+}
+inline uint32_t RoutingItems::span_counts(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingItems.span_counts)
+  return _internal_span_counts(index);
+}
+inline void RoutingItems::set_span_counts(int index, uint32_t value) {
+  _impl_.span_counts_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingItems.span_counts)
+}
+inline void RoutingItems::_internal_add_span_counts(uint32_t value) {
+  _impl_.span_counts_.Add(value);
+}
+inline void RoutingItems::add_span_counts(uint32_t value) {
+  _internal_add_span_counts(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RoutingItems.span_counts)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutingItems::_internal_span_counts() const {
+  return _impl_.span_counts_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RoutingItems::span_counts() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RoutingItems.span_counts)
+  return _internal_span_counts();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutingItems::_internal_mutable_span_counts() {
+  return &_impl_.span_counts_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RoutingItems::mutable_span_counts() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RoutingItems.span_counts)
+  return _internal_mutable_span_counts();
+}
+
+// repeated double travel_times = 4;
+inline int RoutingItems::_internal_travel_times_size() const {
+  return _impl_.travel_times_.size();
+}
+inline int RoutingItems::travel_times_size() const {
+  return _internal_travel_times_size();
+}
+inline void RoutingItems::clear_travel_times() {
+  _impl_.travel_times_.Clear();
+}
+inline double RoutingItems::_internal_travel_times(int index) const {
+  return _impl_.travel_times_.Get(index);
+}
+inline double RoutingItems::travel_times(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingItems.travel_times)
+  return _internal_travel_times(index);
+}
+inline void RoutingItems::set_travel_times(int index, double value) {
+  _impl_.travel_times_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingItems.travel_times)
+}
+inline void RoutingItems::_internal_add_travel_times(double value) {
+  _impl_.travel_times_.Add(value);
+}
+inline void RoutingItems::add_travel_times(double value) {
+  _internal_add_travel_times(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RoutingItems.travel_times)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+RoutingItems::_internal_travel_times() const {
+  return _impl_.travel_times_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+RoutingItems::travel_times() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RoutingItems.travel_times)
+  return _internal_travel_times();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+RoutingItems::_internal_mutable_travel_times() {
+  return &_impl_.travel_times_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+RoutingItems::mutable_travel_times() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RoutingItems.travel_times)
+  return _internal_mutable_travel_times();
+}
+
+// repeated double distances = 5;
+inline int RoutingItems::_internal_distances_size() const {
+  return _impl_.distances_.size();
+}
+inline int RoutingItems::distances_size() const {
+  return _internal_distances_size();
+}
+inline void RoutingItems::clear_distances() {
+  _impl_.distances_.Clear();
+}
+inline double RoutingItems::_internal_distances(int index) const {
+  return _impl_.distances_.Get(index);
+}
+inline double RoutingItems::distances(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RoutingItems.distances)
+  return _internal_distances(index);
+}
+inline void RoutingItems::set_distances(int index, double value) {
+  _impl_.distances_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RoutingItems.distances)
+}
+inline void RoutingItems::_internal_add_distances(double value) {
+  _impl_.distances_.Add(value);
+}
+inline void RoutingItems::add_distances(double value) {
+  _internal_add_distances(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RoutingItems.distances)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+RoutingItems::_internal_distances() const {
+  return _impl_.distances_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+RoutingItems::distances() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RoutingItems.distances)
+  return _internal_distances();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+RoutingItems::_internal_mutable_distances() {
+  return &_impl_.distances_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+RoutingItems::mutable_distances() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RoutingItems.distances)
+  return _internal_mutable_distances();
+}
+
+// -------------------------------------------------------------------
+
+// RouterState
+
+// uint32 vertex_count = 1;
+inline void RouterState::clear_vertex_count() {
+  _impl_.vertex_count_ = 0u;
+}
+inline uint32_t RouterState::_internal_vertex_count() const {
+  return _impl_.vertex_count_;
+}
+inline uint32_t RouterState::vertex_count() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RouterState.vertex_count)
+  return _internal_vertex_count();
+}
+inline void RouterState::_internal_set_vertex_count(uint32_t value) {
+  
+  _impl_.vertex_count_ = value;
+}
+inline void RouterState::set_vertex_count(uint32_t value) {
+  _internal_set_vertex_count(value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RouterState.vertex_count)
+}
+
+// repeated uint32 prev_edges = 3;
+inline int RouterState::_internal_prev_edges_size() const {
+  return _impl_.prev_edges_.size();
+}
+inline int RouterState::prev_edges_size() const {
+  return _internal_prev_edges_size();
+}
+inline void RouterState::clear_prev_edges() {
+  _impl_.prev_edges_.Clear();
+}
+inline uint32_t RouterState::_internal_prev_edges(int index) const {
+  return _impl_.prev_edges_.Get(index);
+}
+inline uint32_t RouterState::prev_edges(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RouterState.prev_edges)
+  return _internal_prev_edges(index);
+}
+inline void RouterState::set_prev_edges(int index, uint32_t value) {
+  _impl_.prev_edges_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RouterState.prev_edges)
+}
+inline void RouterState::_internal_add_prev_edges(uint32_t value) {
+  _impl_.prev_edges_.Add(value);
+}
+inline void RouterState::add_prev_edges(uint32_t value) {
+  _internal_add_prev_edges(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RouterState.prev_edges)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RouterState::_internal_prev_edges() const {
+  return _impl_.prev_edges_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+RouterState::prev_edges() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RouterState.prev_edges)
+  return _internal_prev_edges();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RouterState::_internal_mutable_prev_edges() {
+  return &_impl_.prev_edges_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+RouterState::mutable_prev_edges() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RouterState.prev_edges)
+  return _internal_mutable_prev_edges();
+}
+
+// repeated float weights = 4;
+inline int RouterState::_internal_weights_size() const {
+  return _impl_.weights_.size();
+}
+inline int RouterState::weights_size() const {
+  return _internal_weights_size();
+}
+inline void RouterState::clear_weights() {
+  _impl_.weights_.Clear();
+}
+inline float RouterState::_internal_weights(int index) const {
+  return _impl_.weights_.Get(index);
+}
+inline float RouterState::weights(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.RouterState.weights)
+  return _internal_weights(index);
+}
+inline void RouterState::set_weights(int index, float value) {
+  _impl_.weights_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.RouterState.weights)
+}
+inline void RouterState::_internal_add_weights(float value) {
+  _impl_.weights_.Add(value);
+}
+inline void RouterState::add_weights(float value) {
+  _internal_add_weights(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.RouterState.weights)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+RouterState::_internal_weights() const {
+  return _impl_.weights_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >&
+RouterState::weights() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.RouterState.weights)
+  return _internal_weights();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+RouterState::_internal_mutable_weights() {
+  return &_impl_.weights_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< float >*
+RouterState::mutable_weights() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.RouterState.weights)
+  return _internal_mutable_weights();
+}
+
+// -------------------------------------------------------------------
+
+// LandmarkTables
+
+// repeated uint32 landmarks = 1;
+inline int LandmarkTables::_internal_landmarks_size() const {
+  return _impl_.landmarks_.size();
+}
+inline int LandmarkTables::landmarks_size() const {
+  return _internal_landmarks_size();
+}
+inline void LandmarkTables::clear_landmarks() {
+  _impl_.landmarks_.Clear();
+}
+inline uint32_t LandmarkTables::_internal_landmarks(int index) const {
+  return _impl_.landmarks_.Get(index);
+}
+inline uint32_t LandmarkTables::landmarks(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.LandmarkTables.landmarks)
+  return _internal_landmarks(index);
+}
+inline void LandmarkTables::set_landmarks(int index, uint32_t value) {
+  _impl_.landmarks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.LandmarkTables.landmarks)
+}
+inline void LandmarkTables::_internal_add_landmarks(uint32_t value) {
+  _impl_.landmarks_.Add(value);
+}
+inline void LandmarkTables::add_landmarks(uint32_t value) {
+  _internal_add_landmarks(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.LandmarkTables.landmarks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LandmarkTables::_internal_landmarks() const {
+  return _impl_.landmarks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+LandmarkTables::landmarks() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.LandmarkTables.landmarks)
+  return _internal_landmarks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LandmarkTables::_internal_mutable_landmarks() {
+  return &_impl_.landmarks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+LandmarkTables::mutable_landmarks() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.LandmarkTables.landmarks)
+  return _internal_mutable_landmarks();
+}
+
+// repeated double from_landmarks = 2;
+inline int LandmarkTables::_internal_from_landmarks_size() const {
+  return _impl_.from_landmarks_.size();
+}
+inline int LandmarkTables::from_landmarks_size() const {
+  return _internal_from_landmarks_size();
+}
+inline void LandmarkTables::clear_from_landmarks() {
+  _impl_.from_landmarks_.Clear();
+}
+inline double LandmarkTables::_internal_from_landmarks(int index) const {
+  return _impl_.from_landmarks_.Get(index);
+}
+inline double LandmarkTables::from_landmarks(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.LandmarkTables.from_landmarks)
+  return _internal_from_landmarks(index);
+}
+inline void LandmarkTables::set_from_landmarks(int index, double value) {
+  _impl_.from_landmarks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.LandmarkTables.from_landmarks)
+}
+inline void LandmarkTables::_internal_add_from_landmarks(double value) {
+  _impl_.from_landmarks_.Add(value);
+}
+inline void LandmarkTables::add_from_landmarks(double value) {
+  _internal_add_from_landmarks(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.LandmarkTables.from_landmarks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+LandmarkTables::_internal_from_landmarks() const {
+  return _impl_.from_landmarks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+LandmarkTables::from_landmarks() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.LandmarkTables.from_landmarks)
+  return _internal_from_landmarks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+LandmarkTables::_internal_mutable_from_landmarks() {
+  return &_impl_.from_landmarks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+LandmarkTables::mutable_from_landmarks() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.LandmarkTables.from_landmarks)
+  return _internal_mutable_from_landmarks();
+}
+
+// repeated double to_landmarks = 3;
+inline int LandmarkTables::_internal_to_landmarks_size() const {
+  return _impl_.to_landmarks_.size();
+}
+inline int LandmarkTables::to_landmarks_size() const {
+  return _internal_to_landmarks_size();
+}
+inline void LandmarkTables::clear_to_landmarks() {
+  _impl_.to_landmarks_.Clear();
+}
+inline double LandmarkTables::_internal_to_landmarks(int index) const {
+  return _impl_.to_landmarks_.Get(index);
+}
+inline double LandmarkTables::to_landmarks(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.LandmarkTables.to_landmarks)
+  return _internal_to_landmarks(index);
+}
+inline void LandmarkTables::set_to_landmarks(int index, double value) {
+  _impl_.to_landmarks_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.LandmarkTables.to_landmarks)
+}
+inline void LandmarkTables::_internal_add_to_landmarks(double value) {
+  _impl_.to_landmarks_.Add(value);
+}
+inline void LandmarkTables::add_to_landmarks(double value) {
+  _internal_add_to_landmarks(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.LandmarkTables.to_landmarks)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+LandmarkTables::_internal_to_landmarks() const {
+  return _impl_.to_landmarks_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >&
+LandmarkTables::to_landmarks() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.LandmarkTables.to_landmarks)
+  return _internal_to_landmarks();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+LandmarkTables::_internal_mutable_to_landmarks() {
+  return &_impl_.to_landmarks_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< double >*
+LandmarkTables::mutable_to_landmarks() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.LandmarkTables.to_landmarks)
+  return _internal_mutable_to_landmarks();
+}
+
+// -------------------------------------------------------------------
+
+// ReachabilityIndex
+
+// repeated uint32 components = 1;
+inline int ReachabilityIndex::_internal_components_size() const {
+  return _impl_.components_.size();
+}
+inline int ReachabilityIndex::components_size() const {
+  return _internal_components_size();
+}
+inline void ReachabilityIndex::clear_components() {
+  _impl_.components_.Clear();
+}
+inline uint32_t ReachabilityIndex::_internal_components(int index) const {
+  return _impl_.components_.Get(index);
+}
+inline uint32_t ReachabilityIndex::components(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.ReachabilityIndex.components)
+  return _internal_components(index);
+}
+inline void ReachabilityIndex::set_components(int index, uint32_t value) {
+  _impl_.components_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.ReachabilityIndex.components)
+}
+inline void ReachabilityIndex::_internal_add_components(uint32_t value) {
+  _impl_.components_.Add(value);
+}
+inline void ReachabilityIndex::add_components(uint32_t value) {
+  _internal_add_components(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.ReachabilityIndex.components)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReachabilityIndex::_internal_components() const {
+  return _impl_.components_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReachabilityIndex::components() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.ReachabilityIndex.components)
+  return _internal_components();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReachabilityIndex::_internal_mutable_components() {
+  return &_impl_.components_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReachabilityIndex::mutable_components() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.ReachabilityIndex.components)
+  return _internal_mutable_components();
+}
+
+// repeated uint32 weak_components = 2;
+inline int ReachabilityIndex::_internal_weak_components_size() const {
+  return _impl_.weak_components_.size();
+}
+inline int ReachabilityIndex::weak_components_size() const {
+  return _internal_weak_components_size();
+}
+inline void ReachabilityIndex::clear_weak_components() {
+  _impl_.weak_components_.Clear();
+}
+inline uint32_t ReachabilityIndex::_internal_weak_components(int index) const {
+  return _impl_.weak_components_.Get(index);
+}
+inline uint32_t ReachabilityIndex::weak_components(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.ReachabilityIndex.weak_components)
+  return _internal_weak_components(index);
+}
+inline void ReachabilityIndex::set_weak_components(int index, uint32_t value) {
+  _impl_.weak_components_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.ReachabilityIndex.weak_components)
+}
+inline void ReachabilityIndex::_internal_add_weak_components(uint32_t value) {
+  _impl_.weak_components_.Add(value);
+}
+inline void ReachabilityIndex::add_weak_components(uint32_t value) {
+  _internal_add_weak_components(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.ReachabilityIndex.weak_components)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReachabilityIndex::_internal_weak_components() const {
+  return _impl_.weak_components_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+ReachabilityIndex::weak_components() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.ReachabilityIndex.weak_components)
+  return _internal_weak_components();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReachabilityIndex::_internal_mutable_weak_components() {
+  return &_impl_.weak_components_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+ReachabilityIndex::mutable_weak_components() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.ReachabilityIndex.weak_components)
+  return _internal_mutable_weak_components();
+}
+
+// -------------------------------------------------------------------
+
+// Router
+
+// .proto_schema.graph.RoutingGraph graph = 1;
+inline bool Router::_internal_has_graph() const {
+  return this != internal_default_instance() && _impl_.graph_ != nullptr;
+}
+inline bool Router::has_graph() const {
+  return _internal_has_graph();
+}
+inline const ::proto_schema::graph::RoutingGraph& Router::_internal_graph() const {
+  const ::proto_schema::graph::RoutingGraph* p = _impl_.graph_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::graph::RoutingGraph&>(
+      ::proto_schema::graph::_RoutingGraph_default_instance_);
+}
+inline const ::proto_schema::graph::RoutingGraph& Router::graph() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.graph)
+  return _internal_graph();
+}
+inline void Router::unsafe_arena_set_allocated_graph(
+    ::proto_schema::graph::RoutingGraph* graph) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.graph_);
+  }
+  _impl_.graph_ = graph;
+  if (graph) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.router.Router.graph)
+}
+inline ::proto_schema::graph::RoutingGraph* Router::release_graph() {
+  
+  ::proto_schema::graph::RoutingGraph* temp = _impl_.graph_;
+  _impl_.graph_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::graph::RoutingGraph* Router::unsafe_arena_release_graph() {
+  // @@protoc_insertion_point(field_release:proto_schema.router.Router.graph)
+  
+  ::proto_schema::graph::RoutingGraph* temp = _impl_.graph_;
+  _impl_.graph_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::graph::RoutingGraph* Router::_internal_mutable_graph() {
+  
+  if (_impl_.graph_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::graph::RoutingGraph>(GetArenaForAllocation());
+    _impl_.graph_ = p;
+  }
+  return _impl_.graph_;
+}
+inline ::proto_schema::graph::RoutingGraph* Router::mutable_graph() {
+  ::proto_schema::graph::RoutingGraph* _msg = _internal_mutable_graph();
+  // @@protoc_insertion_point(field_mutable:proto_schema.router.Router.graph)
+  return _msg;
+}
+inline void Router::set_allocated_graph(::proto_schema::graph::RoutingGraph* graph) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.graph_);
+  }
+  if (graph) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(graph));
+    if (message_arena != submessage_arena) {
+      graph = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, graph, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.graph_ = graph;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.router.Router.graph)
+}
+
+// .proto_schema.router.RouterState state = 3;
+inline bool Router::_internal_has_state() const {
+  return this != internal_default_instance() && _impl_.state_ != nullptr;
+}
+inline bool Router::has_state() const {
+  return _internal_has_state();
+}
+inline void Router::clear_state() {
+  if (GetArenaForAllocation() == nullptr && _impl_.state_ != nullptr) {
+    delete _impl_.state_;
+  }
+  _impl_.state_ = nullptr;
+}
+inline const ::proto_schema::router::RouterState& Router::_internal_state() const {
+  const ::proto_schema::router::RouterState* p = _impl_.state_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::router::RouterState&>(
+      ::proto_schema::router::_RouterState_default_instance_);
+}
+inline const ::proto_schema::router::RouterState& Router::state() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.state)
+  return _internal_state();
+}
+inline void Router::unsafe_arena_set_allocated_state(
+    ::proto_schema::router::RouterState* state) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.state_);
+  }
+  _impl_.state_ = state;
+  if (state) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.router.Router.state)
+}
+inline ::proto_schema::router::RouterState* Router::release_state() {
+  
+  ::proto_schema::router::RouterState* temp = _impl_.state_;
+  _impl_.state_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::router::RouterState* Router::unsafe_arena_release_state() {
+  // @@protoc_insertion_point(field_release:proto_schema.router.Router.state)
+  
+  ::proto_schema::router::RouterState* temp = _impl_.state_;
+  _impl_.state_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::router::RouterState* Router::_internal_mutable_state() {
+  
+  if (_impl_.state_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::router::RouterState>(GetArenaForAllocation());
+    _impl_.state_ = p;
+  }
+  return _impl_.state_;
+}
+inline ::proto_schema::router::RouterState* Router::mutable_state() {
+  ::proto_schema::router::RouterState* _msg = _internal_mutable_state();
+  // @@protoc_insertion_point(field_mutable:proto_schema.router.Router.state)
+  return _msg;
+}
+inline void Router::set_allocated_state(::proto_schema::router::RouterState* state) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.state_;
+  }
+  if (state) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(state);
+    if (message_arena != submessage_arena) {
+      state = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, state, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.state_ = state;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.router.Router.state)
+}
+
+// .proto_schema.graph.ContractionHierarchy hierarchy = 4;
+inline bool Router::_internal_has_hierarchy() const {
+  return this != internal_default_instance() && _impl_.hierarchy_ != nullptr;
+}
+inline bool Router::has_hierarchy() const {
+  return _internal_has_hierarchy();
+}
+inline const ::proto_schema::graph::ContractionHierarchy& Router::_internal_hierarchy() const {
+  const ::proto_schema::graph::ContractionHierarchy* p = _impl_.hierarchy_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::graph::ContractionHierarchy&>(
+      ::proto_schema::graph::_ContractionHierarchy_default_instance_);
+}
+inline const ::proto_schema::graph::ContractionHierarchy& Router::hierarchy() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.hierarchy)
+  return _internal_hierarchy();
+}
+inline void Router::unsafe_arena_set_allocated_hierarchy(
+    ::proto_schema::graph::ContractionHierarchy* hierarchy) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hierarchy_);
+  }
+  _impl_.hierarchy_ = hierarchy;
+  if (hierarchy) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.router.Router.hierarchy)
+}
+inline ::proto_schema::graph::ContractionHierarchy* Router::release_hierarchy() {
+  
+  ::proto_schema::graph::ContractionHierarchy* temp = _impl_.hierarchy_;
+  _impl_.hierarchy_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::graph::ContractionHierarchy* Router::unsafe_arena_release_hierarchy() {
+  // @@protoc_insertion_point(field_release:proto_schema.router.Router.hierarchy)
+  
+  ::proto_schema::graph::ContractionHierarchy* temp = _impl_.hierarchy_;
+  _impl_.hierarchy_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::graph::ContractionHierarchy* Router::_internal_mutable_hierarchy() {
+  
+  if (_impl_.hierarchy_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::graph::ContractionHierarchy>(GetArenaForAllocation());
+    _impl_.hierarchy_ = p;
+  }
+  return _impl_.hierarchy_;
+}
+inline ::proto_schema::graph::ContractionHierarchy* Router::mutable_hierarchy() {
+  ::proto_schema::graph::ContractionHierarchy* _msg = _internal_mutable_hierarchy();
+  // @@protoc_insertion_point(field_mutable:proto_schema.router.Router.hierarchy)
+  return _msg;
+}
+inline void Router::set_allocated_hierarchy(::proto_schema::graph::ContractionHierarchy* hierarchy) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.hierarchy_);
+  }
+  if (hierarchy) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(hierarchy));
+    if (message_arena != submessage_arena) {
+      hierarchy = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hierarchy, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.hierarchy_ = hierarchy;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.router.Router.hierarchy)
+}
+
+// .proto_schema.router.LandmarkTables landmarks = 5;
+inline bool Router::_internal_has_landmarks() const {
+  return this != internal_default_instance() && _impl_.landmarks_ != nullptr;
+}
+inline bool Router::has_landmarks() const {
+  return _internal_has_landmarks();
+}
+inline void Router::clear_landmarks() {
+  if (GetArenaForAllocation() == nullptr && _impl_.landmarks_ != nullptr) {
+    delete _impl_.landmarks_;
+  }
+  _impl_.landmarks_ = nullptr;
+}
+inline const ::proto_schema::router::LandmarkTables& Router::_internal_landmarks() const {
+  const ::proto_schema::router::LandmarkTables* p = _impl_.landmarks_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::router::LandmarkTables&>(
+      ::proto_schema::router::_LandmarkTables_default_instance_);
+}
+inline const ::proto_schema::router::LandmarkTables& Router::landmarks() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.landmarks)
+  return _internal_landmarks();
+}
+inline void Router::unsafe_arena_set_allocated_landmarks(
+    ::proto_schema::router::LandmarkTables* landmarks) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.landmarks_);
+  }
+  _impl_.landmarks_ = landmarks;
+  if (landmarks) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.router.Router.landmarks)
+}
+inline ::proto_schema::router::LandmarkTables* Router::release_landmarks() {
+  
+  ::proto_schema::router::LandmarkTables* temp = _impl_.landmarks_;
+  _impl_.landmarks_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::router::LandmarkTables* Router::unsafe_arena_release_landmarks() {
+  // @@protoc_insertion_point(field_release:proto_schema.router.Router.landmarks)
+  
+  ::proto_schema::router::LandmarkTables* temp = _impl_.landmarks_;
+  _impl_.landmarks_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::router::LandmarkTables* Router::_internal_mutable_landmarks() {
+  
+  if (_impl_.landmarks_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::router::LandmarkTables>(GetArenaForAllocation());
+    _impl_.landmarks_ = p;
+  }
+  return _impl_.landmarks_;
+}
+inline ::proto_schema::router::LandmarkTables* Router::mutable_landmarks() {
+  ::proto_schema::router::LandmarkTables* _msg = _internal_mutable_landmarks();
+  // @@protoc_insertion_point(field_mutable:proto_schema.router.Router.landmarks)
+  return _msg;
+}
+inline void Router::set_allocated_landmarks(::proto_schema::router::LandmarkTables* landmarks) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.landmarks_;
+  }
+  if (landmarks) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(landmarks);
+    if (message_arena != submessage_arena) {
+      landmarks = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, landmarks, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.landmarks_ = landmarks;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.router.Router.landmarks)
+}
+
+// .proto_schema.router.RoutingItems routing_items = 6;
+inline bool Router::_internal_has_routing_items() const {
+  return this != internal_default_instance() && _impl_.routing_items_ != nullptr;
+}
+inline bool Router::has_routing_items() const {
+  return _internal_has_routing_items();
+}
+inline void Router::clear_routing_items() {
+  if (GetArenaForAllocation() == nullptr && _impl_.routing_items_ != nullptr) {
+    delete _impl_.routing_items_;
+  }
+  _impl_.routing_items_ = nullptr;
+}
+inline const ::proto_schema::router::RoutingItems& Router::_internal_routing_items() const {
+  const ::proto_schema::router::RoutingItems* p = _impl_.routing_items_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::router::RoutingItems&>(
+      ::proto_schema::router::_RoutingItems_default_instance_);
+}
+inline const ::proto_schema::router::RoutingItems& Router::routing_items() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.routing_items)
+  return _internal_routing_items();
+}
+inline void Router::unsafe_arena_set_allocated_routing_items(
+    ::proto_schema::router::RoutingItems* routing_items) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routing_items_);
+  }
+  _impl_.routing_items_ = routing_items;
+  if (routing_items) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.router.Router.routing_items)
+}
+inline ::proto_schema::router::RoutingItems* Router::release_routing_items() {
+  
+  ::proto_schema::router::RoutingItems* temp = _impl_.routing_items_;
+  _impl_.routing_items_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::router::RoutingItems* Router::unsafe_arena_release_routing_items() {
+  // @@protoc_insertion_point(field_release:proto_schema.router.Router.routing_items)
+  
+  ::proto_schema::router::RoutingItems* temp = _impl_.routing_items_;
+  _impl_.routing_items_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::router::RoutingItems* Router::_internal_mutable_routing_items() {
+  
+  if (_impl_.routing_items_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::router::RoutingItems>(GetArenaForAllocation());
+    _impl_.routing_items_ = p;
+  }
+  return _impl_.routing_items_;
+}
+inline ::proto_schema::router::RoutingItems* Router::mutable_routing_items() {
+  ::proto_schema::router::RoutingItems* _msg = _internal_mutable_routing_items();
+  // @@protoc_insertion_point(field_mutable:proto_schema.router.Router.routing_items)
+  return _msg;
+}
+inline void Router::set_allocated_routing_items(::proto_schema::router::RoutingItems* routing_items) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.routing_items_;
+  }
+  if (routing_items) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(routing_items);
+    if (message_arena != submessage_arena) {
+      routing_items = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, routing_items, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.routing_items_ = routing_items;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.router.Router.routing_items)
+}
+
+// repeated uint32 vertex_ids = 7;
+inline int Router::_internal_vertex_ids_size() const {
+  return _impl_.vertex_ids_.size();
+}
+inline int Router::vertex_ids_size() const {
+  return _internal_vertex_ids_size();
+}
+inline void Router::clear_vertex_ids() {
+  _impl_.vertex_ids_.Clear();
+}
+inline uint32_t Router::_internal_vertex_ids(int index) const {
+  return _impl_.vertex_ids_.Get(index);
+}
+inline uint32_t Router::vertex_ids(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.vertex_ids)
+  return _internal_vertex_ids(index);
+}
+inline void Router::set_vertex_ids(int index, uint32_t value) {
+  _impl_.vertex_ids_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.router.Router.vertex_ids)
+}
+inline void Router::_internal_add_vertex_ids(uint32_t value) {
+  _impl_.vertex_ids_.Add(value);
+}
+inline void Router::add_vertex_ids(uint32_t value) {
+  _internal_add_vertex_ids(value);
+  // @@protoc_insertion_point(field_add:proto_schema.router.Router.vertex_ids)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Router::_internal_vertex_ids() const {
+  return _impl_.vertex_ids_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Router::vertex_ids() const {
+  // @@protoc_insertion_point(field_list:proto_schema.router.Router.vertex_ids)
+  return _internal_vertex_ids();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Router::_internal_mutable_vertex_ids() {
+  return &_impl_.vertex_ids_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Router::mutable_vertex_ids() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.router.Router.vertex_ids)
+  return _internal_mutable_vertex_ids();
+}
+
+// .proto_schema.router.ReachabilityIndex reachability = 8;
+inline bool Router::_internal_has_reachability() const {
+  return this != internal_default_instance() && _impl_.reachability_ != nullptr;
+}
+inline bool Router::has_reachability() const {
+  return _internal_has_reachability();
+}
+inline void Router::clear_reachability() {
+  if (GetArenaForAllocation() == nullptr && _impl_.reachability_ != nullptr) {
+    delete _impl_.reachability_;
+  }
+  _impl_.reachability_ = nullptr;
+}
+inline const ::proto_schema::router::ReachabilityIndex& Router::_internal_reachability() const {
+  const ::proto_schema::router::ReachabilityIndex* p = _impl_.reachability_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::router::ReachabilityIndex&>(
+      ::proto_schema::router::_ReachabilityIndex_default_instance_);
+}
+inline const ::proto_schema::router::ReachabilityIndex& Router::reachability() const {
+  // @@protoc_insertion_point(field_get:proto_schema.router.Router.reachability)
+  return _internal_reachability();
+}
+inline void Router::unsafe_arena_set_allocated_reachability(
+    ::proto_schema::router::ReachabilityIndex* reachability) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.reachability_);
+  }
+  _impl_.reachability_ = reachability;
+  if (reachability) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.router.Router.reachability)
+}
+inline ::proto_schema::router::ReachabilityIndex* Router::release_reachability() {
+  
+  ::proto_schema::router::ReachabilityIndex* temp = _impl_.reachability_;
+  _impl_.reachability_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::router::ReachabilityIndex* Router::unsafe_arena_release_reachability() {
+  // @@protoc_insertion_point(field_release:proto_schema.router.Router.reachability)
+  
+  ::proto_schema::router::ReachabilityIndex* temp = _impl_.reachability_;
+  _impl_.reachability_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::router::ReachabilityIndex* Router::_internal_mutable_reachability() {
+  
+  if (_impl_.reachability_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::router::ReachabilityIndex>(GetArenaForAllocation());
+    _impl_.reachability_ = p;
+  }
+  return _impl_.reachability_;
+}
+inline ::proto_schema::router::ReachabilityIndex* Router::mutable_reachability() {
+  ::proto_schema::router::ReachabilityIndex* _msg = _internal_mutable_reachability();
+  // @@protoc_insertion_point(field_mutable:proto_schema.router.Router.reachability)
+  return _msg;
+}
+inline void Router::set_allocated_reachability(::proto_schema::router::ReachabilityIndex* reachability) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.reachability_;
+  }
+  if (reachability) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(reachability);
+    if (message_arena != submessage_arena) {
+      reachability = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, reachability, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.reachability_ = reachability;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.router.Router.reachability)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace router
+}  // namespace proto_schema
+
+PROTOBUF_NAMESPACE_OPEN
+
+template <> struct is_proto_enum< ::proto_schema::router::RouterType> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto_schema::router::RouterType>() {
+  return ::proto_schema::router::RouterType_descriptor();
+}
+template <> struct is_proto_enum< ::proto_schema::router::VertexOrder> : ::std::true_type {};
+template <>
+inline const EnumDescriptor* GetEnumDescriptor< ::proto_schema::router::VertexOrder>() {
+  return ::proto_schema::router::VertexOrder_descriptor();
+}
+
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transport_5frouter_2eproto
@@ -0,0 +1,59 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/transport_catalogue.dir/domain.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/domain.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/geo.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/geo.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/graph.pb.cc.o"
+  "CMakeFiles/transport_catalogue.dir/graph.pb.cc.o.d"
+  "CMakeFiles/transport_catalogue.dir/input_reader.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/input_reader.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/json.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/json.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/json_builder.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/json_builder.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/json_reader.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/json_reader.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/main.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/main.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/map_renderer.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/map_renderer.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/map_renderer.pb.cc.o"
+  "CMakeFiles/transport_catalogue.dir/map_renderer.pb.cc.o.d"
+  "CMakeFiles/transport_catalogue.dir/raptor_router.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/raptor_router.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/request_handler.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/request_handler.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/serialization.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/serialization.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/stat_reader.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/stat_reader.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/svg.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/svg.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/svg.pb.cc.o"
+  "CMakeFiles/transport_catalogue.dir/svg.pb.cc.o.d"
+  "CMakeFiles/transport_catalogue.dir/transport_catalogue.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/transport_catalogue.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/transport_catalogue.pb.cc.o"
+  "CMakeFiles/transport_catalogue.dir/transport_catalogue.pb.cc.o.d"
+  "CMakeFiles/transport_catalogue.dir/transport_router.cpp.o"
+  "CMakeFiles/transport_catalogue.dir/transport_router.cpp.o.d"
+  "CMakeFiles/transport_catalogue.dir/transport_router.pb.cc.o"
+  "CMakeFiles/transport_catalogue.dir/transport_router.pb.cc.o.d"
+  "graph.pb.cc"
+  "graph.pb.h"
+  "map_renderer.pb.cc"
+  "map_renderer.pb.h"
+  "svg.pb.cc"
+  "svg.pb.h"
+  "transport_catalogue"
+  "transport_catalogue.pb.cc"
+  "transport_catalogue.pb.h"
+  "transport_catalogue.pdb"
+  "transport_router.pb.cc"
+  "transport_router.pb.h"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang CXX)
+  include(CMakeFiles/transport_catalogue.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,1863 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: map_renderer.proto
+
+#include "map_renderer.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace proto_schema {
+namespace maps {
+PROTOBUF_CONSTEXPR Offset::Offset(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.north_)*/0
+  , /*decltype(_impl_.east_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct OffsetDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR OffsetDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~OffsetDefaultTypeInternal() {}
+  union {
+    Offset _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 OffsetDefaultTypeInternal _Offset_default_instance_;
+PROTOBUF_CONSTEXPR Label::Label(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.offset_)*/nullptr
+  , /*decltype(_impl_.font_size_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct LabelDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR LabelDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~LabelDefaultTypeInternal() {}
+  union {
+    Label _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 LabelDefaultTypeInternal _Label_default_instance_;
+PROTOBUF_CONSTEXPR Container::Container(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.width_)*/0
+  , /*decltype(_impl_.height_)*/0
+  , /*decltype(_impl_.padding_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ContainerDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ContainerDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ContainerDefaultTypeInternal() {}
+  union {
+    Container _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ContainerDefaultTypeInternal _Container_default_instance_;
+PROTOBUF_CONSTEXPR Decoration::Decoration(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.underlayer_color_)*/nullptr
+  , /*decltype(_impl_.line_width_)*/0
+  , /*decltype(_impl_.stop_marker_radius_)*/0
+  , /*decltype(_impl_.underlayer_width_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DecorationDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DecorationDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DecorationDefaultTypeInternal() {}
+  union {
+    Decoration _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DecorationDefaultTypeInternal _Decoration_default_instance_;
+PROTOBUF_CONSTEXPR ColorPalette::ColorPalette(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.color_palette_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct ColorPaletteDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR ColorPaletteDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~ColorPaletteDefaultTypeInternal() {}
+  union {
+    ColorPalette _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 ColorPaletteDefaultTypeInternal _ColorPalette_default_instance_;
+PROTOBUF_CONSTEXPR RenderSettings::RenderSettings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.container_)*/nullptr
+  , /*decltype(_impl_.bus_label_)*/nullptr
+  , /*decltype(_impl_.stop_label_)*/nullptr
+  , /*decltype(_impl_.decoration_)*/nullptr
+  , /*decltype(_impl_.color_palette_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct RenderSettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR RenderSettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~RenderSettingsDefaultTypeInternal() {}
+  union {
+    RenderSettings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 RenderSettingsDefaultTypeInternal _RenderSettings_default_instance_;
+}  // namespace maps
+}  // namespace proto_schema
+static ::_pb::Metadata file_level_metadata_map_5frenderer_2eproto[6];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_map_5frenderer_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_map_5frenderer_2eproto = nullptr;
+
+const uint32_t TableStruct_map_5frenderer_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Offset, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Offset, _impl_.north_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Offset, _impl_.east_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Label, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Label, _impl_.offset_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Label, _impl_.font_size_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Container, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Container, _impl_.width_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Container, _impl_.height_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Container, _impl_.padding_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Decoration, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Decoration, _impl_.line_width_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Decoration, _impl_.stop_marker_radius_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Decoration, _impl_.underlayer_color_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::Decoration, _impl_.underlayer_width_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::ColorPalette, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::ColorPalette, _impl_.color_palette_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::RenderSettings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::RenderSettings, _impl_.container_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::RenderSettings, _impl_.bus_label_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::RenderSettings, _impl_.stop_label_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::RenderSettings, _impl_.decoration_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::maps::RenderSettings, _impl_.color_palette_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::proto_schema::maps::Offset)},
+  { 8, -1, -1, sizeof(::proto_schema::maps::Label)},
+  { 16, -1, -1, sizeof(::proto_schema::maps::Container)},
+  { 25, -1, -1, sizeof(::proto_schema::maps::Decoration)},
+  { 35, -1, -1, sizeof(::proto_schema::maps::ColorPalette)},
+  { 42, -1, -1, sizeof(::proto_schema::maps::RenderSettings)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto_schema::maps::_Offset_default_instance_._instance,
+  &::proto_schema::maps::_Label_default_instance_._instance,
+  &::proto_schema::maps::_Container_default_instance_._instance,
+  &::proto_schema::maps::_Decoration_default_instance_._instance,
+  &::proto_schema::maps::_ColorPalette_default_instance_._instance,
+  &::proto_schema::maps::_RenderSettings_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_map_5frenderer_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\022map_renderer.proto\022\021proto_schema.maps\032"
+  "\tsvg.proto\"%\n\006Offset\022\r\n\005north\030\001 \001(\001\022\014\n\004e"
+  "ast\030\002 \001(\001\"E\n\005Label\022)\n\006offset\030\001 \001(\0132\031.pro"
+  "to_schema.maps.Offset\022\021\n\tfont_size\030\002 \001(\005"
+  "\";\n\tContainer\022\r\n\005width\030\001 \001(\001\022\016\n\006height\030\002"
+  " \001(\001\022\017\n\007padding\030\003 \001(\001\"\211\001\n\nDecoration\022\022\n\n"
+  "line_width\030\001 \001(\001\022\032\n\022stop_marker_radius\030\002"
+  " \001(\001\0221\n\020underlayer_color\030\003 \001(\0132\027.proto_s"
+  "chema.svg.Color\022\030\n\020underlayer_width\030\004 \001("
+  "\001\">\n\014ColorPalette\022.\n\rcolor_palette\030\001 \003(\013"
+  "2\027.proto_schema.svg.Color\"\207\002\n\016RenderSett"
+  "ings\022/\n\tcontainer\030\001 \001(\0132\034.proto_schema.m"
+  "aps.Container\022+\n\tbus_label\030\002 \001(\0132\030.proto"
+  "_schema.maps.Label\022,\n\nstop_label\030\003 \001(\0132\030"
+  ".proto_schema.maps.Label\0221\n\ndecoration\030\004"
+  " \001(\0132\035.proto_schema.maps.Decoration\0226\n\rc"
+  "olor_palette\030\005 \001(\0132\037.proto_schema.maps.C"
+  "olorPaletteb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_map_5frenderer_2eproto_deps[1] = {
+  &::descriptor_table_svg_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_map_5frenderer_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_map_5frenderer_2eproto = {
+    false, false, 699, descriptor_table_protodef_map_5frenderer_2eproto,
+    "map_renderer.proto",
+    &descriptor_table_map_5frenderer_2eproto_once, descriptor_table_map_5frenderer_2eproto_deps, 1, 6,
+    schemas, file_default_instances, TableStruct_map_5frenderer_2eproto::offsets,
+    file_level_metadata_map_5frenderer_2eproto, file_level_enum_descriptors_map_5frenderer_2eproto,
+    file_level_service_descriptors_map_5frenderer_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_map_5frenderer_2eproto_getter() {
+  return &descriptor_table_map_5frenderer_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_map_5frenderer_2eproto(&descriptor_table_map_5frenderer_2eproto);
+namespace proto_schema {
+namespace maps {
+
+// ===================================================================
+
+class Offset::_Internal {
+ public:
+};
+
+Offset::Offset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.maps.Offset)
+}
+Offset::Offset(const Offset& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Offset* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.north_){}
+    , decltype(_impl_.east_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.north_, &from._impl_.north_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.east_) -
+    reinterpret_cast<char*>(&_impl_.north_)) + sizeof(_impl_.east_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.maps.Offset)
+}
+
+inline void Offset::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.north_){0}
+    , decltype(_impl_.east_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Offset::~Offset() {
+  // @@protoc_insertion_point(destructor:proto_schema.maps.Offset)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Offset::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Offset::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Offset::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.maps.Offset)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.north_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.east_) -
+      reinterpret_cast<char*>(&_impl_.north_)) + sizeof(_impl_.east_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Offset::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double north = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.north_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double east = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.east_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Offset::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.maps.Offset)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double north = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_north = this->_internal_north();
+  uint64_t raw_north;
+  memcpy(&raw_north, &tmp_north, sizeof(tmp_north));
+  if (raw_north != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_north(), target);
+  }
+
+  // double east = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_east = this->_internal_east();
+  uint64_t raw_east;
+  memcpy(&raw_east, &tmp_east, sizeof(tmp_east));
+  if (raw_east != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_east(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.maps.Offset)
+  return target;
+}
+
+size_t Offset::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.maps.Offset)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double north = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_north = this->_internal_north();
+  uint64_t raw_north;
+  memcpy(&raw_north, &tmp_north, sizeof(tmp_north));
+  if (raw_north != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double east = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_east = this->_internal_east();
+  uint64_t raw_east;
+  memcpy(&raw_east, &tmp_east, sizeof(tmp_east));
+  if (raw_east != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Offset::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Offset::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Offset::GetClassData() const { return &_class_data_; }
+
+
+void Offset::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Offset*>(&to_msg);
+  auto& from = static_cast<const Offset&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.maps.Offset)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_north = from._internal_north();
+  uint64_t raw_north;
+  memcpy(&raw_north, &tmp_north, sizeof(tmp_north));
+  if (raw_north != 0) {
+    _this->_internal_set_north(from._internal_north());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_east = from._internal_east();
+  uint64_t raw_east;
+  memcpy(&raw_east, &tmp_east, sizeof(tmp_east));
+  if (raw_east != 0) {
+    _this->_internal_set_east(from._internal_east());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Offset::CopyFrom(const Offset& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.maps.Offset)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Offset::IsInitialized() const {
+  return true;
+}
+
+void Offset::InternalSwap(Offset* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Offset, _impl_.east_)
+      + sizeof(Offset::_impl_.east_)
+      - PROTOBUF_FIELD_OFFSET(Offset, _impl_.north_)>(
+          reinterpret_cast<char*>(&_impl_.north_),
+          reinterpret_cast<char*>(&other->_impl_.north_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Offset::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
+      file_level_metadata_map_5frenderer_2eproto[0]);
+}
+
+// ===================================================================
+
+class Label::_Internal {
+ public:
+  static const ::proto_schema::maps::Offset& offset(const Label* msg);
+};
+
+const ::proto_schema::maps::Offset&
+Label::_Internal::offset(const Label* msg) {
+  return *msg->_impl_.offset_;
+}
+Label::Label(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.maps.Label)
+}
+Label::Label(const Label& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Label* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){nullptr}
+    , decltype(_impl_.font_size_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_offset()) {
+    _this->_impl_.offset_ = new ::proto_schema::maps::Offset(*from._impl_.offset_);
+  }
+  _this->_impl_.font_size_ = from._impl_.font_size_;
+  // @@protoc_insertion_point(copy_constructor:proto_schema.maps.Label)
+}
+
+inline void Label::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.offset_){nullptr}
+    , decltype(_impl_.font_size_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Label::~Label() {
+  // @@protoc_insertion_point(destructor:proto_schema.maps.Label)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Label::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.offset_;
+}
+
+void Label::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Label::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.maps.Label)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.offset_ != nullptr) {
+    delete _impl_.offset_;
+  }
+  _impl_.offset_ = nullptr;
+  _impl_.font_size_ = 0;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Label::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.maps.Offset offset = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_offset(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // int32 font_size = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.font_size_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Label::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.maps.Label)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.maps.Offset offset = 1;
+  if (this->_internal_has_offset()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::offset(this),
+        _Internal::offset(this).GetCachedSize(), target, stream);
+  }
+
+  // int32 font_size = 2;
+  if (this->_internal_font_size() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteInt32ToArray(2, this->_internal_font_size(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.maps.Label)
+  return target;
+}
+
+size_t Label::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.maps.Label)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_schema.maps.Offset offset = 1;
+  if (this->_internal_has_offset()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.offset_);
+  }
+
+  // int32 font_size = 2;
+  if (this->_internal_font_size() != 0) {
+    total_size += ::_pbi::WireFormatLite::Int32SizePlusOne(this->_internal_font_size());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Label::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Label::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Label::GetClassData() const { return &_class_data_; }
+
+
+void Label::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Label*>(&to_msg);
+  auto& from = static_cast<const Label&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.maps.Label)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_offset()) {
+    _this->_internal_mutable_offset()->::proto_schema::maps::Offset::MergeFrom(
+        from._internal_offset());
+  }
+  if (from._internal_font_size() != 0) {
+    _this->_internal_set_font_size(from._internal_font_size());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Label::CopyFrom(const Label& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.maps.Label)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Label::IsInitialized() const {
+  return true;
+}
+
+void Label::InternalSwap(Label* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Label, _impl_.font_size_)
+      + sizeof(Label::_impl_.font_size_)
+      - PROTOBUF_FIELD_OFFSET(Label, _impl_.offset_)>(
+          reinterpret_cast<char*>(&_impl_.offset_),
+          reinterpret_cast<char*>(&other->_impl_.offset_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Label::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
+      file_level_metadata_map_5frenderer_2eproto[1]);
+}
+
+// ===================================================================
+
+class Container::_Internal {
+ public:
+};
+
+Container::Container(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.maps.Container)
+}
+Container::Container(const Container& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Container* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){}
+    , decltype(_impl_.height_){}
+    , decltype(_impl_.padding_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.width_, &from._impl_.width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.padding_) -
+    reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.padding_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.maps.Container)
+}
+
+inline void Container::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.width_){0}
+    , decltype(_impl_.height_){0}
+    , decltype(_impl_.padding_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Container::~Container() {
+  // @@protoc_insertion_point(destructor:proto_schema.maps.Container)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Container::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Container::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Container::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.maps.Container)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.padding_) -
+      reinterpret_cast<char*>(&_impl_.width_)) + sizeof(_impl_.padding_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Container::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double width = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double height = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.height_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double padding = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.padding_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Container::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.maps.Container)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double width = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_width = this->_internal_width();
+  uint64_t raw_width;
+  memcpy(&raw_width, &tmp_width, sizeof(tmp_width));
+  if (raw_width != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_width(), target);
+  }
+
+  // double height = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_height = this->_internal_height();
+  uint64_t raw_height;
+  memcpy(&raw_height, &tmp_height, sizeof(tmp_height));
+  if (raw_height != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_height(), target);
+  }
+
+  // double padding = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_padding = this->_internal_padding();
+  uint64_t raw_padding;
+  memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
+  if (raw_padding != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_padding(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.maps.Container)
+  return target;
+}
+
+size_t Container::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.maps.Container)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double width = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_width = this->_internal_width();
+  uint64_t raw_width;
+  memcpy(&raw_width, &tmp_width, sizeof(tmp_width));
+  if (raw_width != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double height = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_height = this->_internal_height();
+  uint64_t raw_height;
+  memcpy(&raw_height, &tmp_height, sizeof(tmp_height));
+  if (raw_height != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double padding = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_padding = this->_internal_padding();
+  uint64_t raw_padding;
+  memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
+  if (raw_padding != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Container::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Container::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Container::GetClassData() const { return &_class_data_; }
+
+
+void Container::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Container*>(&to_msg);
+  auto& from = static_cast<const Container&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.maps.Container)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_width = from._internal_width();
+  uint64_t raw_width;
+  memcpy(&raw_width, &tmp_width, sizeof(tmp_width));
+  if (raw_width != 0) {
+    _this->_internal_set_width(from._internal_width());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_height = from._internal_height();
+  uint64_t raw_height;
+  memcpy(&raw_height, &tmp_height, sizeof(tmp_height));
+  if (raw_height != 0) {
+    _this->_internal_set_height(from._internal_height());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_padding = from._internal_padding();
+  uint64_t raw_padding;
+  memcpy(&raw_padding, &tmp_padding, sizeof(tmp_padding));
+  if (raw_padding != 0) {
+    _this->_internal_set_padding(from._internal_padding());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Container::CopyFrom(const Container& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.maps.Container)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Container::IsInitialized() const {
+  return true;
+}
+
+void Container::InternalSwap(Container* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Container, _impl_.padding_)
+      + sizeof(Container::_impl_.padding_)
+      - PROTOBUF_FIELD_OFFSET(Container, _impl_.width_)>(
+          reinterpret_cast<char*>(&_impl_.width_),
+          reinterpret_cast<char*>(&other->_impl_.width_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Container::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
+      file_level_metadata_map_5frenderer_2eproto[2]);
+}
+
+// ===================================================================
+
+class Decoration::_Internal {
+ public:
+  static const ::proto_schema::svg::Color& underlayer_color(const Decoration* msg);
+};
+
+const ::proto_schema::svg::Color&
+Decoration::_Internal::underlayer_color(const Decoration* msg) {
+  return *msg->_impl_.underlayer_color_;
+}
+void Decoration::clear_underlayer_color() {
+  if (GetArenaForAllocation() == nullptr && _impl_.underlayer_color_ != nullptr) {
+    delete _impl_.underlayer_color_;
+  }
+  _impl_.underlayer_color_ = nullptr;
+}
+Decoration::Decoration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.maps.Decoration)
+}
+Decoration::Decoration(const Decoration& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Decoration* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.underlayer_color_){nullptr}
+    , decltype(_impl_.line_width_){}
+    , decltype(_impl_.stop_marker_radius_){}
+    , decltype(_impl_.underlayer_width_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_underlayer_color()) {
+    _this->_impl_.underlayer_color_ = new ::proto_schema::svg::Color(*from._impl_.underlayer_color_);
+  }
+  ::memcpy(&_impl_.line_width_, &from._impl_.line_width_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.underlayer_width_) -
+    reinterpret_cast<char*>(&_impl_.line_width_)) + sizeof(_impl_.underlayer_width_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.maps.Decoration)
+}
+
+inline void Decoration::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.underlayer_color_){nullptr}
+    , decltype(_impl_.line_width_){0}
+    , decltype(_impl_.stop_marker_radius_){0}
+    , decltype(_impl_.underlayer_width_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Decoration::~Decoration() {
+  // @@protoc_insertion_point(destructor:proto_schema.maps.Decoration)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Decoration::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.underlayer_color_;
+}
+
+void Decoration::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Decoration::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.maps.Decoration)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.underlayer_color_ != nullptr) {
+    delete _impl_.underlayer_color_;
+  }
+  _impl_.underlayer_color_ = nullptr;
+  ::memset(&_impl_.line_width_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.underlayer_width_) -
+      reinterpret_cast<char*>(&_impl_.line_width_)) + sizeof(_impl_.underlayer_width_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Decoration::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double line_width = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.line_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double stop_marker_radius = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.stop_marker_radius_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.svg.Color underlayer_color = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_underlayer_color(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double underlayer_width = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.underlayer_width_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Decoration::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.maps.Decoration)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double line_width = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_line_width = this->_internal_line_width();
+  uint64_t raw_line_width;
+  memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
+  if (raw_line_width != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_line_width(), target);
+  }
+
+  // double stop_marker_radius = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_marker_radius = this->_internal_stop_marker_radius();
+  uint64_t raw_stop_marker_radius;
+  memcpy(&raw_stop_marker_radius, &tmp_stop_marker_radius, sizeof(tmp_stop_marker_radius));
+  if (raw_stop_marker_radius != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_stop_marker_radius(), target);
+  }
+
+  // .proto_schema.svg.Color underlayer_color = 3;
+  if (this->_internal_has_underlayer_color()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::underlayer_color(this),
+        _Internal::underlayer_color(this).GetCachedSize(), target, stream);
+  }
+
+  // double underlayer_width = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_underlayer_width = this->_internal_underlayer_width();
+  uint64_t raw_underlayer_width;
+  memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
+  if (raw_underlayer_width != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_underlayer_width(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.maps.Decoration)
+  return target;
+}
+
+size_t Decoration::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.maps.Decoration)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_schema.svg.Color underlayer_color = 3;
+  if (this->_internal_has_underlayer_color()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.underlayer_color_);
+  }
+
+  // double line_width = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_line_width = this->_internal_line_width();
+  uint64_t raw_line_width;
+  memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
+  if (raw_line_width != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double stop_marker_radius = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_marker_radius = this->_internal_stop_marker_radius();
+  uint64_t raw_stop_marker_radius;
+  memcpy(&raw_stop_marker_radius, &tmp_stop_marker_radius, sizeof(tmp_stop_marker_radius));
+  if (raw_stop_marker_radius != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double underlayer_width = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_underlayer_width = this->_internal_underlayer_width();
+  uint64_t raw_underlayer_width;
+  memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
+  if (raw_underlayer_width != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Decoration::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Decoration::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Decoration::GetClassData() const { return &_class_data_; }
+
+
+void Decoration::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Decoration*>(&to_msg);
+  auto& from = static_cast<const Decoration&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.maps.Decoration)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_underlayer_color()) {
+    _this->_internal_mutable_underlayer_color()->::proto_schema::svg::Color::MergeFrom(
+        from._internal_underlayer_color());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_line_width = from._internal_line_width();
+  uint64_t raw_line_width;
+  memcpy(&raw_line_width, &tmp_line_width, sizeof(tmp_line_width));
+  if (raw_line_width != 0) {
+    _this->_internal_set_line_width(from._internal_line_width());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_stop_marker_radius = from._internal_stop_marker_radius();
+  uint64_t raw_stop_marker_radius;
+  memcpy(&raw_stop_marker_radius, &tmp_stop_marker_radius, sizeof(tmp_stop_marker_radius));
+  if (raw_stop_marker_radius != 0) {
+    _this->_internal_set_stop_marker_radius(from._internal_stop_marker_radius());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_underlayer_width = from._internal_underlayer_width();
+  uint64_t raw_underlayer_width;
+  memcpy(&raw_underlayer_width, &tmp_underlayer_width, sizeof(tmp_underlayer_width));
+  if (raw_underlayer_width != 0) {
+    _this->_internal_set_underlayer_width(from._internal_underlayer_width());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Decoration::CopyFrom(const Decoration& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.maps.Decoration)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Decoration::IsInitialized() const {
+  return true;
+}
+
+void Decoration::InternalSwap(Decoration* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Decoration, _impl_.underlayer_width_)
+      + sizeof(Decoration::_impl_.underlayer_width_)
+      - PROTOBUF_FIELD_OFFSET(Decoration, _impl_.underlayer_color_)>(
+          reinterpret_cast<char*>(&_impl_.underlayer_color_),
+          reinterpret_cast<char*>(&other->_impl_.underlayer_color_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Decoration::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
+      file_level_metadata_map_5frenderer_2eproto[3]);
+}
+
+// ===================================================================
+
+class ColorPalette::_Internal {
+ public:
+};
+
+void ColorPalette::clear_color_palette() {
+  _impl_.color_palette_.Clear();
+}
+ColorPalette::ColorPalette(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.maps.ColorPalette)
+}
+ColorPalette::ColorPalette(const ColorPalette& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  ColorPalette* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.color_palette_){from._impl_.color_palette_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.maps.ColorPalette)
+}
+
+inline void ColorPalette::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.color_palette_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+ColorPalette::~ColorPalette() {
+  // @@protoc_insertion_point(destructor:proto_schema.maps.ColorPalette)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void ColorPalette::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.color_palette_.~RepeatedPtrField();
+}
+
+void ColorPalette::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void ColorPalette::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.maps.ColorPalette)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.color_palette_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* ColorPalette::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto_schema.svg.Color color_palette = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_color_palette(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* ColorPalette::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.maps.ColorPalette)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.svg.Color color_palette = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_color_palette_size()); i < n; i++) {
+    const auto& repfield = this->_internal_color_palette(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.maps.ColorPalette)
+  return target;
+}
+
+size_t ColorPalette::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.maps.ColorPalette)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.svg.Color color_palette = 1;
+  total_size += 1UL * this->_internal_color_palette_size();
+  for (const auto& msg : this->_impl_.color_palette_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData ColorPalette::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    ColorPalette::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*ColorPalette::GetClassData() const { return &_class_data_; }
+
+
+void ColorPalette::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<ColorPalette*>(&to_msg);
+  auto& from = static_cast<const ColorPalette&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.maps.ColorPalette)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.color_palette_.MergeFrom(from._impl_.color_palette_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void ColorPalette::CopyFrom(const ColorPalette& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.maps.ColorPalette)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool ColorPalette::IsInitialized() const {
+  return true;
+}
+
+void ColorPalette::InternalSwap(ColorPalette* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.color_palette_.InternalSwap(&other->_impl_.color_palette_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata ColorPalette::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
+      file_level_metadata_map_5frenderer_2eproto[4]);
+}
+
+// ===================================================================
+
+class RenderSettings::_Internal {
+ public:
+  static const ::proto_schema::maps::Container& container(const RenderSettings* msg);
+  static const ::proto_schema::maps::Label& bus_label(const RenderSettings* msg);
+  static const ::proto_schema::maps::Label& stop_label(const RenderSettings* msg);
+  static const ::proto_schema::maps::Decoration& decoration(const RenderSettings* msg);
+  static const ::proto_schema::maps::ColorPalette& color_palette(const RenderSettings* msg);
+};
+
+const ::proto_schema::maps::Container&
+RenderSettings::_Internal::container(const RenderSettings* msg) {
+  return *msg->_impl_.container_;
+}
+const ::proto_schema::maps::Label&
+RenderSettings::_Internal::bus_label(const RenderSettings* msg) {
+  return *msg->_impl_.bus_label_;
+}
+const ::proto_schema::maps::Label&
+RenderSettings::_Internal::stop_label(const RenderSettings* msg) {
+  return *msg->_impl_.stop_label_;
+}
+const ::proto_schema::maps::Decoration&
+RenderSettings::_Internal::decoration(const RenderSettings* msg) {
+  return *msg->_impl_.decoration_;
+}
+const ::proto_schema::maps::ColorPalette&
+RenderSettings::_Internal::color_palette(const RenderSettings* msg) {
+  return *msg->_impl_.color_palette_;
+}
+RenderSettings::RenderSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.maps.RenderSettings)
+}
+RenderSettings::RenderSettings(const RenderSettings& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  RenderSettings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.container_){nullptr}
+    , decltype(_impl_.bus_label_){nullptr}
+    , decltype(_impl_.stop_label_){nullptr}
+    , decltype(_impl_.decoration_){nullptr}
+    , decltype(_impl_.color_palette_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_container()) {
+    _this->_impl_.container_ = new ::proto_schema::maps::Container(*from._impl_.container_);
+  }
+  if (from._internal_has_bus_label()) {
+    _this->_impl_.bus_label_ = new ::proto_schema::maps::Label(*from._impl_.bus_label_);
+  }
+  if (from._internal_has_stop_label()) {
+    _this->_impl_.stop_label_ = new ::proto_schema::maps::Label(*from._impl_.stop_label_);
+  }
+  if (from._internal_has_decoration()) {
+    _this->_impl_.decoration_ = new ::proto_schema::maps::Decoration(*from._impl_.decoration_);
+  }
+  if (from._internal_has_color_palette()) {
+    _this->_impl_.color_palette_ = new ::proto_schema::maps::ColorPalette(*from._impl_.color_palette_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_schema.maps.RenderSettings)
+}
+
+inline void RenderSettings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.container_){nullptr}
+    , decltype(_impl_.bus_label_){nullptr}
+    , decltype(_impl_.stop_label_){nullptr}
+    , decltype(_impl_.decoration_){nullptr}
+    , decltype(_impl_.color_palette_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+RenderSettings::~RenderSettings() {
+  // @@protoc_insertion_point(destructor:proto_schema.maps.RenderSettings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void RenderSettings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.container_;
+  if (this != internal_default_instance()) delete _impl_.bus_label_;
+  if (this != internal_default_instance()) delete _impl_.stop_label_;
+  if (this != internal_default_instance()) delete _impl_.decoration_;
+  if (this != internal_default_instance()) delete _impl_.color_palette_;
+}
+
+void RenderSettings::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void RenderSettings::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.maps.RenderSettings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.container_ != nullptr) {
+    delete _impl_.container_;
+  }
+  _impl_.container_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.bus_label_ != nullptr) {
+    delete _impl_.bus_label_;
+  }
+  _impl_.bus_label_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_label_ != nullptr) {
+    delete _impl_.stop_label_;
+  }
+  _impl_.stop_label_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.decoration_ != nullptr) {
+    delete _impl_.decoration_;
+  }
+  _impl_.decoration_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.color_palette_ != nullptr) {
+    delete _impl_.color_palette_;
+  }
+  _impl_.color_palette_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* RenderSettings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.maps.Container container = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_container(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.maps.Label bus_label = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_bus_label(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.maps.Label stop_label = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stop_label(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.maps.Decoration decoration = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_decoration(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.maps.ColorPalette color_palette = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 42)) {
+          ptr = ctx->ParseMessage(_internal_mutable_color_palette(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* RenderSettings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.maps.RenderSettings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.maps.Container container = 1;
+  if (this->_internal_has_container()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::container(this),
+        _Internal::container(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.maps.Label bus_label = 2;
+  if (this->_internal_has_bus_label()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::bus_label(this),
+        _Internal::bus_label(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.maps.Label stop_label = 3;
+  if (this->_internal_has_stop_label()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::stop_label(this),
+        _Internal::stop_label(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.maps.Decoration decoration = 4;
+  if (this->_internal_has_decoration()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::decoration(this),
+        _Internal::decoration(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.maps.ColorPalette color_palette = 5;
+  if (this->_internal_has_color_palette()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(5, _Internal::color_palette(this),
+        _Internal::color_palette(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.maps.RenderSettings)
+  return target;
+}
+
+size_t RenderSettings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.maps.RenderSettings)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_schema.maps.Container container = 1;
+  if (this->_internal_has_container()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.container_);
+  }
+
+  // .proto_schema.maps.Label bus_label = 2;
+  if (this->_internal_has_bus_label()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.bus_label_);
+  }
+
+  // .proto_schema.maps.Label stop_label = 3;
+  if (this->_internal_has_stop_label()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.stop_label_);
+  }
+
+  // .proto_schema.maps.Decoration decoration = 4;
+  if (this->_internal_has_decoration()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.decoration_);
+  }
+
+  // .proto_schema.maps.ColorPalette color_palette = 5;
+  if (this->_internal_has_color_palette()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.color_palette_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData RenderSettings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    RenderSettings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*RenderSettings::GetClassData() const { return &_class_data_; }
+
+
+void RenderSettings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<RenderSettings*>(&to_msg);
+  auto& from = static_cast<const RenderSettings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.maps.RenderSettings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_container()) {
+    _this->_internal_mutable_container()->::proto_schema::maps::Container::MergeFrom(
+        from._internal_container());
+  }
+  if (from._internal_has_bus_label()) {
+    _this->_internal_mutable_bus_label()->::proto_schema::maps::Label::MergeFrom(
+        from._internal_bus_label());
+  }
+  if (from._internal_has_stop_label()) {
+    _this->_internal_mutable_stop_label()->::proto_schema::maps::Label::MergeFrom(
+        from._internal_stop_label());
+  }
+  if (from._internal_has_decoration()) {
+    _this->_internal_mutable_decoration()->::proto_schema::maps::Decoration::MergeFrom(
+        from._internal_decoration());
+  }
+  if (from._internal_has_color_palette()) {
+    _this->_internal_mutable_color_palette()->::proto_schema::maps::ColorPalette::MergeFrom(
+        from._internal_color_palette());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void RenderSettings::CopyFrom(const RenderSettings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.maps.RenderSettings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool RenderSettings::IsInitialized() const {
+  return true;
+}
+
+void RenderSettings::InternalSwap(RenderSettings* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(RenderSettings, _impl_.color_palette_)
+      + sizeof(RenderSettings::_impl_.color_palette_)
+      - PROTOBUF_FIELD_OFFSET(RenderSettings, _impl_.container_)>(
+          reinterpret_cast<char*>(&_impl_.container_),
+          reinterpret_cast<char*>(&other->_impl_.container_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata RenderSettings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_map_5frenderer_2eproto_getter, &descriptor_table_map_5frenderer_2eproto_once,
+      file_level_metadata_map_5frenderer_2eproto[5]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace maps
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_schema::maps::Offset*
+Arena::CreateMaybeMessage< ::proto_schema::maps::Offset >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::maps::Offset >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::maps::Label*
+Arena::CreateMaybeMessage< ::proto_schema::maps::Label >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::maps::Label >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::maps::Container*
+Arena::CreateMaybeMessage< ::proto_schema::maps::Container >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::maps::Container >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::maps::Decoration*
+Arena::CreateMaybeMessage< ::proto_schema::maps::Decoration >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::maps::Decoration >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::maps::ColorPalette*
+Arena::CreateMaybeMessage< ::proto_schema::maps::ColorPalette >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::maps::ColorPalette >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::maps::RenderSettings*
+Arena::CreateMaybeMessage< ::proto_schema::maps::RenderSettings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::maps::RenderSettings >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
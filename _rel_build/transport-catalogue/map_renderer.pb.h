@@ -0,0 +1,2057 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: map_renderer.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_map_5frenderer_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_map_5frenderer_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "svg.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_map_5frenderer_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_map_5frenderer_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_map_5frenderer_2eproto;
+namespace proto_schema {
+namespace maps {
+class ColorPalette;
+struct ColorPaletteDefaultTypeInternal;
+extern ColorPaletteDefaultTypeInternal _ColorPalette_default_instance_;
+class Container;
+struct ContainerDefaultTypeInternal;
+extern ContainerDefaultTypeInternal _Container_default_instance_;
+class Decoration;
+struct DecorationDefaultTypeInternal;
+extern DecorationDefaultTypeInternal _Decoration_default_instance_;
+class Label;
+struct LabelDefaultTypeInternal;
+extern LabelDefaultTypeInternal _Label_default_instance_;
+class Offset;
+struct OffsetDefaultTypeInternal;
+extern OffsetDefaultTypeInternal _Offset_default_instance_;
+class RenderSettings;
+struct RenderSettingsDefaultTypeInternal;
+extern RenderSettingsDefaultTypeInternal _RenderSettings_default_instance_;
+}  // namespace maps
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_schema::maps::ColorPalette* Arena::CreateMaybeMessage<::proto_schema::maps::ColorPalette>(Arena*);
+template<> ::proto_schema::maps::Container* Arena::CreateMaybeMessage<::proto_schema::maps::Container>(Arena*);
+template<> ::proto_schema::maps::Decoration* Arena::CreateMaybeMessage<::proto_schema::maps::Decoration>(Arena*);
+template<> ::proto_schema::maps::Label* Arena::CreateMaybeMessage<::proto_schema::maps::Label>(Arena*);
+template<> ::proto_schema::maps::Offset* Arena::CreateMaybeMessage<::proto_schema::maps::Offset>(Arena*);
+template<> ::proto_schema::maps::RenderSettings* Arena::CreateMaybeMessage<::proto_schema::maps::RenderSettings>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_schema {
+namespace maps {
+
+// ===================================================================
+
+class Offset final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.maps.Offset) */ {
+ public:
+  inline Offset() : Offset(nullptr) {}
+  ~Offset() override;
+  explicit PROTOBUF_CONSTEXPR Offset(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Offset(const Offset& from);
+  Offset(Offset&& from) noexcept
+    : Offset() {
+    *this = ::std::move(from);
+  }
+
+  inline Offset& operator=(const Offset& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Offset& operator=(Offset&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Offset& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Offset* internal_default_instance() {
+    return reinterpret_cast<const Offset*>(
+               &_Offset_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Offset& a, Offset& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Offset* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Offset* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Offset* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Offset>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Offset& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Offset& from) {
+    Offset::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Offset* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.maps.Offset";
+  }
+  protected:
+  explicit Offset(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNorthFieldNumber = 1,
+    kEastFieldNumber = 2,
+  };
+  // double north = 1;
+  void clear_north();
+  double north() const;
+  void set_north(double value);
+  private:
+  double _internal_north() const;
+  void _internal_set_north(double value);
+  public:
+
+  // double east = 2;
+  void clear_east();
+  double east() const;
+  void set_east(double value);
+  private:
+  double _internal_east() const;
+  void _internal_set_east(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.maps.Offset)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double north_;
+    double east_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_map_5frenderer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Label final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.maps.Label) */ {
+ public:
+  inline Label() : Label(nullptr) {}
+  ~Label() override;
+  explicit PROTOBUF_CONSTEXPR Label(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Label(const Label& from);
+  Label(Label&& from) noexcept
+    : Label() {
+    *this = ::std::move(from);
+  }
+
+  inline Label& operator=(const Label& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Label& operator=(Label&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Label& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Label* internal_default_instance() {
+    return reinterpret_cast<const Label*>(
+               &_Label_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Label& a, Label& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Label* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Label* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Label* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Label>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Label& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Label& from) {
+    Label::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Label* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.maps.Label";
+  }
+  protected:
+  explicit Label(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kOffsetFieldNumber = 1,
+    kFontSizeFieldNumber = 2,
+  };
+  // .proto_schema.maps.Offset offset = 1;
+  bool has_offset() const;
+  private:
+  bool _internal_has_offset() const;
+  public:
+  void clear_offset();
+  const ::proto_schema::maps::Offset& offset() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::Offset* release_offset();
+  ::proto_schema::maps::Offset* mutable_offset();
+  void set_allocated_offset(::proto_schema::maps::Offset* offset);
+  private:
+  const ::proto_schema::maps::Offset& _internal_offset() const;
+  ::proto_schema::maps::Offset* _internal_mutable_offset();
+  public:
+  void unsafe_arena_set_allocated_offset(
+      ::proto_schema::maps::Offset* offset);
+  ::proto_schema::maps::Offset* unsafe_arena_release_offset();
+
+  // int32 font_size = 2;
+  void clear_font_size();
+  int32_t font_size() const;
+  void set_font_size(int32_t value);
+  private:
+  int32_t _internal_font_size() const;
+  void _internal_set_font_size(int32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.maps.Label)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto_schema::maps::Offset* offset_;
+    int32_t font_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_map_5frenderer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Container final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.maps.Container) */ {
+ public:
+  inline Container() : Container(nullptr) {}
+  ~Container() override;
+  explicit PROTOBUF_CONSTEXPR Container(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Container(const Container& from);
+  Container(Container&& from) noexcept
+    : Container() {
+    *this = ::std::move(from);
+  }
+
+  inline Container& operator=(const Container& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Container& operator=(Container&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Container& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Container* internal_default_instance() {
+    return reinterpret_cast<const Container*>(
+               &_Container_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Container& a, Container& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Container* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Container* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Container* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Container>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Container& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Container& from) {
+    Container::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Container* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.maps.Container";
+  }
+  protected:
+  explicit Container(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kWidthFieldNumber = 1,
+    kHeightFieldNumber = 2,
+    kPaddingFieldNumber = 3,
+  };
+  // double width = 1;
+  void clear_width();
+  double width() const;
+  void set_width(double value);
+  private:
+  double _internal_width() const;
+  void _internal_set_width(double value);
+  public:
+
+  // double height = 2;
+  void clear_height();
+  double height() const;
+  void set_height(double value);
+  private:
+  double _internal_height() const;
+  void _internal_set_height(double value);
+  public:
+
+  // double padding = 3;
+  void clear_padding();
+  double padding() const;
+  void set_padding(double value);
+  private:
+  double _internal_padding() const;
+  void _internal_set_padding(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.maps.Container)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double width_;
+    double height_;
+    double padding_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_map_5frenderer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Decoration final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.maps.Decoration) */ {
+ public:
+  inline Decoration() : Decoration(nullptr) {}
+  ~Decoration() override;
+  explicit PROTOBUF_CONSTEXPR Decoration(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Decoration(const Decoration& from);
+  Decoration(Decoration&& from) noexcept
+    : Decoration() {
+    *this = ::std::move(from);
+  }
+
+  inline Decoration& operator=(const Decoration& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Decoration& operator=(Decoration&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Decoration& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Decoration* internal_default_instance() {
+    return reinterpret_cast<const Decoration*>(
+               &_Decoration_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(Decoration& a, Decoration& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Decoration* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Decoration* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Decoration* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Decoration>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Decoration& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Decoration& from) {
+    Decoration::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Decoration* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.maps.Decoration";
+  }
+  protected:
+  explicit Decoration(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kUnderlayerColorFieldNumber = 3,
+    kLineWidthFieldNumber = 1,
+    kStopMarkerRadiusFieldNumber = 2,
+    kUnderlayerWidthFieldNumber = 4,
+  };
+  // .proto_schema.svg.Color underlayer_color = 3;
+  bool has_underlayer_color() const;
+  private:
+  bool _internal_has_underlayer_color() const;
+  public:
+  void clear_underlayer_color();
+  const ::proto_schema::svg::Color& underlayer_color() const;
+  PROTOBUF_NODISCARD ::proto_schema::svg::Color* release_underlayer_color();
+  ::proto_schema::svg::Color* mutable_underlayer_color();
+  void set_allocated_underlayer_color(::proto_schema::svg::Color* underlayer_color);
+  private:
+  const ::proto_schema::svg::Color& _internal_underlayer_color() const;
+  ::proto_schema::svg::Color* _internal_mutable_underlayer_color();
+  public:
+  void unsafe_arena_set_allocated_underlayer_color(
+      ::proto_schema::svg::Color* underlayer_color);
+  ::proto_schema::svg::Color* unsafe_arena_release_underlayer_color();
+
+  // double line_width = 1;
+  void clear_line_width();
+  double line_width() const;
+  void set_line_width(double value);
+  private:
+  double _internal_line_width() const;
+  void _internal_set_line_width(double value);
+  public:
+
+  // double stop_marker_radius = 2;
+  void clear_stop_marker_radius();
+  double stop_marker_radius() const;
+  void set_stop_marker_radius(double value);
+  private:
+  double _internal_stop_marker_radius() const;
+  void _internal_set_stop_marker_radius(double value);
+  public:
+
+  // double underlayer_width = 4;
+  void clear_underlayer_width();
+  double underlayer_width() const;
+  void set_underlayer_width(double value);
+  private:
+  double _internal_underlayer_width() const;
+  void _internal_set_underlayer_width(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.maps.Decoration)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto_schema::svg::Color* underlayer_color_;
+    double line_width_;
+    double stop_marker_radius_;
+    double underlayer_width_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_map_5frenderer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class ColorPalette final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.maps.ColorPalette) */ {
+ public:
+  inline ColorPalette() : ColorPalette(nullptr) {}
+  ~ColorPalette() override;
+  explicit PROTOBUF_CONSTEXPR ColorPalette(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  ColorPalette(const ColorPalette& from);
+  ColorPalette(ColorPalette&& from) noexcept
+    : ColorPalette() {
+    *this = ::std::move(from);
+  }
+
+  inline ColorPalette& operator=(const ColorPalette& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline ColorPalette& operator=(ColorPalette&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const ColorPalette& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const ColorPalette* internal_default_instance() {
+    return reinterpret_cast<const ColorPalette*>(
+               &_ColorPalette_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(ColorPalette& a, ColorPalette& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(ColorPalette* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(ColorPalette* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  ColorPalette* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<ColorPalette>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const ColorPalette& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const ColorPalette& from) {
+    ColorPalette::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(ColorPalette* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.maps.ColorPalette";
+  }
+  protected:
+  explicit ColorPalette(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kColorPaletteFieldNumber = 1,
+  };
+  // repeated .proto_schema.svg.Color color_palette = 1;
+  int color_palette_size() const;
+  private:
+  int _internal_color_palette_size() const;
+  public:
+  void clear_color_palette();
+  ::proto_schema::svg::Color* mutable_color_palette(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::svg::Color >*
+      mutable_color_palette();
+  private:
+  const ::proto_schema::svg::Color& _internal_color_palette(int index) const;
+  ::proto_schema::svg::Color* _internal_add_color_palette();
+  public:
+  const ::proto_schema::svg::Color& color_palette(int index) const;
+  ::proto_schema::svg::Color* add_color_palette();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::svg::Color >&
+      color_palette() const;
+
+  // @@protoc_insertion_point(class_scope:proto_schema.maps.ColorPalette)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::svg::Color > color_palette_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_map_5frenderer_2eproto;
+};
+// -------------------------------------------------------------------
+
+class RenderSettings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.maps.RenderSettings) */ {
+ public:
+  inline RenderSettings() : RenderSettings(nullptr) {}
+  ~RenderSettings() override;
+  explicit PROTOBUF_CONSTEXPR RenderSettings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  RenderSettings(const RenderSettings& from);
+  RenderSettings(RenderSettings&& from) noexcept
+    : RenderSettings() {
+    *this = ::std::move(from);
+  }
+
+  inline RenderSettings& operator=(const RenderSettings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline RenderSettings& operator=(RenderSettings&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const RenderSettings& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const RenderSettings* internal_default_instance() {
+    return reinterpret_cast<const RenderSettings*>(
+               &_RenderSettings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(RenderSettings& a, RenderSettings& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(RenderSettings* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(RenderSettings* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  RenderSettings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<RenderSettings>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const RenderSettings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const RenderSettings& from) {
+    RenderSettings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(RenderSettings* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.maps.RenderSettings";
+  }
+  protected:
+  explicit RenderSettings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kContainerFieldNumber = 1,
+    kBusLabelFieldNumber = 2,
+    kStopLabelFieldNumber = 3,
+    kDecorationFieldNumber = 4,
+    kColorPaletteFieldNumber = 5,
+  };
+  // .proto_schema.maps.Container container = 1;
+  bool has_container() const;
+  private:
+  bool _internal_has_container() const;
+  public:
+  void clear_container();
+  const ::proto_schema::maps::Container& container() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::Container* release_container();
+  ::proto_schema::maps::Container* mutable_container();
+  void set_allocated_container(::proto_schema::maps::Container* container);
+  private:
+  const ::proto_schema::maps::Container& _internal_container() const;
+  ::proto_schema::maps::Container* _internal_mutable_container();
+  public:
+  void unsafe_arena_set_allocated_container(
+      ::proto_schema::maps::Container* container);
+  ::proto_schema::maps::Container* unsafe_arena_release_container();
+
+  // .proto_schema.maps.Label bus_label = 2;
+  bool has_bus_label() const;
+  private:
+  bool _internal_has_bus_label() const;
+  public:
+  void clear_bus_label();
+  const ::proto_schema::maps::Label& bus_label() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::Label* release_bus_label();
+  ::proto_schema::maps::Label* mutable_bus_label();
+  void set_allocated_bus_label(::proto_schema::maps::Label* bus_label);
+  private:
+  const ::proto_schema::maps::Label& _internal_bus_label() const;
+  ::proto_schema::maps::Label* _internal_mutable_bus_label();
+  public:
+  void unsafe_arena_set_allocated_bus_label(
+      ::proto_schema::maps::Label* bus_label);
+  ::proto_schema::maps::Label* unsafe_arena_release_bus_label();
+
+  // .proto_schema.maps.Label stop_label = 3;
+  bool has_stop_label() const;
+  private:
+  bool _internal_has_stop_label() const;
+  public:
+  void clear_stop_label();
+  const ::proto_schema::maps::Label& stop_label() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::Label* release_stop_label();
+  ::proto_schema::maps::Label* mutable_stop_label();
+  void set_allocated_stop_label(::proto_schema::maps::Label* stop_label);
+  private:
+  const ::proto_schema::maps::Label& _internal_stop_label() const;
+  ::proto_schema::maps::Label* _internal_mutable_stop_label();
+  public:
+  void unsafe_arena_set_allocated_stop_label(
+      ::proto_schema::maps::Label* stop_label);
+  ::proto_schema::maps::Label* unsafe_arena_release_stop_label();
+
+  // .proto_schema.maps.Decoration decoration = 4;
+  bool has_decoration() const;
+  private:
+  bool _internal_has_decoration() const;
+  public:
+  void clear_decoration();
+  const ::proto_schema::maps::Decoration& decoration() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::Decoration* release_decoration();
+  ::proto_schema::maps::Decoration* mutable_decoration();
+  void set_allocated_decoration(::proto_schema::maps::Decoration* decoration);
+  private:
+  const ::proto_schema::maps::Decoration& _internal_decoration() const;
+  ::proto_schema::maps::Decoration* _internal_mutable_decoration();
+  public:
+  void unsafe_arena_set_allocated_decoration(
+      ::proto_schema::maps::Decoration* decoration);
+  ::proto_schema::maps::Decoration* unsafe_arena_release_decoration();
+
+  // .proto_schema.maps.ColorPalette color_palette = 5;
+  bool has_color_palette() const;
+  private:
+  bool _internal_has_color_palette() const;
+  public:
+  void clear_color_palette();
+  const ::proto_schema::maps::ColorPalette& color_palette() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::ColorPalette* release_color_palette();
+  ::proto_schema::maps::ColorPalette* mutable_color_palette();
+  void set_allocated_color_palette(::proto_schema::maps::ColorPalette* color_palette);
+  private:
+  const ::proto_schema::maps::ColorPalette& _internal_color_palette() const;
+  ::proto_schema::maps::ColorPalette* _internal_mutable_color_palette();
+  public:
+  void unsafe_arena_set_allocated_color_palette(
+      ::proto_schema::maps::ColorPalette* color_palette);
+  ::proto_schema::maps::ColorPalette* unsafe_arena_release_color_palette();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.maps.RenderSettings)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto_schema::maps::Container* container_;
+    ::proto_schema::maps::Label* bus_label_;
+    ::proto_schema::maps::Label* stop_label_;
+    ::proto_schema::maps::Decoration* decoration_;
+    ::proto_schema::maps::ColorPalette* color_palette_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_map_5frenderer_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Offset
+
+// double north = 1;
+inline void Offset::clear_north() {
+  _impl_.north_ = 0;
+}
+inline double Offset::_internal_north() const {
+  return _impl_.north_;
+}
+inline double Offset::north() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Offset.north)
+  return _internal_north();
+}
+inline void Offset::_internal_set_north(double value) {
+  
+  _impl_.north_ = value;
+}
+inline void Offset::set_north(double value) {
+  _internal_set_north(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Offset.north)
+}
+
+// double east = 2;
+inline void Offset::clear_east() {
+  _impl_.east_ = 0;
+}
+inline double Offset::_internal_east() const {
+  return _impl_.east_;
+}
+inline double Offset::east() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Offset.east)
+  return _internal_east();
+}
+inline void Offset::_internal_set_east(double value) {
+  
+  _impl_.east_ = value;
+}
+inline void Offset::set_east(double value) {
+  _internal_set_east(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Offset.east)
+}
+
+// -------------------------------------------------------------------
+
+// Label
+
+// .proto_schema.maps.Offset offset = 1;
+inline bool Label::_internal_has_offset() const {
+  return this != internal_default_instance() && _impl_.offset_ != nullptr;
+}
+inline bool Label::has_offset() const {
+  return _internal_has_offset();
+}
+inline void Label::clear_offset() {
+  if (GetArenaForAllocation() == nullptr && _impl_.offset_ != nullptr) {
+    delete _impl_.offset_;
+  }
+  _impl_.offset_ = nullptr;
+}
+inline const ::proto_schema::maps::Offset& Label::_internal_offset() const {
+  const ::proto_schema::maps::Offset* p = _impl_.offset_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::Offset&>(
+      ::proto_schema::maps::_Offset_default_instance_);
+}
+inline const ::proto_schema::maps::Offset& Label::offset() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Label.offset)
+  return _internal_offset();
+}
+inline void Label::unsafe_arena_set_allocated_offset(
+    ::proto_schema::maps::Offset* offset) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.offset_);
+  }
+  _impl_.offset_ = offset;
+  if (offset) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.Label.offset)
+}
+inline ::proto_schema::maps::Offset* Label::release_offset() {
+  
+  ::proto_schema::maps::Offset* temp = _impl_.offset_;
+  _impl_.offset_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::Offset* Label::unsafe_arena_release_offset() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.Label.offset)
+  
+  ::proto_schema::maps::Offset* temp = _impl_.offset_;
+  _impl_.offset_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::Offset* Label::_internal_mutable_offset() {
+  
+  if (_impl_.offset_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::Offset>(GetArenaForAllocation());
+    _impl_.offset_ = p;
+  }
+  return _impl_.offset_;
+}
+inline ::proto_schema::maps::Offset* Label::mutable_offset() {
+  ::proto_schema::maps::Offset* _msg = _internal_mutable_offset();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.Label.offset)
+  return _msg;
+}
+inline void Label::set_allocated_offset(::proto_schema::maps::Offset* offset) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.offset_;
+  }
+  if (offset) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(offset);
+    if (message_arena != submessage_arena) {
+      offset = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, offset, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.offset_ = offset;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.Label.offset)
+}
+
+// int32 font_size = 2;
+inline void Label::clear_font_size() {
+  _impl_.font_size_ = 0;
+}
+inline int32_t Label::_internal_font_size() const {
+  return _impl_.font_size_;
+}
+inline int32_t Label::font_size() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Label.font_size)
+  return _internal_font_size();
+}
+inline void Label::_internal_set_font_size(int32_t value) {
+  
+  _impl_.font_size_ = value;
+}
+inline void Label::set_font_size(int32_t value) {
+  _internal_set_font_size(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Label.font_size)
+}
+
+// -------------------------------------------------------------------
+
+// Container
+
+// double width = 1;
+inline void Container::clear_width() {
+  _impl_.width_ = 0;
+}
+inline double Container::_internal_width() const {
+  return _impl_.width_;
+}
+inline double Container::width() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Container.width)
+  return _internal_width();
+}
+inline void Container::_internal_set_width(double value) {
+  
+  _impl_.width_ = value;
+}
+inline void Container::set_width(double value) {
+  _internal_set_width(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Container.width)
+}
+
+// double height = 2;
+inline void Container::clear_height() {
+  _impl_.height_ = 0;
+}
+inline double Container::_internal_height() const {
+  return _impl_.height_;
+}
+inline double Container::height() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Container.height)
+  return _internal_height();
+}
+inline void Container::_internal_set_height(double value) {
+  
+  _impl_.height_ = value;
+}
+inline void Container::set_height(double value) {
+  _internal_set_height(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Container.height)
+}
+
+// double padding = 3;
+inline void Container::clear_padding() {
+  _impl_.padding_ = 0;
+}
+inline double Container::_internal_padding() const {
+  return _impl_.padding_;
+}
+inline double Container::padding() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Container.padding)
+  return _internal_padding();
+}
+inline void Container::_internal_set_padding(double value) {
+  
+  _impl_.padding_ = value;
+}
+inline void Container::set_padding(double value) {
+  _internal_set_padding(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Container.padding)
+}
+
+// -------------------------------------------------------------------
+
+// Decoration
+
+// double line_width = 1;
+inline void Decoration::clear_line_width() {
+  _impl_.line_width_ = 0;
+}
+inline double Decoration::_internal_line_width() const {
+  return _impl_.line_width_;
+}
+inline double Decoration::line_width() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Decoration.line_width)
+  return _internal_line_width();
+}
+inline void Decoration::_internal_set_line_width(double value) {
+  
+  _impl_.line_width_ = value;
+}
+inline void Decoration::set_line_width(double value) {
+  _internal_set_line_width(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Decoration.line_width)
+}
+
+// double stop_marker_radius = 2;
+inline void Decoration::clear_stop_marker_radius() {
+  _impl_.stop_marker_radius_ = 0;
+}
+inline double Decoration::_internal_stop_marker_radius() const {
+  return _impl_.stop_marker_radius_;
+}
+inline double Decoration::stop_marker_radius() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Decoration.stop_marker_radius)
+  return _internal_stop_marker_radius();
+}
+inline void Decoration::_internal_set_stop_marker_radius(double value) {
+  
+  _impl_.stop_marker_radius_ = value;
+}
+inline void Decoration::set_stop_marker_radius(double value) {
+  _internal_set_stop_marker_radius(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Decoration.stop_marker_radius)
+}
+
+// .proto_schema.svg.Color underlayer_color = 3;
+inline bool Decoration::_internal_has_underlayer_color() const {
+  return this != internal_default_instance() && _impl_.underlayer_color_ != nullptr;
+}
+inline bool Decoration::has_underlayer_color() const {
+  return _internal_has_underlayer_color();
+}
+inline const ::proto_schema::svg::Color& Decoration::_internal_underlayer_color() const {
+  const ::proto_schema::svg::Color* p = _impl_.underlayer_color_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::svg::Color&>(
+      ::proto_schema::svg::_Color_default_instance_);
+}
+inline const ::proto_schema::svg::Color& Decoration::underlayer_color() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Decoration.underlayer_color)
+  return _internal_underlayer_color();
+}
+inline void Decoration::unsafe_arena_set_allocated_underlayer_color(
+    ::proto_schema::svg::Color* underlayer_color) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.underlayer_color_);
+  }
+  _impl_.underlayer_color_ = underlayer_color;
+  if (underlayer_color) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.Decoration.underlayer_color)
+}
+inline ::proto_schema::svg::Color* Decoration::release_underlayer_color() {
+  
+  ::proto_schema::svg::Color* temp = _impl_.underlayer_color_;
+  _impl_.underlayer_color_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::svg::Color* Decoration::unsafe_arena_release_underlayer_color() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.Decoration.underlayer_color)
+  
+  ::proto_schema::svg::Color* temp = _impl_.underlayer_color_;
+  _impl_.underlayer_color_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::svg::Color* Decoration::_internal_mutable_underlayer_color() {
+  
+  if (_impl_.underlayer_color_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::svg::Color>(GetArenaForAllocation());
+    _impl_.underlayer_color_ = p;
+  }
+  return _impl_.underlayer_color_;
+}
+inline ::proto_schema::svg::Color* Decoration::mutable_underlayer_color() {
+  ::proto_schema::svg::Color* _msg = _internal_mutable_underlayer_color();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.Decoration.underlayer_color)
+  return _msg;
+}
+inline void Decoration::set_allocated_underlayer_color(::proto_schema::svg::Color* underlayer_color) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.underlayer_color_);
+  }
+  if (underlayer_color) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(underlayer_color));
+    if (message_arena != submessage_arena) {
+      underlayer_color = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, underlayer_color, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.underlayer_color_ = underlayer_color;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.Decoration.underlayer_color)
+}
+
+// double underlayer_width = 4;
+inline void Decoration::clear_underlayer_width() {
+  _impl_.underlayer_width_ = 0;
+}
+inline double Decoration::_internal_underlayer_width() const {
+  return _impl_.underlayer_width_;
+}
+inline double Decoration::underlayer_width() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.Decoration.underlayer_width)
+  return _internal_underlayer_width();
+}
+inline void Decoration::_internal_set_underlayer_width(double value) {
+  
+  _impl_.underlayer_width_ = value;
+}
+inline void Decoration::set_underlayer_width(double value) {
+  _internal_set_underlayer_width(value);
+  // @@protoc_insertion_point(field_set:proto_schema.maps.Decoration.underlayer_width)
+}
+
+// -------------------------------------------------------------------
+
+// ColorPalette
+
+// repeated .proto_schema.svg.Color color_palette = 1;
+inline int ColorPalette::_internal_color_palette_size() const {
+  return _impl_.color_palette_.size();
+}
+inline int ColorPalette::color_palette_size() const {
+  return _internal_color_palette_size();
+}
+inline ::proto_schema::svg::Color* ColorPalette::mutable_color_palette(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.ColorPalette.color_palette)
+  return _impl_.color_palette_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::svg::Color >*
+ColorPalette::mutable_color_palette() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.maps.ColorPalette.color_palette)
+  return &_impl_.color_palette_;
+}
+inline const ::proto_schema::svg::Color& ColorPalette::_internal_color_palette(int index) const {
+  return _impl_.color_palette_.Get(index);
+}
+inline const ::proto_schema::svg::Color& ColorPalette::color_palette(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.ColorPalette.color_palette)
+  return _internal_color_palette(index);
+}
+inline ::proto_schema::svg::Color* ColorPalette::_internal_add_color_palette() {
+  return _impl_.color_palette_.Add();
+}
+inline ::proto_schema::svg::Color* ColorPalette::add_color_palette() {
+  ::proto_schema::svg::Color* _add = _internal_add_color_palette();
+  // @@protoc_insertion_point(field_add:proto_schema.maps.ColorPalette.color_palette)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::svg::Color >&
+ColorPalette::color_palette() const {
+  // @@protoc_insertion_point(field_list:proto_schema.maps.ColorPalette.color_palette)
+  return _impl_.color_palette_;
+}
+
+// -------------------------------------------------------------------
+
+// RenderSettings
+
+// .proto_schema.maps.Container container = 1;
+inline bool RenderSettings::_internal_has_container() const {
+  return this != internal_default_instance() && _impl_.container_ != nullptr;
+}
+inline bool RenderSettings::has_container() const {
+  return _internal_has_container();
+}
+inline void RenderSettings::clear_container() {
+  if (GetArenaForAllocation() == nullptr && _impl_.container_ != nullptr) {
+    delete _impl_.container_;
+  }
+  _impl_.container_ = nullptr;
+}
+inline const ::proto_schema::maps::Container& RenderSettings::_internal_container() const {
+  const ::proto_schema::maps::Container* p = _impl_.container_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::Container&>(
+      ::proto_schema::maps::_Container_default_instance_);
+}
+inline const ::proto_schema::maps::Container& RenderSettings::container() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.RenderSettings.container)
+  return _internal_container();
+}
+inline void RenderSettings::unsafe_arena_set_allocated_container(
+    ::proto_schema::maps::Container* container) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.container_);
+  }
+  _impl_.container_ = container;
+  if (container) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.RenderSettings.container)
+}
+inline ::proto_schema::maps::Container* RenderSettings::release_container() {
+  
+  ::proto_schema::maps::Container* temp = _impl_.container_;
+  _impl_.container_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::Container* RenderSettings::unsafe_arena_release_container() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.RenderSettings.container)
+  
+  ::proto_schema::maps::Container* temp = _impl_.container_;
+  _impl_.container_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::Container* RenderSettings::_internal_mutable_container() {
+  
+  if (_impl_.container_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::Container>(GetArenaForAllocation());
+    _impl_.container_ = p;
+  }
+  return _impl_.container_;
+}
+inline ::proto_schema::maps::Container* RenderSettings::mutable_container() {
+  ::proto_schema::maps::Container* _msg = _internal_mutable_container();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.RenderSettings.container)
+  return _msg;
+}
+inline void RenderSettings::set_allocated_container(::proto_schema::maps::Container* container) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.container_;
+  }
+  if (container) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(container);
+    if (message_arena != submessage_arena) {
+      container = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, container, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.container_ = container;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.RenderSettings.container)
+}
+
+// .proto_schema.maps.Label bus_label = 2;
+inline bool RenderSettings::_internal_has_bus_label() const {
+  return this != internal_default_instance() && _impl_.bus_label_ != nullptr;
+}
+inline bool RenderSettings::has_bus_label() const {
+  return _internal_has_bus_label();
+}
+inline void RenderSettings::clear_bus_label() {
+  if (GetArenaForAllocation() == nullptr && _impl_.bus_label_ != nullptr) {
+    delete _impl_.bus_label_;
+  }
+  _impl_.bus_label_ = nullptr;
+}
+inline const ::proto_schema::maps::Label& RenderSettings::_internal_bus_label() const {
+  const ::proto_schema::maps::Label* p = _impl_.bus_label_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::Label&>(
+      ::proto_schema::maps::_Label_default_instance_);
+}
+inline const ::proto_schema::maps::Label& RenderSettings::bus_label() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.RenderSettings.bus_label)
+  return _internal_bus_label();
+}
+inline void RenderSettings::unsafe_arena_set_allocated_bus_label(
+    ::proto_schema::maps::Label* bus_label) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.bus_label_);
+  }
+  _impl_.bus_label_ = bus_label;
+  if (bus_label) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.RenderSettings.bus_label)
+}
+inline ::proto_schema::maps::Label* RenderSettings::release_bus_label() {
+  
+  ::proto_schema::maps::Label* temp = _impl_.bus_label_;
+  _impl_.bus_label_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::Label* RenderSettings::unsafe_arena_release_bus_label() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.RenderSettings.bus_label)
+  
+  ::proto_schema::maps::Label* temp = _impl_.bus_label_;
+  _impl_.bus_label_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::Label* RenderSettings::_internal_mutable_bus_label() {
+  
+  if (_impl_.bus_label_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::Label>(GetArenaForAllocation());
+    _impl_.bus_label_ = p;
+  }
+  return _impl_.bus_label_;
+}
+inline ::proto_schema::maps::Label* RenderSettings::mutable_bus_label() {
+  ::proto_schema::maps::Label* _msg = _internal_mutable_bus_label();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.RenderSettings.bus_label)
+  return _msg;
+}
+inline void RenderSettings::set_allocated_bus_label(::proto_schema::maps::Label* bus_label) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.bus_label_;
+  }
+  if (bus_label) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(bus_label);
+    if (message_arena != submessage_arena) {
+      bus_label = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, bus_label, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.bus_label_ = bus_label;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.RenderSettings.bus_label)
+}
+
+// .proto_schema.maps.Label stop_label = 3;
+inline bool RenderSettings::_internal_has_stop_label() const {
+  return this != internal_default_instance() && _impl_.stop_label_ != nullptr;
+}
+inline bool RenderSettings::has_stop_label() const {
+  return _internal_has_stop_label();
+}
+inline void RenderSettings::clear_stop_label() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stop_label_ != nullptr) {
+    delete _impl_.stop_label_;
+  }
+  _impl_.stop_label_ = nullptr;
+}
+inline const ::proto_schema::maps::Label& RenderSettings::_internal_stop_label() const {
+  const ::proto_schema::maps::Label* p = _impl_.stop_label_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::Label&>(
+      ::proto_schema::maps::_Label_default_instance_);
+}
+inline const ::proto_schema::maps::Label& RenderSettings::stop_label() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.RenderSettings.stop_label)
+  return _internal_stop_label();
+}
+inline void RenderSettings::unsafe_arena_set_allocated_stop_label(
+    ::proto_schema::maps::Label* stop_label) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stop_label_);
+  }
+  _impl_.stop_label_ = stop_label;
+  if (stop_label) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.RenderSettings.stop_label)
+}
+inline ::proto_schema::maps::Label* RenderSettings::release_stop_label() {
+  
+  ::proto_schema::maps::Label* temp = _impl_.stop_label_;
+  _impl_.stop_label_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::Label* RenderSettings::unsafe_arena_release_stop_label() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.RenderSettings.stop_label)
+  
+  ::proto_schema::maps::Label* temp = _impl_.stop_label_;
+  _impl_.stop_label_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::Label* RenderSettings::_internal_mutable_stop_label() {
+  
+  if (_impl_.stop_label_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::Label>(GetArenaForAllocation());
+    _impl_.stop_label_ = p;
+  }
+  return _impl_.stop_label_;
+}
+inline ::proto_schema::maps::Label* RenderSettings::mutable_stop_label() {
+  ::proto_schema::maps::Label* _msg = _internal_mutable_stop_label();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.RenderSettings.stop_label)
+  return _msg;
+}
+inline void RenderSettings::set_allocated_stop_label(::proto_schema::maps::Label* stop_label) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stop_label_;
+  }
+  if (stop_label) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stop_label);
+    if (message_arena != submessage_arena) {
+      stop_label = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stop_label, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stop_label_ = stop_label;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.RenderSettings.stop_label)
+}
+
+// .proto_schema.maps.Decoration decoration = 4;
+inline bool RenderSettings::_internal_has_decoration() const {
+  return this != internal_default_instance() && _impl_.decoration_ != nullptr;
+}
+inline bool RenderSettings::has_decoration() const {
+  return _internal_has_decoration();
+}
+inline void RenderSettings::clear_decoration() {
+  if (GetArenaForAllocation() == nullptr && _impl_.decoration_ != nullptr) {
+    delete _impl_.decoration_;
+  }
+  _impl_.decoration_ = nullptr;
+}
+inline const ::proto_schema::maps::Decoration& RenderSettings::_internal_decoration() const {
+  const ::proto_schema::maps::Decoration* p = _impl_.decoration_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::Decoration&>(
+      ::proto_schema::maps::_Decoration_default_instance_);
+}
+inline const ::proto_schema::maps::Decoration& RenderSettings::decoration() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.RenderSettings.decoration)
+  return _internal_decoration();
+}
+inline void RenderSettings::unsafe_arena_set_allocated_decoration(
+    ::proto_schema::maps::Decoration* decoration) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.decoration_);
+  }
+  _impl_.decoration_ = decoration;
+  if (decoration) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.RenderSettings.decoration)
+}
+inline ::proto_schema::maps::Decoration* RenderSettings::release_decoration() {
+  
+  ::proto_schema::maps::Decoration* temp = _impl_.decoration_;
+  _impl_.decoration_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::Decoration* RenderSettings::unsafe_arena_release_decoration() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.RenderSettings.decoration)
+  
+  ::proto_schema::maps::Decoration* temp = _impl_.decoration_;
+  _impl_.decoration_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::Decoration* RenderSettings::_internal_mutable_decoration() {
+  
+  if (_impl_.decoration_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::Decoration>(GetArenaForAllocation());
+    _impl_.decoration_ = p;
+  }
+  return _impl_.decoration_;
+}
+inline ::proto_schema::maps::Decoration* RenderSettings::mutable_decoration() {
+  ::proto_schema::maps::Decoration* _msg = _internal_mutable_decoration();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.RenderSettings.decoration)
+  return _msg;
+}
+inline void RenderSettings::set_allocated_decoration(::proto_schema::maps::Decoration* decoration) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.decoration_;
+  }
+  if (decoration) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(decoration);
+    if (message_arena != submessage_arena) {
+      decoration = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, decoration, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.decoration_ = decoration;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.RenderSettings.decoration)
+}
+
+// .proto_schema.maps.ColorPalette color_palette = 5;
+inline bool RenderSettings::_internal_has_color_palette() const {
+  return this != internal_default_instance() && _impl_.color_palette_ != nullptr;
+}
+inline bool RenderSettings::has_color_palette() const {
+  return _internal_has_color_palette();
+}
+inline void RenderSettings::clear_color_palette() {
+  if (GetArenaForAllocation() == nullptr && _impl_.color_palette_ != nullptr) {
+    delete _impl_.color_palette_;
+  }
+  _impl_.color_palette_ = nullptr;
+}
+inline const ::proto_schema::maps::ColorPalette& RenderSettings::_internal_color_palette() const {
+  const ::proto_schema::maps::ColorPalette* p = _impl_.color_palette_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::ColorPalette&>(
+      ::proto_schema::maps::_ColorPalette_default_instance_);
+}
+inline const ::proto_schema::maps::ColorPalette& RenderSettings::color_palette() const {
+  // @@protoc_insertion_point(field_get:proto_schema.maps.RenderSettings.color_palette)
+  return _internal_color_palette();
+}
+inline void RenderSettings::unsafe_arena_set_allocated_color_palette(
+    ::proto_schema::maps::ColorPalette* color_palette) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.color_palette_);
+  }
+  _impl_.color_palette_ = color_palette;
+  if (color_palette) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.maps.RenderSettings.color_palette)
+}
+inline ::proto_schema::maps::ColorPalette* RenderSettings::release_color_palette() {
+  
+  ::proto_schema::maps::ColorPalette* temp = _impl_.color_palette_;
+  _impl_.color_palette_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::ColorPalette* RenderSettings::unsafe_arena_release_color_palette() {
+  // @@protoc_insertion_point(field_release:proto_schema.maps.RenderSettings.color_palette)
+  
+  ::proto_schema::maps::ColorPalette* temp = _impl_.color_palette_;
+  _impl_.color_palette_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::ColorPalette* RenderSettings::_internal_mutable_color_palette() {
+  
+  if (_impl_.color_palette_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::ColorPalette>(GetArenaForAllocation());
+    _impl_.color_palette_ = p;
+  }
+  return _impl_.color_palette_;
+}
+inline ::proto_schema::maps::ColorPalette* RenderSettings::mutable_color_palette() {
+  ::proto_schema::maps::ColorPalette* _msg = _internal_mutable_color_palette();
+  // @@protoc_insertion_point(field_mutable:proto_schema.maps.RenderSettings.color_palette)
+  return _msg;
+}
+inline void RenderSettings::set_allocated_color_palette(::proto_schema::maps::ColorPalette* color_palette) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.color_palette_;
+  }
+  if (color_palette) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(color_palette);
+    if (message_arena != submessage_arena) {
+      color_palette = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, color_palette, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.color_palette_ = color_palette;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.maps.RenderSettings.color_palette)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace maps
+}  // namespace proto_schema
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_map_5frenderer_2eproto
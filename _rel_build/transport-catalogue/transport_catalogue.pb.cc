@@ -0,0 +1,2918 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transport_catalogue.proto
+
+#include "transport_catalogue.pb.h"
+
+#include <algorithm>
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/reflection_ops.h>
+#include <google/protobuf/wire_format.h>
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+
+PROTOBUF_PRAGMA_INIT_SEG
+
+namespace _pb = ::PROTOBUF_NAMESPACE_ID;
+namespace _pbi = _pb::internal;
+
+namespace proto_schema {
+namespace transport {
+PROTOBUF_CONSTEXPR Coordinates::Coordinates(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.lat_)*/0
+  , /*decltype(_impl_.lng_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct CoordinatesDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR CoordinatesDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~CoordinatesDefaultTypeInternal() {}
+  union {
+    Coordinates _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 CoordinatesDefaultTypeInternal _Coordinates_default_instance_;
+PROTOBUF_CONSTEXPR Stop::Stop(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.coordinates_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopDefaultTypeInternal() {}
+  union {
+    Stop _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopDefaultTypeInternal _Stop_default_instance_;
+PROTOBUF_CONSTEXPR Bus::Bus(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.route_)*/{}
+  , /*decltype(_impl_._route_cached_byte_size_)*/{0}
+  , /*decltype(_impl_.name_)*/{&::_pbi::fixed_address_empty_string, ::_pbi::ConstantInitialized{}}
+  , /*decltype(_impl_.is_roundtrip_)*/false
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BusDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BusDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BusDefaultTypeInternal() {}
+  union {
+    Bus _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusDefaultTypeInternal _Bus_default_instance_;
+PROTOBUF_CONSTEXPR DistancesBetweenStops::DistancesBetweenStops(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.distance_)*/0
+  , /*decltype(_impl_.from_stop_)*/0u
+  , /*decltype(_impl_.to_stop_)*/0u
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DistancesBetweenStopsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DistancesBetweenStopsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DistancesBetweenStopsDefaultTypeInternal() {}
+  union {
+    DistancesBetweenStops _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DistancesBetweenStopsDefaultTypeInternal _DistancesBetweenStops_default_instance_;
+PROTOBUF_CONSTEXPR TransportData::TransportData(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.stops_)*/{}
+  , /*decltype(_impl_.buses_)*/{}
+  , /*decltype(_impl_.distances_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct TransportDataDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR TransportDataDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~TransportDataDefaultTypeInternal() {}
+  union {
+    TransportData _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 TransportDataDefaultTypeInternal _TransportData_default_instance_;
+PROTOBUF_CONSTEXPR BusStat::BusStat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.total_stops_)*/0u
+  , /*decltype(_impl_.unique_stops_)*/0u
+  , /*decltype(_impl_.route_length_)*/0
+  , /*decltype(_impl_.route_curvature_)*/0
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct BusStatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR BusStatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~BusStatDefaultTypeInternal() {}
+  union {
+    BusStat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 BusStatDefaultTypeInternal _BusStat_default_instance_;
+PROTOBUF_CONSTEXPR StopStat::StopStat(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.buses_)*/{}
+  , /*decltype(_impl_._buses_cached_byte_size_)*/{0}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StopStatDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StopStatDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StopStatDefaultTypeInternal() {}
+  union {
+    StopStat _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StopStatDefaultTypeInternal _StopStat_default_instance_;
+PROTOBUF_CONSTEXPR Stats::Stats(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.bus_stats_)*/{}
+  , /*decltype(_impl_.stop_stats_)*/{}
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct StatsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR StatsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~StatsDefaultTypeInternal() {}
+  union {
+    Stats _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 StatsDefaultTypeInternal _Stats_default_instance_;
+PROTOBUF_CONSTEXPR Settings::Settings(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.render_settings_)*/nullptr
+  , /*decltype(_impl_.routing_settings_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct SettingsDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR SettingsDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~SettingsDefaultTypeInternal() {}
+  union {
+    Settings _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 SettingsDefaultTypeInternal _Settings_default_instance_;
+PROTOBUF_CONSTEXPR Database::Database(
+    ::_pbi::ConstantInitialized): _impl_{
+    /*decltype(_impl_.transport_data_)*/nullptr
+  , /*decltype(_impl_.settings_)*/nullptr
+  , /*decltype(_impl_.router_)*/nullptr
+  , /*decltype(_impl_.stats_)*/nullptr
+  , /*decltype(_impl_._cached_size_)*/{}} {}
+struct DatabaseDefaultTypeInternal {
+  PROTOBUF_CONSTEXPR DatabaseDefaultTypeInternal()
+      : _instance(::_pbi::ConstantInitialized{}) {}
+  ~DatabaseDefaultTypeInternal() {}
+  union {
+    Database _instance;
+  };
+};
+PROTOBUF_ATTRIBUTE_NO_DESTROY PROTOBUF_CONSTINIT PROTOBUF_ATTRIBUTE_INIT_PRIORITY1 DatabaseDefaultTypeInternal _Database_default_instance_;
+}  // namespace transport
+}  // namespace proto_schema
+static ::_pb::Metadata file_level_metadata_transport_5fcatalogue_2eproto[10];
+static constexpr ::_pb::EnumDescriptor const** file_level_enum_descriptors_transport_5fcatalogue_2eproto = nullptr;
+static constexpr ::_pb::ServiceDescriptor const** file_level_service_descriptors_transport_5fcatalogue_2eproto = nullptr;
+
+const uint32_t TableStruct_transport_5fcatalogue_2eproto::offsets[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Coordinates, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Coordinates, _impl_.lat_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Coordinates, _impl_.lng_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Stop, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Stop, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Stop, _impl_.coordinates_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Bus, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Bus, _impl_.name_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Bus, _impl_.is_roundtrip_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Bus, _impl_.route_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::DistancesBetweenStops, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::DistancesBetweenStops, _impl_.distance_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::DistancesBetweenStops, _impl_.from_stop_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::DistancesBetweenStops, _impl_.to_stop_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::TransportData, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::TransportData, _impl_.stops_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::TransportData, _impl_.buses_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::TransportData, _impl_.distances_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::BusStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::BusStat, _impl_.total_stops_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::BusStat, _impl_.unique_stops_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::BusStat, _impl_.route_length_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::BusStat, _impl_.route_curvature_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::StopStat, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::StopStat, _impl_.buses_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Stats, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Stats, _impl_.bus_stats_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Stats, _impl_.stop_stats_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Settings, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Settings, _impl_.render_settings_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Settings, _impl_.routing_settings_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Database, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  ~0u,  // no _inlined_string_donated_
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Database, _impl_.transport_data_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Database, _impl_.settings_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Database, _impl_.router_),
+  PROTOBUF_FIELD_OFFSET(::proto_schema::transport::Database, _impl_.stats_),
+};
+static const ::_pbi::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
+  { 0, -1, -1, sizeof(::proto_schema::transport::Coordinates)},
+  { 8, -1, -1, sizeof(::proto_schema::transport::Stop)},
+  { 16, -1, -1, sizeof(::proto_schema::transport::Bus)},
+  { 25, -1, -1, sizeof(::proto_schema::transport::DistancesBetweenStops)},
+  { 34, -1, -1, sizeof(::proto_schema::transport::TransportData)},
+  { 43, -1, -1, sizeof(::proto_schema::transport::BusStat)},
+  { 53, -1, -1, sizeof(::proto_schema::transport::StopStat)},
+  { 60, -1, -1, sizeof(::proto_schema::transport::Stats)},
+  { 68, -1, -1, sizeof(::proto_schema::transport::Settings)},
+  { 76, -1, -1, sizeof(::proto_schema::transport::Database)},
+};
+
+static const ::_pb::Message* const file_default_instances[] = {
+  &::proto_schema::transport::_Coordinates_default_instance_._instance,
+  &::proto_schema::transport::_Stop_default_instance_._instance,
+  &::proto_schema::transport::_Bus_default_instance_._instance,
+  &::proto_schema::transport::_DistancesBetweenStops_default_instance_._instance,
+  &::proto_schema::transport::_TransportData_default_instance_._instance,
+  &::proto_schema::transport::_BusStat_default_instance_._instance,
+  &::proto_schema::transport::_StopStat_default_instance_._instance,
+  &::proto_schema::transport::_Stats_default_instance_._instance,
+  &::proto_schema::transport::_Settings_default_instance_._instance,
+  &::proto_schema::transport::_Database_default_instance_._instance,
+};
+
+const char descriptor_table_protodef_transport_5fcatalogue_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
+  "\n\031transport_catalogue.proto\022\026proto_schem"
+  "a.transport\032\022map_renderer.proto\032\026transpo"
+  "rt_router.proto\"\'\n\013Coordinates\022\013\n\003lat\030\001 "
+  "\001(\001\022\013\n\003lng\030\002 \001(\001\"N\n\004Stop\022\014\n\004name\030\001 \001(\t\0228"
+  "\n\013coordinates\030\002 \001(\0132#.proto_schema.trans"
+  "port.Coordinates\">\n\003Bus\022\014\n\004name\030\001 \001(\t\022\024\n"
+  "\014is_roundtrip\030\003 \001(\010\022\r\n\005route\030\004 \003(\rJ\004\010\002\020\003"
+  "\"Y\n\025DistancesBetweenStops\022\020\n\010distance\030\003 "
+  "\001(\001\022\021\n\tfrom_stop\030\004 \001(\r\022\017\n\007to_stop\030\005 \001(\rJ"
+  "\004\010\001\020\002J\004\010\002\020\003\"\252\001\n\rTransportData\022+\n\005stops\030\001"
+  " \003(\0132\034.proto_schema.transport.Stop\022*\n\005bu"
+  "ses\030\002 \003(\0132\033.proto_schema.transport.Bus\022@"
+  "\n\tdistances\030\003 \003(\0132-.proto_schema.transpo"
+  "rt.DistancesBetweenStops\"c\n\007BusStat\022\023\n\013t"
+  "otal_stops\030\001 \001(\r\022\024\n\014unique_stops\030\002 \001(\r\022\024"
+  "\n\014route_length\030\003 \001(\001\022\027\n\017route_curvature\030"
+  "\004 \001(\001\"\031\n\010StopStat\022\r\n\005buses\030\001 \003(\r\"q\n\005Stat"
+  "s\0222\n\tbus_stats\030\001 \003(\0132\037.proto_schema.tran"
+  "sport.BusStat\0224\n\nstop_stats\030\002 \003(\0132 .prot"
+  "o_schema.transport.StopStat\"\206\001\n\010Settings"
+  "\022:\n\017render_settings\030\001 \001(\0132!.proto_schema"
+  ".maps.RenderSettings\022>\n\020routing_settings"
+  "\030\002 \001(\0132$.proto_schema.router.RoutingSett"
+  "ings\"\330\001\n\010Database\022=\n\016transport_data\030\001 \001("
+  "\0132%.proto_schema.transport.TransportData"
+  "\0222\n\010settings\030\002 \001(\0132 .proto_schema.transp"
+  "ort.Settings\022+\n\006router\030\003 \001(\0132\033.proto_sch"
+  "ema.router.Router\022,\n\005stats\030\004 \001(\0132\035.proto"
+  "_schema.transport.Statsb\006proto3"
+  ;
+static const ::_pbi::DescriptorTable* const descriptor_table_transport_5fcatalogue_2eproto_deps[2] = {
+  &::descriptor_table_map_5frenderer_2eproto,
+  &::descriptor_table_transport_5frouter_2eproto,
+};
+static ::_pbi::once_flag descriptor_table_transport_5fcatalogue_2eproto_once;
+const ::_pbi::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto = {
+    false, false, 1151, descriptor_table_protodef_transport_5fcatalogue_2eproto,
+    "transport_catalogue.proto",
+    &descriptor_table_transport_5fcatalogue_2eproto_once, descriptor_table_transport_5fcatalogue_2eproto_deps, 2, 10,
+    schemas, file_default_instances, TableStruct_transport_5fcatalogue_2eproto::offsets,
+    file_level_metadata_transport_5fcatalogue_2eproto, file_level_enum_descriptors_transport_5fcatalogue_2eproto,
+    file_level_service_descriptors_transport_5fcatalogue_2eproto,
+};
+PROTOBUF_ATTRIBUTE_WEAK const ::_pbi::DescriptorTable* descriptor_table_transport_5fcatalogue_2eproto_getter() {
+  return &descriptor_table_transport_5fcatalogue_2eproto;
+}
+
+// Force running AddDescriptors() at dynamic initialization time.
+PROTOBUF_ATTRIBUTE_INIT_PRIORITY2 static ::_pbi::AddDescriptorsRunner dynamic_init_dummy_transport_5fcatalogue_2eproto(&descriptor_table_transport_5fcatalogue_2eproto);
+namespace proto_schema {
+namespace transport {
+
+// ===================================================================
+
+class Coordinates::_Internal {
+ public:
+};
+
+Coordinates::Coordinates(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.Coordinates)
+}
+Coordinates::Coordinates(const Coordinates& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Coordinates* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lat_){}
+    , decltype(_impl_.lng_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.lat_, &from._impl_.lat_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.lng_) -
+    reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.lng_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.Coordinates)
+}
+
+inline void Coordinates::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.lat_){0}
+    , decltype(_impl_.lng_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Coordinates::~Coordinates() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.Coordinates)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Coordinates::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void Coordinates::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Coordinates::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.Coordinates)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.lat_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.lng_) -
+      reinterpret_cast<char*>(&_impl_.lat_)) + sizeof(_impl_.lng_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Coordinates::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double lat = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 9)) {
+          _impl_.lat_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double lng = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 17)) {
+          _impl_.lng_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Coordinates::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.Coordinates)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double lat = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lat = this->_internal_lat();
+  uint64_t raw_lat;
+  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
+  if (raw_lat != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(1, this->_internal_lat(), target);
+  }
+
+  // double lng = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lng = this->_internal_lng();
+  uint64_t raw_lng;
+  memcpy(&raw_lng, &tmp_lng, sizeof(tmp_lng));
+  if (raw_lng != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(2, this->_internal_lng(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.Coordinates)
+  return target;
+}
+
+size_t Coordinates::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.Coordinates)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double lat = 1;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lat = this->_internal_lat();
+  uint64_t raw_lat;
+  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
+  if (raw_lat != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double lng = 2;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lng = this->_internal_lng();
+  uint64_t raw_lng;
+  memcpy(&raw_lng, &tmp_lng, sizeof(tmp_lng));
+  if (raw_lng != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Coordinates::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Coordinates::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Coordinates::GetClassData() const { return &_class_data_; }
+
+
+void Coordinates::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Coordinates*>(&to_msg);
+  auto& from = static_cast<const Coordinates&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.Coordinates)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lat = from._internal_lat();
+  uint64_t raw_lat;
+  memcpy(&raw_lat, &tmp_lat, sizeof(tmp_lat));
+  if (raw_lat != 0) {
+    _this->_internal_set_lat(from._internal_lat());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_lng = from._internal_lng();
+  uint64_t raw_lng;
+  memcpy(&raw_lng, &tmp_lng, sizeof(tmp_lng));
+  if (raw_lng != 0) {
+    _this->_internal_set_lng(from._internal_lng());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Coordinates::CopyFrom(const Coordinates& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.Coordinates)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Coordinates::IsInitialized() const {
+  return true;
+}
+
+void Coordinates::InternalSwap(Coordinates* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Coordinates, _impl_.lng_)
+      + sizeof(Coordinates::_impl_.lng_)
+      - PROTOBUF_FIELD_OFFSET(Coordinates, _impl_.lat_)>(
+          reinterpret_cast<char*>(&_impl_.lat_),
+          reinterpret_cast<char*>(&other->_impl_.lat_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Coordinates::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[0]);
+}
+
+// ===================================================================
+
+class Stop::_Internal {
+ public:
+  static const ::proto_schema::transport::Coordinates& coordinates(const Stop* msg);
+};
+
+const ::proto_schema::transport::Coordinates&
+Stop::_Internal::coordinates(const Stop* msg) {
+  return *msg->_impl_.coordinates_;
+}
+Stop::Stop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.Stop)
+}
+Stop::Stop(const Stop& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stop* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.coordinates_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  if (from._internal_has_coordinates()) {
+    _this->_impl_.coordinates_ = new ::proto_schema::transport::Coordinates(*from._impl_.coordinates_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.Stop)
+}
+
+inline void Stop::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.name_){}
+    , decltype(_impl_.coordinates_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Stop::~Stop() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.Stop)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Stop::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.name_.Destroy();
+  if (this != internal_default_instance()) delete _impl_.coordinates_;
+}
+
+void Stop::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Stop::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.Stop)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.name_.ClearToEmpty();
+  if (GetArenaForAllocation() == nullptr && _impl_.coordinates_ != nullptr) {
+    delete _impl_.coordinates_;
+  }
+  _impl_.coordinates_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Stop::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proto_schema.transport.Stop.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.transport.Coordinates coordinates = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_coordinates(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Stop::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.Stop)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_schema.transport.Stop.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // .proto_schema.transport.Coordinates coordinates = 2;
+  if (this->_internal_has_coordinates()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::coordinates(this),
+        _Internal::coordinates(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.Stop)
+  return target;
+}
+
+size_t Stop::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.Stop)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // .proto_schema.transport.Coordinates coordinates = 2;
+  if (this->_internal_has_coordinates()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.coordinates_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stop::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stop::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stop::GetClassData() const { return &_class_data_; }
+
+
+void Stop::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stop*>(&to_msg);
+  auto& from = static_cast<const Stop&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.Stop)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_has_coordinates()) {
+    _this->_internal_mutable_coordinates()->::proto_schema::transport::Coordinates::MergeFrom(
+        from._internal_coordinates());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Stop::CopyFrom(const Stop& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.Stop)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stop::IsInitialized() const {
+  return true;
+}
+
+void Stop::InternalSwap(Stop* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.coordinates_, other->_impl_.coordinates_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Stop::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[1]);
+}
+
+// ===================================================================
+
+class Bus::_Internal {
+ public:
+};
+
+Bus::Bus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.Bus)
+}
+Bus::Bus(const Bus& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Bus* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.route_){from._impl_.route_}
+    , /*decltype(_impl_._route_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.is_roundtrip_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (!from._internal_name().empty()) {
+    _this->_impl_.name_.Set(from._internal_name(), 
+      _this->GetArenaForAllocation());
+  }
+  _this->_impl_.is_roundtrip_ = from._impl_.is_roundtrip_;
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.Bus)
+}
+
+inline void Bus::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.route_){arena}
+    , /*decltype(_impl_._route_cached_byte_size_)*/{0}
+    , decltype(_impl_.name_){}
+    , decltype(_impl_.is_roundtrip_){false}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+  _impl_.name_.InitDefault();
+  #ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+    _impl_.name_.Set("", GetArenaForAllocation());
+  #endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+}
+
+Bus::~Bus() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.Bus)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Bus::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.route_.~RepeatedField();
+  _impl_.name_.Destroy();
+}
+
+void Bus::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Bus::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.Bus)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.route_.Clear();
+  _impl_.name_.ClearToEmpty();
+  _impl_.is_roundtrip_ = false;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Bus::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // string name = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          auto str = _internal_mutable_name();
+          ptr = ::_pbi::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(ptr);
+          CHK_(::_pbi::VerifyUTF8(str, "proto_schema.transport.Bus.name"));
+        } else
+          goto handle_unusual;
+        continue;
+      // bool is_roundtrip = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 24)) {
+          _impl_.is_roundtrip_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated uint32 route = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_route(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 32) {
+          _internal_add_route(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Bus::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.Bus)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_name().data(), static_cast<int>(this->_internal_name().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "proto_schema.transport.Bus.name");
+    target = stream->WriteStringMaybeAliased(
+        1, this->_internal_name(), target);
+  }
+
+  // bool is_roundtrip = 3;
+  if (this->_internal_is_roundtrip() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteBoolToArray(3, this->_internal_is_roundtrip(), target);
+  }
+
+  // repeated uint32 route = 4;
+  {
+    int byte_size = _impl_._route_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          4, _internal_route(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.Bus)
+  return target;
+}
+
+size_t Bus::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.Bus)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 route = 4;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.route_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._route_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  // string name = 1;
+  if (!this->_internal_name().empty()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_name());
+  }
+
+  // bool is_roundtrip = 3;
+  if (this->_internal_is_roundtrip() != 0) {
+    total_size += 1 + 1;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Bus::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Bus::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Bus::GetClassData() const { return &_class_data_; }
+
+
+void Bus::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Bus*>(&to_msg);
+  auto& from = static_cast<const Bus&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.Bus)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.route_.MergeFrom(from._impl_.route_);
+  if (!from._internal_name().empty()) {
+    _this->_internal_set_name(from._internal_name());
+  }
+  if (from._internal_is_roundtrip() != 0) {
+    _this->_internal_set_is_roundtrip(from._internal_is_roundtrip());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Bus::CopyFrom(const Bus& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.Bus)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Bus::IsInitialized() const {
+  return true;
+}
+
+void Bus::InternalSwap(Bus* other) {
+  using std::swap;
+  auto* lhs_arena = GetArenaForAllocation();
+  auto* rhs_arena = other->GetArenaForAllocation();
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.route_.InternalSwap(&other->_impl_.route_);
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr::InternalSwap(
+      &_impl_.name_, lhs_arena,
+      &other->_impl_.name_, rhs_arena
+  );
+  swap(_impl_.is_roundtrip_, other->_impl_.is_roundtrip_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Bus::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[2]);
+}
+
+// ===================================================================
+
+class DistancesBetweenStops::_Internal {
+ public:
+};
+
+DistancesBetweenStops::DistancesBetweenStops(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.DistancesBetweenStops)
+}
+DistancesBetweenStops::DistancesBetweenStops(const DistancesBetweenStops& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  DistancesBetweenStops* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.distance_){}
+    , decltype(_impl_.from_stop_){}
+    , decltype(_impl_.to_stop_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.distance_, &from._impl_.distance_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.to_stop_) -
+    reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.to_stop_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.DistancesBetweenStops)
+}
+
+inline void DistancesBetweenStops::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.distance_){0}
+    , decltype(_impl_.from_stop_){0u}
+    , decltype(_impl_.to_stop_){0u}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+DistancesBetweenStops::~DistancesBetweenStops() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.DistancesBetweenStops)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void DistancesBetweenStops::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void DistancesBetweenStops::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void DistancesBetweenStops::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.DistancesBetweenStops)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.distance_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.to_stop_) -
+      reinterpret_cast<char*>(&_impl_.distance_)) + sizeof(_impl_.to_stop_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* DistancesBetweenStops::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // double distance = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.distance_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 from_stop = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 32)) {
+          _impl_.from_stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 to_stop = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 40)) {
+          _impl_.to_stop_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* DistancesBetweenStops::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.DistancesBetweenStops)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // double distance = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_distance = this->_internal_distance();
+  uint64_t raw_distance;
+  memcpy(&raw_distance, &tmp_distance, sizeof(tmp_distance));
+  if (raw_distance != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_distance(), target);
+  }
+
+  // uint32 from_stop = 4;
+  if (this->_internal_from_stop() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(4, this->_internal_from_stop(), target);
+  }
+
+  // uint32 to_stop = 5;
+  if (this->_internal_to_stop() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(5, this->_internal_to_stop(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.DistancesBetweenStops)
+  return target;
+}
+
+size_t DistancesBetweenStops::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.DistancesBetweenStops)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // double distance = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_distance = this->_internal_distance();
+  uint64_t raw_distance;
+  memcpy(&raw_distance, &tmp_distance, sizeof(tmp_distance));
+  if (raw_distance != 0) {
+    total_size += 1 + 8;
+  }
+
+  // uint32 from_stop = 4;
+  if (this->_internal_from_stop() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_from_stop());
+  }
+
+  // uint32 to_stop = 5;
+  if (this->_internal_to_stop() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_to_stop());
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData DistancesBetweenStops::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    DistancesBetweenStops::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*DistancesBetweenStops::GetClassData() const { return &_class_data_; }
+
+
+void DistancesBetweenStops::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<DistancesBetweenStops*>(&to_msg);
+  auto& from = static_cast<const DistancesBetweenStops&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.DistancesBetweenStops)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_distance = from._internal_distance();
+  uint64_t raw_distance;
+  memcpy(&raw_distance, &tmp_distance, sizeof(tmp_distance));
+  if (raw_distance != 0) {
+    _this->_internal_set_distance(from._internal_distance());
+  }
+  if (from._internal_from_stop() != 0) {
+    _this->_internal_set_from_stop(from._internal_from_stop());
+  }
+  if (from._internal_to_stop() != 0) {
+    _this->_internal_set_to_stop(from._internal_to_stop());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void DistancesBetweenStops::CopyFrom(const DistancesBetweenStops& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.DistancesBetweenStops)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool DistancesBetweenStops::IsInitialized() const {
+  return true;
+}
+
+void DistancesBetweenStops::InternalSwap(DistancesBetweenStops* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(DistancesBetweenStops, _impl_.to_stop_)
+      + sizeof(DistancesBetweenStops::_impl_.to_stop_)
+      - PROTOBUF_FIELD_OFFSET(DistancesBetweenStops, _impl_.distance_)>(
+          reinterpret_cast<char*>(&_impl_.distance_),
+          reinterpret_cast<char*>(&other->_impl_.distance_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata DistancesBetweenStops::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[3]);
+}
+
+// ===================================================================
+
+class TransportData::_Internal {
+ public:
+};
+
+TransportData::TransportData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.TransportData)
+}
+TransportData::TransportData(const TransportData& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  TransportData* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){from._impl_.stops_}
+    , decltype(_impl_.buses_){from._impl_.buses_}
+    , decltype(_impl_.distances_){from._impl_.distances_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.TransportData)
+}
+
+inline void TransportData::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.stops_){arena}
+    , decltype(_impl_.buses_){arena}
+    , decltype(_impl_.distances_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+TransportData::~TransportData() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.TransportData)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void TransportData::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.stops_.~RepeatedPtrField();
+  _impl_.buses_.~RepeatedPtrField();
+  _impl_.distances_.~RepeatedPtrField();
+}
+
+void TransportData::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void TransportData::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.TransportData)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.stops_.Clear();
+  _impl_.buses_.Clear();
+  _impl_.distances_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* TransportData::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto_schema.transport.Stop stops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stops(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto_schema.transport.Bus buses = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_buses(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto_schema.transport.DistancesBetweenStops distances = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_distances(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* TransportData::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.TransportData)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.transport.Stop stops = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stops_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stops(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto_schema.transport.Bus buses = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_buses_size()); i < n; i++) {
+    const auto& repfield = this->_internal_buses(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto_schema.transport.DistancesBetweenStops distances = 3;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_distances_size()); i < n; i++) {
+    const auto& repfield = this->_internal_distances(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(3, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.TransportData)
+  return target;
+}
+
+size_t TransportData::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.TransportData)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.transport.Stop stops = 1;
+  total_size += 1UL * this->_internal_stops_size();
+  for (const auto& msg : this->_impl_.stops_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .proto_schema.transport.Bus buses = 2;
+  total_size += 1UL * this->_internal_buses_size();
+  for (const auto& msg : this->_impl_.buses_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .proto_schema.transport.DistancesBetweenStops distances = 3;
+  total_size += 1UL * this->_internal_distances_size();
+  for (const auto& msg : this->_impl_.distances_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData TransportData::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    TransportData::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*TransportData::GetClassData() const { return &_class_data_; }
+
+
+void TransportData::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<TransportData*>(&to_msg);
+  auto& from = static_cast<const TransportData&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.TransportData)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.stops_.MergeFrom(from._impl_.stops_);
+  _this->_impl_.buses_.MergeFrom(from._impl_.buses_);
+  _this->_impl_.distances_.MergeFrom(from._impl_.distances_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void TransportData::CopyFrom(const TransportData& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.TransportData)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TransportData::IsInitialized() const {
+  return true;
+}
+
+void TransportData::InternalSwap(TransportData* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.stops_.InternalSwap(&other->_impl_.stops_);
+  _impl_.buses_.InternalSwap(&other->_impl_.buses_);
+  _impl_.distances_.InternalSwap(&other->_impl_.distances_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata TransportData::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[4]);
+}
+
+// ===================================================================
+
+class BusStat::_Internal {
+ public:
+};
+
+BusStat::BusStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.BusStat)
+}
+BusStat::BusStat(const BusStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  BusStat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.total_stops_){}
+    , decltype(_impl_.unique_stops_){}
+    , decltype(_impl_.route_length_){}
+    , decltype(_impl_.route_curvature_){}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::memcpy(&_impl_.total_stops_, &from._impl_.total_stops_,
+    static_cast<size_t>(reinterpret_cast<char*>(&_impl_.route_curvature_) -
+    reinterpret_cast<char*>(&_impl_.total_stops_)) + sizeof(_impl_.route_curvature_));
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.BusStat)
+}
+
+inline void BusStat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.total_stops_){0u}
+    , decltype(_impl_.unique_stops_){0u}
+    , decltype(_impl_.route_length_){0}
+    , decltype(_impl_.route_curvature_){0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+BusStat::~BusStat() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.BusStat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void BusStat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+}
+
+void BusStat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void BusStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.BusStat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  ::memset(&_impl_.total_stops_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&_impl_.route_curvature_) -
+      reinterpret_cast<char*>(&_impl_.total_stops_)) + sizeof(_impl_.route_curvature_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* BusStat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // uint32 total_stops = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 8)) {
+          _impl_.total_stops_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // uint32 unique_stops = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 16)) {
+          _impl_.unique_stops_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // double route_length = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 25)) {
+          _impl_.route_length_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      // double route_curvature = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 33)) {
+          _impl_.route_curvature_ = ::PROTOBUF_NAMESPACE_ID::internal::UnalignedLoad<double>(ptr);
+          ptr += sizeof(double);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* BusStat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.BusStat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // uint32 total_stops = 1;
+  if (this->_internal_total_stops() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(1, this->_internal_total_stops(), target);
+  }
+
+  // uint32 unique_stops = 2;
+  if (this->_internal_unique_stops() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteUInt32ToArray(2, this->_internal_unique_stops(), target);
+  }
+
+  // double route_length = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_length = this->_internal_route_length();
+  uint64_t raw_route_length;
+  memcpy(&raw_route_length, &tmp_route_length, sizeof(tmp_route_length));
+  if (raw_route_length != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(3, this->_internal_route_length(), target);
+  }
+
+  // double route_curvature = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_curvature = this->_internal_route_curvature();
+  uint64_t raw_route_curvature;
+  memcpy(&raw_route_curvature, &tmp_route_curvature, sizeof(tmp_route_curvature));
+  if (raw_route_curvature != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::_pbi::WireFormatLite::WriteDoubleToArray(4, this->_internal_route_curvature(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.BusStat)
+  return target;
+}
+
+size_t BusStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.BusStat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // uint32 total_stops = 1;
+  if (this->_internal_total_stops() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_total_stops());
+  }
+
+  // uint32 unique_stops = 2;
+  if (this->_internal_unique_stops() != 0) {
+    total_size += ::_pbi::WireFormatLite::UInt32SizePlusOne(this->_internal_unique_stops());
+  }
+
+  // double route_length = 3;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_length = this->_internal_route_length();
+  uint64_t raw_route_length;
+  memcpy(&raw_route_length, &tmp_route_length, sizeof(tmp_route_length));
+  if (raw_route_length != 0) {
+    total_size += 1 + 8;
+  }
+
+  // double route_curvature = 4;
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_curvature = this->_internal_route_curvature();
+  uint64_t raw_route_curvature;
+  memcpy(&raw_route_curvature, &tmp_route_curvature, sizeof(tmp_route_curvature));
+  if (raw_route_curvature != 0) {
+    total_size += 1 + 8;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData BusStat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    BusStat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*BusStat::GetClassData() const { return &_class_data_; }
+
+
+void BusStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<BusStat*>(&to_msg);
+  auto& from = static_cast<const BusStat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.BusStat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_total_stops() != 0) {
+    _this->_internal_set_total_stops(from._internal_total_stops());
+  }
+  if (from._internal_unique_stops() != 0) {
+    _this->_internal_set_unique_stops(from._internal_unique_stops());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_length = from._internal_route_length();
+  uint64_t raw_route_length;
+  memcpy(&raw_route_length, &tmp_route_length, sizeof(tmp_route_length));
+  if (raw_route_length != 0) {
+    _this->_internal_set_route_length(from._internal_route_length());
+  }
+  static_assert(sizeof(uint64_t) == sizeof(double), "Code assumes uint64_t and double are the same size.");
+  double tmp_route_curvature = from._internal_route_curvature();
+  uint64_t raw_route_curvature;
+  memcpy(&raw_route_curvature, &tmp_route_curvature, sizeof(tmp_route_curvature));
+  if (raw_route_curvature != 0) {
+    _this->_internal_set_route_curvature(from._internal_route_curvature());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void BusStat::CopyFrom(const BusStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.BusStat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool BusStat::IsInitialized() const {
+  return true;
+}
+
+void BusStat::InternalSwap(BusStat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(BusStat, _impl_.route_curvature_)
+      + sizeof(BusStat::_impl_.route_curvature_)
+      - PROTOBUF_FIELD_OFFSET(BusStat, _impl_.total_stops_)>(
+          reinterpret_cast<char*>(&_impl_.total_stops_),
+          reinterpret_cast<char*>(&other->_impl_.total_stops_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata BusStat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[5]);
+}
+
+// ===================================================================
+
+class StopStat::_Internal {
+ public:
+};
+
+StopStat::StopStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.StopStat)
+}
+StopStat::StopStat(const StopStat& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  StopStat* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buses_){from._impl_.buses_}
+    , /*decltype(_impl_._buses_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.StopStat)
+}
+
+inline void StopStat::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.buses_){arena}
+    , /*decltype(_impl_._buses_cached_byte_size_)*/{0}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+StopStat::~StopStat() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.StopStat)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void StopStat::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.buses_.~RepeatedField();
+}
+
+void StopStat::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void StopStat::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.StopStat)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.buses_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* StopStat::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated uint32 buses = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::PackedUInt32Parser(_internal_mutable_buses(), ptr, ctx);
+          CHK_(ptr);
+        } else if (static_cast<uint8_t>(tag) == 8) {
+          _internal_add_buses(::PROTOBUF_NAMESPACE_ID::internal::ReadVarint32(&ptr));
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* StopStat::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.StopStat)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated uint32 buses = 1;
+  {
+    int byte_size = _impl_._buses_cached_byte_size_.load(std::memory_order_relaxed);
+    if (byte_size > 0) {
+      target = stream->WriteUInt32Packed(
+          1, _internal_buses(), byte_size, target);
+    }
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.StopStat)
+  return target;
+}
+
+size_t StopStat::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.StopStat)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated uint32 buses = 1;
+  {
+    size_t data_size = ::_pbi::WireFormatLite::
+      UInt32Size(this->_impl_.buses_);
+    if (data_size > 0) {
+      total_size += 1 +
+        ::_pbi::WireFormatLite::Int32Size(static_cast<int32_t>(data_size));
+    }
+    int cached_size = ::_pbi::ToCachedSize(data_size);
+    _impl_._buses_cached_byte_size_.store(cached_size,
+                                    std::memory_order_relaxed);
+    total_size += data_size;
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData StopStat::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    StopStat::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*StopStat::GetClassData() const { return &_class_data_; }
+
+
+void StopStat::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<StopStat*>(&to_msg);
+  auto& from = static_cast<const StopStat&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.StopStat)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.buses_.MergeFrom(from._impl_.buses_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void StopStat::CopyFrom(const StopStat& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.StopStat)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool StopStat::IsInitialized() const {
+  return true;
+}
+
+void StopStat::InternalSwap(StopStat* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.buses_.InternalSwap(&other->_impl_.buses_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata StopStat::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[6]);
+}
+
+// ===================================================================
+
+class Stats::_Internal {
+ public:
+};
+
+Stats::Stats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.Stats)
+}
+Stats::Stats(const Stats& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Stats* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_stats_){from._impl_.bus_stats_}
+    , decltype(_impl_.stop_stats_){from._impl_.stop_stats_}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.Stats)
+}
+
+inline void Stats::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.bus_stats_){arena}
+    , decltype(_impl_.stop_stats_){arena}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Stats::~Stats() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.Stats)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Stats::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  _impl_.bus_stats_.~RepeatedPtrField();
+  _impl_.stop_stats_.~RepeatedPtrField();
+}
+
+void Stats::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Stats::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.Stats)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  _impl_.bus_stats_.Clear();
+  _impl_.stop_stats_.Clear();
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Stats::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // repeated .proto_schema.transport.BusStat bus_stats = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_bus_stats(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      // repeated .proto_schema.transport.StopStat stop_stats = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_stop_stats(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Stats::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.Stats)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.transport.BusStat bus_stats = 1;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_bus_stats_size()); i < n; i++) {
+    const auto& repfield = this->_internal_bus_stats(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(1, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  // repeated .proto_schema.transport.StopStat stop_stats = 2;
+  for (unsigned i = 0,
+      n = static_cast<unsigned>(this->_internal_stop_stats_size()); i < n; i++) {
+    const auto& repfield = this->_internal_stop_stats(i);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+        InternalWriteMessage(2, repfield, repfield.GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.Stats)
+  return target;
+}
+
+size_t Stats::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.Stats)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .proto_schema.transport.BusStat bus_stats = 1;
+  total_size += 1UL * this->_internal_bus_stats_size();
+  for (const auto& msg : this->_impl_.bus_stats_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // repeated .proto_schema.transport.StopStat stop_stats = 2;
+  total_size += 1UL * this->_internal_stop_stats_size();
+  for (const auto& msg : this->_impl_.stop_stats_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Stats::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Stats::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Stats::GetClassData() const { return &_class_data_; }
+
+
+void Stats::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Stats*>(&to_msg);
+  auto& from = static_cast<const Stats&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.Stats)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  _this->_impl_.bus_stats_.MergeFrom(from._impl_.bus_stats_);
+  _this->_impl_.stop_stats_.MergeFrom(from._impl_.stop_stats_);
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Stats::CopyFrom(const Stats& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.Stats)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Stats::IsInitialized() const {
+  return true;
+}
+
+void Stats::InternalSwap(Stats* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  _impl_.bus_stats_.InternalSwap(&other->_impl_.bus_stats_);
+  _impl_.stop_stats_.InternalSwap(&other->_impl_.stop_stats_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Stats::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[7]);
+}
+
+// ===================================================================
+
+class Settings::_Internal {
+ public:
+  static const ::proto_schema::maps::RenderSettings& render_settings(const Settings* msg);
+  static const ::proto_schema::router::RoutingSettings& routing_settings(const Settings* msg);
+};
+
+const ::proto_schema::maps::RenderSettings&
+Settings::_Internal::render_settings(const Settings* msg) {
+  return *msg->_impl_.render_settings_;
+}
+const ::proto_schema::router::RoutingSettings&
+Settings::_Internal::routing_settings(const Settings* msg) {
+  return *msg->_impl_.routing_settings_;
+}
+void Settings::clear_render_settings() {
+  if (GetArenaForAllocation() == nullptr && _impl_.render_settings_ != nullptr) {
+    delete _impl_.render_settings_;
+  }
+  _impl_.render_settings_ = nullptr;
+}
+void Settings::clear_routing_settings() {
+  if (GetArenaForAllocation() == nullptr && _impl_.routing_settings_ != nullptr) {
+    delete _impl_.routing_settings_;
+  }
+  _impl_.routing_settings_ = nullptr;
+}
+Settings::Settings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.Settings)
+}
+Settings::Settings(const Settings& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Settings* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.render_settings_){nullptr}
+    , decltype(_impl_.routing_settings_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_render_settings()) {
+    _this->_impl_.render_settings_ = new ::proto_schema::maps::RenderSettings(*from._impl_.render_settings_);
+  }
+  if (from._internal_has_routing_settings()) {
+    _this->_impl_.routing_settings_ = new ::proto_schema::router::RoutingSettings(*from._impl_.routing_settings_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.Settings)
+}
+
+inline void Settings::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.render_settings_){nullptr}
+    , decltype(_impl_.routing_settings_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Settings::~Settings() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.Settings)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Settings::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.render_settings_;
+  if (this != internal_default_instance()) delete _impl_.routing_settings_;
+}
+
+void Settings::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Settings::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.Settings)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.render_settings_ != nullptr) {
+    delete _impl_.render_settings_;
+  }
+  _impl_.render_settings_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.routing_settings_ != nullptr) {
+    delete _impl_.routing_settings_;
+  }
+  _impl_.routing_settings_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Settings::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.maps.RenderSettings render_settings = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_render_settings(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.RoutingSettings routing_settings = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_routing_settings(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Settings::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.Settings)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.maps.RenderSettings render_settings = 1;
+  if (this->_internal_has_render_settings()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::render_settings(this),
+        _Internal::render_settings(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.router.RoutingSettings routing_settings = 2;
+  if (this->_internal_has_routing_settings()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::routing_settings(this),
+        _Internal::routing_settings(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.Settings)
+  return target;
+}
+
+size_t Settings::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.Settings)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_schema.maps.RenderSettings render_settings = 1;
+  if (this->_internal_has_render_settings()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.render_settings_);
+  }
+
+  // .proto_schema.router.RoutingSettings routing_settings = 2;
+  if (this->_internal_has_routing_settings()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.routing_settings_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Settings::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Settings::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Settings::GetClassData() const { return &_class_data_; }
+
+
+void Settings::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Settings*>(&to_msg);
+  auto& from = static_cast<const Settings&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.Settings)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_render_settings()) {
+    _this->_internal_mutable_render_settings()->::proto_schema::maps::RenderSettings::MergeFrom(
+        from._internal_render_settings());
+  }
+  if (from._internal_has_routing_settings()) {
+    _this->_internal_mutable_routing_settings()->::proto_schema::router::RoutingSettings::MergeFrom(
+        from._internal_routing_settings());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Settings::CopyFrom(const Settings& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.Settings)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Settings::IsInitialized() const {
+  return true;
+}
+
+void Settings::InternalSwap(Settings* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Settings, _impl_.routing_settings_)
+      + sizeof(Settings::_impl_.routing_settings_)
+      - PROTOBUF_FIELD_OFFSET(Settings, _impl_.render_settings_)>(
+          reinterpret_cast<char*>(&_impl_.render_settings_),
+          reinterpret_cast<char*>(&other->_impl_.render_settings_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Settings::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[8]);
+}
+
+// ===================================================================
+
+class Database::_Internal {
+ public:
+  static const ::proto_schema::transport::TransportData& transport_data(const Database* msg);
+  static const ::proto_schema::transport::Settings& settings(const Database* msg);
+  static const ::proto_schema::router::Router& router(const Database* msg);
+  static const ::proto_schema::transport::Stats& stats(const Database* msg);
+};
+
+const ::proto_schema::transport::TransportData&
+Database::_Internal::transport_data(const Database* msg) {
+  return *msg->_impl_.transport_data_;
+}
+const ::proto_schema::transport::Settings&
+Database::_Internal::settings(const Database* msg) {
+  return *msg->_impl_.settings_;
+}
+const ::proto_schema::router::Router&
+Database::_Internal::router(const Database* msg) {
+  return *msg->_impl_.router_;
+}
+const ::proto_schema::transport::Stats&
+Database::_Internal::stats(const Database* msg) {
+  return *msg->_impl_.stats_;
+}
+void Database::clear_router() {
+  if (GetArenaForAllocation() == nullptr && _impl_.router_ != nullptr) {
+    delete _impl_.router_;
+  }
+  _impl_.router_ = nullptr;
+}
+Database::Database(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                         bool is_message_owned)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena, is_message_owned) {
+  SharedCtor(arena, is_message_owned);
+  // @@protoc_insertion_point(arena_constructor:proto_schema.transport.Database)
+}
+Database::Database(const Database& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message() {
+  Database* const _this = this; (void)_this;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transport_data_){nullptr}
+    , decltype(_impl_.settings_){nullptr}
+    , decltype(_impl_.router_){nullptr}
+    , decltype(_impl_.stats_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}};
+
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  if (from._internal_has_transport_data()) {
+    _this->_impl_.transport_data_ = new ::proto_schema::transport::TransportData(*from._impl_.transport_data_);
+  }
+  if (from._internal_has_settings()) {
+    _this->_impl_.settings_ = new ::proto_schema::transport::Settings(*from._impl_.settings_);
+  }
+  if (from._internal_has_router()) {
+    _this->_impl_.router_ = new ::proto_schema::router::Router(*from._impl_.router_);
+  }
+  if (from._internal_has_stats()) {
+    _this->_impl_.stats_ = new ::proto_schema::transport::Stats(*from._impl_.stats_);
+  }
+  // @@protoc_insertion_point(copy_constructor:proto_schema.transport.Database)
+}
+
+inline void Database::SharedCtor(
+    ::_pb::Arena* arena, bool is_message_owned) {
+  (void)arena;
+  (void)is_message_owned;
+  new (&_impl_) Impl_{
+      decltype(_impl_.transport_data_){nullptr}
+    , decltype(_impl_.settings_){nullptr}
+    , decltype(_impl_.router_){nullptr}
+    , decltype(_impl_.stats_){nullptr}
+    , /*decltype(_impl_._cached_size_)*/{}
+  };
+}
+
+Database::~Database() {
+  // @@protoc_insertion_point(destructor:proto_schema.transport.Database)
+  if (auto *arena = _internal_metadata_.DeleteReturnArena<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>()) {
+  (void)arena;
+    return;
+  }
+  SharedDtor();
+}
+
+inline void Database::SharedDtor() {
+  GOOGLE_DCHECK(GetArenaForAllocation() == nullptr);
+  if (this != internal_default_instance()) delete _impl_.transport_data_;
+  if (this != internal_default_instance()) delete _impl_.settings_;
+  if (this != internal_default_instance()) delete _impl_.router_;
+  if (this != internal_default_instance()) delete _impl_.stats_;
+}
+
+void Database::SetCachedSize(int size) const {
+  _impl_._cached_size_.Set(size);
+}
+
+void Database::Clear() {
+// @@protoc_insertion_point(message_clear_start:proto_schema.transport.Database)
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  if (GetArenaForAllocation() == nullptr && _impl_.transport_data_ != nullptr) {
+    delete _impl_.transport_data_;
+  }
+  _impl_.transport_data_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.settings_ != nullptr) {
+    delete _impl_.settings_;
+  }
+  _impl_.settings_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.router_ != nullptr) {
+    delete _impl_.router_;
+  }
+  _impl_.router_ = nullptr;
+  if (GetArenaForAllocation() == nullptr && _impl_.stats_ != nullptr) {
+    delete _impl_.stats_;
+  }
+  _impl_.stats_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* Database::_InternalParse(const char* ptr, ::_pbi::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  while (!ctx->Done(&ptr)) {
+    uint32_t tag;
+    ptr = ::_pbi::ReadTag(ptr, &tag);
+    switch (tag >> 3) {
+      // .proto_schema.transport.TransportData transport_data = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_transport_data(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.transport.Settings settings = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 18)) {
+          ptr = ctx->ParseMessage(_internal_mutable_settings(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.router.Router router = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_router(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      // .proto_schema.transport.Stats stats = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<uint8_t>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_stats(), ptr);
+          CHK_(ptr);
+        } else
+          goto handle_unusual;
+        continue;
+      default:
+        goto handle_unusual;
+    }  // switch
+  handle_unusual:
+    if ((tag == 0) || ((tag & 7) == 4)) {
+      CHK_(ptr);
+      ctx->SetLastTag(tag);
+      goto message_done;
+    }
+    ptr = UnknownFieldParse(
+        tag,
+        _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+        ptr, ctx);
+    CHK_(ptr != nullptr);
+  }  // while
+message_done:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto message_done;
+#undef CHK_
+}
+
+uint8_t* Database::_InternalSerialize(
+    uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:proto_schema.transport.Database)
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .proto_schema.transport.TransportData transport_data = 1;
+  if (this->_internal_has_transport_data()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, _Internal::transport_data(this),
+        _Internal::transport_data(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.transport.Settings settings = 2;
+  if (this->_internal_has_settings()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, _Internal::settings(this),
+        _Internal::settings(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.router.Router router = 3;
+  if (this->_internal_has_router()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(3, _Internal::router(this),
+        _Internal::router(this).GetCachedSize(), target, stream);
+  }
+
+  // .proto_schema.transport.Stats stats = 4;
+  if (this->_internal_has_stats()) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(4, _Internal::stats(this),
+        _Internal::stats(this).GetCachedSize(), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::_pbi::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:proto_schema.transport.Database)
+  return target;
+}
+
+size_t Database::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:proto_schema.transport.Database)
+  size_t total_size = 0;
+
+  uint32_t cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // .proto_schema.transport.TransportData transport_data = 1;
+  if (this->_internal_has_transport_data()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.transport_data_);
+  }
+
+  // .proto_schema.transport.Settings settings = 2;
+  if (this->_internal_has_settings()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.settings_);
+  }
+
+  // .proto_schema.router.Router router = 3;
+  if (this->_internal_has_router()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.router_);
+  }
+
+  // .proto_schema.transport.Stats stats = 4;
+  if (this->_internal_has_stats()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *_impl_.stats_);
+  }
+
+  return MaybeComputeUnknownFieldsSize(total_size, &_impl_._cached_size_);
+}
+
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData Database::_class_data_ = {
+    ::PROTOBUF_NAMESPACE_ID::Message::CopyWithSourceCheck,
+    Database::MergeImpl
+};
+const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*Database::GetClassData() const { return &_class_data_; }
+
+
+void Database::MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg) {
+  auto* const _this = static_cast<Database*>(&to_msg);
+  auto& from = static_cast<const Database&>(from_msg);
+  // @@protoc_insertion_point(class_specific_merge_from_start:proto_schema.transport.Database)
+  GOOGLE_DCHECK_NE(&from, _this);
+  uint32_t cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from._internal_has_transport_data()) {
+    _this->_internal_mutable_transport_data()->::proto_schema::transport::TransportData::MergeFrom(
+        from._internal_transport_data());
+  }
+  if (from._internal_has_settings()) {
+    _this->_internal_mutable_settings()->::proto_schema::transport::Settings::MergeFrom(
+        from._internal_settings());
+  }
+  if (from._internal_has_router()) {
+    _this->_internal_mutable_router()->::proto_schema::router::Router::MergeFrom(
+        from._internal_router());
+  }
+  if (from._internal_has_stats()) {
+    _this->_internal_mutable_stats()->::proto_schema::transport::Stats::MergeFrom(
+        from._internal_stats());
+  }
+  _this->_internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+}
+
+void Database::CopyFrom(const Database& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:proto_schema.transport.Database)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool Database::IsInitialized() const {
+  return true;
+}
+
+void Database::InternalSwap(Database* other) {
+  using std::swap;
+  _internal_metadata_.InternalSwap(&other->_internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(Database, _impl_.stats_)
+      + sizeof(Database::_impl_.stats_)
+      - PROTOBUF_FIELD_OFFSET(Database, _impl_.transport_data_)>(
+          reinterpret_cast<char*>(&_impl_.transport_data_),
+          reinterpret_cast<char*>(&other->_impl_.transport_data_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata Database::GetMetadata() const {
+  return ::_pbi::AssignDescriptors(
+      &descriptor_table_transport_5fcatalogue_2eproto_getter, &descriptor_table_transport_5fcatalogue_2eproto_once,
+      file_level_metadata_transport_5fcatalogue_2eproto[9]);
+}
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace transport
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::Coordinates*
+Arena::CreateMaybeMessage< ::proto_schema::transport::Coordinates >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::Coordinates >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::Stop*
+Arena::CreateMaybeMessage< ::proto_schema::transport::Stop >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::Stop >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::Bus*
+Arena::CreateMaybeMessage< ::proto_schema::transport::Bus >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::Bus >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::DistancesBetweenStops*
+Arena::CreateMaybeMessage< ::proto_schema::transport::DistancesBetweenStops >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::DistancesBetweenStops >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::TransportData*
+Arena::CreateMaybeMessage< ::proto_schema::transport::TransportData >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::TransportData >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::BusStat*
+Arena::CreateMaybeMessage< ::proto_schema::transport::BusStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::BusStat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::StopStat*
+Arena::CreateMaybeMessage< ::proto_schema::transport::StopStat >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::StopStat >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::Stats*
+Arena::CreateMaybeMessage< ::proto_schema::transport::Stats >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::Stats >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::Settings*
+Arena::CreateMaybeMessage< ::proto_schema::transport::Settings >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::Settings >(arena);
+}
+template<> PROTOBUF_NOINLINE ::proto_schema::transport::Database*
+Arena::CreateMaybeMessage< ::proto_schema::transport::Database >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::proto_schema::transport::Database >(arena);
+}
+PROTOBUF_NAMESPACE_CLOSE
+
+// @@protoc_insertion_point(global_scope)
+#include <google/protobuf/port_undef.inc>
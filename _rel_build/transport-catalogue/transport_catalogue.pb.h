@@ -0,0 +1,3186 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: transport_catalogue.proto
+
+#ifndef GOOGLE_PROTOBUF_INCLUDED_transport_5fcatalogue_2eproto
+#define GOOGLE_PROTOBUF_INCLUDED_transport_5fcatalogue_2eproto
+
+#include <limits>
+#include <string>
+
+#include <google/protobuf/port_def.inc>
+#if PROTOBUF_VERSION < 3021000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please update
+#error your headers.
+#endif
+#if 3021012 < PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers. Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/port_undef.inc>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/generated_message_reflection.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/unknown_field_set.h>
+#include "map_renderer.pb.h"
+#include "transport_router.pb.h"
+// @@protoc_insertion_point(includes)
+#include <google/protobuf/port_def.inc>
+#define PROTOBUF_INTERNAL_EXPORT_transport_5fcatalogue_2eproto
+PROTOBUF_NAMESPACE_OPEN
+namespace internal {
+class AnyMetadata;
+}  // namespace internal
+PROTOBUF_NAMESPACE_CLOSE
+
+// Internal implementation detail -- do not use these members.
+struct TableStruct_transport_5fcatalogue_2eproto {
+  static const uint32_t offsets[];
+};
+extern const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_transport_5fcatalogue_2eproto;
+namespace proto_schema {
+namespace transport {
+class Bus;
+struct BusDefaultTypeInternal;
+extern BusDefaultTypeInternal _Bus_default_instance_;
+class BusStat;
+struct BusStatDefaultTypeInternal;
+extern BusStatDefaultTypeInternal _BusStat_default_instance_;
+class Coordinates;
+struct CoordinatesDefaultTypeInternal;
+extern CoordinatesDefaultTypeInternal _Coordinates_default_instance_;
+class Database;
+struct DatabaseDefaultTypeInternal;
+extern DatabaseDefaultTypeInternal _Database_default_instance_;
+class DistancesBetweenStops;
+struct DistancesBetweenStopsDefaultTypeInternal;
+extern DistancesBetweenStopsDefaultTypeInternal _DistancesBetweenStops_default_instance_;
+class Settings;
+struct SettingsDefaultTypeInternal;
+extern SettingsDefaultTypeInternal _Settings_default_instance_;
+class Stats;
+struct StatsDefaultTypeInternal;
+extern StatsDefaultTypeInternal _Stats_default_instance_;
+class Stop;
+struct StopDefaultTypeInternal;
+extern StopDefaultTypeInternal _Stop_default_instance_;
+class StopStat;
+struct StopStatDefaultTypeInternal;
+extern StopStatDefaultTypeInternal _StopStat_default_instance_;
+class TransportData;
+struct TransportDataDefaultTypeInternal;
+extern TransportDataDefaultTypeInternal _TransportData_default_instance_;
+}  // namespace transport
+}  // namespace proto_schema
+PROTOBUF_NAMESPACE_OPEN
+template<> ::proto_schema::transport::Bus* Arena::CreateMaybeMessage<::proto_schema::transport::Bus>(Arena*);
+template<> ::proto_schema::transport::BusStat* Arena::CreateMaybeMessage<::proto_schema::transport::BusStat>(Arena*);
+template<> ::proto_schema::transport::Coordinates* Arena::CreateMaybeMessage<::proto_schema::transport::Coordinates>(Arena*);
+template<> ::proto_schema::transport::Database* Arena::CreateMaybeMessage<::proto_schema::transport::Database>(Arena*);
+template<> ::proto_schema::transport::DistancesBetweenStops* Arena::CreateMaybeMessage<::proto_schema::transport::DistancesBetweenStops>(Arena*);
+template<> ::proto_schema::transport::Settings* Arena::CreateMaybeMessage<::proto_schema::transport::Settings>(Arena*);
+template<> ::proto_schema::transport::Stats* Arena::CreateMaybeMessage<::proto_schema::transport::Stats>(Arena*);
+template<> ::proto_schema::transport::Stop* Arena::CreateMaybeMessage<::proto_schema::transport::Stop>(Arena*);
+template<> ::proto_schema::transport::StopStat* Arena::CreateMaybeMessage<::proto_schema::transport::StopStat>(Arena*);
+template<> ::proto_schema::transport::TransportData* Arena::CreateMaybeMessage<::proto_schema::transport::TransportData>(Arena*);
+PROTOBUF_NAMESPACE_CLOSE
+namespace proto_schema {
+namespace transport {
+
+// ===================================================================
+
+class Coordinates final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.Coordinates) */ {
+ public:
+  inline Coordinates() : Coordinates(nullptr) {}
+  ~Coordinates() override;
+  explicit PROTOBUF_CONSTEXPR Coordinates(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Coordinates(const Coordinates& from);
+  Coordinates(Coordinates&& from) noexcept
+    : Coordinates() {
+    *this = ::std::move(from);
+  }
+
+  inline Coordinates& operator=(const Coordinates& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Coordinates& operator=(Coordinates&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Coordinates& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Coordinates* internal_default_instance() {
+    return reinterpret_cast<const Coordinates*>(
+               &_Coordinates_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    0;
+
+  friend void swap(Coordinates& a, Coordinates& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Coordinates* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Coordinates* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Coordinates* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Coordinates>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Coordinates& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Coordinates& from) {
+    Coordinates::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Coordinates* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.Coordinates";
+  }
+  protected:
+  explicit Coordinates(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kLatFieldNumber = 1,
+    kLngFieldNumber = 2,
+  };
+  // double lat = 1;
+  void clear_lat();
+  double lat() const;
+  void set_lat(double value);
+  private:
+  double _internal_lat() const;
+  void _internal_set_lat(double value);
+  public:
+
+  // double lng = 2;
+  void clear_lng();
+  double lng() const;
+  void set_lng(double value);
+  private:
+  double _internal_lng() const;
+  void _internal_set_lng(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.Coordinates)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double lat_;
+    double lng_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Stop final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.Stop) */ {
+ public:
+  inline Stop() : Stop(nullptr) {}
+  ~Stop() override;
+  explicit PROTOBUF_CONSTEXPR Stop(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Stop(const Stop& from);
+  Stop(Stop&& from) noexcept
+    : Stop() {
+    *this = ::std::move(from);
+  }
+
+  inline Stop& operator=(const Stop& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Stop& operator=(Stop&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stop& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stop* internal_default_instance() {
+    return reinterpret_cast<const Stop*>(
+               &_Stop_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    1;
+
+  friend void swap(Stop& a, Stop& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stop* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stop* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Stop* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stop>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Stop& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stop& from) {
+    Stop::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stop* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.Stop";
+  }
+  protected:
+  explicit Stop(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kNameFieldNumber = 1,
+    kCoordinatesFieldNumber = 2,
+  };
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // .proto_schema.transport.Coordinates coordinates = 2;
+  bool has_coordinates() const;
+  private:
+  bool _internal_has_coordinates() const;
+  public:
+  void clear_coordinates();
+  const ::proto_schema::transport::Coordinates& coordinates() const;
+  PROTOBUF_NODISCARD ::proto_schema::transport::Coordinates* release_coordinates();
+  ::proto_schema::transport::Coordinates* mutable_coordinates();
+  void set_allocated_coordinates(::proto_schema::transport::Coordinates* coordinates);
+  private:
+  const ::proto_schema::transport::Coordinates& _internal_coordinates() const;
+  ::proto_schema::transport::Coordinates* _internal_mutable_coordinates();
+  public:
+  void unsafe_arena_set_allocated_coordinates(
+      ::proto_schema::transport::Coordinates* coordinates);
+  ::proto_schema::transport::Coordinates* unsafe_arena_release_coordinates();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.Stop)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    ::proto_schema::transport::Coordinates* coordinates_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Bus final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.Bus) */ {
+ public:
+  inline Bus() : Bus(nullptr) {}
+  ~Bus() override;
+  explicit PROTOBUF_CONSTEXPR Bus(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Bus(const Bus& from);
+  Bus(Bus&& from) noexcept
+    : Bus() {
+    *this = ::std::move(from);
+  }
+
+  inline Bus& operator=(const Bus& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Bus& operator=(Bus&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Bus& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Bus* internal_default_instance() {
+    return reinterpret_cast<const Bus*>(
+               &_Bus_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    2;
+
+  friend void swap(Bus& a, Bus& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Bus* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Bus* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Bus* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Bus>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Bus& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Bus& from) {
+    Bus::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Bus* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.Bus";
+  }
+  protected:
+  explicit Bus(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRouteFieldNumber = 4,
+    kNameFieldNumber = 1,
+    kIsRoundtripFieldNumber = 3,
+  };
+  // repeated uint32 route = 4;
+  int route_size() const;
+  private:
+  int _internal_route_size() const;
+  public:
+  void clear_route();
+  private:
+  uint32_t _internal_route(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_route() const;
+  void _internal_add_route(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_route();
+  public:
+  uint32_t route(int index) const;
+  void set_route(int index, uint32_t value);
+  void add_route(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      route() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_route();
+
+  // string name = 1;
+  void clear_name();
+  const std::string& name() const;
+  template <typename ArgT0 = const std::string&, typename... ArgT>
+  void set_name(ArgT0&& arg0, ArgT... args);
+  std::string* mutable_name();
+  PROTOBUF_NODISCARD std::string* release_name();
+  void set_allocated_name(std::string* name);
+  private:
+  const std::string& _internal_name() const;
+  inline PROTOBUF_ALWAYS_INLINE void _internal_set_name(const std::string& value);
+  std::string* _internal_mutable_name();
+  public:
+
+  // bool is_roundtrip = 3;
+  void clear_is_roundtrip();
+  bool is_roundtrip() const;
+  void set_is_roundtrip(bool value);
+  private:
+  bool _internal_is_roundtrip() const;
+  void _internal_set_is_roundtrip(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.Bus)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > route_;
+    mutable std::atomic<int> _route_cached_byte_size_;
+    ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr name_;
+    bool is_roundtrip_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class DistancesBetweenStops final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.DistancesBetweenStops) */ {
+ public:
+  inline DistancesBetweenStops() : DistancesBetweenStops(nullptr) {}
+  ~DistancesBetweenStops() override;
+  explicit PROTOBUF_CONSTEXPR DistancesBetweenStops(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  DistancesBetweenStops(const DistancesBetweenStops& from);
+  DistancesBetweenStops(DistancesBetweenStops&& from) noexcept
+    : DistancesBetweenStops() {
+    *this = ::std::move(from);
+  }
+
+  inline DistancesBetweenStops& operator=(const DistancesBetweenStops& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline DistancesBetweenStops& operator=(DistancesBetweenStops&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const DistancesBetweenStops& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const DistancesBetweenStops* internal_default_instance() {
+    return reinterpret_cast<const DistancesBetweenStops*>(
+               &_DistancesBetweenStops_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    3;
+
+  friend void swap(DistancesBetweenStops& a, DistancesBetweenStops& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(DistancesBetweenStops* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(DistancesBetweenStops* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  DistancesBetweenStops* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<DistancesBetweenStops>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const DistancesBetweenStops& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const DistancesBetweenStops& from) {
+    DistancesBetweenStops::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(DistancesBetweenStops* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.DistancesBetweenStops";
+  }
+  protected:
+  explicit DistancesBetweenStops(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kDistanceFieldNumber = 3,
+    kFromStopFieldNumber = 4,
+    kToStopFieldNumber = 5,
+  };
+  // double distance = 3;
+  void clear_distance();
+  double distance() const;
+  void set_distance(double value);
+  private:
+  double _internal_distance() const;
+  void _internal_set_distance(double value);
+  public:
+
+  // uint32 from_stop = 4;
+  void clear_from_stop();
+  uint32_t from_stop() const;
+  void set_from_stop(uint32_t value);
+  private:
+  uint32_t _internal_from_stop() const;
+  void _internal_set_from_stop(uint32_t value);
+  public:
+
+  // uint32 to_stop = 5;
+  void clear_to_stop();
+  uint32_t to_stop() const;
+  void set_to_stop(uint32_t value);
+  private:
+  uint32_t _internal_to_stop() const;
+  void _internal_set_to_stop(uint32_t value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.DistancesBetweenStops)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    double distance_;
+    uint32_t from_stop_;
+    uint32_t to_stop_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class TransportData final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.TransportData) */ {
+ public:
+  inline TransportData() : TransportData(nullptr) {}
+  ~TransportData() override;
+  explicit PROTOBUF_CONSTEXPR TransportData(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  TransportData(const TransportData& from);
+  TransportData(TransportData&& from) noexcept
+    : TransportData() {
+    *this = ::std::move(from);
+  }
+
+  inline TransportData& operator=(const TransportData& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline TransportData& operator=(TransportData&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const TransportData& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const TransportData* internal_default_instance() {
+    return reinterpret_cast<const TransportData*>(
+               &_TransportData_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    4;
+
+  friend void swap(TransportData& a, TransportData& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(TransportData* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(TransportData* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  TransportData* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<TransportData>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const TransportData& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const TransportData& from) {
+    TransportData::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(TransportData* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.TransportData";
+  }
+  protected:
+  explicit TransportData(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kStopsFieldNumber = 1,
+    kBusesFieldNumber = 2,
+    kDistancesFieldNumber = 3,
+  };
+  // repeated .proto_schema.transport.Stop stops = 1;
+  int stops_size() const;
+  private:
+  int _internal_stops_size() const;
+  public:
+  void clear_stops();
+  ::proto_schema::transport::Stop* mutable_stops(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Stop >*
+      mutable_stops();
+  private:
+  const ::proto_schema::transport::Stop& _internal_stops(int index) const;
+  ::proto_schema::transport::Stop* _internal_add_stops();
+  public:
+  const ::proto_schema::transport::Stop& stops(int index) const;
+  ::proto_schema::transport::Stop* add_stops();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Stop >&
+      stops() const;
+
+  // repeated .proto_schema.transport.Bus buses = 2;
+  int buses_size() const;
+  private:
+  int _internal_buses_size() const;
+  public:
+  void clear_buses();
+  ::proto_schema::transport::Bus* mutable_buses(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Bus >*
+      mutable_buses();
+  private:
+  const ::proto_schema::transport::Bus& _internal_buses(int index) const;
+  ::proto_schema::transport::Bus* _internal_add_buses();
+  public:
+  const ::proto_schema::transport::Bus& buses(int index) const;
+  ::proto_schema::transport::Bus* add_buses();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Bus >&
+      buses() const;
+
+  // repeated .proto_schema.transport.DistancesBetweenStops distances = 3;
+  int distances_size() const;
+  private:
+  int _internal_distances_size() const;
+  public:
+  void clear_distances();
+  ::proto_schema::transport::DistancesBetweenStops* mutable_distances(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::DistancesBetweenStops >*
+      mutable_distances();
+  private:
+  const ::proto_schema::transport::DistancesBetweenStops& _internal_distances(int index) const;
+  ::proto_schema::transport::DistancesBetweenStops* _internal_add_distances();
+  public:
+  const ::proto_schema::transport::DistancesBetweenStops& distances(int index) const;
+  ::proto_schema::transport::DistancesBetweenStops* add_distances();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::DistancesBetweenStops >&
+      distances() const;
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.TransportData)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Stop > stops_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Bus > buses_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::DistancesBetweenStops > distances_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class BusStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.BusStat) */ {
+ public:
+  inline BusStat() : BusStat(nullptr) {}
+  ~BusStat() override;
+  explicit PROTOBUF_CONSTEXPR BusStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  BusStat(const BusStat& from);
+  BusStat(BusStat&& from) noexcept
+    : BusStat() {
+    *this = ::std::move(from);
+  }
+
+  inline BusStat& operator=(const BusStat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline BusStat& operator=(BusStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const BusStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const BusStat* internal_default_instance() {
+    return reinterpret_cast<const BusStat*>(
+               &_BusStat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    5;
+
+  friend void swap(BusStat& a, BusStat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(BusStat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(BusStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  BusStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<BusStat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const BusStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const BusStat& from) {
+    BusStat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(BusStat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.BusStat";
+  }
+  protected:
+  explicit BusStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTotalStopsFieldNumber = 1,
+    kUniqueStopsFieldNumber = 2,
+    kRouteLengthFieldNumber = 3,
+    kRouteCurvatureFieldNumber = 4,
+  };
+  // uint32 total_stops = 1;
+  void clear_total_stops();
+  uint32_t total_stops() const;
+  void set_total_stops(uint32_t value);
+  private:
+  uint32_t _internal_total_stops() const;
+  void _internal_set_total_stops(uint32_t value);
+  public:
+
+  // uint32 unique_stops = 2;
+  void clear_unique_stops();
+  uint32_t unique_stops() const;
+  void set_unique_stops(uint32_t value);
+  private:
+  uint32_t _internal_unique_stops() const;
+  void _internal_set_unique_stops(uint32_t value);
+  public:
+
+  // double route_length = 3;
+  void clear_route_length();
+  double route_length() const;
+  void set_route_length(double value);
+  private:
+  double _internal_route_length() const;
+  void _internal_set_route_length(double value);
+  public:
+
+  // double route_curvature = 4;
+  void clear_route_curvature();
+  double route_curvature() const;
+  void set_route_curvature(double value);
+  private:
+  double _internal_route_curvature() const;
+  void _internal_set_route_curvature(double value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.BusStat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    uint32_t total_stops_;
+    uint32_t unique_stops_;
+    double route_length_;
+    double route_curvature_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class StopStat final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.StopStat) */ {
+ public:
+  inline StopStat() : StopStat(nullptr) {}
+  ~StopStat() override;
+  explicit PROTOBUF_CONSTEXPR StopStat(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  StopStat(const StopStat& from);
+  StopStat(StopStat&& from) noexcept
+    : StopStat() {
+    *this = ::std::move(from);
+  }
+
+  inline StopStat& operator=(const StopStat& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline StopStat& operator=(StopStat&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const StopStat& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const StopStat* internal_default_instance() {
+    return reinterpret_cast<const StopStat*>(
+               &_StopStat_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    6;
+
+  friend void swap(StopStat& a, StopStat& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(StopStat* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(StopStat* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  StopStat* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<StopStat>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const StopStat& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const StopStat& from) {
+    StopStat::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(StopStat* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.StopStat";
+  }
+  protected:
+  explicit StopStat(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBusesFieldNumber = 1,
+  };
+  // repeated uint32 buses = 1;
+  int buses_size() const;
+  private:
+  int _internal_buses_size() const;
+  public:
+  void clear_buses();
+  private:
+  uint32_t _internal_buses(int index) const;
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      _internal_buses() const;
+  void _internal_add_buses(uint32_t value);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      _internal_mutable_buses();
+  public:
+  uint32_t buses(int index) const;
+  void set_buses(int index, uint32_t value);
+  void add_buses(uint32_t value);
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+      buses() const;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+      mutable_buses();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.StopStat)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t > buses_;
+    mutable std::atomic<int> _buses_cached_byte_size_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Stats final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.Stats) */ {
+ public:
+  inline Stats() : Stats(nullptr) {}
+  ~Stats() override;
+  explicit PROTOBUF_CONSTEXPR Stats(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Stats(const Stats& from);
+  Stats(Stats&& from) noexcept
+    : Stats() {
+    *this = ::std::move(from);
+  }
+
+  inline Stats& operator=(const Stats& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Stats& operator=(Stats&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Stats& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Stats* internal_default_instance() {
+    return reinterpret_cast<const Stats*>(
+               &_Stats_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    7;
+
+  friend void swap(Stats& a, Stats& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Stats* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Stats* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Stats* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Stats>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Stats& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Stats& from) {
+    Stats::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Stats* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.Stats";
+  }
+  protected:
+  explicit Stats(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kBusStatsFieldNumber = 1,
+    kStopStatsFieldNumber = 2,
+  };
+  // repeated .proto_schema.transport.BusStat bus_stats = 1;
+  int bus_stats_size() const;
+  private:
+  int _internal_bus_stats_size() const;
+  public:
+  void clear_bus_stats();
+  ::proto_schema::transport::BusStat* mutable_bus_stats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::BusStat >*
+      mutable_bus_stats();
+  private:
+  const ::proto_schema::transport::BusStat& _internal_bus_stats(int index) const;
+  ::proto_schema::transport::BusStat* _internal_add_bus_stats();
+  public:
+  const ::proto_schema::transport::BusStat& bus_stats(int index) const;
+  ::proto_schema::transport::BusStat* add_bus_stats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::BusStat >&
+      bus_stats() const;
+
+  // repeated .proto_schema.transport.StopStat stop_stats = 2;
+  int stop_stats_size() const;
+  private:
+  int _internal_stop_stats_size() const;
+  public:
+  void clear_stop_stats();
+  ::proto_schema::transport::StopStat* mutable_stop_stats(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::StopStat >*
+      mutable_stop_stats();
+  private:
+  const ::proto_schema::transport::StopStat& _internal_stop_stats(int index) const;
+  ::proto_schema::transport::StopStat* _internal_add_stop_stats();
+  public:
+  const ::proto_schema::transport::StopStat& stop_stats(int index) const;
+  ::proto_schema::transport::StopStat* add_stop_stats();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::StopStat >&
+      stop_stats() const;
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.Stats)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::BusStat > bus_stats_;
+    ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::StopStat > stop_stats_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Settings final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.Settings) */ {
+ public:
+  inline Settings() : Settings(nullptr) {}
+  ~Settings() override;
+  explicit PROTOBUF_CONSTEXPR Settings(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Settings(const Settings& from);
+  Settings(Settings&& from) noexcept
+    : Settings() {
+    *this = ::std::move(from);
+  }
+
+  inline Settings& operator=(const Settings& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Settings& operator=(Settings&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Settings& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Settings* internal_default_instance() {
+    return reinterpret_cast<const Settings*>(
+               &_Settings_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    8;
+
+  friend void swap(Settings& a, Settings& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Settings* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Settings* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Settings* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Settings>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Settings& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Settings& from) {
+    Settings::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Settings* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.Settings";
+  }
+  protected:
+  explicit Settings(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kRenderSettingsFieldNumber = 1,
+    kRoutingSettingsFieldNumber = 2,
+  };
+  // .proto_schema.maps.RenderSettings render_settings = 1;
+  bool has_render_settings() const;
+  private:
+  bool _internal_has_render_settings() const;
+  public:
+  void clear_render_settings();
+  const ::proto_schema::maps::RenderSettings& render_settings() const;
+  PROTOBUF_NODISCARD ::proto_schema::maps::RenderSettings* release_render_settings();
+  ::proto_schema::maps::RenderSettings* mutable_render_settings();
+  void set_allocated_render_settings(::proto_schema::maps::RenderSettings* render_settings);
+  private:
+  const ::proto_schema::maps::RenderSettings& _internal_render_settings() const;
+  ::proto_schema::maps::RenderSettings* _internal_mutable_render_settings();
+  public:
+  void unsafe_arena_set_allocated_render_settings(
+      ::proto_schema::maps::RenderSettings* render_settings);
+  ::proto_schema::maps::RenderSettings* unsafe_arena_release_render_settings();
+
+  // .proto_schema.router.RoutingSettings routing_settings = 2;
+  bool has_routing_settings() const;
+  private:
+  bool _internal_has_routing_settings() const;
+  public:
+  void clear_routing_settings();
+  const ::proto_schema::router::RoutingSettings& routing_settings() const;
+  PROTOBUF_NODISCARD ::proto_schema::router::RoutingSettings* release_routing_settings();
+  ::proto_schema::router::RoutingSettings* mutable_routing_settings();
+  void set_allocated_routing_settings(::proto_schema::router::RoutingSettings* routing_settings);
+  private:
+  const ::proto_schema::router::RoutingSettings& _internal_routing_settings() const;
+  ::proto_schema::router::RoutingSettings* _internal_mutable_routing_settings();
+  public:
+  void unsafe_arena_set_allocated_routing_settings(
+      ::proto_schema::router::RoutingSettings* routing_settings);
+  ::proto_schema::router::RoutingSettings* unsafe_arena_release_routing_settings();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.Settings)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto_schema::maps::RenderSettings* render_settings_;
+    ::proto_schema::router::RoutingSettings* routing_settings_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// -------------------------------------------------------------------
+
+class Database final :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:proto_schema.transport.Database) */ {
+ public:
+  inline Database() : Database(nullptr) {}
+  ~Database() override;
+  explicit PROTOBUF_CONSTEXPR Database(::PROTOBUF_NAMESPACE_ID::internal::ConstantInitialized);
+
+  Database(const Database& from);
+  Database(Database&& from) noexcept
+    : Database() {
+    *this = ::std::move(from);
+  }
+
+  inline Database& operator=(const Database& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline Database& operator=(Database&& from) noexcept {
+    if (this == &from) return *this;
+    if (GetOwningArena() == from.GetOwningArena()
+  #ifdef PROTOBUF_FORCE_COPY_IN_MOVE
+        && GetOwningArena() != nullptr
+  #endif  // !PROTOBUF_FORCE_COPY_IN_MOVE
+    ) {
+      InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return default_instance().GetMetadata().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return default_instance().GetMetadata().reflection;
+  }
+  static const Database& default_instance() {
+    return *internal_default_instance();
+  }
+  static inline const Database* internal_default_instance() {
+    return reinterpret_cast<const Database*>(
+               &_Database_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    9;
+
+  friend void swap(Database& a, Database& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(Database* other) {
+    if (other == this) return;
+  #ifdef PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() != nullptr &&
+        GetOwningArena() == other->GetOwningArena()) {
+   #else  // PROTOBUF_FORCE_COPY_IN_SWAP
+    if (GetOwningArena() == other->GetOwningArena()) {
+  #endif  // !PROTOBUF_FORCE_COPY_IN_SWAP
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(Database* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetOwningArena() == other->GetOwningArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  Database* New(::PROTOBUF_NAMESPACE_ID::Arena* arena = nullptr) const final {
+    return CreateMaybeMessage<Database>(arena);
+  }
+  using ::PROTOBUF_NAMESPACE_ID::Message::CopyFrom;
+  void CopyFrom(const Database& from);
+  using ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom;
+  void MergeFrom( const Database& from) {
+    Database::MergeImpl(*this, from);
+  }
+  private:
+  static void MergeImpl(::PROTOBUF_NAMESPACE_ID::Message& to_msg, const ::PROTOBUF_NAMESPACE_ID::Message& from_msg);
+  public:
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  uint8_t* _InternalSerialize(
+      uint8_t* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _impl_._cached_size_.Get(); }
+
+  private:
+  void SharedCtor(::PROTOBUF_NAMESPACE_ID::Arena* arena, bool is_message_owned);
+  void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(Database* other);
+
+  private:
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "proto_schema.transport.Database";
+  }
+  protected:
+  explicit Database(::PROTOBUF_NAMESPACE_ID::Arena* arena,
+                       bool is_message_owned = false);
+  public:
+
+  static const ClassData _class_data_;
+  const ::PROTOBUF_NAMESPACE_ID::Message::ClassData*GetClassData() const final;
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kTransportDataFieldNumber = 1,
+    kSettingsFieldNumber = 2,
+    kRouterFieldNumber = 3,
+    kStatsFieldNumber = 4,
+  };
+  // .proto_schema.transport.TransportData transport_data = 1;
+  bool has_transport_data() const;
+  private:
+  bool _internal_has_transport_data() const;
+  public:
+  void clear_transport_data();
+  const ::proto_schema::transport::TransportData& transport_data() const;
+  PROTOBUF_NODISCARD ::proto_schema::transport::TransportData* release_transport_data();
+  ::proto_schema::transport::TransportData* mutable_transport_data();
+  void set_allocated_transport_data(::proto_schema::transport::TransportData* transport_data);
+  private:
+  const ::proto_schema::transport::TransportData& _internal_transport_data() const;
+  ::proto_schema::transport::TransportData* _internal_mutable_transport_data();
+  public:
+  void unsafe_arena_set_allocated_transport_data(
+      ::proto_schema::transport::TransportData* transport_data);
+  ::proto_schema::transport::TransportData* unsafe_arena_release_transport_data();
+
+  // .proto_schema.transport.Settings settings = 2;
+  bool has_settings() const;
+  private:
+  bool _internal_has_settings() const;
+  public:
+  void clear_settings();
+  const ::proto_schema::transport::Settings& settings() const;
+  PROTOBUF_NODISCARD ::proto_schema::transport::Settings* release_settings();
+  ::proto_schema::transport::Settings* mutable_settings();
+  void set_allocated_settings(::proto_schema::transport::Settings* settings);
+  private:
+  const ::proto_schema::transport::Settings& _internal_settings() const;
+  ::proto_schema::transport::Settings* _internal_mutable_settings();
+  public:
+  void unsafe_arena_set_allocated_settings(
+      ::proto_schema::transport::Settings* settings);
+  ::proto_schema::transport::Settings* unsafe_arena_release_settings();
+
+  // .proto_schema.router.Router router = 3;
+  bool has_router() const;
+  private:
+  bool _internal_has_router() const;
+  public:
+  void clear_router();
+  const ::proto_schema::router::Router& router() const;
+  PROTOBUF_NODISCARD ::proto_schema::router::Router* release_router();
+  ::proto_schema::router::Router* mutable_router();
+  void set_allocated_router(::proto_schema::router::Router* router);
+  private:
+  const ::proto_schema::router::Router& _internal_router() const;
+  ::proto_schema::router::Router* _internal_mutable_router();
+  public:
+  void unsafe_arena_set_allocated_router(
+      ::proto_schema::router::Router* router);
+  ::proto_schema::router::Router* unsafe_arena_release_router();
+
+  // .proto_schema.transport.Stats stats = 4;
+  bool has_stats() const;
+  private:
+  bool _internal_has_stats() const;
+  public:
+  void clear_stats();
+  const ::proto_schema::transport::Stats& stats() const;
+  PROTOBUF_NODISCARD ::proto_schema::transport::Stats* release_stats();
+  ::proto_schema::transport::Stats* mutable_stats();
+  void set_allocated_stats(::proto_schema::transport::Stats* stats);
+  private:
+  const ::proto_schema::transport::Stats& _internal_stats() const;
+  ::proto_schema::transport::Stats* _internal_mutable_stats();
+  public:
+  void unsafe_arena_set_allocated_stats(
+      ::proto_schema::transport::Stats* stats);
+  ::proto_schema::transport::Stats* unsafe_arena_release_stats();
+
+  // @@protoc_insertion_point(class_scope:proto_schema.transport.Database)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  struct Impl_ {
+    ::proto_schema::transport::TransportData* transport_data_;
+    ::proto_schema::transport::Settings* settings_;
+    ::proto_schema::router::Router* router_;
+    ::proto_schema::transport::Stats* stats_;
+    mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  };
+  union { Impl_ _impl_; };
+  friend struct ::TableStruct_transport_5fcatalogue_2eproto;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wstrict-aliasing"
+#endif  // __GNUC__
+// Coordinates
+
+// double lat = 1;
+inline void Coordinates::clear_lat() {
+  _impl_.lat_ = 0;
+}
+inline double Coordinates::_internal_lat() const {
+  return _impl_.lat_;
+}
+inline double Coordinates::lat() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Coordinates.lat)
+  return _internal_lat();
+}
+inline void Coordinates::_internal_set_lat(double value) {
+  
+  _impl_.lat_ = value;
+}
+inline void Coordinates::set_lat(double value) {
+  _internal_set_lat(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.Coordinates.lat)
+}
+
+// double lng = 2;
+inline void Coordinates::clear_lng() {
+  _impl_.lng_ = 0;
+}
+inline double Coordinates::_internal_lng() const {
+  return _impl_.lng_;
+}
+inline double Coordinates::lng() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Coordinates.lng)
+  return _internal_lng();
+}
+inline void Coordinates::_internal_set_lng(double value) {
+  
+  _impl_.lng_ = value;
+}
+inline void Coordinates::set_lng(double value) {
+  _internal_set_lng(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.Coordinates.lng)
+}
+
+// -------------------------------------------------------------------
+
+// Stop
+
+// string name = 1;
+inline void Stop::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Stop::name() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Stop.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Stop::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto_schema.transport.Stop.name)
+}
+inline std::string* Stop::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Stop.name)
+  return _s;
+}
+inline const std::string& Stop::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Stop::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Stop::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Stop::release_name() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Stop.name)
+  return _impl_.name_.Release();
+}
+inline void Stop::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Stop.name)
+}
+
+// .proto_schema.transport.Coordinates coordinates = 2;
+inline bool Stop::_internal_has_coordinates() const {
+  return this != internal_default_instance() && _impl_.coordinates_ != nullptr;
+}
+inline bool Stop::has_coordinates() const {
+  return _internal_has_coordinates();
+}
+inline void Stop::clear_coordinates() {
+  if (GetArenaForAllocation() == nullptr && _impl_.coordinates_ != nullptr) {
+    delete _impl_.coordinates_;
+  }
+  _impl_.coordinates_ = nullptr;
+}
+inline const ::proto_schema::transport::Coordinates& Stop::_internal_coordinates() const {
+  const ::proto_schema::transport::Coordinates* p = _impl_.coordinates_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::transport::Coordinates&>(
+      ::proto_schema::transport::_Coordinates_default_instance_);
+}
+inline const ::proto_schema::transport::Coordinates& Stop::coordinates() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Stop.coordinates)
+  return _internal_coordinates();
+}
+inline void Stop::unsafe_arena_set_allocated_coordinates(
+    ::proto_schema::transport::Coordinates* coordinates) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.coordinates_);
+  }
+  _impl_.coordinates_ = coordinates;
+  if (coordinates) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Stop.coordinates)
+}
+inline ::proto_schema::transport::Coordinates* Stop::release_coordinates() {
+  
+  ::proto_schema::transport::Coordinates* temp = _impl_.coordinates_;
+  _impl_.coordinates_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::transport::Coordinates* Stop::unsafe_arena_release_coordinates() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Stop.coordinates)
+  
+  ::proto_schema::transport::Coordinates* temp = _impl_.coordinates_;
+  _impl_.coordinates_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::transport::Coordinates* Stop::_internal_mutable_coordinates() {
+  
+  if (_impl_.coordinates_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::transport::Coordinates>(GetArenaForAllocation());
+    _impl_.coordinates_ = p;
+  }
+  return _impl_.coordinates_;
+}
+inline ::proto_schema::transport::Coordinates* Stop::mutable_coordinates() {
+  ::proto_schema::transport::Coordinates* _msg = _internal_mutable_coordinates();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Stop.coordinates)
+  return _msg;
+}
+inline void Stop::set_allocated_coordinates(::proto_schema::transport::Coordinates* coordinates) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.coordinates_;
+  }
+  if (coordinates) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(coordinates);
+    if (message_arena != submessage_arena) {
+      coordinates = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, coordinates, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.coordinates_ = coordinates;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Stop.coordinates)
+}
+
+// -------------------------------------------------------------------
+
+// Bus
+
+// string name = 1;
+inline void Bus::clear_name() {
+  _impl_.name_.ClearToEmpty();
+}
+inline const std::string& Bus::name() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Bus.name)
+  return _internal_name();
+}
+template <typename ArgT0, typename... ArgT>
+inline PROTOBUF_ALWAYS_INLINE
+void Bus::set_name(ArgT0&& arg0, ArgT... args) {
+ 
+ _impl_.name_.Set(static_cast<ArgT0 &&>(arg0), args..., GetArenaForAllocation());
+  // @@protoc_insertion_point(field_set:proto_schema.transport.Bus.name)
+}
+inline std::string* Bus::mutable_name() {
+  std::string* _s = _internal_mutable_name();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Bus.name)
+  return _s;
+}
+inline const std::string& Bus::_internal_name() const {
+  return _impl_.name_.Get();
+}
+inline void Bus::_internal_set_name(const std::string& value) {
+  
+  _impl_.name_.Set(value, GetArenaForAllocation());
+}
+inline std::string* Bus::_internal_mutable_name() {
+  
+  return _impl_.name_.Mutable(GetArenaForAllocation());
+}
+inline std::string* Bus::release_name() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Bus.name)
+  return _impl_.name_.Release();
+}
+inline void Bus::set_allocated_name(std::string* name) {
+  if (name != nullptr) {
+    
+  } else {
+    
+  }
+  _impl_.name_.SetAllocated(name, GetArenaForAllocation());
+#ifdef PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  if (_impl_.name_.IsDefault()) {
+    _impl_.name_.Set("", GetArenaForAllocation());
+  }
+#endif // PROTOBUF_FORCE_COPY_DEFAULT_STRING
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Bus.name)
+}
+
+// bool is_roundtrip = 3;
+inline void Bus::clear_is_roundtrip() {
+  _impl_.is_roundtrip_ = false;
+}
+inline bool Bus::_internal_is_roundtrip() const {
+  return _impl_.is_roundtrip_;
+}
+inline bool Bus::is_roundtrip() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Bus.is_roundtrip)
+  return _internal_is_roundtrip();
+}
+inline void Bus::_internal_set_is_roundtrip(bool value) {
+  
+  _impl_.is_roundtrip_ = value;
+}
+inline void Bus::set_is_roundtrip(bool value) {
+  _internal_set_is_roundtrip(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.Bus.is_roundtrip)
+}
+
+// repeated uint32 route = 4;
+inline int Bus::_internal_route_size() const {
+  return _impl_.route_.size();
+}
+inline int Bus::route_size() const {
+  return _internal_route_size();
+}
+inline void Bus::clear_route() {
+  _impl_.route_.Clear();
+}
+inline uint32_t Bus::_internal_route(int index) const {
+  return _impl_.route_.Get(index);
+}
+inline uint32_t Bus::route(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Bus.route)
+  return _internal_route(index);
+}
+inline void Bus::set_route(int index, uint32_t value) {
+  _impl_.route_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.Bus.route)
+}
+inline void Bus::_internal_add_route(uint32_t value) {
+  _impl_.route_.Add(value);
+}
+inline void Bus::add_route(uint32_t value) {
+  _internal_add_route(value);
+  // @@protoc_insertion_point(field_add:proto_schema.transport.Bus.route)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Bus::_internal_route() const {
+  return _impl_.route_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+Bus::route() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.Bus.route)
+  return _internal_route();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Bus::_internal_mutable_route() {
+  return &_impl_.route_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+Bus::mutable_route() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.Bus.route)
+  return _internal_mutable_route();
+}
+
+// -------------------------------------------------------------------
+
+// DistancesBetweenStops
+
+// double distance = 3;
+inline void DistancesBetweenStops::clear_distance() {
+  _impl_.distance_ = 0;
+}
+inline double DistancesBetweenStops::_internal_distance() const {
+  return _impl_.distance_;
+}
+inline double DistancesBetweenStops::distance() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.DistancesBetweenStops.distance)
+  return _internal_distance();
+}
+inline void DistancesBetweenStops::_internal_set_distance(double value) {
+  
+  _impl_.distance_ = value;
+}
+inline void DistancesBetweenStops::set_distance(double value) {
+  _internal_set_distance(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.DistancesBetweenStops.distance)
+}
+
+// uint32 from_stop = 4;
+inline void DistancesBetweenStops::clear_from_stop() {
+  _impl_.from_stop_ = 0u;
+}
+inline uint32_t DistancesBetweenStops::_internal_from_stop() const {
+  return _impl_.from_stop_;
+}
+inline uint32_t DistancesBetweenStops::from_stop() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.DistancesBetweenStops.from_stop)
+  return _internal_from_stop();
+}
+inline void DistancesBetweenStops::_internal_set_from_stop(uint32_t value) {
+  
+  _impl_.from_stop_ = value;
+}
+inline void DistancesBetweenStops::set_from_stop(uint32_t value) {
+  _internal_set_from_stop(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.DistancesBetweenStops.from_stop)
+}
+
+// uint32 to_stop = 5;
+inline void DistancesBetweenStops::clear_to_stop() {
+  _impl_.to_stop_ = 0u;
+}
+inline uint32_t DistancesBetweenStops::_internal_to_stop() const {
+  return _impl_.to_stop_;
+}
+inline uint32_t DistancesBetweenStops::to_stop() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.DistancesBetweenStops.to_stop)
+  return _internal_to_stop();
+}
+inline void DistancesBetweenStops::_internal_set_to_stop(uint32_t value) {
+  
+  _impl_.to_stop_ = value;
+}
+inline void DistancesBetweenStops::set_to_stop(uint32_t value) {
+  _internal_set_to_stop(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.DistancesBetweenStops.to_stop)
+}
+
+// -------------------------------------------------------------------
+
+// TransportData
+
+// repeated .proto_schema.transport.Stop stops = 1;
+inline int TransportData::_internal_stops_size() const {
+  return _impl_.stops_.size();
+}
+inline int TransportData::stops_size() const {
+  return _internal_stops_size();
+}
+inline void TransportData::clear_stops() {
+  _impl_.stops_.Clear();
+}
+inline ::proto_schema::transport::Stop* TransportData::mutable_stops(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.TransportData.stops)
+  return _impl_.stops_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Stop >*
+TransportData::mutable_stops() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.TransportData.stops)
+  return &_impl_.stops_;
+}
+inline const ::proto_schema::transport::Stop& TransportData::_internal_stops(int index) const {
+  return _impl_.stops_.Get(index);
+}
+inline const ::proto_schema::transport::Stop& TransportData::stops(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.TransportData.stops)
+  return _internal_stops(index);
+}
+inline ::proto_schema::transport::Stop* TransportData::_internal_add_stops() {
+  return _impl_.stops_.Add();
+}
+inline ::proto_schema::transport::Stop* TransportData::add_stops() {
+  ::proto_schema::transport::Stop* _add = _internal_add_stops();
+  // @@protoc_insertion_point(field_add:proto_schema.transport.TransportData.stops)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Stop >&
+TransportData::stops() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.TransportData.stops)
+  return _impl_.stops_;
+}
+
+// repeated .proto_schema.transport.Bus buses = 2;
+inline int TransportData::_internal_buses_size() const {
+  return _impl_.buses_.size();
+}
+inline int TransportData::buses_size() const {
+  return _internal_buses_size();
+}
+inline void TransportData::clear_buses() {
+  _impl_.buses_.Clear();
+}
+inline ::proto_schema::transport::Bus* TransportData::mutable_buses(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.TransportData.buses)
+  return _impl_.buses_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Bus >*
+TransportData::mutable_buses() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.TransportData.buses)
+  return &_impl_.buses_;
+}
+inline const ::proto_schema::transport::Bus& TransportData::_internal_buses(int index) const {
+  return _impl_.buses_.Get(index);
+}
+inline const ::proto_schema::transport::Bus& TransportData::buses(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.TransportData.buses)
+  return _internal_buses(index);
+}
+inline ::proto_schema::transport::Bus* TransportData::_internal_add_buses() {
+  return _impl_.buses_.Add();
+}
+inline ::proto_schema::transport::Bus* TransportData::add_buses() {
+  ::proto_schema::transport::Bus* _add = _internal_add_buses();
+  // @@protoc_insertion_point(field_add:proto_schema.transport.TransportData.buses)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::Bus >&
+TransportData::buses() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.TransportData.buses)
+  return _impl_.buses_;
+}
+
+// repeated .proto_schema.transport.DistancesBetweenStops distances = 3;
+inline int TransportData::_internal_distances_size() const {
+  return _impl_.distances_.size();
+}
+inline int TransportData::distances_size() const {
+  return _internal_distances_size();
+}
+inline void TransportData::clear_distances() {
+  _impl_.distances_.Clear();
+}
+inline ::proto_schema::transport::DistancesBetweenStops* TransportData::mutable_distances(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.TransportData.distances)
+  return _impl_.distances_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::DistancesBetweenStops >*
+TransportData::mutable_distances() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.TransportData.distances)
+  return &_impl_.distances_;
+}
+inline const ::proto_schema::transport::DistancesBetweenStops& TransportData::_internal_distances(int index) const {
+  return _impl_.distances_.Get(index);
+}
+inline const ::proto_schema::transport::DistancesBetweenStops& TransportData::distances(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.TransportData.distances)
+  return _internal_distances(index);
+}
+inline ::proto_schema::transport::DistancesBetweenStops* TransportData::_internal_add_distances() {
+  return _impl_.distances_.Add();
+}
+inline ::proto_schema::transport::DistancesBetweenStops* TransportData::add_distances() {
+  ::proto_schema::transport::DistancesBetweenStops* _add = _internal_add_distances();
+  // @@protoc_insertion_point(field_add:proto_schema.transport.TransportData.distances)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::DistancesBetweenStops >&
+TransportData::distances() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.TransportData.distances)
+  return _impl_.distances_;
+}
+
+// -------------------------------------------------------------------
+
+// BusStat
+
+// uint32 total_stops = 1;
+inline void BusStat::clear_total_stops() {
+  _impl_.total_stops_ = 0u;
+}
+inline uint32_t BusStat::_internal_total_stops() const {
+  return _impl_.total_stops_;
+}
+inline uint32_t BusStat::total_stops() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.BusStat.total_stops)
+  return _internal_total_stops();
+}
+inline void BusStat::_internal_set_total_stops(uint32_t value) {
+  
+  _impl_.total_stops_ = value;
+}
+inline void BusStat::set_total_stops(uint32_t value) {
+  _internal_set_total_stops(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.BusStat.total_stops)
+}
+
+// uint32 unique_stops = 2;
+inline void BusStat::clear_unique_stops() {
+  _impl_.unique_stops_ = 0u;
+}
+inline uint32_t BusStat::_internal_unique_stops() const {
+  return _impl_.unique_stops_;
+}
+inline uint32_t BusStat::unique_stops() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.BusStat.unique_stops)
+  return _internal_unique_stops();
+}
+inline void BusStat::_internal_set_unique_stops(uint32_t value) {
+  
+  _impl_.unique_stops_ = value;
+}
+inline void BusStat::set_unique_stops(uint32_t value) {
+  _internal_set_unique_stops(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.BusStat.unique_stops)
+}
+
+// double route_length = 3;
+inline void BusStat::clear_route_length() {
+  _impl_.route_length_ = 0;
+}
+inline double BusStat::_internal_route_length() const {
+  return _impl_.route_length_;
+}
+inline double BusStat::route_length() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.BusStat.route_length)
+  return _internal_route_length();
+}
+inline void BusStat::_internal_set_route_length(double value) {
+  
+  _impl_.route_length_ = value;
+}
+inline void BusStat::set_route_length(double value) {
+  _internal_set_route_length(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.BusStat.route_length)
+}
+
+// double route_curvature = 4;
+inline void BusStat::clear_route_curvature() {
+  _impl_.route_curvature_ = 0;
+}
+inline double BusStat::_internal_route_curvature() const {
+  return _impl_.route_curvature_;
+}
+inline double BusStat::route_curvature() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.BusStat.route_curvature)
+  return _internal_route_curvature();
+}
+inline void BusStat::_internal_set_route_curvature(double value) {
+  
+  _impl_.route_curvature_ = value;
+}
+inline void BusStat::set_route_curvature(double value) {
+  _internal_set_route_curvature(value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.BusStat.route_curvature)
+}
+
+// -------------------------------------------------------------------
+
+// StopStat
+
+// repeated uint32 buses = 1;
+inline int StopStat::_internal_buses_size() const {
+  return _impl_.buses_.size();
+}
+inline int StopStat::buses_size() const {
+  return _internal_buses_size();
+}
+inline void StopStat::clear_buses() {
+  _impl_.buses_.Clear();
+}
+inline uint32_t StopStat::_internal_buses(int index) const {
+  return _impl_.buses_.Get(index);
+}
+inline uint32_t StopStat::buses(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.StopStat.buses)
+  return _internal_buses(index);
+}
+inline void StopStat::set_buses(int index, uint32_t value) {
+  _impl_.buses_.Set(index, value);
+  // @@protoc_insertion_point(field_set:proto_schema.transport.StopStat.buses)
+}
+inline void StopStat::_internal_add_buses(uint32_t value) {
+  _impl_.buses_.Add(value);
+}
+inline void StopStat::add_buses(uint32_t value) {
+  _internal_add_buses(value);
+  // @@protoc_insertion_point(field_add:proto_schema.transport.StopStat.buses)
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+StopStat::_internal_buses() const {
+  return _impl_.buses_;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >&
+StopStat::buses() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.StopStat.buses)
+  return _internal_buses();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+StopStat::_internal_mutable_buses() {
+  return &_impl_.buses_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< uint32_t >*
+StopStat::mutable_buses() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.StopStat.buses)
+  return _internal_mutable_buses();
+}
+
+// -------------------------------------------------------------------
+
+// Stats
+
+// repeated .proto_schema.transport.BusStat bus_stats = 1;
+inline int Stats::_internal_bus_stats_size() const {
+  return _impl_.bus_stats_.size();
+}
+inline int Stats::bus_stats_size() const {
+  return _internal_bus_stats_size();
+}
+inline void Stats::clear_bus_stats() {
+  _impl_.bus_stats_.Clear();
+}
+inline ::proto_schema::transport::BusStat* Stats::mutable_bus_stats(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Stats.bus_stats)
+  return _impl_.bus_stats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::BusStat >*
+Stats::mutable_bus_stats() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.Stats.bus_stats)
+  return &_impl_.bus_stats_;
+}
+inline const ::proto_schema::transport::BusStat& Stats::_internal_bus_stats(int index) const {
+  return _impl_.bus_stats_.Get(index);
+}
+inline const ::proto_schema::transport::BusStat& Stats::bus_stats(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Stats.bus_stats)
+  return _internal_bus_stats(index);
+}
+inline ::proto_schema::transport::BusStat* Stats::_internal_add_bus_stats() {
+  return _impl_.bus_stats_.Add();
+}
+inline ::proto_schema::transport::BusStat* Stats::add_bus_stats() {
+  ::proto_schema::transport::BusStat* _add = _internal_add_bus_stats();
+  // @@protoc_insertion_point(field_add:proto_schema.transport.Stats.bus_stats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::BusStat >&
+Stats::bus_stats() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.Stats.bus_stats)
+  return _impl_.bus_stats_;
+}
+
+// repeated .proto_schema.transport.StopStat stop_stats = 2;
+inline int Stats::_internal_stop_stats_size() const {
+  return _impl_.stop_stats_.size();
+}
+inline int Stats::stop_stats_size() const {
+  return _internal_stop_stats_size();
+}
+inline void Stats::clear_stop_stats() {
+  _impl_.stop_stats_.Clear();
+}
+inline ::proto_schema::transport::StopStat* Stats::mutable_stop_stats(int index) {
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Stats.stop_stats)
+  return _impl_.stop_stats_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::StopStat >*
+Stats::mutable_stop_stats() {
+  // @@protoc_insertion_point(field_mutable_list:proto_schema.transport.Stats.stop_stats)
+  return &_impl_.stop_stats_;
+}
+inline const ::proto_schema::transport::StopStat& Stats::_internal_stop_stats(int index) const {
+  return _impl_.stop_stats_.Get(index);
+}
+inline const ::proto_schema::transport::StopStat& Stats::stop_stats(int index) const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Stats.stop_stats)
+  return _internal_stop_stats(index);
+}
+inline ::proto_schema::transport::StopStat* Stats::_internal_add_stop_stats() {
+  return _impl_.stop_stats_.Add();
+}
+inline ::proto_schema::transport::StopStat* Stats::add_stop_stats() {
+  ::proto_schema::transport::StopStat* _add = _internal_add_stop_stats();
+  // @@protoc_insertion_point(field_add:proto_schema.transport.Stats.stop_stats)
+  return _add;
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::proto_schema::transport::StopStat >&
+Stats::stop_stats() const {
+  // @@protoc_insertion_point(field_list:proto_schema.transport.Stats.stop_stats)
+  return _impl_.stop_stats_;
+}
+
+// -------------------------------------------------------------------
+
+// Settings
+
+// .proto_schema.maps.RenderSettings render_settings = 1;
+inline bool Settings::_internal_has_render_settings() const {
+  return this != internal_default_instance() && _impl_.render_settings_ != nullptr;
+}
+inline bool Settings::has_render_settings() const {
+  return _internal_has_render_settings();
+}
+inline const ::proto_schema::maps::RenderSettings& Settings::_internal_render_settings() const {
+  const ::proto_schema::maps::RenderSettings* p = _impl_.render_settings_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::maps::RenderSettings&>(
+      ::proto_schema::maps::_RenderSettings_default_instance_);
+}
+inline const ::proto_schema::maps::RenderSettings& Settings::render_settings() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Settings.render_settings)
+  return _internal_render_settings();
+}
+inline void Settings::unsafe_arena_set_allocated_render_settings(
+    ::proto_schema::maps::RenderSettings* render_settings) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.render_settings_);
+  }
+  _impl_.render_settings_ = render_settings;
+  if (render_settings) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Settings.render_settings)
+}
+inline ::proto_schema::maps::RenderSettings* Settings::release_render_settings() {
+  
+  ::proto_schema::maps::RenderSettings* temp = _impl_.render_settings_;
+  _impl_.render_settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::maps::RenderSettings* Settings::unsafe_arena_release_render_settings() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Settings.render_settings)
+  
+  ::proto_schema::maps::RenderSettings* temp = _impl_.render_settings_;
+  _impl_.render_settings_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::maps::RenderSettings* Settings::_internal_mutable_render_settings() {
+  
+  if (_impl_.render_settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::maps::RenderSettings>(GetArenaForAllocation());
+    _impl_.render_settings_ = p;
+  }
+  return _impl_.render_settings_;
+}
+inline ::proto_schema::maps::RenderSettings* Settings::mutable_render_settings() {
+  ::proto_schema::maps::RenderSettings* _msg = _internal_mutable_render_settings();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Settings.render_settings)
+  return _msg;
+}
+inline void Settings::set_allocated_render_settings(::proto_schema::maps::RenderSettings* render_settings) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.render_settings_);
+  }
+  if (render_settings) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(render_settings));
+    if (message_arena != submessage_arena) {
+      render_settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, render_settings, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.render_settings_ = render_settings;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Settings.render_settings)
+}
+
+// .proto_schema.router.RoutingSettings routing_settings = 2;
+inline bool Settings::_internal_has_routing_settings() const {
+  return this != internal_default_instance() && _impl_.routing_settings_ != nullptr;
+}
+inline bool Settings::has_routing_settings() const {
+  return _internal_has_routing_settings();
+}
+inline const ::proto_schema::router::RoutingSettings& Settings::_internal_routing_settings() const {
+  const ::proto_schema::router::RoutingSettings* p = _impl_.routing_settings_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::router::RoutingSettings&>(
+      ::proto_schema::router::_RoutingSettings_default_instance_);
+}
+inline const ::proto_schema::router::RoutingSettings& Settings::routing_settings() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Settings.routing_settings)
+  return _internal_routing_settings();
+}
+inline void Settings::unsafe_arena_set_allocated_routing_settings(
+    ::proto_schema::router::RoutingSettings* routing_settings) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routing_settings_);
+  }
+  _impl_.routing_settings_ = routing_settings;
+  if (routing_settings) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Settings.routing_settings)
+}
+inline ::proto_schema::router::RoutingSettings* Settings::release_routing_settings() {
+  
+  ::proto_schema::router::RoutingSettings* temp = _impl_.routing_settings_;
+  _impl_.routing_settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::router::RoutingSettings* Settings::unsafe_arena_release_routing_settings() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Settings.routing_settings)
+  
+  ::proto_schema::router::RoutingSettings* temp = _impl_.routing_settings_;
+  _impl_.routing_settings_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::router::RoutingSettings* Settings::_internal_mutable_routing_settings() {
+  
+  if (_impl_.routing_settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::router::RoutingSettings>(GetArenaForAllocation());
+    _impl_.routing_settings_ = p;
+  }
+  return _impl_.routing_settings_;
+}
+inline ::proto_schema::router::RoutingSettings* Settings::mutable_routing_settings() {
+  ::proto_schema::router::RoutingSettings* _msg = _internal_mutable_routing_settings();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Settings.routing_settings)
+  return _msg;
+}
+inline void Settings::set_allocated_routing_settings(::proto_schema::router::RoutingSettings* routing_settings) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.routing_settings_);
+  }
+  if (routing_settings) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(routing_settings));
+    if (message_arena != submessage_arena) {
+      routing_settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, routing_settings, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.routing_settings_ = routing_settings;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Settings.routing_settings)
+}
+
+// -------------------------------------------------------------------
+
+// Database
+
+// .proto_schema.transport.TransportData transport_data = 1;
+inline bool Database::_internal_has_transport_data() const {
+  return this != internal_default_instance() && _impl_.transport_data_ != nullptr;
+}
+inline bool Database::has_transport_data() const {
+  return _internal_has_transport_data();
+}
+inline void Database::clear_transport_data() {
+  if (GetArenaForAllocation() == nullptr && _impl_.transport_data_ != nullptr) {
+    delete _impl_.transport_data_;
+  }
+  _impl_.transport_data_ = nullptr;
+}
+inline const ::proto_schema::transport::TransportData& Database::_internal_transport_data() const {
+  const ::proto_schema::transport::TransportData* p = _impl_.transport_data_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::transport::TransportData&>(
+      ::proto_schema::transport::_TransportData_default_instance_);
+}
+inline const ::proto_schema::transport::TransportData& Database::transport_data() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Database.transport_data)
+  return _internal_transport_data();
+}
+inline void Database::unsafe_arena_set_allocated_transport_data(
+    ::proto_schema::transport::TransportData* transport_data) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.transport_data_);
+  }
+  _impl_.transport_data_ = transport_data;
+  if (transport_data) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Database.transport_data)
+}
+inline ::proto_schema::transport::TransportData* Database::release_transport_data() {
+  
+  ::proto_schema::transport::TransportData* temp = _impl_.transport_data_;
+  _impl_.transport_data_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::transport::TransportData* Database::unsafe_arena_release_transport_data() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Database.transport_data)
+  
+  ::proto_schema::transport::TransportData* temp = _impl_.transport_data_;
+  _impl_.transport_data_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::transport::TransportData* Database::_internal_mutable_transport_data() {
+  
+  if (_impl_.transport_data_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::transport::TransportData>(GetArenaForAllocation());
+    _impl_.transport_data_ = p;
+  }
+  return _impl_.transport_data_;
+}
+inline ::proto_schema::transport::TransportData* Database::mutable_transport_data() {
+  ::proto_schema::transport::TransportData* _msg = _internal_mutable_transport_data();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Database.transport_data)
+  return _msg;
+}
+inline void Database::set_allocated_transport_data(::proto_schema::transport::TransportData* transport_data) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.transport_data_;
+  }
+  if (transport_data) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(transport_data);
+    if (message_arena != submessage_arena) {
+      transport_data = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, transport_data, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.transport_data_ = transport_data;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Database.transport_data)
+}
+
+// .proto_schema.transport.Settings settings = 2;
+inline bool Database::_internal_has_settings() const {
+  return this != internal_default_instance() && _impl_.settings_ != nullptr;
+}
+inline bool Database::has_settings() const {
+  return _internal_has_settings();
+}
+inline void Database::clear_settings() {
+  if (GetArenaForAllocation() == nullptr && _impl_.settings_ != nullptr) {
+    delete _impl_.settings_;
+  }
+  _impl_.settings_ = nullptr;
+}
+inline const ::proto_schema::transport::Settings& Database::_internal_settings() const {
+  const ::proto_schema::transport::Settings* p = _impl_.settings_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::transport::Settings&>(
+      ::proto_schema::transport::_Settings_default_instance_);
+}
+inline const ::proto_schema::transport::Settings& Database::settings() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Database.settings)
+  return _internal_settings();
+}
+inline void Database::unsafe_arena_set_allocated_settings(
+    ::proto_schema::transport::Settings* settings) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.settings_);
+  }
+  _impl_.settings_ = settings;
+  if (settings) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Database.settings)
+}
+inline ::proto_schema::transport::Settings* Database::release_settings() {
+  
+  ::proto_schema::transport::Settings* temp = _impl_.settings_;
+  _impl_.settings_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::transport::Settings* Database::unsafe_arena_release_settings() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Database.settings)
+  
+  ::proto_schema::transport::Settings* temp = _impl_.settings_;
+  _impl_.settings_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::transport::Settings* Database::_internal_mutable_settings() {
+  
+  if (_impl_.settings_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::transport::Settings>(GetArenaForAllocation());
+    _impl_.settings_ = p;
+  }
+  return _impl_.settings_;
+}
+inline ::proto_schema::transport::Settings* Database::mutable_settings() {
+  ::proto_schema::transport::Settings* _msg = _internal_mutable_settings();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Database.settings)
+  return _msg;
+}
+inline void Database::set_allocated_settings(::proto_schema::transport::Settings* settings) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.settings_;
+  }
+  if (settings) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(settings);
+    if (message_arena != submessage_arena) {
+      settings = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, settings, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.settings_ = settings;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Database.settings)
+}
+
+// .proto_schema.router.Router router = 3;
+inline bool Database::_internal_has_router() const {
+  return this != internal_default_instance() && _impl_.router_ != nullptr;
+}
+inline bool Database::has_router() const {
+  return _internal_has_router();
+}
+inline const ::proto_schema::router::Router& Database::_internal_router() const {
+  const ::proto_schema::router::Router* p = _impl_.router_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::router::Router&>(
+      ::proto_schema::router::_Router_default_instance_);
+}
+inline const ::proto_schema::router::Router& Database::router() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Database.router)
+  return _internal_router();
+}
+inline void Database::unsafe_arena_set_allocated_router(
+    ::proto_schema::router::Router* router) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_);
+  }
+  _impl_.router_ = router;
+  if (router) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Database.router)
+}
+inline ::proto_schema::router::Router* Database::release_router() {
+  
+  ::proto_schema::router::Router* temp = _impl_.router_;
+  _impl_.router_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::router::Router* Database::unsafe_arena_release_router() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Database.router)
+  
+  ::proto_schema::router::Router* temp = _impl_.router_;
+  _impl_.router_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::router::Router* Database::_internal_mutable_router() {
+  
+  if (_impl_.router_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::router::Router>(GetArenaForAllocation());
+    _impl_.router_ = p;
+  }
+  return _impl_.router_;
+}
+inline ::proto_schema::router::Router* Database::mutable_router() {
+  ::proto_schema::router::Router* _msg = _internal_mutable_router();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Database.router)
+  return _msg;
+}
+inline void Database::set_allocated_router(::proto_schema::router::Router* router) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete reinterpret_cast< ::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.router_);
+  }
+  if (router) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(
+                reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(router));
+    if (message_arena != submessage_arena) {
+      router = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, router, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.router_ = router;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Database.router)
+}
+
+// .proto_schema.transport.Stats stats = 4;
+inline bool Database::_internal_has_stats() const {
+  return this != internal_default_instance() && _impl_.stats_ != nullptr;
+}
+inline bool Database::has_stats() const {
+  return _internal_has_stats();
+}
+inline void Database::clear_stats() {
+  if (GetArenaForAllocation() == nullptr && _impl_.stats_ != nullptr) {
+    delete _impl_.stats_;
+  }
+  _impl_.stats_ = nullptr;
+}
+inline const ::proto_schema::transport::Stats& Database::_internal_stats() const {
+  const ::proto_schema::transport::Stats* p = _impl_.stats_;
+  return p != nullptr ? *p : reinterpret_cast<const ::proto_schema::transport::Stats&>(
+      ::proto_schema::transport::_Stats_default_instance_);
+}
+inline const ::proto_schema::transport::Stats& Database::stats() const {
+  // @@protoc_insertion_point(field_get:proto_schema.transport.Database.stats)
+  return _internal_stats();
+}
+inline void Database::unsafe_arena_set_allocated_stats(
+    ::proto_schema::transport::Stats* stats) {
+  if (GetArenaForAllocation() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(_impl_.stats_);
+  }
+  _impl_.stats_ = stats;
+  if (stats) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:proto_schema.transport.Database.stats)
+}
+inline ::proto_schema::transport::Stats* Database::release_stats() {
+  
+  ::proto_schema::transport::Stats* temp = _impl_.stats_;
+  _impl_.stats_ = nullptr;
+#ifdef PROTOBUF_FORCE_COPY_IN_RELEASE
+  auto* old =  reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(temp);
+  temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  if (GetArenaForAllocation() == nullptr) { delete old; }
+#else  // PROTOBUF_FORCE_COPY_IN_RELEASE
+  if (GetArenaForAllocation() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+#endif  // !PROTOBUF_FORCE_COPY_IN_RELEASE
+  return temp;
+}
+inline ::proto_schema::transport::Stats* Database::unsafe_arena_release_stats() {
+  // @@protoc_insertion_point(field_release:proto_schema.transport.Database.stats)
+  
+  ::proto_schema::transport::Stats* temp = _impl_.stats_;
+  _impl_.stats_ = nullptr;
+  return temp;
+}
+inline ::proto_schema::transport::Stats* Database::_internal_mutable_stats() {
+  
+  if (_impl_.stats_ == nullptr) {
+    auto* p = CreateMaybeMessage<::proto_schema::transport::Stats>(GetArenaForAllocation());
+    _impl_.stats_ = p;
+  }
+  return _impl_.stats_;
+}
+inline ::proto_schema::transport::Stats* Database::mutable_stats() {
+  ::proto_schema::transport::Stats* _msg = _internal_mutable_stats();
+  // @@protoc_insertion_point(field_mutable:proto_schema.transport.Database.stats)
+  return _msg;
+}
+inline void Database::set_allocated_stats(::proto_schema::transport::Stats* stats) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArenaForAllocation();
+  if (message_arena == nullptr) {
+    delete _impl_.stats_;
+  }
+  if (stats) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+        ::PROTOBUF_NAMESPACE_ID::Arena::InternalGetOwningArena(stats);
+    if (message_arena != submessage_arena) {
+      stats = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, stats, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  _impl_.stats_ = stats;
+  // @@protoc_insertion_point(field_set_allocated:proto_schema.transport.Database.stats)
+}
+
+#ifdef __GNUC__
+  #pragma GCC diagnostic pop
+#endif  // __GNUC__
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace transport
+}  // namespace proto_schema
+
+// @@protoc_insertion_point(global_scope)
+
+#include <google/protobuf/port_undef.inc>
+#endif  // GOOGLE_PROTOBUF_INCLUDED_GOOGLE_PROTOBUF_INCLUDED_transport_5fcatalogue_2eproto
@@ -0,0 +1,146 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/// Open-addressing hash map with 64-bit keys, the slots are one flat array probed linearly (Robin Hood hashing).
+/// A key that is farther from its home slot takes the place of a closer one, so the probe sequences stay short
+/// and a lookup stops at the first slot that is closer to its home than the key would be.
+namespace transport_catalogue::detail /* FlatHashMap */ {
+
+    template <typename Value>
+    class FlatHashMap {
+    public:
+        using Key = uint64_t;
+
+        FlatHashMap() = default;
+
+        /// Return the value of the key, or nullptr if the key is not found
+        const Value* Find(Key key) const {
+            if (slots_.empty()) {
+                return nullptr;
+            }
+            size_t index = GetHomeIndex_(key);
+            for (uint32_t probe = 1;; ++probe, index = (index + 1) & mask_) {
+                const Slot& slot = slots_[index];
+                if (slot.probe < probe) {
+                    return nullptr;
+                }
+                if (slot.key == key) {
+                    return &slot.value;
+                }
+            }
+        }
+
+        Value* Find(Key key) {
+            return const_cast<Value*>(std::as_const(*this).Find(key));
+        }
+
+        bool Contains(Key key) const {
+            return Find(key) != nullptr;
+        }
+
+        /// Return the value of the key, a default constructed value is inserted if the key is not found
+        Value& operator[](Key key) {
+            if (Value* value = Find(key)) {
+                return *value;
+            }
+            if ((size_ + 1) * MAX_LOAD_DENOMINATOR > slots_.size() * MAX_LOAD_NUMERATOR) {
+                Rehash_(std::max(slots_.size() * 2, MIN_CAPACITY));
+            }
+            return Insert_(Slot{key, Value{}, 1});
+        }
+
+        /// Make room for `count` keys without rehashing
+        void Reserve(size_t count) {
+            size_t capacity = MIN_CAPACITY;
+            while (count * MAX_LOAD_DENOMINATOR > capacity * MAX_LOAD_NUMERATOR) {
+                capacity *= 2;
+            }
+            if (capacity > slots_.size()) {
+                Rehash_(capacity);
+            }
+        }
+
+        void Clear() {
+            slots_.clear();
+            mask_ = 0;
+            size_ = 0;
+        }
+
+        size_t Size() const {
+            return size_;
+        }
+
+        bool IsEmpty() const {
+            return size_ == 0;
+        }
+
+        /// Call `action(key, value)` for every key in the slots order
+        template <typename Action>
+        void ForEach(Action&& action) const {
+            for (const Slot& slot : slots_) {
+                if (slot.probe != 0) {
+                    action(slot.key, slot.value);
+                }
+            }
+        }
+
+    private:
+        static constexpr size_t MIN_CAPACITY = 16;
+        static constexpr size_t MAX_LOAD_NUMERATOR = 7;
+        static constexpr size_t MAX_LOAD_DENOMINATOR = 8;
+
+        /// `probe` is the distance from the home slot plus one, zero marks an empty slot
+        struct Slot {
+            Key key = 0;
+            Value value{};
+            uint32_t probe = 0;
+        };
+
+        std::vector<Slot> slots_;
+        size_t mask_ = 0;
+        size_t size_ = 0;
+
+        /// Fibonacci hashing of the key, the capacity is a power of two
+        size_t GetHomeIndex_(Key key) const {
+            return static_cast<size_t>((key ^ (key >> 29)) * 0x9E3779B97F4A7C15ull >> 32) & mask_;
+        }
+
+        /// Insert the new key, the capacity must have room for it
+        Value& Insert_(Slot&& new_slot) {
+            Value* result = nullptr;
+            for (size_t index = GetHomeIndex_(new_slot.key);; index = (index + 1) & mask_, ++new_slot.probe) {
+                Slot& slot = slots_[index];
+                if (slot.probe == 0) {
+                    slot = std::move(new_slot);
+                    ++size_;
+                    return result != nullptr ? *result : slot.value;
+                }
+                if (slot.probe < new_slot.probe) {
+                    std::swap(slot, new_slot);
+                    // The displaced slots are moved farther only, so the inserted value stays here
+                    if (result == nullptr) {
+                        result = &slot.value;
+                    }
+                }
+            }
+        }
+
+        void Rehash_(size_t capacity) {
+            std::vector<Slot> slots(capacity);
+            std::swap(slots, slots_);
+            mask_ = capacity - 1;
+            size_ = 0;
+            for (Slot& slot : slots) {
+                if (slot.probe != 0) {
+                    slot.probe = 1;
+                    Insert_(std::move(slot));
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+
+/// Bounded least-recently-used cache split into shards by the key hash.
+/// Every shard has its own lock, so concurrent lookups of different keys rarely wait for each other.
+namespace transport_catalogue::detail /* ShardedLruCache */ {
+
+    template <typename Key, typename Value, typename Hasher = std::hash<Key>>
+    class ShardedLruCache {
+    public:
+        struct Stats {
+            size_t hits = 0;
+            size_t misses = 0;
+            size_t size = 0;
+        };
+
+        static constexpr size_t DEFAULT_SHARDS_COUNT = 16;
+
+        /// Zero capacity disables the cache: nothing is stored and lookups are not counted
+        explicit ShardedLruCache(size_t capacity = 0, size_t shards_count = DEFAULT_SHARDS_COUNT) : capacity_(capacity) {
+            // Every shard keeps at least one entry, so the total capacity is exact
+            shards_count_ = std::min(capacity, std::max<size_t>(shards_count, 1));
+            shards_ = std::make_unique<Shard[]>(shards_count_);
+            for (size_t i = 0; i < shards_count_; ++i) {
+                shards_[i].capacity = capacity / shards_count_ + (i < capacity % shards_count_ ? 1 : 0);
+            }
+        }
+
+        /// Return the cached value and mark it as the most recently used, or nullopt on miss
+        std::optional<Value> Find(const Key& key) {
+            if (shards_count_ == 0) {
+                return std::nullopt;
+            }
+
+            Shard& shard = GetShard_(key);
+            std::lock_guard lock(shard.mutex);
+            auto it = shard.indexes.find(key);
+            if (it == shard.indexes.end()) {
+                ++shard.misses;
+                return std::nullopt;
+            }
+            ++shard.hits;
+            shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+            return it->second->second;
+        }
+
+        /// Store the value as the most recently used, evicting the least recently used value of the shard if it is full
+        void Insert(const Key& key, Value value) {
+            if (shards_count_ == 0) {
+                return;
+            }
+
+            Shard& shard = GetShard_(key);
+            std::lock_guard lock(shard.mutex);
+            auto it = shard.indexes.find(key);
+            if (it != shard.indexes.end()) {
+                it->second->second = std::move(value);
+                shard.entries.splice(shard.entries.begin(), shard.entries, it->second);
+                return;
+            }
+            if (shard.entries.size() == shard.capacity) {
+                shard.indexes.erase(shard.entries.back().first);
+                shard.entries.pop_back();
+            }
+            shard.entries.emplace_front(key, std::move(value));
+            shard.indexes.emplace(key, shard.entries.begin());
+        }
+
+        /// Drop all values and reset the counters
+        void Clear() {
+            for (size_t i = 0; i < shards_count_; ++i) {
+                std::lock_guard lock(shards_[i].mutex);
+                shards_[i].entries.clear();
+                shards_[i].indexes.clear();
+                shards_[i].hits = 0;
+                shards_[i].misses = 0;
+            }
+        }
+
+        size_t GetCapacity() const {
+            return capacity_;
+        }
+
+        Stats GetStats() const {
+            Stats stats;
+            for (size_t i = 0; i < shards_count_; ++i) {
+                std::lock_guard lock(shards_[i].mutex);
+                stats.hits += shards_[i].hits;
+                stats.misses += shards_[i].misses;
+                stats.size += shards_[i].entries.size();
+            }
+            return stats;
+        }
+
+    private:
+        using Entries = std::list<std::pair<Key, Value>>;
+
+        struct Shard {
+            mutable std::mutex mutex;
+            Entries entries;
+            std::unordered_map<Key, typename Entries::iterator, Hasher> indexes;
+            size_t capacity = 0;
+            size_t hits = 0;
+            size_t misses = 0;
+        };
+
+        size_t capacity_ = 0;
+        size_t shards_count_ = 0;
+        std::unique_ptr<Shard[]> shards_;
+
+    private:
+        Shard& GetShard_(const Key& key) {
+            // Spread the hash bits, since std::hash of integer keys is the identity
+            const uint64_t hash = static_cast<uint64_t>(Hasher{}(key)) * 0x9E3779B97F4A7C15ull;
+            return shards_[(hash >> 32) % shards_count_];
+        }
+    };
+}
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define GRAPH_MIN_PLUS_X86 1
+#include <immintrin.h>
+#else
+#define GRAPH_MIN_PLUS_X86 0
+#endif
+
+/// Min-plus row relaxation used by the all-pairs router:
+/// `weights_from[j] = min(weights_from[j], weight_from_through + weights_through[j])`,
+/// and the prev edge of every improved cell is taken from `prev_edges_through[j]`
+/// (or `prev_edge_from_through` if the route through the vertex ends at that vertex).
+/// Missing routes are stored as infinity, so they never pass the comparison.
+namespace graph::detail /* Min-plus row kernels */ {
+
+    template <typename StoredWeight, typename StoredEdgeId>
+    inline void RelaxRowScalar(
+        StoredWeight weight_from_through, StoredEdgeId prev_edge_from_through, const StoredWeight* weights_through,
+        const StoredEdgeId* prev_edges_through, StoredWeight* weights_from, StoredEdgeId* prev_edges_from, size_t count) {
+        constexpr StoredEdgeId none_edge = std::numeric_limits<StoredEdgeId>::max();
+        for (size_t i = 0; i < count; ++i) {
+            const StoredWeight candidate_weight = weight_from_through + weights_through[i];
+            if (candidate_weight < weights_from[i]) {
+                weights_from[i] = candidate_weight;
+                prev_edges_from[i] = prev_edges_through[i] != none_edge ? prev_edges_through[i] : prev_edge_from_through;
+            }
+        }
+    }
+
+    using RelaxRowFunction = void (*)(float, uint32_t, const float*, const uint32_t*, float*, uint32_t*, size_t);
+
+#if GRAPH_MIN_PLUS_X86
+    __attribute__((target("sse4.1"))) inline void RelaxRowSse41(
+        float weight_from_through, uint32_t prev_edge_from_through, const float* weights_through, const uint32_t* prev_edges_through,
+        float* weights_from, uint32_t* prev_edges_from, size_t count) {
+        const __m128 weight_from_through_x4 = _mm_set1_ps(weight_from_through);
+        const __m128i prev_edge_from_through_x4 = _mm_set1_epi32(static_cast<int>(prev_edge_from_through));
+        const __m128i none_edge_x4 = _mm_set1_epi32(-1);
+
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            const __m128 weights = _mm_loadu_ps(weights_from + i);
+            const __m128 candidate_weights = _mm_add_ps(weight_from_through_x4, _mm_loadu_ps(weights_through + i));
+            const __m128 is_improved = _mm_cmplt_ps(candidate_weights, weights);
+            if (_mm_movemask_ps(is_improved) == 0) {
+                continue;
+            }
+            _mm_storeu_ps(weights_from + i, _mm_blendv_ps(weights, candidate_weights, is_improved));
+
+            const __m128i prev_edges_through_x4 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(prev_edges_through + i));
+            const __m128i candidate_prev_edges =
+                _mm_blendv_epi8(prev_edges_through_x4, prev_edge_from_through_x4, _mm_cmpeq_epi32(prev_edges_through_x4, none_edge_x4));
+            __m128i* prev_edges = reinterpret_cast<__m128i*>(prev_edges_from + i);
+            _mm_storeu_si128(prev_edges, _mm_blendv_epi8(_mm_loadu_si128(prev_edges), candidate_prev_edges, _mm_castps_si128(is_improved)));
+        }
+        RelaxRowScalar(
+            weight_from_through, prev_edge_from_through, weights_through + i, prev_edges_through + i, weights_from + i, prev_edges_from + i,
+            count - i);
+    }
+
+    __attribute__((target("avx2"))) inline void RelaxRowAvx2(
+        float weight_from_through, uint32_t prev_edge_from_through, const float* weights_through, const uint32_t* prev_edges_through,
+        float* weights_from, uint32_t* prev_edges_from, size_t count) {
+        const __m256 weight_from_through_x8 = _mm256_set1_ps(weight_from_through);
+        const __m256i prev_edge_from_through_x8 = _mm256_set1_epi32(static_cast<int>(prev_edge_from_through));
+        const __m256i none_edge_x8 = _mm256_set1_epi32(-1);
+
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            const __m256 weights = _mm256_loadu_ps(weights_from + i);
+            const __m256 candidate_weights = _mm256_add_ps(weight_from_through_x8, _mm256_loadu_ps(weights_through + i));
+            const __m256 is_improved = _mm256_cmp_ps(candidate_weights, weights, _CMP_LT_OQ);
+            if (_mm256_movemask_ps(is_improved) == 0) {
+                continue;
+            }
+            _mm256_storeu_ps(weights_from + i, _mm256_blendv_ps(weights, candidate_weights, is_improved));
+
+            const __m256i prev_edges_through_x8 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(prev_edges_through + i));
+            const __m256i candidate_prev_edges = _mm256_blendv_epi8(
+                prev_edges_through_x8, prev_edge_from_through_x8, _mm256_cmpeq_epi32(prev_edges_through_x8, none_edge_x8));
+            __m256i* prev_edges = reinterpret_cast<__m256i*>(prev_edges_from + i);
+            _mm256_storeu_si256(
+                prev_edges, _mm256_blendv_epi8(_mm256_loadu_si256(prev_edges), candidate_prev_edges, _mm256_castps_si256(is_improved)));
+        }
+        RelaxRowScalar(
+            weight_from_through, prev_edge_from_through, weights_through + i, prev_edges_through + i, weights_from + i, prev_edges_from + i,
+            count - i);
+    }
+#endif
+
+    /// Picks the widest kernel supported by the running CPU (resolved once)
+    inline RelaxRowFunction GetRelaxRowFunction() {
+        static const RelaxRowFunction relax_row = []() -> RelaxRowFunction {
+#if GRAPH_MIN_PLUS_X86
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) {
+                return &RelaxRowAvx2;
+            }
+            if (__builtin_cpu_supports("sse4.1")) {
+                return &RelaxRowSse41;
+            }
+#endif
+            return &RelaxRowScalar<float, uint32_t>;
+        }();
+        return relax_row;
+    }
+}
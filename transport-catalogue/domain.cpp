@@ -22,8 +22,99 @@ namespace transport_catalogue::data /* Bus implementation */ {
     }
 }
 
-namespace transport_catalogue::data /* Hasher implementation */ {
-    size_t Hasher::operator()(const std::pair<const Stop*, const Stop*>& stops) const {
-        return this->operator()({stops.first, stops.second});
+namespace transport_catalogue::data /* DatabaseScheme::DistanceBetweenStopsTable implementation */ {
+    void DatabaseScheme::DistanceBetweenStopsTable::Set(StopRecord from, StopRecord to, DistanceBetweenStopsRecord distance) {
+        Item& item = distances_[MakeKey_(from, to)];
+        size_ += item.is_set ? 0 : 1;
+        item = {distance, true};
+
+        Item& opposite_item = distances_[MakeKey_(to, from)];
+        if (!opposite_item.is_set) {
+            opposite_item.distance = distance;
+        }
+    }
+
+    DistanceBetweenStopsRecord DatabaseScheme::DistanceBetweenStopsTable::Get(StopRecord from, StopRecord to) const {
+        const Item* item = distances_.Find(MakeKey_(from, to));
+        return item != nullptr ? item->distance : DistanceBetweenStopsRecord{0., 0.};
+    }
+
+    bool DatabaseScheme::DistanceBetweenStopsTable::Contains(StopRecord from, StopRecord to) const {
+        return distances_.Contains(MakeKey_(from, to));
+    }
+
+    size_t DatabaseScheme::DistanceBetweenStopsTable::Size() const {
+        return size_;
+    }
+}
+
+namespace transport_catalogue::data /* DatabaseScheme::StopToBusesView implementation */ {
+    void DatabaseScheme::StopToBusesView::Add(StopId stop_id, BusRecord bus) {
+        if (static_cast<size_t>(stop_id) >= pending_buses_.size()) {
+            pending_buses_.resize(static_cast<size_t>(stop_id) + 1);
+        }
+        pending_buses_[stop_id].push_back(bus);
+        ++pending_count_;
+    }
+
+    void DatabaseScheme::StopToBusesView::Freeze() {
+        const size_t stops_count = std::max(offsets_.size() - 1, pending_buses_.size());
+        std::vector<size_t> offsets;
+        offsets.reserve(stops_count + 1);
+        offsets.push_back(0);
+        std::vector<BusRecord> buses;
+        buses.reserve(buses_.size() + pending_count_);
+
+        for (StopId stop_id = 0; stop_id < stops_count; ++stop_id) {
+            const size_t row_begin = buses.size();
+            ForEachBus(stop_id, [&buses](BusRecord bus) {
+                buses.push_back(bus);
+            });
+            std::sort(buses.begin() + row_begin, buses.end(), ByNameCompare{});
+            // A bus passing the stop several times is listed once
+            buses.erase(std::unique(buses.begin() + row_begin, buses.end()), buses.end());
+            offsets.push_back(buses.size());
+        }
+
+        offsets_ = std::move(offsets);
+        buses_ = std::move(buses);
+        std::vector<std::vector<BusRecord>>().swap(pending_buses_);
+        pending_count_ = 0;
+    }
+
+    bool DatabaseScheme::StopToBusesView::IsFrozen() const {
+        return pending_count_ == 0;
+    }
+
+    BusRecordsView DatabaseScheme::StopToBusesView::GetBuses(StopId stop_id) const {
+        assert(IsFrozen());
+        if (static_cast<size_t>(stop_id) + 1 >= offsets_.size()) {
+            return {};
+        }
+        return BusRecordsView{buses_.data() + offsets_[stop_id], buses_.data() + offsets_[stop_id + 1]};
+    }
+}
+
+namespace transport_catalogue::data /* DatabaseScheme::StopStatsView implementation */ {
+    void DatabaseScheme::StopStatsView::PushBack(BusRecordsView buses) {
+        buses_.insert(buses_.end(), buses.begin(), buses.end());
+        offsets_.push_back(buses_.size());
+    }
+
+    StopStat DatabaseScheme::StopStatsView::operator[](StopId stop_id) const {
+        return StopStat{BusRecordsView{buses_.data() + offsets_.at(stop_id), buses_.data() + offsets_.at(stop_id + 1)}};
     }
-}
\ No newline at end of file
+
+    size_t DatabaseScheme::StopStatsView::size() const {
+        return offsets_.size() - 1;
+    }
+
+    bool DatabaseScheme::StopStatsView::empty() const {
+        return size() == 0;
+    }
+
+    void DatabaseScheme::StopStatsView::clear() {
+        offsets_.assign(1, 0);
+        buses_.clear();
+    }
+}
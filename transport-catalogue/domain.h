@@ -1,8 +1,10 @@
 #pragma once
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <execution>
 #include <iterator>
@@ -10,6 +12,8 @@
 #include <mutex>
 #include <optional>
 #include <set>
+#include <span>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -19,6 +23,7 @@
 #include <variant>
 #include <vector>
 
+#include "detail/flat_hash_map.h"
 #include "detail/type_traits.h"
 #include "geo.h"
 
@@ -103,10 +108,14 @@ namespace transport_catalogue::detail::converters {
 
 namespace transport_catalogue::data /* Db objects (ORM) */ {
     using Coordinates = geo::Coordinates;
+    /// Dense ids assigned by the database in the insertion order, the id of a record is its index in the table
+    using StopId = uint32_t;
+    using BusId = uint32_t;
 
     struct Stop {
         std::string name;
         Coordinates coordinates;
+        StopId id = 0;
         Stop() = default;
         template <
             typename String = std::string, typename Coordinates = data::Coordinates,
@@ -131,10 +140,20 @@ namespace transport_catalogue::data /* Db objects (ORM) */ {
         using vector::vector;
     };
 
+    /// Cumulative distances from the first stop of the route to every stop of the route, filled by the database.
+    /// The geographic distance of a hop is counted only if the hop has the measured distance record.
+    /// Distances set after the bus are applied when the bus is read from the database again
+    struct RouteDistances {
+        std::vector<double> measured;
+        std::vector<double> geographic;
+    };
+
     struct Bus {
         std::string name;
         Route route;
         bool is_roundtrip = false;
+        BusId id = 0;
+        RouteDistances distances;
         Bus() = default;
         template <
             typename String = std::string, typename Route = data::Route,
@@ -157,6 +176,19 @@ namespace transport_catalogue::data /* Db objects (ORM) */ {
             }
             return route.front();
         }
+
+        /// Measured distance of the route part between the stops positions
+        double GetMeasuredDistance(size_t from_position, size_t to_position) const {
+            return distances.measured[to_position] - distances.measured[from_position];
+        }
+
+        double GetMeasuredLength() const {
+            return distances.measured.empty() ? 0. : distances.measured.back();
+        }
+
+        double GetGeographicLength() const {
+            return distances.geographic.empty() ? 0. : distances.geographic.back();
+        }
     };
 
     struct ByNameCompare {
@@ -171,6 +203,8 @@ namespace transport_catalogue::data /* Db objects (ORM) */ {
 
     using BusRecord = DbRecord<Bus>;
     using BusRecordSet = std::set<BusRecord, ByNameCompare>;
+    /// Contiguous buses sorted by name
+    using BusRecordsView = std::span<const BusRecord>;
 
     struct DistanceBetweenStopsRecord {
         double distance = 0.;
@@ -195,25 +229,9 @@ namespace transport_catalogue::data /* Db objects (ORM) */ {
     };
 
     struct StopStat {
-        std::vector<std::string> buses;
-    };
-
-    class Hasher {
-    public:
-        size_t operator()(const std::pair<const Stop*, const Stop*>& stops) const;
-
-        template <typename T>
-        size_t operator()(std::initializer_list<const T*> items) const {
-            size_t hash = 0;
-            for (const T* cur : items) {
-                hash = hash * INDEX + pointer_hasher_(cur);
-            }
-            return hash;
-        }
-
-    private:
-        std::hash<const void*> pointer_hasher_;
-        static const size_t INDEX = 42;
+        /// Buses passing the stop sorted by name, the names are resolved by the answer output.
+        /// Valid until the next change of the stats or of the buses
+        BusRecordsView buses;
     };
 
 }
@@ -249,10 +267,8 @@ namespace transport_catalogue::data /* Db scheme abstraction */ {
 namespace transport_catalogue::data /* Db scheme */ {
     class DatabaseScheme {
     public: /* Aliases */
-        using DistanceBetweenStopsTableBase = std::unordered_map<std::pair<const Stop*, const Stop*>, DistanceBetweenStopsRecord, Hasher>;
         using NameToStopViewBase = std::unordered_map<std::string_view, const data::Stop*>;
         using NameToBusRoutesViewBase = std::unordered_map<std::string_view, const data::Bus*>;
-        using StopToBusesViewBase = std::unordered_map<StopRecord, BusRecordSet>;
 
     public:
         class StopsTable : public DataTable, public std::deque<Stop> {
@@ -267,10 +283,43 @@ namespace transport_catalogue::data /* Db scheme */ {
             BusRoutesTable() : DataTable("BusRoutesTable"), std::deque<Bus>() {}
         };
 
-        class DistanceBetweenStopsTable : public DataTable, public DistanceBetweenStopsTableBase {
+        /// Distances keyed by the packed (from stop id, to stop id) pair. The distance in one direction is stored for the opposite
+        /// direction too while that one is not set, so a lookup is a single probe
+        class DistanceBetweenStopsTable : public DataTable {
         public:
-            using DistanceBetweenStopsTableBase::unordered_map;
-            DistanceBetweenStopsTable() : DataTable("DistanceBetweenStopsTable"), DistanceBetweenStopsTableBase() {}
+            DistanceBetweenStopsTable() : DataTable("DistanceBetweenStopsTable") {}
+
+            void Set(StopRecord from, StopRecord to, DistanceBetweenStopsRecord distance);
+            /// Return zero distances if the distance is not set in either direction
+            DistanceBetweenStopsRecord Get(StopRecord from, StopRecord to) const;
+            /// Return true if the distance is set in either direction
+            bool Contains(StopRecord from, StopRecord to) const;
+            /// Count of the set distances
+            size_t Size() const;
+
+            /// Call `action(from_id, to_id, distance)` for every set distance, the opposite directions copies are skipped
+            template <typename Action>
+            void ForEach(Action&& action) const {
+                distances_.ForEach([&action](uint64_t key, const Item& item) {
+                    if (item.is_set) {
+                        action(static_cast<StopId>(key >> 32), static_cast<StopId>(key), item.distance);
+                    }
+                });
+            }
+
+        private:
+            struct Item {
+                DistanceBetweenStopsRecord distance;
+                /// False for a copy of the opposite direction distance
+                bool is_set = false;
+            };
+
+            detail::FlatHashMap<Item> distances_;
+            size_t size_ = 0;
+
+            static uint64_t MakeKey_(StopRecord from, StopRecord to) {
+                return static_cast<uint64_t>(from->id) << 32 | to->id;
+            }
         };
 
         class NameToStopView : public TableView, public NameToStopViewBase {
@@ -285,10 +334,62 @@ namespace transport_catalogue::data /* Db scheme */ {
             NameToBusRoutesView() : TableView("NameToBusRoutesView"), NameToBusRoutesViewBase() {}
         };
 
-        class StopToBusesView : public TableView, public StopToBusesViewBase {
+        /// Buses of the stops in the compressed-sparse-row layout: buses of the stop `s` are `buses_[offsets_[s] .. offsets_[s + 1])`
+        /// sorted by name. The added buses are pending in the lists of their stops until the view is frozen, so ingestion only appends them
+        class StopToBusesView : public TableView {
         public:
-            using StopToBusesViewBase::unordered_map;
-            StopToBusesView() : TableView("StopToBusesView"), StopToBusesViewBase() {}
+            StopToBusesView() : TableView("StopToBusesView") {}
+
+            void Add(StopId stop_id, BusRecord bus);
+            /// Merge the pending buses into the sorted rows
+            void Freeze();
+            bool IsFrozen() const;
+            /// The view must be frozen, the result is valid until the next freezing
+            BusRecordsView GetBuses(StopId stop_id) const;
+
+            /// Call `action(bus)` for the frozen and the pending buses of the stop without freezing the view,
+            /// a pending bus may be visited more than once
+            template <typename Action>
+            void ForEachBus(StopId stop_id, Action&& action) const {
+                if (static_cast<size_t>(stop_id) + 1 < offsets_.size()) {
+                    std::for_each(buses_.data() + offsets_[stop_id], buses_.data() + offsets_[stop_id + 1], action);
+                }
+                if (static_cast<size_t>(stop_id) < pending_buses_.size()) {
+                    std::for_each(pending_buses_[stop_id].begin(), pending_buses_[stop_id].end(), action);
+                }
+            }
+
+        private:
+            std::vector<size_t> offsets_{0};
+            std::vector<BusRecord> buses_;
+            /// Indexed by StopId
+            std::vector<std::vector<BusRecord>> pending_buses_;
+            size_t pending_count_ = 0;
+        };
+
+        /// Materialized stats of the buses indexed by BusId, empty while the stats are not built
+        class BusStatsView : public TableView, public std::vector<BusStat> {
+        public:
+            using std::vector<BusStat>::vector;
+            BusStatsView() : TableView("BusStatsView"), std::vector<BusStat>() {}
+        };
+
+        /// Materialized stats of the stops indexed by StopId, empty while the stats are not built.
+        /// The buses of all stops are stored in one array (compressed sparse row layout), a stat refers to its row
+        class StopStatsView : public TableView {
+        public:
+            StopStatsView() : TableView("StopStatsView") {}
+
+            /// Append the stat of the next stop id
+            void PushBack(BusRecordsView buses);
+            StopStat operator[](StopId stop_id) const;
+            size_t size() const;
+            bool empty() const;
+            void clear();
+
+        private:
+            std::vector<size_t> offsets_{0};
+            std::vector<BusRecord> buses_;
         };
     };
 }
@@ -301,13 +402,16 @@ namespace transport_catalogue::data /* Interfaces */ {
         virtual const DatabaseScheme::StopsTable& GetStopsTable() const = 0;
 
         virtual std::vector<BusRecord> GetBuses() const = 0;
-        virtual const BusRecordSet& GetBuses(StopRecord stop) const = 0;
-        virtual const BusRecordSet& GetBuses(const std::string_view bus_name) const = 0;
+        virtual BusRecordsView GetBuses(StopRecord stop) const = 0;
+        virtual BusRecordsView GetBuses(const std::string_view bus_name) const = 0;
         virtual const DatabaseScheme::BusRoutesTable& GetBusRoutesTable() const = 0;
 
         virtual const DatabaseScheme::DistanceBetweenStopsTable& GetDistancesBetweenStops() const = 0;
         virtual DistanceBetweenStopsRecord GetDistanceBetweenStops(StopRecord from, StopRecord to) const = 0;
 
+        virtual const DatabaseScheme::BusStatsView& GetBusStatsView() const = 0;
+        virtual const DatabaseScheme::StopStatsView& GetStopStatsView() const = 0;
+
         virtual ~ITransportDataReader() = default;
     };
 
@@ -323,6 +427,10 @@ namespace transport_catalogue::data /* Interfaces */ {
         virtual void SetMeasuredDistance(const std::string_view from_stop_name, const std::string_view to_stop_name, double distance) const = 0;
         virtual void SetMeasuredDistance(data::MeasuredRoadDistance&& distance) const = 0;
 
+        /// Store the materialized stats, they are dropped by the next change of the data.
+        /// Throw std::invalid_argument if the stats counts do not match the buses and stops counts
+        virtual void SetStats(DatabaseScheme::BusStatsView&& bus_stats, DatabaseScheme::StopStatsView&& stop_stats) const = 0;
+
         virtual ~ITransportDataWriter() = default;
     };
 
@@ -334,6 +442,10 @@ namespace transport_catalogue::data /* Interfaces */ {
         virtual StopStat GetStopInfo(const data::StopRecord stop) const = 0;
         virtual std::optional<StopStat> GetStopInfo(const std::string_view stop_name) const = 0;
 
+        /// Compute the stats of every bus and stop in parallel, the materialized stats are not used
+        virtual DatabaseScheme::BusStatsView ComputeBusStats() const = 0;
+        virtual DatabaseScheme::StopStatsView ComputeStopStats() const = 0;
+
         virtual const data::ITransportDataReader& GetDataReader() const = 0;
 
         virtual ~ITransportStatDataReader() = default;
@@ -395,6 +507,8 @@ namespace transport_catalogue::data /* Database */ {
 
         const Stop* GetStop(const std::string_view name) const;
 
+        void SetStats(DatabaseScheme::BusStatsView&& bus_stats, DatabaseScheme::StopStatsView&& stop_stats);
+
     private:
         DatabaseScheme::StopsTable stops_;
         DatabaseScheme::BusRoutesTable bus_routes_;
@@ -403,6 +517,15 @@ namespace transport_catalogue::data /* Database */ {
         DatabaseScheme::NameToStopView name_to_stop_;
         DatabaseScheme::NameToBusRoutesView name_to_bus_;
         DatabaseScheme::StopToBusesView stop_to_buses_;
+        /// False while the stop to buses view has pending buses, the first reader freezes it
+        std::atomic_bool is_stop_to_buses_frozen_{true};
+        /// Buses whose cumulative distances are stale after a change of the distances, the first reader recomputes them
+        std::vector<BusId> stale_buses_;
+        /// Indexed by BusId
+        std::vector<bool> is_bus_stale_;
+        std::atomic_bool has_stale_buses_{false};
+        DatabaseScheme::BusStatsView bus_stats_;
+        DatabaseScheme::StopStatsView stop_stats_;
 
         std::mutex mutex_;
 
@@ -423,6 +546,18 @@ namespace transport_catalogue::data /* Database */ {
                 true>
         Route ToRoute(Container&& stops) const;
 
+        /// Fill the cumulative distances of the bus route, the distances of unknown stops are zero
+        void ComputeRouteDistances(Bus& bus) const;
+
+        /// Return the frozen stop to buses view, the concurrent readers freeze it once
+        const DatabaseScheme::StopToBusesView& GetStopToBusesView();
+
+        /// Recompute the cumulative distances of the stale buses, the concurrent readers do it once
+        void UpdateRouteDistances();
+
+        /// Drop the materialized stats on a change of the data
+        void ResetStats();
+
     public:
         class DataWriter;
         class DataReader;
@@ -453,6 +588,8 @@ namespace transport_catalogue::data /* Database inner classes (Read/Write interf
 
         void SetMeasuredDistance(data::MeasuredRoadDistance&& distance) const override;
 
+        void SetStats(DatabaseScheme::BusStatsView&& bus_stats, DatabaseScheme::StopStatsView&& stop_stats) const override;
+
     private:
         Database& db_;
     };
@@ -471,19 +608,24 @@ namespace transport_catalogue::data /* Database inner classes (Read/Write interf
         }
 
         const DatabaseScheme::BusRoutesTable& GetBusRoutesTable() const override {
+            db_.UpdateRouteDistances();
             return db_.GetBusRoutesTable();
         }
 
         std::vector<BusRecord> GetBuses() const override;
 
-        const BusRecordSet& GetBuses(StopRecord stop) const override;
+        BusRecordsView GetBuses(StopRecord stop) const override;
 
-        const BusRecordSet& GetBuses(const std::string_view bus_name) const override;
+        BusRecordsView GetBuses(const std::string_view bus_name) const override;
 
         const DatabaseScheme::DistanceBetweenStopsTable& GetDistancesBetweenStops() const override;
 
         DistanceBetweenStopsRecord GetDistanceBetweenStops(StopRecord from, StopRecord to) const override;
 
+        const DatabaseScheme::BusStatsView& GetBusStatsView() const override;
+
+        const DatabaseScheme::StopStatsView& GetStopStatsView() const override;
+
     private:
         Database& db_;
     };
@@ -496,6 +638,8 @@ namespace transport_catalogue::data /* Database implementation */ {
     const Stop& Database<Owner>::AddStop(Stop&& stop) {
         assert(name_to_stop_.count(stop.name) == 0);
 
+        ResetStats();
+        stop.id = static_cast<StopId>(stops_.size());
         const Stop& new_stop = stops_.emplace_back(std::forward<Stop>(stop));
         name_to_stop_[new_stop.name] = &new_stop;
         return new_stop;
@@ -517,7 +661,20 @@ namespace transport_catalogue::data /* Database implementation */ {
 
         double pseudo_length = geo::ComputeDistance(from_stop->coordinates, to_stop->coordinates);
 
-        measured_distances_btw_stops_[{from_stop, to_stop}] = {pseudo_length, distance};
+        ResetStats();
+        measured_distances_btw_stops_.Set(from_stop, to_stop, {pseudo_length, distance});
+
+        // The distance is used for the opposite direction too, every route of the opposite direction passes the from stop as well.
+        // The pending buses are scanned as is, so a batch of distances does not freeze the view after every bus.
+        // The buses are only marked, their routes are recomputed once for the whole batch
+        stop_to_buses_.ForEachBus(from_stop->id, [this](const BusRecord bus) {
+            if (!is_bus_stale_[bus->id]) {
+                is_bus_stale_[bus->id] = true;
+                stale_buses_.push_back(bus->id);
+            }
+        });
+        // Pairs with the acquire load of the readers, which recompute the routes under the mutex
+        has_stale_buses_.store(!stale_buses_.empty(), std::memory_order_release);
     }
 
     template <class Owner>
@@ -525,11 +682,19 @@ namespace transport_catalogue::data /* Database implementation */ {
     const Bus& Database<Owner>::AddBus(Bus&& bus) {
         assert(name_to_bus_.count(bus.name) == 0);
 
-        const Bus& new_bus = bus_routes_.emplace_back(std::forward<Bus>(bus));
+        ResetStats();
+        bus.id = static_cast<BusId>(bus_routes_.size());
+        Bus& new_bus = bus_routes_.emplace_back(std::forward<Bus>(bus));
+        ComputeRouteDistances(new_bus);
+        is_bus_stale_.push_back(false);
         name_to_bus_[new_bus.name] = &new_bus;
         std::for_each(new_bus.route.begin(), new_bus.route.end(), [this, &new_bus](const Stop* stop) {
-            stop_to_buses_[stop].insert(&new_bus);
+            if (stop != nullptr) {
+                stop_to_buses_.Add(stop->id, &new_bus);
+            }
         });
+        // Pairs with the acquire load of the readers, which freeze the view under the mutex
+        is_stop_to_buses_frozen_.store(false, std::memory_order_release);
         return new_bus;
     }
 
@@ -580,6 +745,63 @@ namespace transport_catalogue::data /* Database implementation */ {
         return route;
     }
 
+    template <class Owner>
+    void Database<Owner>::SetStats(DatabaseScheme::BusStatsView&& bus_stats, DatabaseScheme::StopStatsView&& stop_stats) {
+        if (bus_stats.size() != bus_routes_.size() || stop_stats.size() != stops_.size()) {
+            throw std::invalid_argument("Stats do not match the buses and stops tables");
+        }
+        bus_stats_ = std::move(bus_stats);
+        stop_stats_ = std::move(stop_stats);
+    }
+
+    template <class Owner>
+    void Database<Owner>::ResetStats() {
+        bus_stats_.clear();
+        stop_stats_.clear();
+    }
+
+    template <class Owner>
+    const DatabaseScheme::StopToBusesView& Database<Owner>::GetStopToBusesView() {
+        if (!is_stop_to_buses_frozen_.load(std::memory_order_acquire)) {
+            std::lock_guard lock(mutex_);
+            if (!stop_to_buses_.IsFrozen()) {
+                stop_to_buses_.Freeze();
+            }
+            is_stop_to_buses_frozen_.store(true, std::memory_order_release);
+        }
+        return stop_to_buses_;
+    }
+
+    template <class Owner>
+    void Database<Owner>::UpdateRouteDistances() {
+        if (has_stale_buses_.load(std::memory_order_acquire)) {
+            std::lock_guard lock(mutex_);
+            for (const BusId bus_id : stale_buses_) {
+                ComputeRouteDistances(bus_routes_[bus_id]);
+                is_bus_stale_[bus_id] = false;
+            }
+            stale_buses_.clear();
+            has_stale_buses_.store(false, std::memory_order_release);
+        }
+    }
+
+    template <class Owner>
+    void Database<Owner>::ComputeRouteDistances(Bus& bus) const {
+        const Route& route = bus.route;
+        RouteDistances& distances = bus.distances;
+        distances.measured.assign(route.size(), 0.);
+        distances.geographic.assign(route.size(), 0.);
+        for (size_t i = 1; i < route.size(); ++i) {
+            const Stop* from_stop = route[i - 1];
+            const Stop* to_stop = route[i];
+            // A hop without the distance record adds nothing to both lengths
+            const DistanceBetweenStopsRecord distance =
+                from_stop != nullptr && to_stop != nullptr ? measured_distances_btw_stops_.Get(from_stop, to_stop) : DistanceBetweenStopsRecord{0., 0.};
+            distances.measured[i] = distances.measured[i - 1] + distance.measured_distance;
+            distances.geographic[i] = distances.geographic[i - 1] + distance.distance;
+        }
+    }
+
     template <class Owner>
     template <
         typename StringView, typename TableView,
@@ -681,12 +903,18 @@ namespace transport_catalogue::data /* Database::DataWriter implementation */ {
     void Database<Owner>::DataWriter::SetMeasuredDistance(data::MeasuredRoadDistance&& distance) const {
         db_.AddMeasuredDistance(std::move(distance.from_stop), std::move(distance.to_stop), std::move(distance.distance));
     }
+
+    template <class Owner>
+    void Database<Owner>::DataWriter::SetStats(DatabaseScheme::BusStatsView&& bus_stats, DatabaseScheme::StopStatsView&& stop_stats) const {
+        db_.SetStats(std::move(bus_stats), std::move(stop_stats));
+    }
 }
 
 namespace transport_catalogue::data /* Database::DataReader implementation */ {
 
     template <class Owner>
     BusRecord Database<Owner>::DataReader::GetBus(std::string_view name) const {
+        db_.UpdateRouteDistances();
         return db_.GetBus(name);
     }
 
@@ -697,6 +925,7 @@ namespace transport_catalogue::data /* Database::DataReader implementation */ {
 
     template <class Owner>
     std::vector<BusRecord> Database<Owner>::DataReader::GetBuses() const {
+        db_.UpdateRouteDistances();
         std::vector<BusRecord> result(db_.name_to_bus_.size());
         std::transform(db_.name_to_bus_.begin(), db_.name_to_bus_.end(), result.begin(), [](auto&& item) {
             return item.second;
@@ -705,17 +934,14 @@ namespace transport_catalogue::data /* Database::DataReader implementation */ {
     }
 
     template <class Owner>
-    const BusRecordSet& Database<Owner>::DataReader::GetBuses(StopRecord stop) const {
-        static const BusRecordSet empty_result;
-        auto ptr = db_.stop_to_buses_.find(stop);
-        return ptr == db_.stop_to_buses_.end() ? empty_result : ptr->second;
+    BusRecordsView Database<Owner>::DataReader::GetBuses(StopRecord stop) const {
+        db_.UpdateRouteDistances();
+        return stop == nullptr ? BusRecordsView{} : db_.GetStopToBusesView().GetBuses(stop->id);
     }
 
     template <class Owner>
-    const BusRecordSet& Database<Owner>::DataReader::GetBuses(const std::string_view bus_name) const {
-        static const BusRecordSet empty_result;
-        auto stop_ptr = GetStop(bus_name);
-        return stop_ptr == nullptr ? empty_result : GetBuses(stop_ptr);
+    BusRecordsView Database<Owner>::DataReader::GetBuses(const std::string_view bus_name) const {
+        return GetBuses(GetStop(bus_name));
     }
 
     template <class Owner>
@@ -725,12 +951,16 @@ namespace transport_catalogue::data /* Database::DataReader implementation */ {
 
     template <class Owner>
     DistanceBetweenStopsRecord Database<Owner>::DataReader::GetDistanceBetweenStops(StopRecord from, StopRecord to) const {
-        auto ptr = db_.measured_distances_btw_stops_.find({from, to});
-        if (ptr != db_.measured_distances_btw_stops_.end()) {
-            return ptr->second;
-        } else if (ptr = db_.measured_distances_btw_stops_.find({to, from}); ptr != db_.measured_distances_btw_stops_.end()) {
-            return ptr->second;
-        }
-        return {0., 0.};
+        return db_.measured_distances_btw_stops_.Get(from, to);
+    }
+
+    template <class Owner>
+    const DatabaseScheme::BusStatsView& Database<Owner>::DataReader::GetBusStatsView() const {
+        return db_.bus_stats_;
+    }
+
+    template <class Owner>
+    const DatabaseScheme::StopStatsView& Database<Owner>::DataReader::GetStopStatsView() const {
+        return db_.stop_stats_;
     }
 }
\ No newline at end of file
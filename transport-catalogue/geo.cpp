@@ -1,15 +1,45 @@
 #include "geo.h"
 
+#include <algorithm>
+
 namespace transport_catalogue::geo {
     double ComputeDistance(Coordinates from, Coordinates to) {
         using namespace std;
         if (from == to) {
             return 0;
         }
-        static const double dr = M_PI / 180.;
         return std::acos(
-                   std::sin(from.lat * dr) * std::sin(to.lat * dr) +
-                   std::cos(from.lat * dr) * std::cos(to.lat * dr) * std::cos(std::abs(from.lng - to.lng) * dr)) *
+                   std::sin(ToRadians(from.lat)) * std::sin(ToRadians(to.lat)) +
+                   std::cos(ToRadians(from.lat)) * std::cos(ToRadians(to.lat)) * std::cos(ToRadians(std::abs(from.lng - to.lng)))) *
                EARTH_RADIUS;
     }
-}
\ No newline at end of file
+
+    uint64_t ComputeHilbertIndex(Coordinates point, Coordinates min, Coordinates max, uint32_t order) {
+        const uint64_t side = uint64_t{1} << order;
+        const auto to_cell = [side](double value, double min, double max) -> uint64_t {
+            if (!(max > min)) {
+                return 0;
+            }
+            const double cell = (value - min) / (max - min) * static_cast<double>(side);
+            return cell <= 0. ? 0 : std::min(static_cast<uint64_t>(cell), side - 1);
+        };
+        uint64_t x = to_cell(point.lng, min.lng, max.lng);
+        uint64_t y = to_cell(point.lat, min.lat, max.lat);
+
+        uint64_t index = 0;
+        for (uint64_t s = side / 2; s > 0; s /= 2) {
+            const uint64_t rx = (x & s) > 0 ? 1 : 0;
+            const uint64_t ry = (y & s) > 0 ? 1 : 0;
+            index += s * s * ((3 * rx) ^ ry);
+            // Rotate the quadrant, so the curve of the next level is continuous
+            if (ry == 0) {
+                if (rx == 1) {
+                    x = side - 1 - x;
+                    y = side - 1 - y;
+                }
+                std::swap(x, y);
+            }
+        }
+        return index;
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cmath>
+#include <cstdint>
 #include <exception>
 #include <iostream>
 #include <optional>
@@ -14,6 +15,11 @@ namespace transport_catalogue::geo {
 
     static const double EARTH_RADIUS = 6371000.;
     static constexpr const double THRESHOLD = 1e-6;
+    static constexpr const double DEG_TO_RAD = M_PI / 180.;
+
+    inline double ToRadians(double degrees) {
+        return degrees * DEG_TO_RAD;
+    }
 
     struct Coordinates {
         double lat = 0.;
@@ -42,6 +48,10 @@ namespace transport_catalogue::geo {
 
     double ComputeDistance(Coordinates from, Coordinates to);
 
+    /// Position of the point on the Hilbert curve filling the [min, max] box (2^order x 2^order grid).
+    /// Points at close positions are close geographically, points outside the box are clamped to it
+    uint64_t ComputeHilbertIndex(Coordinates point, Coordinates min, Coordinates max, uint32_t order = 16);
+
     struct Point {
         double north = 0.;
         double east = 0.;
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cstdlib>
 #include <iterator>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
@@ -31,6 +32,14 @@ namespace graph {
         using EdgeContainer = std::vector<Edge<Weight>>;
         using IncidentEdges = std::vector<IncidenceList>;
 
+        /// Contiguous view of vertex incident edges in frozen (CSR) layout
+        struct IncidentArcs {
+            const EdgeId* edge_ids = nullptr;
+            const VertexId* targets = nullptr;
+            const Weight* weights = nullptr;
+            size_t count = 0;
+        };
+
     public:
         DirectedWeightedGraph() = default;
         explicit DirectedWeightedGraph(size_t vertex_count);
@@ -45,9 +54,30 @@ namespace graph {
         const Edge<Weight>& GetEdge(EdgeId edge_id) const;
         IncidentEdgesRange GetIncidentEdges(VertexId vertex) const;
 
+        /// Convert incidence lists to compressed sparse row layout (offsets + edges sorted by source vertex).
+        /// Edge ids and incident edges order are preserved. No edges can be added to a frozen graph.
+        void Freeze();
+        /// Convert the CSR layout back to incidence lists, so edges can be added again. Edge ids are preserved
+        void Unfreeze();
+        bool IsFrozen() const;
+        /// Change the edge weight in place, O(1) in both layouts (the arc slot of a frozen edge is indexed by the edge id)
+        void SetEdgeWeight(EdgeId edge_id, Weight weight);
+        /// Change the weights of all edges at once (indexed by the edge id), the topology is kept
+        void SetEdgeWeights(const std::vector<Weight>& weights);
+        IncidentArcs GetIncidentArcs(VertexId vertex) const;
+
     private:
         EdgeContainer edges_;
         IncidentEdges incidence_lists_;
+
+        /// CSR layout (filled by Freeze), the targets and weights are copied next to the edge ids to scan the arcs sequentially
+        bool is_frozen_ = false;
+        std::vector<size_t> arc_offsets_;
+        std::vector<EdgeId> arc_edge_ids_;
+        std::vector<VertexId> arc_targets_;
+        std::vector<Weight> arc_weights_;
+        /// Arc slot of every edge (indexed by the edge id) to keep the arc weights in sync
+        std::vector<size_t> edge_arcs_;
     };
 
     template <typename Weight>
@@ -60,6 +90,9 @@ namespace graph {
     template <typename Weight>
     template <typename TEdge, std::enable_if_t<std::is_same_v<std::decay_t<TEdge>, Edge<Weight>>, bool>>
     EdgeId DirectedWeightedGraph<Weight>::AddEdge(TEdge&& edge) {
+        if (is_frozen_) {
+            throw std::logic_error("Unable to add edge to frozen graph");
+        }
         const Edge<Weight>& emplaced_edge = edges_.emplace_back(std::forward<TEdge>(edge));
         const EdgeId id = edges_.size() - 1;
         incidence_lists_.at(emplaced_edge.from).push_back(id);
@@ -68,7 +101,7 @@ namespace graph {
 
     template <typename Weight>
     size_t DirectedWeightedGraph<Weight>::GetVertexCount() const {
-        return incidence_lists_.size();
+        return is_frozen_ ? arc_offsets_.size() - 1 : incidence_lists_.size();
     }
 
     template <typename Weight>
@@ -83,6 +116,99 @@ namespace graph {
 
     template <typename Weight>
     typename DirectedWeightedGraph<Weight>::IncidentEdgesRange DirectedWeightedGraph<Weight>::GetIncidentEdges(VertexId vertex) const {
+        if (is_frozen_) {
+            const auto begin = arc_edge_ids_.begin();
+            return IncidentEdgesRange(begin + arc_offsets_.at(vertex), begin + arc_offsets_.at(vertex + 1));
+        }
         return ranges::AsRange(incidence_lists_.at(vertex));
     }
+
+    template <typename Weight>
+    void DirectedWeightedGraph<Weight>::Freeze() {
+        if (is_frozen_) {
+            return;
+        }
+
+        const size_t vertex_count = incidence_lists_.size();
+        arc_offsets_.assign(vertex_count + 1, 0);
+        arc_edge_ids_.clear();
+        arc_edge_ids_.reserve(edges_.size());
+        arc_targets_.clear();
+        arc_targets_.reserve(edges_.size());
+        arc_weights_.clear();
+        arc_weights_.reserve(edges_.size());
+        edge_arcs_.assign(edges_.size(), 0);
+
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            for (const EdgeId edge_id : incidence_lists_[vertex]) {
+                const Edge<Weight>& edge = edges_.at(edge_id);
+                edge_arcs_[edge_id] = arc_edge_ids_.size();
+                arc_edge_ids_.push_back(edge_id);
+                arc_targets_.push_back(edge.to);
+                arc_weights_.push_back(edge.weight);
+            }
+            arc_offsets_[vertex + 1] = arc_edge_ids_.size();
+        }
+
+        IncidentEdges().swap(incidence_lists_);
+        is_frozen_ = true;
+    }
+
+    template <typename Weight>
+    void DirectedWeightedGraph<Weight>::Unfreeze() {
+        if (!is_frozen_) {
+            return;
+        }
+
+        const size_t vertex_count = arc_offsets_.size() - 1;
+        incidence_lists_.assign(vertex_count, IncidenceList{});
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            incidence_lists_[vertex].assign(arc_edge_ids_.begin() + arc_offsets_[vertex], arc_edge_ids_.begin() + arc_offsets_[vertex + 1]);
+        }
+
+        std::vector<size_t>().swap(arc_offsets_);
+        std::vector<EdgeId>().swap(arc_edge_ids_);
+        std::vector<VertexId>().swap(arc_targets_);
+        std::vector<Weight>().swap(arc_weights_);
+        std::vector<size_t>().swap(edge_arcs_);
+        is_frozen_ = false;
+    }
+
+    template <typename Weight>
+    void DirectedWeightedGraph<Weight>::SetEdgeWeight(EdgeId edge_id, Weight weight) {
+        edges_.at(edge_id).weight = weight;
+        if (is_frozen_) {
+            arc_weights_[edge_arcs_[edge_id]] = weight;
+        }
+    }
+
+    template <typename Weight>
+    void DirectedWeightedGraph<Weight>::SetEdgeWeights(const std::vector<Weight>& weights) {
+        if (weights.size() != edges_.size()) {
+            throw std::invalid_argument("Weights count does not match the edges count");
+        }
+        for (EdgeId edge_id = 0; edge_id < edges_.size(); ++edge_id) {
+            edges_[edge_id].weight = weights[edge_id];
+        }
+        if (is_frozen_) {
+            std::transform(arc_edge_ids_.begin(), arc_edge_ids_.end(), arc_weights_.begin(), [&weights](EdgeId edge_id) {
+                return weights[edge_id];
+            });
+        }
+    }
+
+    template <typename Weight>
+    bool DirectedWeightedGraph<Weight>::IsFrozen() const {
+        return is_frozen_;
+    }
+
+    template <typename Weight>
+    typename DirectedWeightedGraph<Weight>::IncidentArcs DirectedWeightedGraph<Weight>::GetIncidentArcs(VertexId vertex) const {
+        if (!is_frozen_) {
+            throw std::logic_error("Incident arcs are available for frozen graph only");
+        }
+        const size_t begin = arc_offsets_.at(vertex);
+        const size_t count = arc_offsets_.at(vertex + 1) - begin;
+        return IncidentArcs{arc_edge_ids_.data() + begin, arc_targets_.data() + begin, arc_weights_.data() + begin, count};
+    }
 }
\ No newline at end of file
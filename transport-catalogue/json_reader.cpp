@@ -279,8 +279,11 @@ namespace transport_catalogue::io /* JsonResponseSender implementation */ {
             if (!stat.has_value()) {
                 dict_context.Key(ERROR_MESSAGE_ITEM.first).Value(ERROR_MESSAGE_ITEM.second);
             } else {
-                dict_context.Key(StatFields::BUSES)
-                    .Value(json::Array(std::make_move_iterator(stat->buses.begin()), std::make_move_iterator(stat->buses.end())));
+                json::Array buses_names(stat->buses.size());
+                std::transform(stat->buses.begin(), stat->buses.end(), buses_names.begin(), [](const data::BusRecord bus) -> json::Node {
+                    return bus->name;
+                });
+                dict_context.Key(StatFields::BUSES).Value(std::move(buses_names));
             }
         } else if (response.IsMapResponse()) {
             auto map = std::move(response.GetMapData());
@@ -296,6 +299,20 @@ namespace transport_catalogue::io /* JsonResponseSender implementation */ {
             } else {
                 BuildRouteMessage_(std::move(route_info.value()), dict_context);
             }
+        } else if (response.IsRouteMatrixResponse()) {
+            auto route_matrix = std::move(response.GetRouteMatrix());
+            if (!route_matrix.has_value()) {
+                dict_context.Key(ERROR_MESSAGE_ITEM.first).Value(ERROR_MESSAGE_ITEM.second);
+            } else {
+                BuildRouteMatrixMessage_(std::move(route_matrix.value()), dict_context);
+            }
+        } else if (response.IsReachableResponse()) {
+            auto reachable_stops = std::move(response.GetReachableStops());
+            if (!reachable_stops.has_value()) {
+                dict_context.Key(ERROR_MESSAGE_ITEM.first).Value(ERROR_MESSAGE_ITEM.second);
+            } else {
+                BuildReachableMessage_(std::move(reachable_stops.value()), dict_context);
+            }
         } else {
             throw exceptions::ReadingException("Invalid response (Is not stat response). Response does not contain stat info");
         }
@@ -306,7 +323,57 @@ namespace transport_catalogue::io /* JsonResponseSender implementation */ {
 
     void JsonResponseSender::BuildRouteMessage_(RouteInfo&& route_info, json::Builder::KeyValueContext& dict_context) const {
         dict_context.Key(StatFields::TOTAL_TIME).Value(static_cast<double>(route_info.total_time));
-        auto&& items = std::move(route_info.items);
+        dict_context.Key(StatFields::ITEMS).Value(BuildRouteItems_(std::move(route_info.items)));
+    }
+
+    /// Rows are sources, columns are targets. A missing route is null.
+    /// Route items are added only if the matrix routes are unpacked
+    void JsonResponseSender::BuildRouteMatrixMessage_(RouteMatrix&& route_matrix, json::Builder::KeyValueContext& dict_context) const {
+        const bool has_items = route_matrix.is_unpacked;
+
+        json::Array total_times;
+        json::Array items;
+        total_times.reserve(route_matrix.sources_count);
+        for (size_t i = 0; i < route_matrix.sources_count; ++i) {
+            json::Array total_times_row;
+            json::Array items_row;
+            total_times_row.reserve(route_matrix.targets_count);
+            for (size_t j = 0; j < route_matrix.targets_count; ++j) {
+                std::optional<RouteInfo>& route = route_matrix.routes[i * route_matrix.targets_count + j];
+                if (!route.has_value()) {
+                    total_times_row.emplace_back(nullptr);
+                    if (has_items) {
+                        items_row.emplace_back(nullptr);
+                    }
+                    continue;
+                }
+                total_times_row.emplace_back(static_cast<double>(route->total_time));
+                if (has_items) {
+                    items_row.emplace_back(BuildRouteItems_(std::move(route->items)));
+                }
+            }
+            total_times.emplace_back(std::move(total_times_row));
+            if (has_items) {
+                items.emplace_back(std::move(items_row));
+            }
+        }
+
+        dict_context.Key(StatFields::TOTAL_TIMES).Value(std::move(total_times));
+        if (has_items) {
+            dict_context.Key(StatFields::ITEMS).Value(std::move(items));
+        }
+    }
+
+    void JsonResponseSender::BuildReachableMessage_(ReachableStops&& reachable_stops, json::Builder::KeyValueContext& dict_context) const {
+        json::Array stops_json;
+        stops_json.reserve(reachable_stops.size());
+        std::for_each(reachable_stops.begin(), reachable_stops.end(), [&stops_json](const router::ReachableStop& stop) {
+            stops_json.emplace_back(json::Dict{{StatFields::STOP_NAME, std::string(stop.stop_name)}, {StatFields::TIME, stop.time}});
+        });
+        dict_context.Key(StatFields::STOPS).Value(std::move(stops_json));
+    }
+
+    json::Array JsonResponseSender::BuildRouteItems_(RouteInfo::ItemsCollection&& items) {
         json::Array items_json;
         items_json.reserve(items.size());
         std::for_each(std::make_move_iterator(items.begin()), std::make_move_iterator(items.end()), [&items_json](auto&& item) {
@@ -323,7 +390,7 @@ namespace transport_catalogue::io /* JsonResponseSender implementation */ {
                 {"span_count", static_cast<int>(bus_info.span_count)},
                 {"time", static_cast<double>(bus_info.time)}});
         });
-        dict_context.Key(StatFields::ITEMS).Value(std::move(items_json));
+        return items_json;
     }
 
     json::Document JsonResponseSender::BuildStatResponse_(std::vector<StatResponse>&& responses) const {
@@ -70,6 +70,10 @@ namespace transport_catalogue::io /* JsonResponseSender */ {
             inline static const std::string MAP{"map"};
             inline static const std::string TOTAL_TIME{"total_time"};
             inline static const std::string ITEMS{"items"};
+            inline static const std::string TOTAL_TIMES{"total_times"};
+            inline static const std::string STOPS{"stops"};
+            inline static const std::string STOP_NAME{"stop_name"};
+            inline static const std::string TIME{"time"};
         };
 
         JsonResponseSender(std::ostream& output_stream) : output_stream_(output_stream) {}
@@ -84,6 +88,9 @@ namespace transport_catalogue::io /* JsonResponseSender */ {
     private:
         json::Dict BuildStatMessage_(StatResponse&& response) const;
         void BuildRouteMessage_(RouteInfo&& route_info, json::Builder::KeyValueContext& dict_context) const;
+        void BuildRouteMatrixMessage_(RouteMatrix&& route_matrix, json::Builder::KeyValueContext& dict_context) const;
+        void BuildReachableMessage_(ReachableStops&& reachable_stops, json::Builder::KeyValueContext& dict_context) const;
+        static json::Array BuildRouteItems_(RouteInfo::ItemsCollection&& items);
         json::Document BuildStatResponse_(std::vector<StatResponse>&& responses) const;
     };
 
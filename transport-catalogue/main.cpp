@@ -9,6 +9,7 @@
 #include "./tests/transport_catalogue_test.h"
 #include "json_reader.h"
 #include "request_handler.h"
+#include "tests/graph_test.h"
 #include "tests/json_builder_test.h"
 #include "tests/make_database_test.h"
 #include "tests/request_handler_test.h"
@@ -44,6 +45,9 @@ int tests() {
     RequestHandlerTester request_handler_tester;
     request_handler_tester.RunTests();
 
+    GraphTester graph_tester;
+    graph_tester.RunTests();
+
     TransportRouterTester transport_router_tester;
     transport_router_tester.RunTests();
 
@@ -0,0 +1,234 @@
+#include "raptor_router.h"
+
+#include <algorithm>
+#include <optional>
+#include <stdexcept>
+#include <vector>
+
+namespace transport_catalogue::router /* RaptorRouter implementation */ {
+
+    RaptorRouter::RaptorRouter(const data::ITransportDataReader& db_reader, double bus_wait_time_min, double bus_velocity_kmh)
+        : bus_wait_time_min_(bus_wait_time_min) {
+        const data::DatabaseScheme::StopsTable& stops = db_reader.GetStopsTable();
+        stops_.reserve(stops.size());
+        std::for_each(stops.begin(), stops.end(), [this](const data::Stop& stop) {
+            stops_.push_back(&stop);
+        });
+
+        const data::DatabaseScheme::BusRoutesTable& buses = db_reader.GetBusRoutesTable();
+        std::vector<RouteId> route_ids(buses.size(), NONE);
+        route_offsets_.push_back(0);
+        std::for_each(buses.begin(), buses.end(), [&](const data::Bus& bus) {
+            if (bus.route.size() < 2) {
+                return;
+            }
+            route_ids[bus.id] = static_cast<RouteId>(routes_.size());
+            routes_.push_back(&bus);
+
+            for (size_t i = 0; i < bus.route.size(); ++i) {
+                route_stops_.push_back(bus.route[i]->id);
+                route_times_.push_back(bus.GetMeasuredDistance(0, i) / 1000.0 / bus_velocity_kmh * 60.0);
+            }
+            route_offsets_.push_back(route_stops_.size());
+        });
+
+        stop_route_offsets_.reserve(stops_.size() + 1);
+        stop_route_offsets_.push_back(0);
+        for (StopId stop_id = 0; stop_id < stops_.size(); ++stop_id) {
+            for (const data::BusRecord bus : db_reader.GetBuses(stops_[stop_id])) {
+                const RouteId route = route_ids[bus->id];
+                if (route == NONE) {
+                    continue;
+                }
+                const auto route_begin = route_stops_.begin() + route_offsets_[route];
+                const auto position = std::find(route_begin, route_stops_.begin() + route_offsets_[route + 1], stop_id) - route_begin;
+                stop_routes_.push_back(route);
+                stop_route_positions_.push_back(static_cast<Position>(position));
+            }
+            stop_route_offsets_.push_back(stop_routes_.size());
+        }
+    }
+
+    size_t RaptorRouter::GetRoutesCount() const {
+        return routes_.size();
+    }
+
+    size_t RaptorRouter::GetStopsCount() const {
+        return stops_.size();
+    }
+
+    RaptorRouter::StopId RaptorRouter::GetStopId(data::StopRecord stop) const {
+        if (stop == nullptr || stop->id >= stops_.size() || stops_[stop->id] != stop) {
+            throw std::out_of_range("Stop is not found");
+        }
+        return stop->id;
+    }
+
+    RaptorRouter::SearchScratch& RaptorRouter::GetScratch() {
+        static thread_local SearchScratch scratch;
+        return scratch;
+    }
+
+    size_t RaptorRouter::Search(StopId from, StopId to, double max_time, SearchScratch& scratch) const {
+        const size_t stops_count = stops_.size();
+        scratch.rounds.resize(std::max<size_t>(scratch.rounds.size(), 1));
+        scratch.rounds[0].assign(stops_count, Label{});
+        scratch.rounds[0][from].time = 0.;
+        scratch.best_times.assign(stops_count, INFINITE_TIME);
+        scratch.best_times[from] = 0.;
+        scratch.is_marked.assign(stops_count, false);
+        scratch.route_scan_positions.assign(routes_.size(), NONE);
+        scratch.marked_stops.assign(1, from);
+        scratch.marked_routes.clear();
+
+        size_t rounds_count = 1;
+        for (; !scratch.marked_stops.empty(); ++rounds_count) {
+            // Routes to scan from the first position of an improved stop
+            for (const StopId stop_id : scratch.marked_stops) {
+                scratch.is_marked[stop_id] = false;
+                for (size_t i = stop_route_offsets_[stop_id]; i < stop_route_offsets_[stop_id + 1]; ++i) {
+                    Position& scan_position = scratch.route_scan_positions[stop_routes_[i]];
+                    if (scan_position == NONE) {
+                        scratch.marked_routes.push_back(stop_routes_[i]);
+                    }
+                    scan_position = std::min(scan_position, stop_route_positions_[i]);
+                }
+            }
+            scratch.marked_stops.clear();
+
+            if (scratch.rounds.size() <= rounds_count) {
+                scratch.rounds.resize(rounds_count + 1);
+            }
+            const std::vector<Label>& previous_round = scratch.rounds[rounds_count - 1];
+            std::vector<Label>& round = scratch.rounds[rounds_count];
+            round.resize(stops_count);
+            for (StopId stop_id = 0; stop_id < stops_count; ++stop_id) {
+                round[stop_id] = Label{previous_round[stop_id].time};
+            }
+
+            for (const RouteId route : scratch.marked_routes) {
+                const StopId* route_stops = &route_stops_[route_offsets_[route]];
+                const double* route_times = &route_times_[route_offsets_[route]];
+                const Position route_size = static_cast<Position>(route_offsets_[route + 1] - route_offsets_[route]);
+
+                // The bus is boarded where (previous round arrival - time from the route start) is minimal
+                Position board_position = NONE;
+                double board_key = INFINITE_TIME;
+                for (Position position = scratch.route_scan_positions[route]; position < route_size; ++position) {
+                    const StopId stop_id = route_stops[position];
+                    if (board_position != NONE && stop_id != route_stops[board_position]) {
+                        const double arrival_time = board_key + bus_wait_time_min_ + route_times[position];
+                        const double target_time = to == NONE ? INFINITE_TIME : scratch.best_times[to];
+                        if (arrival_time <= max_time && arrival_time < std::min(scratch.best_times[stop_id], target_time)) {
+                            round[stop_id] = Label{arrival_time, route, board_position, position};
+                            scratch.best_times[stop_id] = arrival_time;
+                            if (!scratch.is_marked[stop_id]) {
+                                scratch.is_marked[stop_id] = true;
+                                scratch.marked_stops.push_back(stop_id);
+                            }
+                        }
+                    }
+                    if (previous_round[stop_id].time - route_times[position] < board_key) {
+                        board_key = previous_round[stop_id].time - route_times[position];
+                        board_position = position;
+                    }
+                }
+                scratch.route_scan_positions[route] = NONE;
+            }
+            scratch.marked_routes.clear();
+        }
+        return rounds_count;
+    }
+
+    RaptorRouter::Journey RaptorRouter::MakeJourney(const SearchScratch& scratch, size_t round, StopId to) const {
+        Journey journey;
+        for (StopId stop_id = to; round > 0; --round) {
+            const Label& label = scratch.rounds[round][stop_id];
+            if (label.route == NONE) {
+                continue;
+            }
+            const size_t route_offset = route_offsets_[label.route];
+            const double travel_time = route_times_[route_offset + label.alight_position] - route_times_[route_offset + label.board_position];
+            stop_id = route_stops_[route_offset + label.board_position];
+            journey.legs.push_back({routes_[label.route], stops_[stop_id], label.alight_position - label.board_position, travel_time});
+            journey.total_time += bus_wait_time_min_ + travel_time;
+        }
+        std::reverse(journey.legs.begin(), journey.legs.end());
+        return journey;
+    }
+
+    std::vector<RaptorRouter::Journey> RaptorRouter::BuildParetoRoutes(data::StopRecord from, data::StopRecord to) const {
+        const StopId from_id = GetStopId(from);
+        const StopId to_id = GetStopId(to);
+
+        std::vector<Journey> journeys;
+        if (from == to) {
+            journeys.push_back(Journey{});
+            return journeys;
+        }
+
+        SearchScratch& scratch = GetScratch();
+        const size_t rounds_count = Search(from_id, to_id, INFINITE_TIME, scratch);
+        // Every improvement of the target is strictly faster than the previous one (target pruning)
+        for (size_t round = 1; round < rounds_count; ++round) {
+            if (scratch.rounds[round][to_id].route != NONE) {
+                journeys.push_back(MakeJourney(scratch, round, to_id));
+            }
+        }
+        return journeys;
+    }
+
+    std::vector<std::pair<data::StopRecord, double>> RaptorRouter::BuildReachable(data::StopRecord from, double max_time) const {
+        const StopId from_id = GetStopId(from);
+
+        std::vector<std::pair<data::StopRecord, double>> reachable;
+        if (max_time < 0.) {
+            return reachable;
+        }
+        SearchScratch& scratch = GetScratch();
+        Search(from_id, NONE, max_time, scratch);
+        for (StopId stop_id = 0; stop_id < stops_.size(); ++stop_id) {
+            if (scratch.best_times[stop_id] <= max_time) {
+                reachable.emplace_back(stops_[stop_id], scratch.best_times[stop_id]);
+            }
+        }
+        return reachable;
+    }
+
+    std::vector<std::optional<RaptorRouter::Journey>> RaptorRouter::BuildRoutes(
+        data::StopRecord from, const std::vector<data::StopRecord>& targets) const {
+        const StopId from_id = GetStopId(from);
+        std::vector<StopId> target_ids(targets.size());
+        std::transform(targets.begin(), targets.end(), target_ids.begin(), [this](data::StopRecord stop) {
+            return GetStopId(stop);
+        });
+
+        SearchScratch& scratch = GetScratch();
+        const size_t rounds_count = Search(from_id, NONE, INFINITE_TIME, scratch);
+
+        std::vector<std::optional<Journey>> journeys(targets.size());
+        for (size_t i = 0; i < target_ids.size(); ++i) {
+            const StopId to_id = target_ids[i];
+            if (to_id == from_id) {
+                journeys[i] = Journey{};
+                continue;
+            }
+            // Every improvement of a stop is strictly faster than the previous one, the last one is the fastest
+            for (size_t round = rounds_count - 1; round > 0; --round) {
+                if (scratch.rounds[round][to_id].route != NONE) {
+                    journeys[i] = MakeJourney(scratch, round, to_id);
+                    break;
+                }
+            }
+        }
+        return journeys;
+    }
+
+    std::optional<RaptorRouter::Journey> RaptorRouter::BuildRoute(data::StopRecord from, data::StopRecord to) const {
+        std::vector<Journey> journeys = BuildParetoRoutes(from, to);
+        if (journeys.empty()) {
+            return std::nullopt;
+        }
+        return std::move(journeys.back());
+    }
+}
@@ -0,0 +1,103 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "domain.h"
+
+namespace transport_catalogue::router /* RaptorRouter */ {
+
+    /// Round-based transit router (RAPTOR) working directly on the buses routes, no routing graph is built.
+    /// Round `k` finds the fastest journeys with `k` boardings: every route that serves a stop improved in
+    /// the previous round is scanned once along its stops array. Each boarding costs the bus wait time.
+    class RaptorRouter {
+    public:
+        struct Leg {
+            data::BusRecord bus = nullptr;
+            data::StopRecord board_stop = nullptr;
+            size_t span_count = 0;
+            double travel_time = 0.;
+        };
+
+        struct Journey {
+            double total_time = 0.;
+            std::vector<Leg> legs;
+        };
+
+        /// Build flat routes arrays from the buses table and the stop to buses view of the database
+        RaptorRouter(const data::ITransportDataReader& db_reader, double bus_wait_time_min, double bus_velocity_kmh);
+
+        /// Return the fastest journey (the fewest boardings among equally fast ones)
+        std::optional<Journey> BuildRoute(data::StopRecord from, data::StopRecord to) const;
+
+        /// Return the fastest journeys from `from` to every target (nullopt for unreachable ones), all of them are read
+        /// from the labels of a single one-to-all search
+        std::vector<std::optional<Journey>> BuildRoutes(data::StopRecord from, const std::vector<data::StopRecord>& targets) const;
+
+        /// Return the Pareto set of (total time, boardings count) journeys ordered by boardings count,
+        /// every next journey is strictly faster than the previous one
+        std::vector<Journey> BuildParetoRoutes(data::StopRecord from, data::StopRecord to) const;
+
+        /// Return stops reachable from `from` not later than `max_time` with the earliest arrival times (unordered)
+        std::vector<std::pair<data::StopRecord, double>> BuildReachable(data::StopRecord from, double max_time) const;
+
+        size_t GetRoutesCount() const;
+        size_t GetStopsCount() const;
+
+    private:
+        using StopId = data::StopId;
+        using RouteId = uint32_t;
+        using Position = uint32_t;
+
+        static constexpr double INFINITE_TIME = std::numeric_limits<double>::infinity();
+        static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+
+        /// Arrival of a round, `route` is NONE if the label is not improved in the round
+        struct Label {
+            double time = INFINITE_TIME;
+            RouteId route = NONE;
+            Position board_position = NONE;
+            Position alight_position = NONE;
+        };
+
+        struct SearchScratch {
+            std::vector<std::vector<Label>> rounds;
+            std::vector<double> best_times;
+            std::vector<bool> is_marked;
+            std::vector<StopId> marked_stops;
+            std::vector<Position> route_scan_positions;
+            std::vector<RouteId> marked_routes;
+        };
+
+        double bus_wait_time_min_;
+        /// Indexed by StopId
+        std::vector<data::StopRecord> stops_;
+
+        /// Routes stops and travel times in a compressed-sparse-row layout:
+        /// stops of route `r` are `route_stops_[route_offsets_[r] .. route_offsets_[r + 1])`,
+        /// `route_times_[i]` is the travel time from the route start to the stop `route_stops_[i]`
+        std::vector<data::BusRecord> routes_;
+        std::vector<size_t> route_offsets_;
+        std::vector<StopId> route_stops_;
+        std::vector<double> route_times_;
+
+        /// Routes serving the stop and the first position of the stop on the route (compressed-sparse-row layout)
+        std::vector<size_t> stop_route_offsets_;
+        std::vector<RouteId> stop_routes_;
+        std::vector<Position> stop_route_positions_;
+
+        static SearchScratch& GetScratch();
+
+        /// Throw std::out_of_range if the stop is not a stop of the router
+        StopId GetStopId(data::StopRecord stop) const;
+
+        /// Run rounds until no stop is improved, return the count of the rounds with labels.
+        /// Arrivals later than `max_time` or the best arrival to `to` are pruned, `to` is NONE for a one-to-all search
+        size_t Search(StopId from, StopId to, double max_time, SearchScratch& scratch) const;
+        Journey MakeJourney(const SearchScratch& scratch, size_t round, StopId to) const;
+    };
+}
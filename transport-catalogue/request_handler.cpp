@@ -178,7 +178,8 @@ namespace transport_catalogue::io /* Request implementation */ {
         : Request(
               (assert(
                    command == converter(RequestCommand::BUS) || command == converter(RequestCommand::STOP) ||
-                   command == converter(RequestCommand::MAP) || command == converter(RequestCommand::ROUTE)),
+                   command == converter(RequestCommand::MAP) || command == converter(RequestCommand::ROUTE) ||
+                   command == converter(RequestCommand::ROUTE_MATRIX) || command == converter(RequestCommand::REACHABLE)),
                converter.ToRequestCommand(std::move(command))),
               std::move(args)) {}
 
@@ -212,8 +213,8 @@ namespace transport_catalogue::io /* Request implementation */ {
 
     bool Request::IsValidRequest() const {
         return (
-            IsGetBusCommand() || IsGetStopCommand() || IsGetMapCommand() || IsGetRouteCommand() || IsRenderSettingsRequest() || IsRoutingSettingsRequest() ||
-            IsSerializationSettingsRequest());
+            IsGetBusCommand() || IsGetStopCommand() || IsGetMapCommand() || IsGetRouteCommand() || IsGetRouteMatrixCommand() || IsGetReachableCommand() ||
+            IsRenderSettingsRequest() || IsRoutingSettingsRequest() || IsSerializationSettingsRequest());
     }
 
     RequestCommand& Request::GetCommand() {
@@ -239,6 +240,14 @@ namespace transport_catalogue::io /* Request implementation */ {
     bool Request::IsGetRouteCommand() const {
         return command_ == RequestCommand::ROUTE;
     }
+
+    bool Request::IsGetRouteMatrixCommand() const {
+        return command_ == RequestCommand::ROUTE_MATRIX;
+    }
+
+    bool Request::IsGetReachableCommand() const {
+        return command_ == RequestCommand::REACHABLE;
+    }
 }
 
 namespace transport_catalogue::io /* RequestEnumConverter implementation */ {
@@ -256,6 +265,10 @@ namespace transport_catalogue::io /* RequestEnumConverter implementation */ {
             return "Map"sv;
         case io::RequestCommand::ROUTE:  /// For StatRequest
             return "Route"sv;
+        case io::RequestCommand::ROUTE_MATRIX:  /// For StatRequest
+            return "RouteMatrix"sv;
+        case io::RequestCommand::REACHABLE:  /// For StatRequest
+            return "Reachable"sv;
         case io::RequestCommand::UNKNOWN:  /// Unused
             return "Unknown"sv;
         default:
@@ -275,6 +288,10 @@ namespace transport_catalogue::io /* RequestEnumConverter implementation */ {
             return io::RequestCommand::MAP;
         } else if (enum_name == "Route"sv) {  /// For StatRequest
             return io::RequestCommand::ROUTE;
+        } else if (enum_name == "RouteMatrix"sv) {  /// For StatRequest
+            return io::RequestCommand::ROUTE_MATRIX;
+        } else if (enum_name == "Reachable"sv) {  /// For StatRequest
+            return io::RequestCommand::REACHABLE;
         } else if (enum_name == "Unknown"sv) {  /// Unused
             return io::RequestCommand::UNKNOWN;
         }
@@ -333,6 +350,7 @@ namespace transport_catalogue::io /* RequestHandler implementation */ {
             if (!router_.HasGraph() && !force_disable_build_graph_) {
                 router_.Build();
             }
+            db_writer_.SetStats(db_reader_.ComputeBusStats(), db_reader_.ComputeStopStats());
             storage_.SaveToStorage();
         }
     }
@@ -341,7 +359,10 @@ namespace transport_catalogue::io /* RequestHandler implementation */ {
         assert(raw_req.IsValidRequest());
 
         if (raw_req.IsGetStopCommand()) {
-            db_writer_.AddStop(data::Stop{std::move(raw_req.GetName()), std::move(raw_req.GetCoordinates().value())});
+            // A known stop keeps its record, only its road distances are updated
+            if (db_reader_.GetDataReader().GetStop(raw_req.GetName()) == nullptr) {
+                db_writer_.AddStop(data::Stop{std::move(raw_req.GetName()), std::move(raw_req.GetCoordinates().value())});
+            }
             std::move(raw_req.GetRoadDistances().begin(), raw_req.GetRoadDistances().end(), std::back_inserter(out_distances));
 
         } else {
@@ -355,16 +376,43 @@ namespace transport_catalogue::io /* RequestHandler implementation */ {
         std::vector<data::MeasuredRoadDistance> out_distances;
         out_distances.reserve(base_req.size());
 
+        // The router built before is updated after the changes are written
+        const bool is_router_built = router_.HasGraph();
+        const data::ITransportDataReader& data_reader = db_reader_.GetDataReader();
+        const bool has_new_stops = std::any_of(base_req.begin(), base_req.end(), [&data_reader](const BaseRequest& req) {
+            return req.IsGetStopCommand() && data_reader.GetStop(req.GetName()) == nullptr;
+        });
+        std::vector<std::string> new_buses;
+        if (is_router_built && !has_new_stops) {
+            std::for_each(base_req.begin(), base_req.end(), [&new_buses](const BaseRequest& req) {
+                if (!req.IsGetStopCommand()) {
+                    new_buses.push_back(req.GetName());
+                }
+            });
+        }
+
         std::for_each(std::make_move_iterator(base_req.begin()), std::make_move_iterator(base_req.end()), [this, &out_distances](BaseRequest&& req) {
             ExecuteRequest(std::move(req), out_distances);
         });
 
-        std::for_each(
-            std::make_move_iterator(out_distances.begin()), std::make_move_iterator(out_distances.end()), [this](data::MeasuredRoadDistance&& dist) {
-                db_writer_.SetMeasuredDistance(std::move(dist));
-            });
+        std::for_each(out_distances.begin(), out_distances.end(), [this](const data::MeasuredRoadDistance& dist) {
+            db_writer_.SetMeasuredDistance(dist.from_stop, dist.to_stop, dist.distance);
+        });
 
-        out_distances.shrink_to_fit();
+        if (is_router_built && has_new_stops) {
+            router_.ResetGraph();
+            router_.Build();
+            return;
+        }
+        std::for_each(new_buses.begin(), new_buses.end(), [this](const std::string& bus_name) {
+            router_.AddBus(bus_name);
+        });
+        // The edges of the new buses are made with the new distances already, the rest of the buses are updated here
+        if (is_router_built) {
+            std::for_each(out_distances.begin(), out_distances.end(), [this](const data::MeasuredRoadDistance& dist) {
+                router_.UpdateDistance(dist.from_stop, dist.to_stop);
+            });
+        }
     }
 
     void RequestHandler::ExecuteRequest(StatRequest&& request) {
@@ -383,6 +431,8 @@ namespace transport_catalogue::io /* RequestHandler implementation */ {
             bool is_stop = request.IsGetStopCommand();
             bool is_map = request.IsGetMapCommand();
             bool is_router = request.IsGetRouteCommand();
+            bool is_route_matrix = request.IsGetRouteMatrixCommand();
+            bool is_reachable = request.IsGetReachableCommand();
 
             std::string name = request.GetName().value_or("");
 
@@ -394,11 +444,34 @@ namespace transport_catalogue::io /* RequestHandler implementation */ {
                 route_request = std::optional<RouteStatRequest>{RouteStatRequest(StatRequest(request))};
             }
 
+            std::optional<RouteMatrix> route_matrix = std::nullopt;
+            if (is_route_matrix) {
+                if (!router_.HasGraph()) {
+                    router_.Build();
+                }
+                RouteMatrixStatRequest route_matrix_request{StatRequest(request)};
+                assert(route_matrix_request.IsValidRequest());
+                route_matrix = router_.GetRouteMatrix(
+                    {route_matrix_request.GetFromStops().begin(), route_matrix_request.GetFromStops().end()},
+                    {route_matrix_request.GetToStops().begin(), route_matrix_request.GetToStops().end()}, route_matrix_request.HasItems());
+            }
+
+            std::optional<ReachableStops> reachable_stops = std::nullopt;
+            if (is_reachable) {
+                if (!router_.HasGraph()) {
+                    router_.Build();
+                }
+                ReachableStatRequest reachable_request{StatRequest(request)};
+                assert(reachable_request.IsValidRequest());
+                reachable_stops = router_.GetReachableStops(reachable_request.GetFromStop().value(), reachable_request.GetMaxTime().value());
+            }
+
             StatResponse resp(
                 std::move(request), is_bus ? db_reader_.GetBusInfo(name) : std::nullopt, is_stop ? db_reader_.GetStopInfo(name) : std::nullopt,
                 is_map ? std::optional<RawMapData>(RenderMap()) : std::nullopt,
                 is_router ? std::optional<RouteInfo>(router_.GetRouteInfo(route_request->GetFromStop().value(), route_request->GetToStop().value()))
-                          : std::nullopt);
+                          : std::nullopt,
+                std::move(route_matrix), std::move(reachable_stops));
 
             responses.emplace_back(std::move(resp));
         });
@@ -419,7 +492,9 @@ namespace transport_catalogue::io /* RequestHandler implementation */ {
         assert(request.IsValidRequest());
 
         router_.SetSettings(
-            {static_cast<double>(request.GetBusWaitTimeMin().value_or(0)), static_cast<double>(request.GetBusVelocityKmh().value_or(0))});
+            {static_cast<double>(request.GetBusWaitTimeMin().value_or(0)), static_cast<double>(request.GetBusVelocityKmh().value_or(0)),
+             request.GetRouterType().value_or(router::RouterType::ALL_PAIRS), request.GetCollapseParallelEdges().value_or(false),
+             request.GetRouteCacheCapacity().value_or(0), request.GetVertexOrder().value_or(router::VertexOrder::STOPS_TABLE)});
     }
 
     void RequestHandler::ExecuteRequest(SerializationSettingsRequest&& request) {
@@ -612,6 +687,14 @@ namespace transport_catalogue::io /* Response implementation */ {
         return command_ == RequestCommand::ROUTE;
     }
 
+    bool Response::IsRouteMatrixResponse() const {
+        return command_ == RequestCommand::ROUTE_MATRIX;
+    }
+
+    bool Response::IsReachableResponse() const {
+        return command_ == RequestCommand::REACHABLE;
+    }
+
     bool Response::IsStatResponse() const {
         return false;
     }
@@ -625,20 +708,24 @@ namespace transport_catalogue::io /* StatResponse implementation */ {
 
     StatResponse::StatResponse(
         int&& request_id, RequestCommand&& command, std::string&& name, std::optional<data::BusStat>&& bus_stat,
-        std::optional<data::StopStat>&& stop_stat, std::optional<RawMapData>&& map_data, std::optional<RouteInfo>&& route_info)
+        std::optional<data::StopStat>&& stop_stat, std::optional<RawMapData>&& map_data, std::optional<RouteInfo>&& route_info,
+        std::optional<RouteMatrix>&& route_matrix, std::optional<ReachableStops>&& reachable_stops)
         : Response(std::move(request_id), std::move(command), std::move(name)),
           bus_stat_{std::move(bus_stat)},
           stop_stat_{std::move(stop_stat)},
           map_data_{std::move(map_data)},
-          route_info_{std::move(route_info)} {}
+          route_info_{std::move(route_info)},
+          route_matrix_{std::move(route_matrix)},
+          reachable_stops_{std::move(reachable_stops)} {}
 
     StatResponse::StatResponse(
         StatRequest&& request, std::optional<data::BusStat>&& bus_stat, std::optional<data::StopStat>&& stop_stat,
-        std::optional<RawMapData>&& map_data, std::optional<RouteInfo>&& route_info)
+        std::optional<RawMapData>&& map_data, std::optional<RouteInfo>&& route_info, std::optional<RouteMatrix>&& route_matrix,
+        std::optional<ReachableStops>&& reachable_stops)
         : StatResponse(
               std::move((request.GetRequestId().value())), std::move(request.GetCommand()),
               request.GetName().has_value() ? std::move(request.GetName().value()) : std::string{}, std::move(bus_stat), std::move(stop_stat),
-              std::move(map_data), std::move(route_info)) {}
+              std::move(map_data), std::move(route_info), std::move(route_matrix), std::move(reachable_stops)) {}
 
     std::optional<data::BusStat>& StatResponse::GetBusInfo() {
         return bus_stat_;
@@ -656,6 +743,14 @@ namespace transport_catalogue::io /* StatResponse implementation */ {
         return route_info_;
     }
 
+    std::optional<RouteMatrix>& StatResponse::GetRouteMatrix() {
+        return route_matrix_;
+    }
+
+    std::optional<ReachableStops>& StatResponse::GetReachableStops() {
+        return reachable_stops_;
+    }
+
     bool StatResponse::IsStatResponse() const {
         return true;
     }
@@ -760,6 +855,75 @@ namespace transport_catalogue::io /* RouteStatRequest implementation */ {
     }
 }
 
+namespace transport_catalogue::io /* RouteMatrixStatRequest implementation */ {
+
+    RouteMatrixStatRequest::RouteMatrixStatRequest(StatRequest&& request) : StatRequest(std::move(request)) {
+        Build();
+    }
+
+    bool RouteMatrixStatRequest::IsValidRequest() const {
+        return StatRequest::IsValidRequest() && IsGetRouteMatrixCommand();
+    }
+
+    const std::vector<std::string>& RouteMatrixStatRequest::GetFromStops() const {
+        return from_;
+    }
+
+    const std::vector<std::string>& RouteMatrixStatRequest::GetToStops() const {
+        return to_;
+    }
+
+    bool RouteMatrixStatRequest::HasItems() const {
+        return items_.value_or(false);
+    }
+
+    void RouteMatrixStatRequest::Build() {
+        from_ = ExtractStops_(RouteMatrixRequestFields::FROM);
+        to_ = ExtractStops_(RouteMatrixRequestFields::TO);
+        items_ = args_.ExtractIf<bool>(RouteMatrixRequestFields::ITEMS);
+    }
+
+    std::vector<std::string> RouteMatrixStatRequest::ExtractStops_(const std::string& key) {
+        std::optional<Array> stops_tmp = args_.ExtractIf<Array>(key);
+        if (!stops_tmp.has_value()) {
+            return {};
+        }
+
+        std::vector<std::string> stops(stops_tmp.value().size());
+        std::transform(
+            std::make_move_iterator(stops_tmp.value().begin()), std::make_move_iterator(stops_tmp.value().end()), stops.begin(),
+            [](auto&& stop_name) {
+                assert(std::holds_alternative<std::string>(stop_name));
+                return std::get<std::string>(std::move(stop_name));
+            });
+        return stops;
+    }
+}
+
+namespace transport_catalogue::io /* ReachableStatRequest implementation */ {
+
+    ReachableStatRequest::ReachableStatRequest(StatRequest&& request) : StatRequest(std::move(request)) {
+        Build();
+    }
+
+    bool ReachableStatRequest::IsValidRequest() const {
+        return StatRequest::IsValidRequest() && from_ != std::nullopt && max_time_ != std::nullopt;
+    }
+
+    const std::optional<std::string>& ReachableStatRequest::GetFromStop() const {
+        return from_;
+    }
+
+    const std::optional<double>& ReachableStatRequest::GetMaxTime() const {
+        return max_time_;
+    }
+
+    void ReachableStatRequest::Build() {
+        from_ = args_.ExtractIf<std::string>(ReachableRequestFields::FROM);
+        max_time_ = args_.ExtractNumberValueIf(ReachableRequestFields::MAX_TIME);
+    }
+}
+
 namespace transport_catalogue::io /* RoutingSettingsRequest implementation */ {
 
     RoutingSettingsRequest::RoutingSettingsRequest(RequestCommand type, RequestArgsMap&& args) : Request(std::move(type), std::move(args)) {
@@ -781,6 +945,22 @@ namespace transport_catalogue::io /* RoutingSettingsRequest implementation */ {
         return bus_velocity_kmh_;
     }
 
+    const std::optional<router::RouterType>& RoutingSettingsRequest::GetRouterType() const {
+        return router_type_;
+    }
+
+    const std::optional<bool>& RoutingSettingsRequest::GetCollapseParallelEdges() const {
+        return collapse_parallel_edges_;
+    }
+
+    const std::optional<size_t>& RoutingSettingsRequest::GetRouteCacheCapacity() const {
+        return route_cache_capacity_;
+    }
+
+    const std::optional<router::VertexOrder>& RoutingSettingsRequest::GetVertexOrder() const {
+        return vertex_order_;
+    }
+
     bool RoutingSettingsRequest::IsRoutingSettingsRequest() const {
         return true;
     }
@@ -788,6 +968,46 @@ namespace transport_catalogue::io /* RoutingSettingsRequest implementation */ {
     void RoutingSettingsRequest::Build() {
         bus_wait_time_min_ = args_.ExtractNumberValueIf(RoutingSettingsRequestFields::BUS_WAIT_TIME);
         bus_velocity_kmh_ = args_.ExtractNumberValueIf(RoutingSettingsRequestFields::BUS_VELOCITY);
+
+        std::optional<std::string> router_type = args_.ExtractIf<std::string>(RoutingSettingsRequestFields::ROUTER_TYPE);
+        router_type_ = router_type.has_value() ? std::optional{ToRouterType(router_type.value())} : std::nullopt;
+        collapse_parallel_edges_ = args_.ExtractIf<bool>(RoutingSettingsRequestFields::COLLAPSE_PARALLEL_EDGES);
+
+        std::optional<double> route_cache_capacity = args_.ExtractNumberValueIf(RoutingSettingsRequestFields::ROUTE_CACHE_CAPACITY);
+        if (route_cache_capacity.has_value() && route_cache_capacity.value() < 0.) {
+            throw std::invalid_argument("Route cache capacity should be non-negative");
+        }
+        route_cache_capacity_ =
+            route_cache_capacity.has_value() ? std::optional{static_cast<size_t>(route_cache_capacity.value())} : std::nullopt;
+
+        std::optional<std::string> vertex_order = args_.ExtractIf<std::string>(RoutingSettingsRequestFields::VERTEX_ORDER);
+        vertex_order_ = vertex_order.has_value() ? std::optional{ToVertexOrder(vertex_order.value())} : std::nullopt;
+    }
+
+    router::RouterType RoutingSettingsRequest::ToRouterType(std::string_view type_name) {
+        if (type_name == RouterTypeValues::ALL_PAIRS) {
+            return router::RouterType::ALL_PAIRS;
+        } else if (type_name == RouterTypeValues::DIJKSTRA) {
+            return router::RouterType::DIJKSTRA;
+        } else if (type_name == RouterTypeValues::CONTRACTION_HIERARCHY) {
+            return router::RouterType::CONTRACTION_HIERARCHY;
+        } else if (type_name == RouterTypeValues::A_STAR) {
+            return router::RouterType::A_STAR;
+        } else if (type_name == RouterTypeValues::ALT) {
+            return router::RouterType::ALT;
+        } else if (type_name == RouterTypeValues::RAPTOR) {
+            return router::RouterType::RAPTOR;
+        }
+        throw std::invalid_argument("Invalid router type: " + std::string(type_name));
+    }
+
+    router::VertexOrder RoutingSettingsRequest::ToVertexOrder(std::string_view order_name) {
+        if (order_name == VertexOrderValues::STOPS_TABLE) {
+            return router::VertexOrder::STOPS_TABLE;
+        } else if (order_name == VertexOrderValues::HILBERT_CURVE) {
+            return router::VertexOrder::HILBERT_CURVE;
+        }
+        throw std::invalid_argument("Invalid vertex order: " + std::string(order_name));
     }
 }
 
@@ -39,6 +39,8 @@ namespace transport_catalogue::exceptions {
 namespace transport_catalogue::io /* Requests aliases */ {
     using RawMapData = maps::MapRenderer::RawMapData;
     using RouteInfo = router::RouteInfo;
+    using RouteMatrix = router::RouteMatrix;
+    using ReachableStops = router::ReachableStops;
     using RequestInnerArrayValueType = std::variant<std::monostate, std::string, int, double, bool>;
     using RequestArrayValueType = std::variant<std::monostate, std::string, int, double, bool, std::vector<RequestInnerArrayValueType>>;
     using RequestDictValueType = std::variant<std::monostate, std::string, int, double, bool, std::vector<RequestInnerArrayValueType>>;
@@ -83,7 +85,7 @@ namespace transport_catalogue::io /* Request fields enums */ {
     enum class RequestType : int8_t { BASE, STAT, RENDER_SETTINGS, ROUTING_SETTINGS, SERIALIZATION_SETTINGS, UNKNOWN };
 
     /// Request GET commands (for build responses)
-    enum class RequestCommand : uint8_t { STOP, BUS, MAP, ROUTE, UNKNOWN };
+    enum class RequestCommand : uint8_t { STOP, BUS, MAP, ROUTE, ROUTE_MATRIX, REACHABLE, UNKNOWN };
 
     struct RequestFields {
         inline static const std::string BASE_REQUESTS{"base_requests"};
@@ -111,6 +113,17 @@ namespace transport_catalogue::io /* Request fields enums */ {
         inline static const std::string ID{"id"};
     };
 
+    struct RouteMatrixRequestFields {
+        inline static const std::string FROM{"from"};
+        inline static const std::string TO{"to"};
+        inline static const std::string ITEMS{"items"};
+    };
+
+    struct ReachableRequestFields {
+        inline static const std::string FROM{"from"};
+        inline static const std::string MAX_TIME{"max_time"};
+    };
+
     struct RenderSettingsRequestFields {
         inline static const std::string WIDTH{"width"};
         inline static const std::string HEIGHT{"height"};
@@ -129,6 +142,24 @@ namespace transport_catalogue::io /* Request fields enums */ {
     struct RoutingSettingsRequestFields {
         inline static const std::string BUS_WAIT_TIME{"bus_wait_time"};
         inline static const std::string BUS_VELOCITY{"bus_velocity"};
+        inline static const std::string ROUTER_TYPE{"router_type"};
+        inline static const std::string COLLAPSE_PARALLEL_EDGES{"collapse_parallel_edges"};
+        inline static const std::string ROUTE_CACHE_CAPACITY{"route_cache_capacity"};
+        inline static const std::string VERTEX_ORDER{"vertex_order"};
+    };
+
+    struct RouterTypeValues {
+        inline static const std::string ALL_PAIRS{"all_pairs"};
+        inline static const std::string DIJKSTRA{"dijkstra"};
+        inline static const std::string CONTRACTION_HIERARCHY{"contraction_hierarchy"};
+        inline static const std::string A_STAR{"a_star"};
+        inline static const std::string ALT{"alt"};
+        inline static const std::string RAPTOR{"raptor"};
+    };
+
+    struct VertexOrderValues {
+        inline static const std::string STOPS_TABLE{"stops_table"};
+        inline static const std::string HILBERT_CURVE{"hilbert_curve"};
     };
 
     struct SerializationSettingsFields {
@@ -233,6 +264,8 @@ namespace transport_catalogue::io /* Request */ {
         virtual bool IsGetBusCommand() const;
         virtual bool IsGetMapCommand() const;
         virtual bool IsGetRouteCommand() const;
+        virtual bool IsGetRouteMatrixCommand() const;
+        virtual bool IsGetReachableCommand() const;
 
         RequestCommand& GetCommand();
         const RequestCommand& GetCommand() const;
@@ -251,7 +284,8 @@ namespace transport_catalogue::io /* Request */ {
 
         explicit Request(RawRequest&& raw_request);
         virtual void Build() {
-            assert((command_ != RequestCommand::MAP && command_ != RequestCommand::ROUTE));
+            assert((command_ != RequestCommand::MAP && command_ != RequestCommand::ROUTE && command_ != RequestCommand::ROUTE_MATRIX &&
+                    command_ != RequestCommand::REACHABLE));
         }
     };
 }
@@ -366,6 +400,51 @@ namespace transport_catalogue::io /* RouteStatRequest */ {
     };
 }
 
+namespace transport_catalogue::io /* RouteMatrixStatRequest */ {
+
+    class RouteMatrixStatRequest final : public StatRequest {
+        using StatRequest::StatRequest;
+
+    public:
+        RouteMatrixStatRequest(StatRequest&& request);
+
+        bool IsValidRequest() const override;
+        const std::vector<std::string>& GetFromStops() const;
+        const std::vector<std::string>& GetToStops() const;
+        bool HasItems() const;
+
+    private:
+        std::vector<std::string> from_;
+        std::vector<std::string> to_;
+        std::optional<bool> items_;
+
+    private:
+        void Build() override;
+        std::vector<std::string> ExtractStops_(const std::string& key);
+    };
+}
+
+namespace transport_catalogue::io /* ReachableStatRequest */ {
+
+    class ReachableStatRequest final : public StatRequest {
+        using StatRequest::StatRequest;
+
+    public:
+        ReachableStatRequest(StatRequest&& request);
+
+        bool IsValidRequest() const override;
+        const std::optional<std::string>& GetFromStop() const;
+        const std::optional<double>& GetMaxTime() const;
+
+    private:
+        std::optional<std::string> from_;
+        std::optional<double> max_time_;
+
+    private:
+        void Build() override;
+    };
+}
+
 namespace transport_catalogue::io /* RenderSettingsRequest */ {
 
     class RenderSettingsRequest : public Request {
@@ -427,6 +506,10 @@ namespace transport_catalogue::io /* RoutingSettingsRequest */ {
 
         const std::optional<uint16_t>& GetBusWaitTimeMin() const;
         const std::optional<uint16_t>& GetBusVelocityKmh() const;
+        const std::optional<router::RouterType>& GetRouterType() const;
+        const std::optional<bool>& GetCollapseParallelEdges() const;
+        const std::optional<size_t>& GetRouteCacheCapacity() const;
+        const std::optional<router::VertexOrder>& GetVertexOrder() const;
         bool IsRoutingSettingsRequest() const override;
 
     protected:
@@ -435,6 +518,14 @@ namespace transport_catalogue::io /* RoutingSettingsRequest */ {
     private:
         std::optional<uint16_t> bus_wait_time_min_;
         std::optional<uint16_t> bus_velocity_kmh_;
+        std::optional<router::RouterType> router_type_;
+        std::optional<bool> collapse_parallel_edges_;
+        std::optional<size_t> route_cache_capacity_;
+        std::optional<router::VertexOrder> vertex_order_;
+
+    private:
+        static router::RouterType ToRouterType(std::string_view type_name);
+        static router::VertexOrder ToVertexOrder(std::string_view order_name);
     };
 }
 
@@ -478,6 +569,8 @@ namespace transport_catalogue::io /* Response */ {
         virtual bool IsStopResponse() const;
         virtual bool IsMapResponse() const;
         virtual bool IsRouteResponse() const;
+        virtual bool IsRouteMatrixResponse() const;
+        virtual bool IsReachableResponse() const;
         virtual bool IsStatResponse() const;
         virtual bool IsBaseResponse() const;
 
@@ -494,16 +587,20 @@ namespace transport_catalogue::io /* Response */ {
         StatResponse(
             int&& request_id, RequestCommand&& command, std::string&& name, std::optional<data::BusStat>&& bus_stat = std::nullopt,
             std::optional<data::StopStat>&& stop_stat = std::nullopt, std::optional<RawMapData>&& map_data = std::nullopt,
-            std::optional<RouteInfo>&& route_info = std::nullopt);
+            std::optional<RouteInfo>&& route_info = std::nullopt, std::optional<RouteMatrix>&& route_matrix = std::nullopt,
+            std::optional<ReachableStops>&& reachable_stops = std::nullopt);
 
         StatResponse(
             StatRequest&& request, std::optional<data::BusStat>&& bus_stat = std::nullopt, std::optional<data::StopStat>&& stop_stat = std::nullopt,
-            std::optional<RawMapData>&& map_data = std::nullopt, std::optional<RouteInfo>&& route_info = std::nullopt);
+            std::optional<RawMapData>&& map_data = std::nullopt, std::optional<RouteInfo>&& route_info = std::nullopt,
+            std::optional<RouteMatrix>&& route_matrix = std::nullopt, std::optional<ReachableStops>&& reachable_stops = std::nullopt);
 
         std::optional<data::BusStat>& GetBusInfo();
         std::optional<data::StopStat>& GetStopInfo();
         std::optional<RawMapData>& GetMapData();
         std::optional<RouteInfo>& GetRouteInfo();
+        std::optional<RouteMatrix>& GetRouteMatrix();
+        std::optional<ReachableStops>& GetReachableStops();
 
         bool IsStatResponse() const override;
 
@@ -512,6 +609,8 @@ namespace transport_catalogue::io /* Response */ {
         std::optional<data::StopStat> stop_stat_;
         std::optional<RawMapData> map_data_;
         std::optional<RouteInfo> route_info_;
+        std::optional<RouteMatrix> route_matrix_;
+        std::optional<ReachableStops> reachable_stops_;
     };
 }
 
@@ -1,58 +1,137 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cstdint>
+#include <functional>
 #include <iterator>
+#include <limits>
+#include <numeric>
 #include <optional>
 #include <stdexcept>
+#include <tuple>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include <tbb/blocked_range2d.h>
+#include <tbb/parallel_for.h>
+
+#include "detail/min_plus.h"
 #include "graph.h"
 
-namespace graph {
+namespace graph /* IRouter */ {
 
     template <typename Weight>
-    class Router {
-    private:
-        using Graph = DirectedWeightedGraph<Weight>;
-
+    class IRouter {
     public:
-        explicit Router(const Graph& graph);
-
         struct RouteInfo {
             Weight weight;
             std::vector<EdgeId> edges;
         };
 
-        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const;
+        /// Debug counters of on-demand search routers, accumulated over all queries
+        struct SearchStats {
+            size_t queries_count = 0;
+            size_t settled_vertices_count = 0;
+        };
+
+        virtual std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const = 0;
+
+        /// Routes matrix from many sources to many targets (row-major, `sources.size() x targets.size()`).
+        /// Routers with an on-demand search override it to share the search work between the pairs
+        virtual std::vector<std::optional<RouteInfo>> BuildRoutes(const std::vector<VertexId>& sources, const std::vector<VertexId>& targets) const {
+            std::vector<std::optional<RouteInfo>> routes;
+            routes.reserve(sources.size() * targets.size());
+            for (const VertexId from : sources) {
+                for (const VertexId to : targets) {
+                    routes.push_back(BuildRoute(from, to));
+                }
+            }
+            return routes;
+        }
+
+        /// Routers without an on-demand search report zero counters
+        virtual SearchStats GetSearchStats() const {
+            return {};
+        }
+
+        virtual ~IRouter() = default;
+    };
+}
+
+namespace graph /* Router storage policies */ {
+
+    /// Routes table with one optional cell per vertices pair (V separately allocated rows).
+    /// Keeps weights in the graph's `Weight` type, so lookups are exact.
+    template <typename Weight>
+    class NestedRoutesStorage {
+    public:
+        using StoredWeight = Weight;
 
-    private:
         struct RouteInternalData {
             Weight weight;
             std::optional<EdgeId> prev_edge;
         };
-        using RoutesInternalData = std::vector<std::vector<std::optional<RouteInternalData>>>;
 
-        void InitializeRoutesInternalData(const Graph& graph) {
-            const size_t vertex_count = graph.GetVertexCount();
-            for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
-                routes_internal_data_[vertex][vertex] = RouteInternalData{ZERO_WEIGHT, std::nullopt};
-                for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
-                    const auto& edge = graph.GetEdge(edge_id);
-                    if (edge.weight < ZERO_WEIGHT) {
-                        throw std::domain_error("Edges' weights should be non-negative");
-                    }
-                    auto& route_internal_data = routes_internal_data_[vertex][edge.to];
-                    if (!route_internal_data || route_internal_data->weight > edge.weight) {
-                        route_internal_data = RouteInternalData{edge.weight, edge_id};
+        NestedRoutesStorage() = default;
+
+        explicit NestedRoutesStorage(size_t vertex_count)
+            : routes_internal_data_(vertex_count, std::vector<std::optional<RouteInternalData>>(vertex_count)) {}
+
+        size_t GetVertexCount() const {
+            return routes_internal_data_.size();
+        }
+
+        bool HasRoute(VertexId from, VertexId to) const {
+            return routes_internal_data_[from][to].has_value();
+        }
+
+        /// Should be called only if `HasRoute(from, to)`
+        StoredWeight GetWeight(VertexId from, VertexId to) const {
+            return routes_internal_data_[from][to]->weight;
+        }
+
+        /// Should be called only if `HasRoute(from, to)`
+        std::optional<EdgeId> GetPrevEdge(VertexId from, VertexId to) const {
+            return routes_internal_data_[from][to]->prev_edge;
+        }
+
+        void SetRoute(VertexId from, VertexId to, Weight weight, std::optional<EdgeId> prev_edge) {
+            routes_internal_data_[from][to] = RouteInternalData{weight, prev_edge};
+        }
+
+        /// Remove every route from the vertex
+        void ClearRoutesFrom(VertexId from) {
+            for (std::optional<RouteInternalData>& route : routes_internal_data_[from]) {
+                route.reset();
+            }
+        }
+
+        void RelaxAll() {
+            for (VertexId vertex_through = 0; vertex_through < GetVertexCount(); ++vertex_through) {
+                RelaxThroughVertex(vertex_through);
+            }
+        }
+
+        void RelaxThroughVertex(VertexId vertex_through) {
+            const size_t vertex_count = GetVertexCount();
+            for (VertexId vertex_from = 0; vertex_from < vertex_count; ++vertex_from) {
+                if (const auto& route_from = routes_internal_data_[vertex_from][vertex_through]) {
+                    for (VertexId vertex_to = 0; vertex_to < vertex_count; ++vertex_to) {
+                        if (const auto& route_to = routes_internal_data_[vertex_through][vertex_to]) {
+                            RelaxRoute(vertex_from, vertex_to, *route_from, *route_to);
+                        }
                     }
                 }
             }
         }
 
+    private:
         void RelaxRoute(VertexId vertex_from, VertexId vertex_to, const RouteInternalData& route_from, const RouteInternalData& route_to) {
             auto& route_relaxing = routes_internal_data_[vertex_from][vertex_to];
             const Weight candidate_weight = route_from.weight + route_to.weight;
@@ -61,48 +140,2317 @@ namespace graph {
             }
         }
 
-        void RelaxRoutesInternalDataThroughVertex(size_t vertex_count, VertexId vertex_through) {
-            for (VertexId vertex_from = 0; vertex_from < vertex_count; ++vertex_from) {
-                if (const auto& route_from = routes_internal_data_[vertex_from][vertex_through]) {
-                    for (VertexId vertex_to = 0; vertex_to < vertex_count; ++vertex_to) {
-                        if (const auto& route_to = routes_internal_data_[vertex_through][vertex_to]) {
-                            RelaxRoute(vertex_from, vertex_to, *route_from, *route_to);
+        std::vector<std::vector<std::optional<RouteInternalData>>> routes_internal_data_;
+    };
+
+    /// Routes table packed into one contiguous row-major V x V allocation:
+    /// a `StoredWeight` array (infinity marks a missing route) and a prev-edge array
+    /// (`NONE_EDGE` marks a route without edges). With `float` weights and `uint32_t` edge ids
+    /// a cell takes 8 bytes instead of ~40 for `NestedRoutesStorage<double>`.
+    template <typename StoredWeightType = float, typename StoredEdgeId = uint32_t>
+    class PackedRoutesStorage {
+    public:
+        using StoredWeight = StoredWeightType;
+
+        static constexpr StoredWeight INFINITE_WEIGHT = std::numeric_limits<StoredWeight>::has_infinity
+                                                            ? std::numeric_limits<StoredWeight>::infinity()
+                                                            : std::numeric_limits<StoredWeight>::max();
+        static constexpr StoredEdgeId NONE_EDGE = std::numeric_limits<StoredEdgeId>::max();
+
+        PackedRoutesStorage() = default;
+
+        explicit PackedRoutesStorage(size_t vertex_count)
+            : vertex_count_(vertex_count),
+              weights_(vertex_count * vertex_count, INFINITE_WEIGHT),
+              prev_edges_(vertex_count * vertex_count, NONE_EDGE) {}
+
+        size_t GetVertexCount() const {
+            return vertex_count_;
+        }
+
+        bool HasRoute(VertexId from, VertexId to) const {
+            return weights_[Index(from, to)] != INFINITE_WEIGHT;
+        }
+
+        /// Should be called only if `HasRoute(from, to)`
+        StoredWeight GetWeight(VertexId from, VertexId to) const {
+            return weights_[Index(from, to)];
+        }
+
+        /// Should be called only if `HasRoute(from, to)`
+        std::optional<EdgeId> GetPrevEdge(VertexId from, VertexId to) const {
+            const StoredEdgeId prev_edge = prev_edges_[Index(from, to)];
+            return prev_edge == NONE_EDGE ? std::nullopt : std::optional<EdgeId>(prev_edge);
+        }
+
+        template <typename Weight>
+        void SetRoute(VertexId from, VertexId to, Weight weight, std::optional<EdgeId> prev_edge) {
+            if (prev_edge.has_value() && *prev_edge >= NONE_EDGE) {
+                throw std::overflow_error("Edge id does not fit the packed routes storage");
+            }
+            weights_[Index(from, to)] = static_cast<StoredWeight>(weight);
+            prev_edges_[Index(from, to)] = prev_edge.has_value() ? static_cast<StoredEdgeId>(*prev_edge) : NONE_EDGE;
+        }
+
+        /// Remove every route from the vertex
+        void ClearRoutesFrom(VertexId from) {
+            std::fill_n(weights_.begin() + Index(from, 0), vertex_count_, INFINITE_WEIGHT);
+            std::fill_n(prev_edges_.begin() + Index(from, 0), vertex_count_, NONE_EDGE);
+        }
+
+        /// Blocked Floyd-Warshall: the table is split into `BLOCK_SIZE` x `BLOCK_SIZE` tiles, and for every
+        /// diagonal tile the three dependent phases run in order (the diagonal tile itself, then tiles
+        /// of its row and column, then the rest), while the independent tiles of a phase run in parallel
+        void RelaxAll() {
+            const size_t block_count = (vertex_count_ + BLOCK_SIZE - 1) / BLOCK_SIZE;
+            for (size_t block_through = 0; block_through < block_count; ++block_through) {
+                RelaxBlock(block_through, block_through, block_through);
+
+                tbb::parallel_for(size_t{0}, block_count, [this, block_through](size_t block) {
+                    if (block != block_through) {
+                        RelaxBlock(block_through, block, block_through);
+                        RelaxBlock(block, block_through, block_through);
+                    }
+                });
+
+                tbb::parallel_for(
+                    tbb::blocked_range2d<size_t>(0, block_count, 1, 0, block_count, 1),
+                    [this, block_through](const tbb::blocked_range2d<size_t>& blocks) {
+                        for (size_t block_from = blocks.rows().begin(); block_from != blocks.rows().end(); ++block_from) {
+                            for (size_t block_to = blocks.cols().begin(); block_to != blocks.cols().end(); ++block_to) {
+                                if (block_from != block_through && block_to != block_through) {
+                                    RelaxBlock(block_from, block_to, block_through);
+                                }
+                            }
                         }
+                    });
+            }
+        }
+
+        void RelaxThroughVertex(VertexId vertex_through) {
+            RelaxRange(0, vertex_count_, 0, vertex_count_, vertex_through);
+        }
+
+        static constexpr size_t BLOCK_SIZE = 64;
+
+    private:
+        size_t Index(VertexId from, VertexId to) const {
+            return from * vertex_count_ + to;
+        }
+
+        void RelaxBlock(size_t block_from, size_t block_to, size_t block_through) {
+            const size_t from_begin = block_from * BLOCK_SIZE;
+            const size_t to_begin = block_to * BLOCK_SIZE;
+            const size_t through_begin = block_through * BLOCK_SIZE;
+            const size_t through_end = std::min(through_begin + BLOCK_SIZE, vertex_count_);
+            for (VertexId vertex_through = through_begin; vertex_through < through_end; ++vertex_through) {
+                RelaxRange(
+                    from_begin, std::min(from_begin + BLOCK_SIZE, vertex_count_), to_begin, std::min(to_begin + BLOCK_SIZE, vertex_count_),
+                    vertex_through);
+            }
+        }
+
+        void RelaxRange(VertexId from_begin, VertexId from_end, VertexId to_begin, VertexId to_end, VertexId vertex_through) {
+            const StoredWeight* weights_through = &weights_[Index(vertex_through, 0)];
+            const StoredEdgeId* prev_edges_through = &prev_edges_[Index(vertex_through, 0)];
+
+            for (VertexId vertex_from = from_begin; vertex_from < from_end; ++vertex_from) {
+                StoredWeight* weights_from = &weights_[Index(vertex_from, 0)];
+                const StoredWeight weight_from_through = weights_from[vertex_through];
+                if (weight_from_through == INFINITE_WEIGHT) {
+                    continue;
+                }
+                StoredEdgeId* prev_edges_from = &prev_edges_[Index(vertex_from, 0)];
+                const StoredEdgeId prev_edge_from_through = prev_edges_from[vertex_through];
+
+                if constexpr (IS_SIMD_LAYOUT) {
+                    relax_row_(
+                        weight_from_through, prev_edge_from_through, weights_through + to_begin, prev_edges_through + to_begin,
+                        weights_from + to_begin, prev_edges_from + to_begin, to_end - to_begin);
+                } else {
+                    detail::RelaxRowScalar(
+                        weight_from_through, prev_edge_from_through, weights_through + to_begin, prev_edges_through + to_begin,
+                        weights_from + to_begin, prev_edges_from + to_begin, to_end - to_begin);
+                }
+            }
+        }
+
+        /// `float` weights with `uint32_t` edge ids are relaxed by a SIMD kernel picked for the running CPU
+        static constexpr bool IS_SIMD_LAYOUT = std::is_same_v<StoredWeight, float> && std::is_same_v<StoredEdgeId, uint32_t>;
+        detail::RelaxRowFunction relax_row_ = detail::GetRelaxRowFunction();
+
+        size_t vertex_count_ = 0;
+        std::vector<StoredWeight> weights_;
+        std::vector<StoredEdgeId> prev_edges_;
+    };
+}
+
+namespace graph /* Router (all-pairs precompute) */ {
+
+    /// How the all-pairs routes table is calculated
+    /// FLOYD_WARSHALL - O(V^3) relaxation of the whole table (blocked and vectorized by the storage)
+    /// SINGLE_SOURCE_SEARCHES - one Dijkstra search per source vertex, O(V * E * log(V)), rows are filled in parallel
+    /// AUTO - single-source searches for sparse graphs, Floyd-Warshall for dense ones
+    enum class AllPairsStrategy : uint8_t { AUTO, FLOYD_WARSHALL, SINGLE_SOURCE_SEARCHES };
+
+    /// All-pairs router. `Storage` is the routes table policy
+    /// (`NestedRoutesStorage` or `PackedRoutesStorage`).
+    /// If the storage keeps weights in a narrower type than `Weight`,
+    /// the route weight is recomputed from the route edges, so a lookup is exact for the found route.
+    template <typename Weight, typename Storage = NestedRoutesStorage<Weight>>
+    class Router : public IRouter<Weight> {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        using RouteInfo = typename IRouter<Weight>::RouteInfo;
+        using RoutesInternalData = Storage;
+
+    public:
+        explicit Router(const Graph& graph, AllPairsStrategy strategy = AllPairsStrategy::AUTO);
+
+        /// Adopt precomputed routes data (e.g. restored from storage) without recalculation
+        Router(const Graph& graph, RoutesInternalData&& routes_internal_data);
+
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const override;
+
+        const RoutesInternalData& GetRoutesInternalData() const;
+
+        /// Strategy used to calculate the routes table (FLOYD_WARSHALL for the adopted routes data)
+        AllPairsStrategy GetStrategy() const;
+
+        /// Single-source searches are chosen if the average out-degree E/V is less than V / SPARSE_DEGREE_RATIO:
+        /// V searches take about V * E * log(V) operations against V^3 vectorized Floyd-Warshall relaxations
+        static AllPairsStrategy ChooseStrategy(const Graph& graph);
+
+        static constexpr size_t SPARSE_DEGREE_RATIO = 32;
+
+        /// Update the routes table after the edges are added to the graph or made lighter: routes through every edge
+        /// are relaxed in O(V^2), an edge that is not lighter than the current route between its ends is skipped in O(1).
+        /// If V or more edges are lighter, they are written to the table and the whole table is relaxed once in O(V^3)
+        void RelaxEdges(const std::vector<EdgeId>& edge_ids);
+
+        /// Update the routes table after the edges are made heavier. Only the rows whose routes pass any of the edges
+        /// depend on them, so these rows are recalculated by single-source searches and the rest are kept.
+        /// Return the count of recalculated rows
+        size_t RepairEdges(const std::vector<EdgeId>& edge_ids);
+
+        /// Update the routes table in place after the edge weights are changed, the topology is kept. The changed edges are
+        /// found by the weights the table is calculated for: lighter ones are relaxed, then the rows whose routes pass heavier ones
+        /// are repaired. If both V or more edges are lighter and some are heavier, the whole table is recalculated
+        /// (see `RecalculateWeights`), as the update would cost more than that
+        void CustomizeWeights();
+
+    private:
+        void InitializeRoutesInternalData(const Graph& graph) {
+            const size_t vertex_count = graph.GetVertexCount();
+            // The lightest of parallel edges is chosen by `Weight` comparison, not by the (maybe narrower) stored weight
+            std::vector<std::optional<EdgeId>> best_edges(vertex_count);
+            std::vector<VertexId> targets;
+            for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+                routes_internal_data_.SetRoute(vertex, vertex, ZERO_WEIGHT, std::nullopt);
+                for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
+                    const auto& edge = graph.GetEdge(edge_id);
+                    if (edge.weight < ZERO_WEIGHT) {
+                        throw std::domain_error("Edges' weights should be non-negative");
+                    }
+                    if (edge.to == vertex) {
+                        continue;
+                    }
+                    std::optional<EdgeId>& best_edge = best_edges[edge.to];
+                    if (!best_edge) {
+                        targets.push_back(edge.to);
+                    }
+                    if (!best_edge || graph.GetEdge(*best_edge).weight > edge.weight) {
+                        best_edge = edge_id;
                     }
                 }
+                for (const VertexId target : targets) {
+                    routes_internal_data_.SetRoute(vertex, target, graph.GetEdge(*best_edges[target]).weight, best_edges[target]);
+                    best_edges[target].reset();
+                }
+                targets.clear();
             }
         }
 
+        /// Fill every row of the table by a Dijkstra search from its vertex, rows are independent and filled in parallel
+        void FillBySingleSourceSearches(const Graph& graph);
+
+        /// Recalculate the whole table for new weights. Single-source searches fill every row again. For Floyd-Warshall
+        /// the stored routes are re-weighed along their prev edges, so the relaxation starts from the routes of the previous
+        /// weights instead of the single edges, but it is still a full O(V^3) pass
+        void RecalculateWeights();
+
+        /// Remember the current weights of the edges as the ones the table is calculated for
+        void StoreEdgeWeights(const std::vector<EdgeId>& edge_ids);
+
         static constexpr Weight ZERO_WEIGHT{};
+        static constexpr bool IS_EXACT_STORAGE = std::is_same_v<typename Storage::StoredWeight, Weight>;
         const Graph& graph_;
         RoutesInternalData routes_internal_data_;
+        AllPairsStrategy strategy_ = AllPairsStrategy::FLOYD_WARSHALL;
+        /// Edge weights the table is calculated for (indexed by the edge id)
+        std::vector<Weight> edge_weights_;
     };
 
-    template <typename Weight>
-    Router<Weight>::Router(const Graph& graph)
-        : graph_(graph), routes_internal_data_(graph.GetVertexCount(), std::vector<std::optional<RouteInternalData>>(graph.GetVertexCount())) {
+    template <typename Weight, typename Storage>
+    Router<Weight, Storage>::Router(const Graph& graph, AllPairsStrategy strategy)
+        : graph_(graph),
+          routes_internal_data_(graph.GetVertexCount()),
+          strategy_(strategy == AllPairsStrategy::AUTO ? ChooseStrategy(graph) : strategy) {
+        StoreEdgeWeights({});
+        if (strategy_ == AllPairsStrategy::SINGLE_SOURCE_SEARCHES) {
+            FillBySingleSourceSearches(graph);
+            return;
+        }
+
         InitializeRoutesInternalData(graph);
 
+        routes_internal_data_.RelaxAll();
+    }
+
+    template <typename Weight, typename Storage>
+    AllPairsStrategy Router<Weight, Storage>::ChooseStrategy(const Graph& graph) {
         const size_t vertex_count = graph.GetVertexCount();
-        for (VertexId vertex_through = 0; vertex_through < vertex_count; ++vertex_through) {
-            RelaxRoutesInternalDataThroughVertex(vertex_count, vertex_through);
+        return graph.GetEdgeCount() * SPARSE_DEGREE_RATIO < vertex_count * vertex_count ? AllPairsStrategy::SINGLE_SOURCE_SEARCHES
+                                                                                         : AllPairsStrategy::FLOYD_WARSHALL;
+    }
+
+    template <typename Weight, typename Storage>
+    AllPairsStrategy Router<Weight, Storage>::GetStrategy() const {
+        return strategy_;
+    }
+
+    template <typename Weight, typename Storage>
+    Router<Weight, Storage>::Router(const Graph& graph, RoutesInternalData&& routes_internal_data)
+        : graph_(graph), routes_internal_data_(std::move(routes_internal_data)) {
+        if (routes_internal_data_.GetVertexCount() != graph.GetVertexCount()) {
+            throw std::invalid_argument("Routes internal data does not match the graph vertex count");
         }
+        StoreEdgeWeights({});
     }
 
-    template <typename Weight>
-    std::optional<typename Router<Weight>::RouteInfo> Router<Weight>::BuildRoute(VertexId from, VertexId to) const {
-        const auto& route_internal_data = routes_internal_data_.at(from).at(to);
-        if (!route_internal_data) {
+    template <typename Weight, typename Storage>
+    const typename Router<Weight, Storage>::RoutesInternalData& Router<Weight, Storage>::GetRoutesInternalData() const {
+        return routes_internal_data_;
+    }
+
+    template <typename Weight, typename Storage>
+    void Router<Weight, Storage>::RelaxEdges(const std::vector<EdgeId>& edge_ids) {
+        using StoredWeight = typename Storage::StoredWeight;
+        StoreEdgeWeights(edge_ids);
+        const size_t vertex_count = routes_internal_data_.GetVertexCount();
+        const auto is_lighter = [this](const auto& edge) {
+            if (edge.weight < ZERO_WEIGHT) {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+            return edge.from != edge.to && (!routes_internal_data_.HasRoute(edge.from, edge.to) ||
+                                            static_cast<StoredWeight>(edge.weight) < routes_internal_data_.GetWeight(edge.from, edge.to));
+        };
+
+        // Relaxing every edge costs O(V^2), so from V lighter edges one O(V^3) relaxation of the whole table is cheaper.
+        // The table keeps routes of the current graph, with the lighter edges written in it Floyd-Warshall finds the shortest ones
+        const size_t lighter_count = std::count_if(edge_ids.begin(), edge_ids.end(), [this, &is_lighter](EdgeId edge_id) {
+            return is_lighter(graph_.GetEdge(edge_id));
+        });
+        if (lighter_count >= vertex_count) {
+            for (const EdgeId edge_id : edge_ids) {
+                const auto& edge = graph_.GetEdge(edge_id);
+                if (is_lighter(edge)) {
+                    routes_internal_data_.SetRoute(edge.from, edge.to, edge.weight, edge_id);
+                }
+            }
+            routes_internal_data_.RelaxAll();
+            return;
+        }
+
+        for (const EdgeId edge_id : edge_ids) {
+            const auto& edge = graph_.GetEdge(edge_id);
+            if (!is_lighter(edge)) {
+                continue;
+            }
+            const StoredWeight edge_weight = static_cast<StoredWeight>(edge.weight);
+
+            // Route `from -> to` through the edge is `from -> edge.from`, the edge, `edge.to -> to`. The first and the last parts
+            // do not pass the edge (it would be a cycle), so the rows are independent: only the row `edge.to` is read by all of them,
+            // and it is never improved
+            tbb::parallel_for(VertexId{0}, static_cast<VertexId>(vertex_count), [this, &edge, edge_id, edge_weight, vertex_count](VertexId from) {
+                if (from == edge.to || !routes_internal_data_.HasRoute(from, edge.from)) {
+                    return;
+                }
+                const StoredWeight weight_through = routes_internal_data_.GetWeight(from, edge.from) + edge_weight;
+                for (VertexId to = 0; to < vertex_count; ++to) {
+                    if (!routes_internal_data_.HasRoute(edge.to, to)) {
+                        continue;
+                    }
+                    const StoredWeight candidate_weight = weight_through + routes_internal_data_.GetWeight(edge.to, to);
+                    if (!routes_internal_data_.HasRoute(from, to) || candidate_weight < routes_internal_data_.GetWeight(from, to)) {
+                        const std::optional<EdgeId> prev_edge = routes_internal_data_.GetPrevEdge(edge.to, to);
+                        routes_internal_data_.SetRoute(from, to, candidate_weight, prev_edge.has_value() ? prev_edge : std::optional{edge_id});
+                    }
+                }
+            });
+        }
+    }
+
+    template <typename Weight, typename Storage>
+    std::optional<typename Router<Weight, Storage>::RouteInfo> Router<Weight, Storage>::BuildRoute(VertexId from, VertexId to) const {
+        const size_t vertex_count = routes_internal_data_.GetVertexCount();
+        if (from >= vertex_count || to >= vertex_count) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+        if (!routes_internal_data_.HasRoute(from, to)) {
             return std::nullopt;
         }
-        const Weight weight = route_internal_data->weight;
+
         std::vector<EdgeId> edges;
-        for (std::optional<EdgeId> edge_id = route_internal_data->prev_edge; edge_id;
-             edge_id = routes_internal_data_[from][graph_.GetEdge(*edge_id).from]->prev_edge) {
+        for (std::optional<EdgeId> edge_id = routes_internal_data_.GetPrevEdge(from, to); edge_id;
+             edge_id = routes_internal_data_.GetPrevEdge(from, graph_.GetEdge(*edge_id).from)) {
             edges.push_back(*edge_id);
         }
         std::reverse(edges.begin(), edges.end());
 
+        Weight weight = ZERO_WEIGHT;
+        if constexpr (IS_EXACT_STORAGE) {
+            weight = routes_internal_data_.GetWeight(from, to);
+        } else {
+            for (const EdgeId edge_id : edges) {
+                weight += graph_.GetEdge(edge_id).weight;
+            }
+        }
+
         return RouteInfo{weight, std::move(edges)};
     }
-}
\ No newline at end of file
+}
+
+namespace graph /* Search queue policies */ {
+
+    /// Binary heap of (key, vertex) items, equal keys are popped in the order of the vertex id.
+    /// Accepts keys in any order
+    template <typename Weight>
+    class BinaryHeapQueue {
+    public:
+        void Push(Weight key, VertexId vertex) {
+            items_.push_back({key, vertex});
+            std::push_heap(items_.begin(), items_.end(), std::greater<Item>{});
+        }
+
+        /// Pop the vertex with the minimal key. Should be called only if the queue is not empty
+        VertexId Pop() {
+            std::pop_heap(items_.begin(), items_.end(), std::greater<Item>{});
+            const VertexId vertex = items_.back().vertex;
+            items_.pop_back();
+            return vertex;
+        }
+
+        bool IsEmpty() const {
+            return items_.empty();
+        }
+
+        void Clear() {
+            items_.clear();
+        }
+
+    private:
+        struct Item {
+            Weight key;
+            VertexId vertex;
+
+            bool operator>(const Item& rhs) const {
+                return key > rhs.key || (key == rhs.key && vertex > rhs.vertex);
+            }
+        };
+
+        std::vector<Item> items_;
+    };
+
+    /// Monotone radix heap: a pushed key should not be less than the last popped key, which holds for
+    /// Dijkstra and A* with a consistent heuristic. An item is kept in the bucket of the highest bit that
+    /// differs from the last popped key, so a push is O(1) and an item moves between buckets at most 64 times.
+    /// Non-negative floating-point keys are compared by their bit patterns. A key slightly less than the last
+    /// popped one (rounding of a heuristic) is raised to it, negative keys are treated as zero.
+    template <typename Weight>
+    class RadixHeapQueue {
+        static_assert(std::is_arithmetic_v<Weight>, "Radix heap keys should be arithmetic");
+
+    public:
+        void Push(Weight key, VertexId vertex) {
+            const uint64_t radix_key = std::max(ToRadixKey(key), last_key_);
+            buckets_[GetBucketIndex(radix_key)].push_back({radix_key, vertex});
+            ++size_;
+        }
+
+        /// Pop a vertex with the minimal key. Should be called only if the queue is not empty
+        VertexId Pop() {
+            if (buckets_[0].empty()) {
+                // Items of the first non-empty bucket are redistributed around its minimal key
+                size_t index = 1;
+                while (buckets_[index].empty()) {
+                    ++index;
+                }
+                std::vector<Item>& bucket = buckets_[index];
+                last_key_ = std::min_element(bucket.begin(), bucket.end(), [](const Item& lhs, const Item& rhs) {
+                                return lhs.radix_key < rhs.radix_key;
+                            })->radix_key;
+                for (const Item& item : bucket) {
+                    buckets_[GetBucketIndex(item.radix_key)].push_back(item);
+                }
+                bucket.clear();
+            }
+
+            const VertexId vertex = buckets_[0].back().vertex;
+            buckets_[0].pop_back();
+            --size_;
+            return vertex;
+        }
+
+        bool IsEmpty() const {
+            return size_ == 0;
+        }
+
+        void Clear() {
+            for (std::vector<Item>& bucket : buckets_) {
+                bucket.clear();
+            }
+            last_key_ = 0;
+            size_ = 0;
+        }
+
+    private:
+        struct Item {
+            uint64_t radix_key;
+            VertexId vertex;
+        };
+
+        static constexpr size_t BUCKETS_COUNT = std::numeric_limits<uint64_t>::digits + 1;
+
+        std::array<std::vector<Item>, BUCKETS_COUNT> buckets_;
+        uint64_t last_key_ = 0;
+        size_t size_ = 0;
+
+        static uint64_t ToRadixKey(Weight key) {
+            if (!(key > Weight{})) {
+                return 0;
+            }
+            if constexpr (std::is_floating_point_v<Weight>) {
+                return std::bit_cast<uint64_t>(static_cast<double>(key));
+            } else {
+                return static_cast<uint64_t>(key);
+            }
+        }
+
+        size_t GetBucketIndex(uint64_t radix_key) const {
+            return radix_key == last_key_ ? 0 : static_cast<size_t>(std::numeric_limits<uint64_t>::digits - std::countl_zero(radix_key ^ last_key_));
+        }
+    };
+}
+
+namespace graph /* DijkstraRouter (on-demand single-pair search) */ {
+
+    /// Answers every query with a fresh Dijkstra search, no precompute.
+    /// Search state lives in a thread-local scratch space that is reused between queries,
+    /// so a query allocates only the resulting edges list.
+    template <typename Weight, typename Queue = BinaryHeapQueue<Weight>>
+    class DijkstraRouter : public IRouter<Weight> {
+    protected:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        using RouteInfo = typename IRouter<Weight>::RouteInfo;
+        using SearchStats = typename IRouter<Weight>::SearchStats;
+
+        explicit DijkstraRouter(const Graph& graph);
+
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const override;
+
+        /// One search per source until all targets are settled (shortest-path tree)
+        std::vector<std::optional<RouteInfo>> BuildRoutes(const std::vector<VertexId>& sources, const std::vector<VertexId>& targets) const override;
+
+        /// Return vertices reachable from `from` with a route weight not greater than `max_weight`, in the order of the weight.
+        /// The search stops at the first vertex beyond the budget
+        std::vector<std::pair<VertexId, Weight>> BuildReachable(VertexId from, Weight max_weight) const;
+
+        /// Settle every vertex reachable from `from` and call `on_settled(vertex, weight, prev_edge)` in the order of the weight.
+        /// `prev_edge` is the last edge of the route, nullopt for `from` itself
+        template <typename OnSettled>
+        void BuildTree(VertexId from, OnSettled&& on_settled) const;
+
+        SearchStats GetSearchStats() const override;
+
+    protected:
+        static constexpr Weight ZERO_WEIGHT{};
+
+        /// Search ordered by `weight + potential(vertex)`. The potential should be a consistent
+        /// lower bound of the remaining weight to `to` (A*); zero potential gives plain Dijkstra
+        template <typename Potential>
+        std::optional<RouteInfo> Search(VertexId from, VertexId to, Potential&& potential) const;
+
+        const Graph& graph_;
+
+    private:
+        struct SearchScratch {
+            std::vector<Weight> weights;
+            std::vector<EdgeId> prev_edges;
+            /// Start vertices of the previous edges, read to tell the ties of parallel edges without the edges lookup
+            std::vector<VertexId> prev_vertices;
+            std::vector<bool> settled;
+            std::vector<VertexId> touched;
+            Queue queue;
+
+            void Prepare(size_t vertex_count);
+            void Reset();
+        };
+
+        static constexpr Weight INFINITE_WEIGHT = std::numeric_limits<Weight>::max();
+        static constexpr EdgeId NONE_EDGE = std::numeric_limits<EdgeId>::max();
+        static constexpr double TIE_TOLERANCE = 1e-12;
+
+        mutable std::atomic<size_t> queries_count_ = 0;
+        mutable std::atomic<size_t> settled_vertices_count_ = 0;
+
+        static SearchScratch& GetScratch();
+
+        void CheckVertex(VertexId vertex) const;
+
+        /// Settle vertices in the order of `weight + potential(vertex)` until `is_done(vertex)` is true for a settled vertex
+        template <typename Potential, typename IsDone>
+        void RunSearch(SearchScratch& scratch, VertexId from, Potential&& potential, IsDone&& is_done) const;
+
+        std::optional<RouteInfo> MakeRoute(const SearchScratch& scratch, VertexId to) const;
+
+        /// Weights closer than the slack are tied, as they may differ by the summation order only. The all-pairs router sums a route
+        /// split by its greatest intermediate vertex, the search sums it edge by edge, so the same route may get weights differing
+        /// in the last bits
+        static Weight GetTieSlack(Weight weight);
+
+        /// Whether the route to `target` of `weight` ending by `edge_id` from the settled `vertex` replaces the current route of a tied weight.
+        /// Ties are resolved as Floyd-Warshall of the all-pairs router resolves them, so both routers return the same routes
+        bool IsPreferredTie(const SearchScratch& scratch, VertexId vertex, EdgeId edge_id, VertexId target, Weight weight) const;
+
+        /// Index of the edge starting from the greatest intermediate vertex of the route part [begin, end) of two edges at least.
+        /// Floyd-Warshall builds the route of this part from the parts before and after this vertex
+        size_t FindAllPairsSplit(const std::vector<EdgeId>& edges, size_t begin, size_t end) const;
+
+        /// Route part weight summed as Floyd-Warshall sums it: the sum of the parts before and after the greatest intermediate vertex
+        Weight GetAllPairsWeight(const std::vector<EdgeId>& edges, size_t begin, size_t end) const;
+
+        /// Negative if Floyd-Warshall prefers the lhs part, positive if the rhs part, zero if the parts are the same.
+        /// The parts of a lesser weight are preferred. Of the parts of the same weight the one found on an earlier iteration
+        /// (with a lesser greatest intermediate vertex) is kept, and the parts through the same vertex are compared by halves
+        int CompareAllPairsRoutes(const std::vector<EdgeId>& lhs, size_t lhs_begin, size_t lhs_end, const std::vector<EdgeId>& rhs,
+                                  size_t rhs_begin, size_t rhs_end) const;
+    };
+
+    template <typename Weight, typename Queue>
+    DijkstraRouter<Weight, Queue>::DijkstraRouter(const Graph& graph) : graph_(graph) {
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            if (graph.GetEdge(edge_id).weight < ZERO_WEIGHT) {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+        }
+    }
+
+    template <typename Weight, typename Queue>
+    typename DijkstraRouter<Weight, Queue>::SearchScratch& DijkstraRouter<Weight, Queue>::GetScratch() {
+        static thread_local SearchScratch scratch;
+        return scratch;
+    }
+
+    template <typename Weight, typename Queue>
+    void DijkstraRouter<Weight, Queue>::SearchScratch::Prepare(size_t vertex_count) {
+        if (weights.size() < vertex_count) {
+            weights.resize(vertex_count, INFINITE_WEIGHT);
+            prev_edges.resize(vertex_count, NONE_EDGE);
+            prev_vertices.resize(vertex_count);
+            settled.resize(vertex_count, false);
+        }
+    }
+
+    template <typename Weight, typename Queue>
+    void DijkstraRouter<Weight, Queue>::SearchScratch::Reset() {
+        for (const VertexId vertex : touched) {
+            weights[vertex] = INFINITE_WEIGHT;
+            prev_edges[vertex] = NONE_EDGE;
+            settled[vertex] = false;
+        }
+        touched.clear();
+        queue.Clear();
+    }
+
+    template <typename Weight, typename Queue>
+    typename DijkstraRouter<Weight, Queue>::SearchStats DijkstraRouter<Weight, Queue>::GetSearchStats() const {
+        return {queries_count_.load(std::memory_order_relaxed), settled_vertices_count_.load(std::memory_order_relaxed)};
+    }
+
+    template <typename Weight, typename Queue>
+    std::optional<typename DijkstraRouter<Weight, Queue>::RouteInfo> DijkstraRouter<Weight, Queue>::BuildRoute(VertexId from, VertexId to) const {
+        return Search(from, to, [](VertexId) {
+            return ZERO_WEIGHT;
+        });
+    }
+
+    template <typename Weight, typename Queue>
+    void DijkstraRouter<Weight, Queue>::CheckVertex(VertexId vertex) const {
+        if (vertex >= graph_.GetVertexCount()) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+    }
+
+    template <typename Weight, typename Queue>
+    template <typename Potential>
+    std::optional<typename DijkstraRouter<Weight, Queue>::RouteInfo> DijkstraRouter<Weight, Queue>::Search(
+        VertexId from, VertexId to, Potential&& potential) const {
+        CheckVertex(from);
+        CheckVertex(to);
+
+        SearchScratch& scratch = GetScratch();
+        RunSearch(scratch, from, potential, [to](VertexId vertex) {
+            return vertex == to;
+        });
+        std::optional<RouteInfo> result = MakeRoute(scratch, to);
+        scratch.Reset();
+        return result;
+    }
+
+    template <typename Weight, typename Queue>
+    std::vector<std::optional<typename DijkstraRouter<Weight, Queue>::RouteInfo>> DijkstraRouter<Weight, Queue>::BuildRoutes(
+        const std::vector<VertexId>& sources, const std::vector<VertexId>& targets) const {
+        std::vector<bool> is_target(graph_.GetVertexCount(), false);
+        size_t targets_count = 0;
+        for (const VertexId to : targets) {
+            CheckVertex(to);
+            targets_count += is_target[to] ? 0 : 1;
+            is_target[to] = true;
+        }
+
+        std::vector<std::optional<RouteInfo>> routes;
+        routes.reserve(sources.size() * targets.size());
+        SearchScratch& scratch = GetScratch();
+        for (const VertexId from : sources) {
+            CheckVertex(from);
+            if (targets_count == 0) {
+                continue;
+            }
+            size_t remaining_targets_count = targets_count;
+            RunSearch(
+                scratch, from,
+                [](VertexId) {
+                    return ZERO_WEIGHT;
+                },
+                [&is_target, &remaining_targets_count](VertexId vertex) {
+                    return is_target[vertex] && --remaining_targets_count == 0;
+                });
+            for (const VertexId to : targets) {
+                routes.push_back(MakeRoute(scratch, to));
+            }
+            scratch.Reset();
+        }
+        return routes;
+    }
+
+    template <typename Weight, typename Queue>
+    std::vector<std::pair<VertexId, Weight>> DijkstraRouter<Weight, Queue>::BuildReachable(VertexId from, Weight max_weight) const {
+        CheckVertex(from);
+
+        std::vector<std::pair<VertexId, Weight>> reachable;
+        SearchScratch& scratch = GetScratch();
+        RunSearch(
+            scratch, from,
+            [](VertexId) {
+                return ZERO_WEIGHT;
+            },
+            [&scratch, &reachable, max_weight](VertexId vertex) {
+                if (max_weight < scratch.weights[vertex]) {
+                    return true;
+                }
+                reachable.emplace_back(vertex, scratch.weights[vertex]);
+                return false;
+            });
+        scratch.Reset();
+        return reachable;
+    }
+
+    template <typename Weight, typename Queue>
+    template <typename OnSettled>
+    void DijkstraRouter<Weight, Queue>::BuildTree(VertexId from, OnSettled&& on_settled) const {
+        CheckVertex(from);
+
+        SearchScratch& scratch = GetScratch();
+        RunSearch(
+            scratch, from,
+            [](VertexId) {
+                return ZERO_WEIGHT;
+            },
+            [&scratch, &on_settled](VertexId vertex) {
+                const EdgeId prev_edge = scratch.prev_edges[vertex];
+                on_settled(vertex, scratch.weights[vertex], prev_edge == NONE_EDGE ? std::nullopt : std::optional<EdgeId>(prev_edge));
+                return false;
+            });
+        scratch.Reset();
+    }
+
+    template <typename Weight, typename Queue>
+    template <typename Potential, typename IsDone>
+    void DijkstraRouter<Weight, Queue>::RunSearch(SearchScratch& scratch, VertexId from, Potential&& potential, IsDone&& is_done) const {
+        scratch.Prepare(graph_.GetVertexCount());
+
+        scratch.weights[from] = ZERO_WEIGHT;
+        scratch.touched.push_back(from);
+        scratch.queue.Push(potential(from), from);
+
+        size_t settled_count = 0;
+        while (!scratch.queue.IsEmpty()) {
+            const VertexId vertex = scratch.queue.Pop();
+
+            if (scratch.settled[vertex]) {
+                continue;
+            }
+            scratch.settled[vertex] = true;
+            ++settled_count;
+            if (is_done(vertex)) {
+                break;
+            }
+
+            const Weight vertex_weight = scratch.weights[vertex];
+            const auto relax = [this, &scratch, &potential, vertex, vertex_weight](EdgeId edge_id, VertexId target, Weight edge_weight) {
+                const Weight candidate_weight = vertex_weight + edge_weight;
+                Weight& target_weight = scratch.weights[target];
+                const Weight tie_slack = GetTieSlack(candidate_weight);
+                if (candidate_weight + tie_slack < target_weight) {
+                    if (target_weight == INFINITE_WEIGHT) {
+                        scratch.touched.push_back(target);
+                    }
+                    target_weight = candidate_weight;
+                    scratch.prev_edges[target] = edge_id;
+                    scratch.prev_vertices[target] = vertex;
+                    scratch.queue.Push(candidate_weight + potential(target), target);
+                } else if (candidate_weight <= target_weight + tie_slack && IsPreferredTie(scratch, vertex, edge_id, target, candidate_weight)) {
+                    // The queued key of the target is kept unless the weight is lesser in the last bits
+                    if (candidate_weight < target_weight) {
+                        scratch.queue.Push(candidate_weight + potential(target), target);
+                    }
+                    target_weight = candidate_weight;
+                    scratch.prev_edges[target] = edge_id;
+                    scratch.prev_vertices[target] = vertex;
+                }
+            };
+
+            if (graph_.IsFrozen()) {
+                const auto arcs = graph_.GetIncidentArcs(vertex);
+                for (size_t i = 0; i < arcs.count; ++i) {
+                    relax(arcs.edge_ids[i], arcs.targets[i], arcs.weights[i]);
+                }
+            } else {
+                for (const EdgeId edge_id : graph_.GetIncidentEdges(vertex)) {
+                    const auto& edge = graph_.GetEdge(edge_id);
+                    relax(edge_id, edge.to, edge.weight);
+                }
+            }
+        }
+        queries_count_.fetch_add(1, std::memory_order_relaxed);
+        settled_vertices_count_.fetch_add(settled_count, std::memory_order_relaxed);
+    }
+
+    template <typename Weight, typename Queue>
+    std::optional<typename DijkstraRouter<Weight, Queue>::RouteInfo> DijkstraRouter<Weight, Queue>::MakeRoute(
+        const SearchScratch& scratch, VertexId to) const {
+        if (!scratch.settled[to]) {
+            return std::nullopt;
+        }
+        std::vector<EdgeId> edges;
+        for (EdgeId edge_id = scratch.prev_edges[to]; edge_id != NONE_EDGE; edge_id = scratch.prev_edges[graph_.GetEdge(edge_id).from]) {
+            edges.push_back(edge_id);
+        }
+        std::reverse(edges.begin(), edges.end());
+        return RouteInfo{scratch.weights[to], std::move(edges)};
+    }
+
+    template <typename Weight, typename Queue>
+    Weight DijkstraRouter<Weight, Queue>::GetTieSlack(Weight weight) {
+        if constexpr (std::is_floating_point_v<Weight>) {
+            return TIE_TOLERANCE * weight;
+        } else {
+            return ZERO_WEIGHT;
+        }
+    }
+
+    template <typename Weight, typename Queue>
+    bool DijkstraRouter<Weight, Queue>::IsPreferredTie(const SearchScratch& scratch, VertexId vertex, EdgeId edge_id, VertexId target,
+                                                       Weight weight) const {
+        if (scratch.settled[target]) {
+            return false;
+        }
+        // Parallel edges extend the same route, the lighter edge or the first of the edges of the same weight is kept
+        if (scratch.prev_vertices[target] == vertex) {
+            return weight < scratch.weights[target] || (weight == scratch.weights[target] && edge_id < scratch.prev_edges[target]);
+        }
+
+        // Routes are the branches of the search tree ended by the edges to the target
+        const auto fill_route = [&scratch](EdgeId last_edge_id, VertexId last_vertex, std::vector<EdgeId>& edges) {
+            edges.assign(1, last_edge_id);
+            for (VertexId route_vertex = last_vertex; scratch.prev_edges[route_vertex] != NONE_EDGE;
+                 route_vertex = scratch.prev_vertices[route_vertex]) {
+                edges.push_back(scratch.prev_edges[route_vertex]);
+            }
+            std::reverse(edges.begin(), edges.end());
+        };
+        static thread_local std::vector<EdgeId> route;
+        static thread_local std::vector<EdgeId> current_route;
+        fill_route(edge_id, vertex, route);
+        fill_route(scratch.prev_edges[target], scratch.prev_vertices[target], current_route);
+        return CompareAllPairsRoutes(route, 0, route.size(), current_route, 0, current_route.size()) < 0;
+    }
+
+    template <typename Weight, typename Queue>
+    size_t DijkstraRouter<Weight, Queue>::FindAllPairsSplit(const std::vector<EdgeId>& edges, size_t begin, size_t end) const {
+        size_t split = begin + 1;
+        for (size_t index = begin + 2; index < end; ++index) {
+            if (graph_.GetEdge(edges[index]).from > graph_.GetEdge(edges[split]).from) {
+                split = index;
+            }
+        }
+        return split;
+    }
+
+    template <typename Weight, typename Queue>
+    Weight DijkstraRouter<Weight, Queue>::GetAllPairsWeight(const std::vector<EdgeId>& edges, size_t begin, size_t end) const {
+        if (end - begin == 1) {
+            return graph_.GetEdge(edges[begin]).weight;
+        }
+        const size_t split = FindAllPairsSplit(edges, begin, end);
+        return GetAllPairsWeight(edges, begin, split) + GetAllPairsWeight(edges, split, end);
+    }
+
+    template <typename Weight, typename Queue>
+    int DijkstraRouter<Weight, Queue>::CompareAllPairsRoutes(const std::vector<EdgeId>& lhs, size_t lhs_begin, size_t lhs_end,
+                                                             const std::vector<EdgeId>& rhs, size_t rhs_begin, size_t rhs_end) const {
+        const Weight lhs_weight = GetAllPairsWeight(lhs, lhs_begin, lhs_end);
+        const Weight rhs_weight = GetAllPairsWeight(rhs, rhs_begin, rhs_end);
+        if (lhs_weight != rhs_weight) {
+            return lhs_weight < rhs_weight ? -1 : 1;
+        }
+
+        // A single edge is found before any route through an intermediate vertex, of the parallel edges the first one is kept
+        const bool lhs_is_edge = lhs_end - lhs_begin == 1;
+        const bool rhs_is_edge = rhs_end - rhs_begin == 1;
+        if (lhs_is_edge || rhs_is_edge) {
+            if (lhs_is_edge && rhs_is_edge) {
+                return lhs[lhs_begin] == rhs[rhs_begin] ? 0 : (lhs[lhs_begin] < rhs[rhs_begin] ? -1 : 1);
+            }
+            return lhs_is_edge ? -1 : 1;
+        }
+
+        const size_t lhs_split = FindAllPairsSplit(lhs, lhs_begin, lhs_end);
+        const size_t rhs_split = FindAllPairsSplit(rhs, rhs_begin, rhs_end);
+        const VertexId lhs_vertex = graph_.GetEdge(lhs[lhs_split]).from;
+        const VertexId rhs_vertex = graph_.GetEdge(rhs[rhs_split]).from;
+        if (lhs_vertex != rhs_vertex) {
+            return lhs_vertex < rhs_vertex ? -1 : 1;
+        }
+        const int first_half_order = CompareAllPairsRoutes(lhs, lhs_begin, lhs_split, rhs, rhs_begin, rhs_split);
+        return first_half_order != 0 ? first_half_order : CompareAllPairsRoutes(lhs, lhs_split, lhs_end, rhs, rhs_split, rhs_end);
+    }
+}
+
+namespace graph /* Router single-source searches (needs DijkstraRouter) */ {
+
+    template <typename Weight, typename Storage>
+    void Router<Weight, Storage>::FillBySingleSourceSearches(const Graph& graph) {
+        const DijkstraRouter<Weight> dijkstra_router(graph);
+        tbb::parallel_for(VertexId{0}, static_cast<VertexId>(graph.GetVertexCount()), [this, &dijkstra_router](VertexId from) {
+            dijkstra_router.BuildTree(from, [this, from](VertexId to, Weight weight, std::optional<EdgeId> prev_edge) {
+                routes_internal_data_.SetRoute(from, to, weight, prev_edge);
+            });
+        });
+    }
+
+    template <typename Weight, typename Storage>
+    void Router<Weight, Storage>::StoreEdgeWeights(const std::vector<EdgeId>& edge_ids) {
+        const size_t stored_count = edge_weights_.size();
+        edge_weights_.resize(graph_.GetEdgeCount());
+        for (EdgeId edge_id = stored_count; edge_id < edge_weights_.size(); ++edge_id) {
+            edge_weights_[edge_id] = graph_.GetEdge(edge_id).weight;
+        }
+        for (const EdgeId edge_id : edge_ids) {
+            edge_weights_.at(edge_id) = graph_.GetEdge(edge_id).weight;
+        }
+    }
+
+    template <typename Weight, typename Storage>
+    void Router<Weight, Storage>::CustomizeWeights() {
+        // Edges added after the last update have no stored weight and are lighter than the missing edge
+        const size_t vertex_count = routes_internal_data_.GetVertexCount();
+        std::vector<EdgeId> heavier_edges;
+        std::vector<EdgeId> lighter_edges;
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id) {
+            const Weight weight = graph_.GetEdge(edge_id).weight;
+            if (weight < ZERO_WEIGHT) {
+                throw std::domain_error("Edges' weights should be non-negative");
+            }
+            if (edge_id >= edge_weights_.size() || weight < edge_weights_[edge_id]) {
+                lighter_edges.push_back(edge_id);
+            } else if (edge_weights_[edge_id] < weight) {
+                heavier_edges.push_back(edge_id);
+            }
+        }
+
+        // The lighter edges are relaxed first, so the table is exact for the graph with the previous weights of the heavier edges.
+        // Routes that do not pass a heavier edge stay the shortest ones when it gets heavier, the rows of the rest are searched again
+        if (heavier_edges.empty() || lighter_edges.size() < vertex_count) {
+            RelaxEdges(lighter_edges);
+            RepairEdges(heavier_edges);
+            return;
+        }
+        RecalculateWeights();
+    }
+
+    template <typename Weight, typename Storage>
+    void Router<Weight, Storage>::RecalculateWeights() {
+        edge_weights_.clear();
+        StoreEdgeWeights({});
+        if (strategy_ == AllPairsStrategy::SINGLE_SOURCE_SEARCHES) {
+            // The same vertices are reachable, so every stored route is overwritten
+            FillBySingleSourceSearches(graph_);
+            return;
+        }
+
+        // A stored route is a path of the graph, so its new weight is an upper bound of the new route weight
+        const size_t vertex_count = routes_internal_data_.GetVertexCount();
+        tbb::parallel_for(VertexId{0}, static_cast<VertexId>(vertex_count), [this, vertex_count](VertexId from) {
+            std::vector<Weight> weights(vertex_count, ZERO_WEIGHT);
+            std::vector<bool> is_weighed(vertex_count, false);
+            std::vector<VertexId> path;
+            is_weighed[from] = true;
+
+            // Walk back to a re-weighed vertex of the route, then re-weigh the walked vertices forward.
+            // A route longer than V vertices or without a prev edge is broken, then the row is relaxed from the single edges
+            const auto reweigh_route = [this, from, vertex_count, &weights, &is_weighed, &path](VertexId to) {
+                for (VertexId vertex = to; !is_weighed[vertex];) {
+                    const std::optional<EdgeId> prev_edge = routes_internal_data_.GetPrevEdge(from, vertex);
+                    if (path.size() == vertex_count || !prev_edge.has_value()) {
+                        return false;
+                    }
+                    path.push_back(vertex);
+                    vertex = graph_.GetEdge(*prev_edge).from;
+                    if (!routes_internal_data_.HasRoute(from, vertex)) {
+                        return false;
+                    }
+                }
+                for (auto vertex_it = path.rbegin(); vertex_it != path.rend(); ++vertex_it) {
+                    const EdgeId edge_id = *routes_internal_data_.GetPrevEdge(from, *vertex_it);
+                    const auto& edge = graph_.GetEdge(edge_id);
+                    weights[*vertex_it] = weights[edge.from] + edge.weight;
+                    is_weighed[*vertex_it] = true;
+                    routes_internal_data_.SetRoute(from, *vertex_it, weights[*vertex_it], edge_id);
+                }
+                path.clear();
+                return true;
+            };
+            for (VertexId to = 0; to < vertex_count; ++to) {
+                if (is_weighed[to] || !routes_internal_data_.HasRoute(from, to)) {
+                    continue;
+                }
+                if (!reweigh_route(to)) {
+                    routes_internal_data_.ClearRoutesFrom(from);
+                    routes_internal_data_.SetRoute(from, from, ZERO_WEIGHT, std::nullopt);
+                    is_weighed.assign(vertex_count, false);
+                    is_weighed[from] = true;
+                    break;
+                }
+            }
+
+            // The relaxation starts from the single edges at most, a lighter edge replaces the re-weighed route
+            for (const EdgeId edge_id : graph_.GetIncidentEdges(from)) {
+                const auto& edge = graph_.GetEdge(edge_id);
+                if (edge.to != from && (!is_weighed[edge.to] || edge.weight < weights[edge.to])) {
+                    weights[edge.to] = edge.weight;
+                    is_weighed[edge.to] = true;
+                    routes_internal_data_.SetRoute(from, edge.to, edge.weight, edge_id);
+                }
+            }
+        });
+
+        routes_internal_data_.RelaxAll();
+    }
+
+    template <typename Weight, typename Storage>
+    size_t Router<Weight, Storage>::RepairEdges(const std::vector<EdgeId>& edge_ids) {
+        StoreEdgeWeights(edge_ids);
+        if (edge_ids.empty()) {
+            return 0;
+        }
+
+        std::vector<bool> is_changed_edge(graph_.GetEdgeCount(), false);
+        for (const EdgeId edge_id : edge_ids) {
+            is_changed_edge.at(edge_id) = true;
+        }
+
+        // Routes of a row are restored by the prev edges of the row, so the row depends on the edges it stores only
+        const size_t vertex_count = routes_internal_data_.GetVertexCount();
+        std::vector<char> is_affected(vertex_count, false);
+        tbb::parallel_for(VertexId{0}, static_cast<VertexId>(vertex_count), [this, &is_changed_edge, &is_affected, vertex_count](VertexId from) {
+            for (VertexId to = 0; to < vertex_count && !is_affected[from]; ++to) {
+                if (routes_internal_data_.HasRoute(from, to)) {
+                    const std::optional<EdgeId> prev_edge = routes_internal_data_.GetPrevEdge(from, to);
+                    is_affected[from] = prev_edge.has_value() && is_changed_edge[*prev_edge];
+                }
+            }
+        });
+
+        std::vector<VertexId> sources;
+        for (VertexId from = 0; from < vertex_count; ++from) {
+            if (is_affected[from]) {
+                sources.push_back(from);
+            }
+        }
+
+        const DijkstraRouter<Weight> dijkstra_router(graph_);
+        tbb::parallel_for(size_t{0}, sources.size(), [this, &dijkstra_router, &sources](size_t index) {
+            const VertexId from = sources[index];
+            routes_internal_data_.ClearRoutesFrom(from);
+            dijkstra_router.BuildTree(from, [this, from](VertexId to, Weight weight, std::optional<EdgeId> prev_edge) {
+                routes_internal_data_.SetRoute(from, to, weight, prev_edge);
+            });
+        });
+        return sources.size();
+    }
+}
+
+namespace graph /* HopLengthProfiles (metric-independent all-pairs customization) */ {
+
+    /// Metric-independent all-pairs preprocessing for the edge weights of the form `hop_weight + length_factor * length`:
+    /// every edge has the same fixed part and a part proportional to its own length. The profile of a vertices pair keeps
+    /// the shortest route of every edges count that is shorter than the routes with fewer edges (the Pareto routes of
+    /// the edges count and the length). For any non-negative `hop_weight` and positive `length_factor` the lightest route
+    /// is one of them, so the routes table for new factors is made by one pass over the profiles in O(V^2 + P)
+    /// (P is the total profiles size) without any search. Profiles are built by the rounds of relaxation from every source,
+    /// one round per edge of a route, in O(V * K * E) (K is the most edges of a Pareto route, parallel edges are counted once)
+    template <typename Weight>
+    class HopLengthProfiles {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        /// Lengths are indexed by the edge id. Throw std::domain_error if a length is negative
+        HopLengthProfiles(const Graph& graph, const std::vector<Weight>& lengths);
+
+        /// Routes table for the edge weights `hop_weight + length_factor * length`, it is exact for the graph with these weights.
+        /// Throw std::domain_error if `hop_weight` is negative or `length_factor` is not positive
+        template <typename Storage>
+        Storage Customize(Weight hop_weight, Weight length_factor) const;
+
+        size_t GetVertexCount() const;
+        /// Total count of the Pareto routes of all pairs
+        size_t GetProfilesSize() const;
+
+    private:
+        struct ProfileRoute {
+            uint32_t to = 0;
+            uint32_t hops = 0;
+            Weight length{};
+            EdgeId last_edge = 0;
+        };
+
+        static constexpr Weight ZERO_WEIGHT{};
+        static constexpr Weight INFINITE_WEIGHT =
+            std::numeric_limits<Weight>::has_infinity ? std::numeric_limits<Weight>::infinity() : std::numeric_limits<Weight>::max();
+        /// Pareto routes from every source in the ascending edges count order
+        std::vector<std::vector<ProfileRoute>> rows_;
+    };
+
+    template <typename Weight>
+    HopLengthProfiles<Weight>::HopLengthProfiles(const Graph& graph, const std::vector<Weight>& lengths) : rows_(graph.GetVertexCount()) {
+        const size_t vertex_count = graph.GetVertexCount();
+        if (lengths.size() != graph.GetEdgeCount()) {
+            throw std::invalid_argument("Lengths count does not match the edges count");
+        }
+        if (vertex_count > std::numeric_limits<uint32_t>::max()) {
+            throw std::overflow_error("Vertex id does not fit the routes profiles");
+        }
+        if (std::any_of(lengths.begin(), lengths.end(), [](Weight length) {
+                return length < ZERO_WEIGHT;
+            })) {
+            throw std::domain_error("Edges' lengths should be non-negative");
+        }
+
+        // Only the shortest of parallel edges makes a Pareto route, the others are dropped before the rounds
+        struct Arc {
+            VertexId to;
+            Weight length;
+            EdgeId edge_id;
+        };
+        std::vector<size_t> arc_offsets(vertex_count + 1, 0);
+        std::vector<Arc> arcs;
+        arcs.reserve(graph.GetEdgeCount());
+        std::vector<size_t> arc_indexes(vertex_count, 0);
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            const size_t arcs_begin = arcs.size();
+            for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
+                const VertexId to = graph.GetEdge(edge_id).to;
+                if (to == vertex) {
+                    continue;
+                }
+                const size_t arc_index = arc_indexes[to];
+                if (arc_index < arcs_begin || arc_index >= arcs.size() || arcs[arc_index].to != to) {
+                    arc_indexes[to] = arcs.size();
+                    arcs.push_back({to, lengths[edge_id], edge_id});
+                } else if (lengths[edge_id] < arcs[arc_index].length) {
+                    arcs[arc_index] = {to, lengths[edge_id], edge_id};
+                }
+            }
+            arc_offsets[vertex + 1] = arcs.size();
+        }
+
+        // The round `k` relaxes the arcs of the vertices whose route is shortened in the round `k - 1` only, by the length of that route.
+        // So a route shortened in the round `k` has exactly `k` edges, and a route with fewer edges is never recorded twice
+        tbb::parallel_for(VertexId{0}, static_cast<VertexId>(vertex_count), [this, &arcs, &arc_offsets, vertex_count](VertexId from) {
+            std::vector<ProfileRoute>& row = rows_[from];
+            std::vector<Weight> best_lengths(vertex_count, INFINITE_WEIGHT);
+            std::vector<uint32_t> shortened_rounds(vertex_count, 0);
+            std::vector<size_t> route_indexes(vertex_count, 0);
+            std::vector<std::pair<VertexId, Weight>> frontier{{from, ZERO_WEIGHT}};
+            best_lengths[from] = ZERO_WEIGHT;
+
+            for (uint32_t round = 1; !frontier.empty(); ++round) {
+                const size_t round_begin = row.size();
+                for (const auto& [vertex, length] : frontier) {
+                    for (size_t arc_index = arc_offsets[vertex]; arc_index < arc_offsets[vertex + 1]; ++arc_index) {
+                        const Arc& arc = arcs[arc_index];
+                        const Weight candidate_length = length + arc.length;
+                        if (!(candidate_length < best_lengths[arc.to])) {
+                            continue;
+                        }
+                        best_lengths[arc.to] = candidate_length;
+                        if (shortened_rounds[arc.to] != round) {
+                            shortened_rounds[arc.to] = round;
+                            route_indexes[arc.to] = row.size();
+                            row.push_back({static_cast<uint32_t>(arc.to), round, candidate_length, arc.edge_id});
+                        } else {
+                            row[route_indexes[arc.to]].length = candidate_length;
+                            row[route_indexes[arc.to]].last_edge = arc.edge_id;
+                        }
+                    }
+                }
+                frontier.clear();
+                for (size_t index = round_begin; index < row.size(); ++index) {
+                    frontier.emplace_back(row[index].to, row[index].length);
+                }
+            }
+            row.shrink_to_fit();
+        });
+    }
+
+    template <typename Weight>
+    template <typename Storage>
+    Storage HopLengthProfiles<Weight>::Customize(Weight hop_weight, Weight length_factor) const {
+        if (hop_weight < ZERO_WEIGHT || !(length_factor > ZERO_WEIGHT)) {
+            throw std::domain_error("Hop weight should be non-negative and length factor should be positive");
+        }
+
+        // Routes of the same weight are chosen by the fewest edges, so the prev edges of a row never make a cycle:
+        // the route to the edge start has fewer edges than the route through the edge
+        const size_t vertex_count = rows_.size();
+        Storage storage(vertex_count);
+        tbb::parallel_for(VertexId{0}, static_cast<VertexId>(vertex_count), [this, &storage, hop_weight, length_factor, vertex_count](VertexId from) {
+            std::vector<Weight> weights(vertex_count, INFINITE_WEIGHT);
+            storage.SetRoute(from, from, ZERO_WEIGHT, std::nullopt);
+            for (const ProfileRoute& route : rows_[from]) {
+                const Weight weight = static_cast<Weight>(route.hops) * hop_weight + route.length * length_factor;
+                if (weight < weights[route.to]) {
+                    weights[route.to] = weight;
+                    storage.SetRoute(from, route.to, weight, route.last_edge);
+                }
+            }
+        });
+        return storage;
+    }
+
+    template <typename Weight>
+    size_t HopLengthProfiles<Weight>::GetVertexCount() const {
+        return rows_.size();
+    }
+
+    template <typename Weight>
+    size_t HopLengthProfiles<Weight>::GetProfilesSize() const {
+        return std::transform_reduce(rows_.begin(), rows_.end(), size_t{0}, std::plus<>{}, [](const std::vector<ProfileRoute>& row) {
+            return row.size();
+        });
+    }
+}
+
+namespace graph /* AStarRouter (goal-directed single-pair search) */ {
+
+    /// Dijkstra search directed to the target by a heuristic: the queue is ordered by
+    /// `weight + heuristic(vertex, to)`. The heuristic should be a consistent lower bound of
+    /// the route weight from `vertex` to `to`, otherwise found routes may be not the shortest.
+    template <typename Weight, typename Queue = BinaryHeapQueue<Weight>>
+    class AStarRouter : public DijkstraRouter<Weight, Queue> {
+    private:
+        using Graph = typename DijkstraRouter<Weight, Queue>::Graph;
+
+    public:
+        using RouteInfo = typename IRouter<Weight>::RouteInfo;
+        using Heuristic = std::function<Weight(VertexId vertex, VertexId to)>;
+
+        AStarRouter(const Graph& graph, Heuristic heuristic);
+
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const override;
+
+    private:
+        Heuristic heuristic_;
+    };
+
+    template <typename Weight, typename Queue>
+    AStarRouter<Weight, Queue>::AStarRouter(const Graph& graph, Heuristic heuristic)
+        : DijkstraRouter<Weight, Queue>(graph), heuristic_(std::move(heuristic)) {}
+
+    template <typename Weight, typename Queue>
+    std::optional<typename AStarRouter<Weight, Queue>::RouteInfo> AStarRouter<Weight, Queue>::BuildRoute(VertexId from, VertexId to) const {
+        return this->Search(from, to, [this, to](VertexId vertex) {
+            return heuristic_(vertex, to);
+        });
+    }
+}
+
+namespace graph /* LandmarkTables (ALT heuristic) */ {
+
+    /// Route weights from and to a few landmark vertices. By the triangle inequality
+    /// `d(v, t) >= d(L, t) - d(L, v)` and `d(v, t) >= d(v, L) - d(t, L)` for every landmark `L`,
+    /// the maximum of these bounds is a consistent A* heuristic (ALT).
+    /// Tables are row-major (landmark x vertex), a missing route is stored as infinity.
+    template <typename Weight>
+    struct LandmarkTables {
+        std::vector<VertexId> landmarks;
+        std::vector<Weight> from_landmarks;
+        std::vector<Weight> to_landmarks;
+
+        static constexpr Weight ZERO_WEIGHT{};
+        static constexpr Weight INFINITE_WEIGHT =
+            std::numeric_limits<Weight>::has_infinity ? std::numeric_limits<Weight>::infinity() : std::numeric_limits<Weight>::max();
+
+        /// Choose `landmarks_count` landmarks by the farthest-first rule and calculate their tables
+        static LandmarkTables Build(const DirectedWeightedGraph<Weight>& graph, size_t landmarks_count);
+
+        /// Throw std::invalid_argument if tables do not match the graph
+        void Validate(const DirectedWeightedGraph<Weight>& graph) const;
+
+        Weight GetLowerBound(VertexId vertex, VertexId to) const;
+    };
+
+    template <typename Weight>
+    LandmarkTables<Weight> LandmarkTables<Weight>::Build(const DirectedWeightedGraph<Weight>& graph, size_t landmarks_count) {
+        const size_t vertex_count = graph.GetVertexCount();
+        landmarks_count = std::min(landmarks_count, vertex_count);
+
+        // Reverse adjacency is needed for the routes to landmarks
+        std::vector<std::vector<EdgeId>> reverse_incidence_lists(vertex_count);
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            reverse_incidence_lists[graph.GetEdge(edge_id).to].push_back(edge_id);
+        }
+
+        const auto calculate_weights = [&graph, &reverse_incidence_lists, vertex_count](VertexId source, bool is_reverse, Weight* weights) {
+            using QueueItem = std::pair<Weight, VertexId>;
+            std::vector<QueueItem> queue{{ZERO_WEIGHT, source}};
+            const auto compare = std::greater<QueueItem>{};
+            std::fill(weights, weights + vertex_count, INFINITE_WEIGHT);
+            weights[source] = ZERO_WEIGHT;
+
+            while (!queue.empty()) {
+                std::pop_heap(queue.begin(), queue.end(), compare);
+                const auto [weight, vertex] = queue.back();
+                queue.pop_back();
+                if (weight > weights[vertex]) {
+                    continue;
+                }
+                const auto relax = [&](VertexId target, Weight edge_weight) {
+                    if (weight + edge_weight < weights[target]) {
+                        weights[target] = weight + edge_weight;
+                        queue.emplace_back(weights[target], target);
+                        std::push_heap(queue.begin(), queue.end(), compare);
+                    }
+                };
+                if (is_reverse) {
+                    for (const EdgeId edge_id : reverse_incidence_lists[vertex]) {
+                        relax(graph.GetEdge(edge_id).from, graph.GetEdge(edge_id).weight);
+                    }
+                } else {
+                    for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
+                        relax(graph.GetEdge(edge_id).to, graph.GetEdge(edge_id).weight);
+                    }
+                }
+            }
+        };
+
+        LandmarkTables tables;
+        tables.from_landmarks.resize(landmarks_count * vertex_count);
+        tables.to_landmarks.resize(landmarks_count * vertex_count);
+
+        // Next landmark is the vertex farthest from the chosen ones (unreachable vertices count as the farthest)
+        std::vector<Weight> nearest_landmark_weights(vertex_count, INFINITE_WEIGHT);
+        VertexId landmark = 0;
+        for (size_t i = 0; i < landmarks_count; ++i) {
+            tables.landmarks.push_back(landmark);
+            Weight* from_landmark = &tables.from_landmarks[i * vertex_count];
+            calculate_weights(landmark, false, from_landmark);
+            calculate_weights(landmark, true, &tables.to_landmarks[i * vertex_count]);
+
+            for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+                nearest_landmark_weights[vertex] = std::min(nearest_landmark_weights[vertex], from_landmark[vertex]);
+            }
+            landmark = static_cast<VertexId>(
+                std::max_element(nearest_landmark_weights.begin(), nearest_landmark_weights.end()) - nearest_landmark_weights.begin());
+        }
+        return tables;
+    }
+
+    template <typename Weight>
+    void LandmarkTables<Weight>::Validate(const DirectedWeightedGraph<Weight>& graph) const {
+        const size_t vertex_count = graph.GetVertexCount();
+        const bool is_valid = from_landmarks.size() == landmarks.size() * vertex_count &&
+                              to_landmarks.size() == landmarks.size() * vertex_count &&
+                              std::all_of(landmarks.begin(), landmarks.end(), [vertex_count](VertexId landmark) {
+                                  return landmark < vertex_count;
+                              });
+        if (!is_valid) {
+            throw std::invalid_argument("Landmark tables do not match the graph");
+        }
+    }
+
+    template <typename Weight>
+    Weight LandmarkTables<Weight>::GetLowerBound(VertexId vertex, VertexId to) const {
+        const size_t vertex_count = landmarks.empty() ? 0 : from_landmarks.size() / landmarks.size();
+        Weight lower_bound = ZERO_WEIGHT;
+        for (size_t i = 0; i < landmarks.size(); ++i) {
+            const Weight* from_landmark = &from_landmarks[i * vertex_count];
+            const Weight* to_landmark = &to_landmarks[i * vertex_count];
+            if (from_landmark[to] != INFINITE_WEIGHT && from_landmark[vertex] != INFINITE_WEIGHT) {
+                lower_bound = std::max(lower_bound, from_landmark[to] - from_landmark[vertex]);
+            }
+            if (to_landmark[vertex] != INFINITE_WEIGHT && to_landmark[to] != INFINITE_WEIGHT) {
+                lower_bound = std::max(lower_bound, to_landmark[vertex] - to_landmark[to]);
+            }
+        }
+        return lower_bound;
+    }
+}
+
+namespace graph /* ReachabilityIndex (strongly connected components) */ {
+
+    /// Strongly connected components of the graph numbered in the topological order of the components graph, and weakly
+    /// connected components. Edges never lead to a preceding strong component, so a route does not exist if the target component
+    /// precedes the source one or if the vertices are in different weak components. Answers "no route" without a search
+    struct ReachabilityIndex {
+        std::vector<uint32_t> components;
+        std::vector<uint32_t> weak_components;
+
+        /// Label the components by the iterative Tarjan's algorithm, O(V + E)
+        template <typename Weight>
+        static ReachabilityIndex Build(const DirectedWeightedGraph<Weight>& graph);
+
+        /// Throw std::invalid_argument if the labels do not match the graph
+        template <typename Weight>
+        void Validate(const DirectedWeightedGraph<Weight>& graph) const;
+
+        /// False if there is no route for sure, true if the route may exist
+        bool MayReach(VertexId from, VertexId to) const {
+            return weak_components[from] == weak_components[to] && components[from] <= components[to];
+        }
+    };
+
+    template <typename Weight>
+    ReachabilityIndex ReachabilityIndex::Build(const DirectedWeightedGraph<Weight>& graph) {
+        static constexpr uint32_t NONE = std::numeric_limits<uint32_t>::max();
+        const size_t vertex_count = graph.GetVertexCount();
+
+        ReachabilityIndex index;
+        index.components.assign(vertex_count, NONE);
+        std::vector<uint32_t> visit_indexes(vertex_count, NONE);
+        std::vector<uint32_t> low_links(vertex_count, NONE);
+        std::vector<VertexId> stack;
+        // Depth-first search frames: the vertex and the count of its incident edges visited
+        std::vector<std::pair<VertexId, size_t>> frames;
+        uint32_t visit_index = 0;
+        uint32_t components_count = 0;
+
+        for (VertexId root = 0; root < vertex_count; ++root) {
+            if (visit_indexes[root] != NONE) {
+                continue;
+            }
+            visit_indexes[root] = low_links[root] = visit_index++;
+            stack.push_back(root);
+            frames.emplace_back(root, 0);
+
+            while (!frames.empty()) {
+                const VertexId vertex = frames.back().first;
+                const auto incident_edges = graph.GetIncidentEdges(vertex);
+                const auto edge_it = std::next(incident_edges.begin(), frames.back().second);
+                if (edge_it != incident_edges.end()) {
+                    ++frames.back().second;
+                    const VertexId target = graph.GetEdge(*edge_it).to;
+                    if (visit_indexes[target] == NONE) {
+                        visit_indexes[target] = low_links[target] = visit_index++;
+                        stack.push_back(target);
+                        frames.emplace_back(target, 0);
+                    } else if (index.components[target] == NONE) {
+                        // The target is on the stack (its component is not completed yet)
+                        low_links[vertex] = std::min(low_links[vertex], visit_indexes[target]);
+                    }
+                    continue;
+                }
+
+                frames.pop_back();
+                if (!frames.empty()) {
+                    low_links[frames.back().first] = std::min(low_links[frames.back().first], low_links[vertex]);
+                }
+                if (low_links[vertex] == visit_indexes[vertex]) {
+                    VertexId component_vertex = vertex;
+                    do {
+                        component_vertex = stack.back();
+                        stack.pop_back();
+                        index.components[component_vertex] = components_count;
+                    } while (component_vertex != vertex);
+                    ++components_count;
+                }
+            }
+        }
+
+        // Tarjan's algorithm completes the components in the reverse topological order
+        std::for_each(index.components.begin(), index.components.end(), [components_count](uint32_t& component) {
+            component = components_count - 1 - component;
+        });
+
+        // Weak components are the sets of the disjoint-set forest joined by the edges
+        std::vector<uint32_t> parents(vertex_count);
+        std::iota(parents.begin(), parents.end(), 0u);
+        const auto find_root = [&parents](uint32_t vertex) {
+            while (parents[vertex] != vertex) {
+                vertex = parents[vertex] = parents[parents[vertex]];
+            }
+            return vertex;
+        };
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            const auto& edge = graph.GetEdge(edge_id);
+            const uint32_t from_root = find_root(static_cast<uint32_t>(edge.from));
+            const uint32_t to_root = find_root(static_cast<uint32_t>(edge.to));
+            parents[std::max(from_root, to_root)] = std::min(from_root, to_root);
+        }
+        index.weak_components.resize(vertex_count);
+        for (uint32_t vertex = 0; vertex < vertex_count; ++vertex) {
+            index.weak_components[vertex] = find_root(vertex);
+        }
+        return index;
+    }
+
+    template <typename Weight>
+    void ReachabilityIndex::Validate(const DirectedWeightedGraph<Weight>& graph) const {
+        const size_t vertex_count = graph.GetVertexCount();
+        if (components.size() != vertex_count || weak_components.size() != vertex_count) {
+            throw std::invalid_argument("Reachability index does not match the graph");
+        }
+        for (EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+            if (!MayReach(graph.GetEdge(edge_id).from, graph.GetEdge(edge_id).to)) {
+                throw std::invalid_argument("Reachability index does not match the graph");
+            }
+        }
+    }
+}
+
+namespace graph /* ContractionHierarchy (preprocessed shortcuts) */ {
+
+    /// Result of contraction hierarchies preprocessing.
+    /// Edge ids below the graph edge count refer to graph edges, `edge_count + i` refers to `shortcuts[i]`.
+    /// A shortcut replaces the two-edge path `first_edge` + `second_edge` through a contracted vertex,
+    /// and refers only to graph edges or to earlier shortcuts.
+    template <typename Weight>
+    struct ContractionHierarchy {
+        struct Shortcut {
+            VertexId from;
+            VertexId to;
+            Weight weight;
+            EdgeId first_edge;
+            EdgeId second_edge;
+        };
+
+        /// Contraction order of every vertex, vertices contracted later have higher ranks
+        std::vector<VertexId> ranks;
+        std::vector<Shortcut> shortcuts;
+    };
+
+    /// Contracts vertices one by one in the order of the lowest priority (edge difference plus count of contracted
+    /// neighbours, updated lazily) and adds a shortcut for every pair of neighbours which has no witness path of
+    /// the same or lower weight that avoids the contracted vertex.
+    template <typename Weight>
+    class ContractionHierarchyBuilder {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+        using Shortcut = typename ContractionHierarchy<Weight>::Shortcut;
+
+    public:
+        explicit ContractionHierarchyBuilder(const Graph& graph);
+
+        ContractionHierarchy<Weight> Build();
+        /// Contract the vertices in the order of the given ranks (e.g. of the hierarchy built before the edge weights changed).
+        /// The order is not recalculated, only the witness searches are repeated, so the shortcuts fit the current weights
+        ContractionHierarchy<Weight> Build(const std::vector<VertexId>& ranks);
+
+    private:
+        struct Arc {
+            VertexId vertex;
+            Weight weight;
+            EdgeId edge_id;
+        };
+
+        struct WitnessItem {
+            Weight weight;
+            VertexId vertex;
+
+            bool operator>(const WitnessItem& rhs) const {
+                return weight > rhs.weight || (weight == rhs.weight && vertex > rhs.vertex);
+            }
+        };
+
+        /// Witness searches give up after this count of settled vertices (an extra shortcut is added then).
+        /// Priorities are estimated with direct witnesses only (the source is the only settled vertex)
+        static constexpr size_t PRIORITY_WITNESS_SETTLED_LIMIT = 1;
+        static constexpr size_t CONTRACTION_WITNESS_SETTLED_LIMIT = 32;
+        static constexpr Weight ZERO_WEIGHT{};
+        static constexpr Weight INFINITE_WEIGHT = std::numeric_limits<Weight>::max();
+
+        const Graph& graph_;
+        std::vector<std::vector<Arc>> out_arcs_;
+        std::vector<std::vector<Arc>> in_arcs_;
+        std::vector<bool> contracted_;
+        std::vector<size_t> contracted_neighbours_;
+        std::vector<Shortcut> shortcuts_;
+
+        std::vector<Weight> witness_weights_;
+        std::vector<VertexId> witness_touched_;
+        std::vector<WitnessItem> witness_queue_;
+        /// Weight of the arc from the contracted vertex for its out-neighbours, infinity for other vertices
+        std::vector<Weight> witness_targets_;
+
+        void AddOrImproveArc(VertexId from, VertexId to, Weight weight, EdgeId edge_id);
+
+        /// Search witnesses from the in-neighbour of the contracted vertex; stops as soon as a witness is found
+        /// for every out-neighbour (`targets_count`), or the search exceeds `max_weight` or the settled limit
+        void RunWitnessSearch(
+            VertexId source, VertexId skipped_vertex, Weight in_weight, Weight max_weight, size_t targets_count, size_t settled_limit);
+        void ResetWitnessSearch();
+
+        /// Call `on_shortcut(in_arc, out_arc)` for every shortcut needed to contract the vertex
+        template <typename OnShortcut>
+        void ForEachRequiredShortcut(VertexId vertex, size_t settled_limit, OnShortcut&& on_shortcut);
+
+        int64_t CalculatePriority(VertexId vertex);
+        void Contract(VertexId vertex);
+    };
+
+    template <typename Weight>
+    ContractionHierarchyBuilder<Weight>::ContractionHierarchyBuilder(const Graph& graph)
+        : graph_(graph),
+          out_arcs_(graph.GetVertexCount()),
+          in_arcs_(graph.GetVertexCount()),
+          contracted_(graph.GetVertexCount(), false),
+          contracted_neighbours_(graph.GetVertexCount(), 0),
+          witness_weights_(graph.GetVertexCount(), INFINITE_WEIGHT),
+          witness_targets_(graph.GetVertexCount(), INFINITE_WEIGHT) {
+        const size_t vertex_count = graph.GetVertexCount();
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            // Only the lightest of parallel edges takes part in the contraction
+            std::vector<Arc>& arcs = out_arcs_[vertex];
+            for (const EdgeId edge_id : graph.GetIncidentEdges(vertex)) {
+                const auto& edge = graph.GetEdge(edge_id);
+                if (edge.weight < ZERO_WEIGHT) {
+                    throw std::domain_error("Edges' weights should be non-negative");
+                }
+                if (edge.to != vertex) {
+                    arcs.push_back({edge.to, edge.weight, edge_id});
+                }
+            }
+            std::sort(arcs.begin(), arcs.end(), [](const Arc& lhs, const Arc& rhs) {
+                return std::tie(lhs.vertex, lhs.weight, lhs.edge_id) < std::tie(rhs.vertex, rhs.weight, rhs.edge_id);
+            });
+            arcs.erase(
+                std::unique(
+                    arcs.begin(), arcs.end(),
+                    [](const Arc& lhs, const Arc& rhs) {
+                        return lhs.vertex == rhs.vertex;
+                    }),
+                arcs.end());
+            for (const Arc& arc : arcs) {
+                in_arcs_[arc.vertex].push_back({vertex, arc.weight, arc.edge_id});
+            }
+        }
+    }
+
+    template <typename Weight>
+    ContractionHierarchy<Weight> ContractionHierarchyBuilder<Weight>::Build() {
+        using QueueItem = std::pair<int64_t, VertexId>;
+
+        const size_t vertex_count = graph_.GetVertexCount();
+        std::vector<QueueItem> queue;
+        queue.reserve(vertex_count);
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            queue.emplace_back(CalculatePriority(vertex), vertex);
+        }
+        const auto compare = std::greater<QueueItem>{};
+        std::make_heap(queue.begin(), queue.end(), compare);
+
+        ContractionHierarchy<Weight> hierarchy;
+        hierarchy.ranks.resize(vertex_count);
+        VertexId rank = 0;
+        while (!queue.empty()) {
+            std::pop_heap(queue.begin(), queue.end(), compare);
+            const VertexId vertex = queue.back().second;
+            queue.pop_back();
+
+            // Lazy update: the priority could grow since it was calculated
+            const int64_t priority = CalculatePriority(vertex);
+            if (!queue.empty() && priority > queue.front().first) {
+                queue.emplace_back(priority, vertex);
+                std::push_heap(queue.begin(), queue.end(), compare);
+                continue;
+            }
+
+            Contract(vertex);
+            hierarchy.ranks[vertex] = rank++;
+        }
+
+        hierarchy.shortcuts = std::move(shortcuts_);
+        return hierarchy;
+    }
+
+    template <typename Weight>
+    ContractionHierarchy<Weight> ContractionHierarchyBuilder<Weight>::Build(const std::vector<VertexId>& ranks) {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (ranks.size() != vertex_count) {
+            throw std::invalid_argument("Contraction order does not match the graph vertex count");
+        }
+        std::vector<VertexId> order(vertex_count, vertex_count);
+        for (VertexId vertex = 0; vertex < vertex_count; ++vertex) {
+            if (ranks[vertex] >= vertex_count || order[ranks[vertex]] != vertex_count) {
+                throw std::invalid_argument("Contraction order is not a permutation of the vertices");
+            }
+            order[ranks[vertex]] = vertex;
+        }
+
+        for (const VertexId vertex : order) {
+            Contract(vertex);
+        }
+
+        ContractionHierarchy<Weight> hierarchy;
+        hierarchy.ranks = ranks;
+        hierarchy.shortcuts = std::move(shortcuts_);
+        return hierarchy;
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::AddOrImproveArc(VertexId from, VertexId to, Weight weight, EdgeId edge_id) {
+        auto out_it = std::find_if(out_arcs_[from].begin(), out_arcs_[from].end(), [to](const Arc& arc) {
+            return arc.vertex == to;
+        });
+        if (out_it == out_arcs_[from].end()) {
+            out_arcs_[from].push_back({to, weight, edge_id});
+            in_arcs_[to].push_back({from, weight, edge_id});
+            return;
+        }
+        if (weight < out_it->weight) {
+            *out_it = {to, weight, edge_id};
+            auto in_it = std::find_if(in_arcs_[to].begin(), in_arcs_[to].end(), [from](const Arc& arc) {
+                return arc.vertex == from;
+            });
+            *in_it = {from, weight, edge_id};
+        }
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::RunWitnessSearch(
+        VertexId source, VertexId skipped_vertex, Weight in_weight, Weight max_weight, size_t targets_count, size_t settled_limit) {
+        const auto compare = std::greater<WitnessItem>{};
+        const auto is_witnessed = [this, in_weight](VertexId vertex) {
+            return witness_weights_[vertex] <= in_weight + witness_targets_[vertex];
+        };
+        if (targets_count == 0) {
+            return;
+        }
+        witness_weights_[source] = ZERO_WEIGHT;
+        witness_touched_.push_back(source);
+        witness_queue_.push_back({ZERO_WEIGHT, source});
+
+        size_t settled_count = 0;
+        while (!witness_queue_.empty() && settled_count < settled_limit) {
+            std::pop_heap(witness_queue_.begin(), witness_queue_.end(), compare);
+            const WitnessItem item = witness_queue_.back();
+            witness_queue_.pop_back();
+
+            if (item.weight > witness_weights_[item.vertex]) {
+                continue;
+            }
+            if (item.weight > max_weight) {
+                break;
+            }
+            ++settled_count;
+
+            for (const Arc& arc : out_arcs_[item.vertex]) {
+                if (arc.vertex == skipped_vertex) {
+                    continue;
+                }
+                const Weight candidate_weight = item.weight + arc.weight;
+                Weight& target_weight = witness_weights_[arc.vertex];
+                if (candidate_weight < target_weight) {
+                    if (target_weight == INFINITE_WEIGHT) {
+                        witness_touched_.push_back(arc.vertex);
+                    }
+                    const bool was_witnessed = is_witnessed(arc.vertex);
+                    target_weight = candidate_weight;
+                    if (!was_witnessed && witness_targets_[arc.vertex] != INFINITE_WEIGHT && is_witnessed(arc.vertex) && --targets_count == 0) {
+                        return;
+                    }
+                    witness_queue_.push_back({candidate_weight, arc.vertex});
+                    std::push_heap(witness_queue_.begin(), witness_queue_.end(), compare);
+                }
+            }
+        }
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::ResetWitnessSearch() {
+        for (const VertexId vertex : witness_touched_) {
+            witness_weights_[vertex] = INFINITE_WEIGHT;
+        }
+        witness_touched_.clear();
+        witness_queue_.clear();
+    }
+
+    template <typename Weight>
+    template <typename OnShortcut>
+    void ContractionHierarchyBuilder<Weight>::ForEachRequiredShortcut(VertexId vertex, size_t settled_limit, OnShortcut&& on_shortcut) {
+        const std::vector<Arc>& out_arcs = out_arcs_[vertex];
+        if (out_arcs.empty()) {
+            return;
+        }
+        Weight max_out_weight = ZERO_WEIGHT;
+        for (const Arc& out_arc : out_arcs) {
+            max_out_weight = std::max(max_out_weight, out_arc.weight);
+            witness_targets_[out_arc.vertex] = out_arc.weight;
+        }
+
+        for (const Arc& in_arc : in_arcs_[vertex]) {
+            const bool is_source_target = witness_targets_[in_arc.vertex] != INFINITE_WEIGHT;
+            RunWitnessSearch(
+                in_arc.vertex, vertex, in_arc.weight, in_arc.weight + max_out_weight, out_arcs.size() - (is_source_target ? 1 : 0),
+                settled_limit);
+            for (const Arc& out_arc : out_arcs) {
+                if (out_arc.vertex != in_arc.vertex && witness_weights_[out_arc.vertex] > in_arc.weight + out_arc.weight) {
+                    on_shortcut(in_arc, out_arc);
+                }
+            }
+            ResetWitnessSearch();
+        }
+
+        for (const Arc& out_arc : out_arcs) {
+            witness_targets_[out_arc.vertex] = INFINITE_WEIGHT;
+        }
+    }
+
+    template <typename Weight>
+    int64_t ContractionHierarchyBuilder<Weight>::CalculatePriority(VertexId vertex) {
+        int64_t shortcuts_count = 0;
+        ForEachRequiredShortcut(vertex, PRIORITY_WITNESS_SETTLED_LIMIT, [&shortcuts_count](const Arc&, const Arc&) {
+            ++shortcuts_count;
+        });
+        const int64_t removed_arcs_count = static_cast<int64_t>(in_arcs_[vertex].size() + out_arcs_[vertex].size());
+        return shortcuts_count - removed_arcs_count + static_cast<int64_t>(contracted_neighbours_[vertex]);
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyBuilder<Weight>::Contract(VertexId vertex) {
+        std::vector<Shortcut> new_shortcuts;
+        ForEachRequiredShortcut(vertex, CONTRACTION_WITNESS_SETTLED_LIMIT, [&new_shortcuts](const Arc& in_arc, const Arc& out_arc) {
+            new_shortcuts.push_back({in_arc.vertex, out_arc.vertex, in_arc.weight + out_arc.weight, in_arc.edge_id, out_arc.edge_id});
+        });
+
+        contracted_[vertex] = true;
+        for (const Arc& in_arc : in_arcs_[vertex]) {
+            auto& arcs = out_arcs_[in_arc.vertex];
+            arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [vertex](const Arc& arc) { return arc.vertex == vertex; }), arcs.end());
+            ++contracted_neighbours_[in_arc.vertex];
+        }
+        for (const Arc& out_arc : out_arcs_[vertex]) {
+            auto& arcs = in_arcs_[out_arc.vertex];
+            arcs.erase(std::remove_if(arcs.begin(), arcs.end(), [vertex](const Arc& arc) { return arc.vertex == vertex; }), arcs.end());
+            ++contracted_neighbours_[out_arc.vertex];
+        }
+        out_arcs_[vertex].clear();
+        in_arcs_[vertex].clear();
+
+        for (const Shortcut& shortcut : new_shortcuts) {
+            const EdgeId edge_id = graph_.GetEdgeCount() + shortcuts_.size();
+            shortcuts_.push_back(shortcut);
+            AddOrImproveArc(shortcut.from, shortcut.to, shortcut.weight, edge_id);
+        }
+    }
+}
+
+namespace graph /* ContractionHierarchyRouter (bidirectional upward search) */ {
+
+    /// Answers queries with a bidirectional Dijkstra search over a contraction hierarchy:
+    /// the forward search follows only arcs to higher ranked vertices, the backward search
+    /// follows only arcs from higher ranked vertices. Found shortcuts are unpacked into graph edges.
+    template <typename Weight>
+    class ContractionHierarchyRouter : public IRouter<Weight> {
+    private:
+        using Graph = DirectedWeightedGraph<Weight>;
+
+    public:
+        using RouteInfo = typename IRouter<Weight>::RouteInfo;
+        using SearchStats = typename IRouter<Weight>::SearchStats;
+        using Hierarchy = ContractionHierarchy<Weight>;
+
+        /// Preprocess the graph (contract all vertices)
+        explicit ContractionHierarchyRouter(const Graph& graph);
+
+        /// Adopt preprocessed hierarchy (e.g. restored from storage) without recalculation
+        ContractionHierarchyRouter(const Graph& graph, Hierarchy&& hierarchy);
+
+        std::optional<RouteInfo> BuildRoute(VertexId from, VertexId to) const override;
+
+        /// Bucket-based many-to-many: one backward upward search per target fills the buckets of the reached vertices,
+        /// then one forward upward search per source meets them
+        std::vector<std::optional<RouteInfo>> BuildRoutes(const std::vector<VertexId>& sources, const std::vector<VertexId>& targets) const override;
+
+        SearchStats GetSearchStats() const override;
+
+        const Hierarchy& GetHierarchy() const;
+
+    private:
+        struct QueueItem {
+            Weight weight;
+            VertexId vertex;
+
+            bool operator>(const QueueItem& rhs) const {
+                return weight > rhs.weight || (weight == rhs.weight && vertex > rhs.vertex);
+            }
+        };
+
+        /// Upward arcs in a compressed-sparse-row layout, `vertices[i]` is the other end of arc `i`
+        struct SearchGraph {
+            std::vector<size_t> offsets;
+            std::vector<VertexId> vertices;
+            std::vector<Weight> weights;
+            std::vector<EdgeId> edge_ids;
+        };
+
+        struct SearchDirection {
+            std::vector<Weight> weights;
+            std::vector<EdgeId> prev_edges;
+            std::vector<VertexId> touched;
+            std::vector<QueueItem> queue;
+
+            void Prepare(size_t vertex_count);
+            void Reset();
+            void Push(VertexId vertex, Weight weight, EdgeId prev_edge);
+        };
+
+        struct SearchScratch {
+            SearchDirection forward;
+            SearchDirection backward;
+        };
+
+        /// Upward weight from the bucket vertex to the target, and the next hierarchy edge of the route to the target
+        struct BucketItem {
+            VertexId vertex;
+            size_t target_index;
+            Weight weight;
+            EdgeId next_edge;
+
+            bool operator<(const BucketItem& rhs) const {
+                return std::tie(vertex, target_index) < std::tie(rhs.vertex, rhs.target_index);
+            }
+        };
+
+        static constexpr Weight ZERO_WEIGHT{};
+        static constexpr Weight INFINITE_WEIGHT = std::numeric_limits<Weight>::max();
+        static constexpr EdgeId NONE_EDGE = std::numeric_limits<EdgeId>::max();
+
+        const Graph& graph_;
+        Hierarchy hierarchy_;
+        SearchGraph forward_graph_;
+        SearchGraph backward_graph_;
+        mutable std::atomic<size_t> queries_count_ = 0;
+        mutable std::atomic<size_t> settled_vertices_count_ = 0;
+
+        static SearchScratch& GetScratch();
+
+        void Validate() const;
+        void BuildSearchGraphs();
+        VertexId GetEdgeFrom(EdgeId edge_id) const;
+        VertexId GetEdgeTo(EdgeId edge_id) const;
+        void UnpackEdge(EdgeId edge_id, std::vector<EdgeId>& edges) const;
+        RouteInfo UnpackRoute(const std::vector<EdgeId>& hierarchy_edges) const;
+
+        /// Settle all vertices reachable by the search graph from `start`, `on_settled(vertex, weight)` is called for each one
+        template <typename OnSettled>
+        size_t SearchAll(SearchDirection& direction, const SearchGraph& search_graph, VertexId start, OnSettled&& on_settled) const;
+
+        /// Settle the next vertex of the direction and update the best meeting point.
+        /// Return false if the popped queue item is outdated (nothing settled)
+        bool Step(SearchDirection& direction, const SearchGraph& search_graph, const SearchDirection& opposite_direction,
+                  Weight& best_weight, VertexId& meeting_vertex) const;
+    };
+
+    template <typename Weight>
+    ContractionHierarchyRouter<Weight>::ContractionHierarchyRouter(const Graph& graph)
+        : graph_(graph), hierarchy_(ContractionHierarchyBuilder<Weight>(graph).Build()) {
+        BuildSearchGraphs();
+    }
+
+    template <typename Weight>
+    ContractionHierarchyRouter<Weight>::ContractionHierarchyRouter(const Graph& graph, Hierarchy&& hierarchy)
+        : graph_(graph), hierarchy_(std::move(hierarchy)) {
+        Validate();
+        BuildSearchGraphs();
+    }
+
+    template <typename Weight>
+    const typename ContractionHierarchyRouter<Weight>::Hierarchy& ContractionHierarchyRouter<Weight>::GetHierarchy() const {
+        return hierarchy_;
+    }
+
+    template <typename Weight>
+    typename ContractionHierarchyRouter<Weight>::SearchScratch& ContractionHierarchyRouter<Weight>::GetScratch() {
+        static thread_local SearchScratch scratch;
+        return scratch;
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyRouter<Weight>::Validate() const {
+        const size_t vertex_count = graph_.GetVertexCount();
+        const size_t edge_count = graph_.GetEdgeCount();
+        if (hierarchy_.ranks.size() != vertex_count) {
+            throw std::invalid_argument("Contraction hierarchy does not match the graph vertex count");
+        }
+        for (size_t i = 0; i < hierarchy_.shortcuts.size(); ++i) {
+            const auto& shortcut = hierarchy_.shortcuts[i];
+            if (shortcut.from >= vertex_count || shortcut.to >= vertex_count || shortcut.first_edge >= edge_count + i ||
+                shortcut.second_edge >= edge_count + i) {
+                throw std::invalid_argument("Contraction hierarchy shortcut is invalid");
+            }
+        }
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyRouter<Weight>::BuildSearchGraphs() {
+        struct Arc {
+            VertexId vertex;
+            VertexId other_vertex;
+            Weight weight;
+            EdgeId edge_id;
+        };
+
+        std::vector<Arc> forward_arcs;
+        std::vector<Arc> backward_arcs;
+        const auto add_arc = [this, &forward_arcs, &backward_arcs](VertexId from, VertexId to, Weight weight, EdgeId edge_id) {
+            if (from == to) {
+                return;
+            }
+            if (hierarchy_.ranks[from] < hierarchy_.ranks[to]) {
+                forward_arcs.push_back({from, to, weight, edge_id});
+            } else {
+                backward_arcs.push_back({to, from, weight, edge_id});
+            }
+        };
+        for (EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id) {
+            const auto& edge = graph_.GetEdge(edge_id);
+            add_arc(edge.from, edge.to, edge.weight, edge_id);
+        }
+        for (size_t i = 0; i < hierarchy_.shortcuts.size(); ++i) {
+            const auto& shortcut = hierarchy_.shortcuts[i];
+            add_arc(shortcut.from, shortcut.to, shortcut.weight, graph_.GetEdgeCount() + i);
+        }
+
+        const size_t vertex_count = graph_.GetVertexCount();
+        const auto fill = [vertex_count](std::vector<Arc>& arcs, SearchGraph& search_graph) {
+            // Keep only the lightest arc between two vertices
+            std::sort(arcs.begin(), arcs.end(), [](const Arc& lhs, const Arc& rhs) {
+                return std::tie(lhs.vertex, lhs.other_vertex, lhs.weight, lhs.edge_id) <
+                       std::tie(rhs.vertex, rhs.other_vertex, rhs.weight, rhs.edge_id);
+            });
+            arcs.erase(
+                std::unique(
+                    arcs.begin(), arcs.end(),
+                    [](const Arc& lhs, const Arc& rhs) {
+                        return lhs.vertex == rhs.vertex && lhs.other_vertex == rhs.other_vertex;
+                    }),
+                arcs.end());
+
+            search_graph.offsets.assign(vertex_count + 1, 0);
+            for (const Arc& arc : arcs) {
+                ++search_graph.offsets[arc.vertex + 1];
+                search_graph.vertices.push_back(arc.other_vertex);
+                search_graph.weights.push_back(arc.weight);
+                search_graph.edge_ids.push_back(arc.edge_id);
+            }
+            std::partial_sum(search_graph.offsets.begin(), search_graph.offsets.end(), search_graph.offsets.begin());
+        };
+        fill(forward_arcs, forward_graph_);
+        fill(backward_arcs, backward_graph_);
+    }
+
+    template <typename Weight>
+    VertexId ContractionHierarchyRouter<Weight>::GetEdgeFrom(EdgeId edge_id) const {
+        return edge_id < graph_.GetEdgeCount() ? graph_.GetEdge(edge_id).from : hierarchy_.shortcuts[edge_id - graph_.GetEdgeCount()].from;
+    }
+
+    template <typename Weight>
+    VertexId ContractionHierarchyRouter<Weight>::GetEdgeTo(EdgeId edge_id) const {
+        return edge_id < graph_.GetEdgeCount() ? graph_.GetEdge(edge_id).to : hierarchy_.shortcuts[edge_id - graph_.GetEdgeCount()].to;
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyRouter<Weight>::UnpackEdge(EdgeId edge_id, std::vector<EdgeId>& edges) const {
+        std::vector<EdgeId> stack{edge_id};
+        while (!stack.empty()) {
+            const EdgeId current_edge_id = stack.back();
+            stack.pop_back();
+            if (current_edge_id < graph_.GetEdgeCount()) {
+                edges.push_back(current_edge_id);
+            } else {
+                const auto& shortcut = hierarchy_.shortcuts[current_edge_id - graph_.GetEdgeCount()];
+                stack.push_back(shortcut.second_edge);
+                stack.push_back(shortcut.first_edge);
+            }
+        }
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyRouter<Weight>::SearchDirection::Prepare(size_t vertex_count) {
+        if (weights.size() < vertex_count) {
+            weights.resize(vertex_count, INFINITE_WEIGHT);
+            prev_edges.resize(vertex_count, NONE_EDGE);
+        }
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyRouter<Weight>::SearchDirection::Reset() {
+        for (const VertexId vertex : touched) {
+            weights[vertex] = INFINITE_WEIGHT;
+            prev_edges[vertex] = NONE_EDGE;
+        }
+        touched.clear();
+        queue.clear();
+    }
+
+    template <typename Weight>
+    void ContractionHierarchyRouter<Weight>::SearchDirection::Push(VertexId vertex, Weight weight, EdgeId prev_edge) {
+        if (weights[vertex] == INFINITE_WEIGHT) {
+            touched.push_back(vertex);
+        }
+        weights[vertex] = weight;
+        prev_edges[vertex] = prev_edge;
+        queue.push_back({weight, vertex});
+        std::push_heap(queue.begin(), queue.end(), std::greater<QueueItem>{});
+    }
+
+    template <typename Weight>
+    bool ContractionHierarchyRouter<Weight>::Step(
+        SearchDirection& direction, const SearchGraph& search_graph, const SearchDirection& opposite_direction, Weight& best_weight,
+        VertexId& meeting_vertex) const {
+        std::pop_heap(direction.queue.begin(), direction.queue.end(), std::greater<QueueItem>{});
+        const QueueItem item = direction.queue.back();
+        direction.queue.pop_back();
+        if (item.weight > direction.weights[item.vertex]) {
+            return false;
+        }
+
+        const Weight opposite_weight = opposite_direction.weights[item.vertex];
+        if (opposite_weight != INFINITE_WEIGHT && item.weight + opposite_weight < best_weight) {
+            best_weight = item.weight + opposite_weight;
+            meeting_vertex = item.vertex;
+        }
+
+        for (size_t i = search_graph.offsets[item.vertex]; i < search_graph.offsets[item.vertex + 1]; ++i) {
+            const Weight candidate_weight = item.weight + search_graph.weights[i];
+            if (candidate_weight < direction.weights[search_graph.vertices[i]]) {
+                direction.Push(search_graph.vertices[i], candidate_weight, search_graph.edge_ids[i]);
+            }
+        }
+        return true;
+    }
+
+    template <typename Weight>
+    typename ContractionHierarchyRouter<Weight>::SearchStats ContractionHierarchyRouter<Weight>::GetSearchStats() const {
+        return {queries_count_.load(std::memory_order_relaxed), settled_vertices_count_.load(std::memory_order_relaxed)};
+    }
+
+    template <typename Weight>
+    std::optional<typename ContractionHierarchyRouter<Weight>::RouteInfo> ContractionHierarchyRouter<Weight>::BuildRoute(
+        VertexId from, VertexId to) const {
+        const size_t vertex_count = graph_.GetVertexCount();
+        if (from >= vertex_count || to >= vertex_count) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+
+        SearchScratch& scratch = GetScratch();
+        scratch.forward.Prepare(vertex_count);
+        scratch.backward.Prepare(vertex_count);
+        scratch.forward.Push(from, ZERO_WEIGHT, NONE_EDGE);
+        scratch.backward.Push(to, ZERO_WEIGHT, NONE_EDGE);
+
+        Weight best_weight = INFINITE_WEIGHT;
+        VertexId meeting_vertex = vertex_count;
+        size_t settled_count = 0;
+        // A direction stops when its nearest vertex is not closer than the best route found
+        const auto is_active = [&best_weight](const SearchDirection& direction) {
+            return !direction.queue.empty() && direction.queue.front().weight < best_weight;
+        };
+        for (bool is_forward_turn = true; is_active(scratch.forward) || is_active(scratch.backward); is_forward_turn = !is_forward_turn) {
+            if (is_forward_turn ? !is_active(scratch.forward) : !is_active(scratch.backward)) {
+                continue;
+            }
+            const bool is_settled = is_forward_turn ? Step(scratch.forward, forward_graph_, scratch.backward, best_weight, meeting_vertex)
+                                                    : Step(scratch.backward, backward_graph_, scratch.forward, best_weight, meeting_vertex);
+            settled_count += is_settled ? 1 : 0;
+        }
+        queries_count_.fetch_add(1, std::memory_order_relaxed);
+        settled_vertices_count_.fetch_add(settled_count, std::memory_order_relaxed);
+
+        std::optional<RouteInfo> result;
+        if (meeting_vertex != vertex_count) {
+            std::vector<EdgeId> hierarchy_edges;
+            for (EdgeId edge_id = scratch.forward.prev_edges[meeting_vertex]; edge_id != NONE_EDGE;
+                 edge_id = scratch.forward.prev_edges[GetEdgeFrom(edge_id)]) {
+                hierarchy_edges.push_back(edge_id);
+            }
+            std::reverse(hierarchy_edges.begin(), hierarchy_edges.end());
+            for (EdgeId edge_id = scratch.backward.prev_edges[meeting_vertex]; edge_id != NONE_EDGE;
+                 edge_id = scratch.backward.prev_edges[GetEdgeTo(edge_id)]) {
+                hierarchy_edges.push_back(edge_id);
+            }
+
+            result = UnpackRoute(hierarchy_edges);
+        }
+
+        scratch.forward.Reset();
+        scratch.backward.Reset();
+        return result;
+    }
+
+    template <typename Weight>
+    typename ContractionHierarchyRouter<Weight>::RouteInfo ContractionHierarchyRouter<Weight>::UnpackRoute(
+        const std::vector<EdgeId>& hierarchy_edges) const {
+        RouteInfo route{ZERO_WEIGHT, {}};
+        for (const EdgeId edge_id : hierarchy_edges) {
+            UnpackEdge(edge_id, route.edges);
+        }
+        for (const EdgeId edge_id : route.edges) {
+            route.weight += graph_.GetEdge(edge_id).weight;
+        }
+        return route;
+    }
+
+    template <typename Weight>
+    template <typename OnSettled>
+    size_t ContractionHierarchyRouter<Weight>::SearchAll(
+        SearchDirection& direction, const SearchGraph& search_graph, VertexId start, OnSettled&& on_settled) const {
+        size_t settled_count = 0;
+        direction.Push(start, ZERO_WEIGHT, NONE_EDGE);
+        while (!direction.queue.empty()) {
+            std::pop_heap(direction.queue.begin(), direction.queue.end(), std::greater<QueueItem>{});
+            const QueueItem item = direction.queue.back();
+            direction.queue.pop_back();
+            if (item.weight > direction.weights[item.vertex]) {
+                continue;
+            }
+            ++settled_count;
+            on_settled(item.vertex, item.weight);
+
+            for (size_t i = search_graph.offsets[item.vertex]; i < search_graph.offsets[item.vertex + 1]; ++i) {
+                const Weight candidate_weight = item.weight + search_graph.weights[i];
+                if (candidate_weight < direction.weights[search_graph.vertices[i]]) {
+                    direction.Push(search_graph.vertices[i], candidate_weight, search_graph.edge_ids[i]);
+                }
+            }
+        }
+        return settled_count;
+    }
+
+    template <typename Weight>
+    std::vector<std::optional<typename ContractionHierarchyRouter<Weight>::RouteInfo>> ContractionHierarchyRouter<Weight>::BuildRoutes(
+        const std::vector<VertexId>& sources, const std::vector<VertexId>& targets) const {
+        const size_t vertex_count = graph_.GetVertexCount();
+        const auto is_valid_vertex = [vertex_count](VertexId vertex) {
+            return vertex < vertex_count;
+        };
+        if (!std::all_of(sources.begin(), sources.end(), is_valid_vertex) || !std::all_of(targets.begin(), targets.end(), is_valid_vertex)) {
+            throw std::out_of_range("Vertex id is out of range");
+        }
+
+        SearchScratch& scratch = GetScratch();
+        scratch.forward.Prepare(vertex_count);
+        scratch.backward.Prepare(vertex_count);
+        size_t settled_count = 0;
+
+        std::vector<BucketItem> buckets;
+        for (size_t target_index = 0; target_index < targets.size(); ++target_index) {
+            settled_count += SearchAll(scratch.backward, backward_graph_, targets[target_index], [&](VertexId vertex, Weight weight) {
+                buckets.push_back({vertex, target_index, weight, scratch.backward.prev_edges[vertex]});
+            });
+            scratch.backward.Reset();
+        }
+        std::sort(buckets.begin(), buckets.end());
+        std::vector<size_t> bucket_offsets(vertex_count + 1, 0);
+        for (const BucketItem& item : buckets) {
+            ++bucket_offsets[item.vertex + 1];
+        }
+        std::partial_sum(bucket_offsets.begin(), bucket_offsets.end(), bucket_offsets.begin());
+        const auto find_bucket_item = [&buckets, &bucket_offsets](VertexId vertex, size_t target_index) {
+            return std::lower_bound(
+                buckets.begin() + bucket_offsets[vertex], buckets.begin() + bucket_offsets[vertex + 1],
+                BucketItem{vertex, target_index, {}, NONE_EDGE});
+        };
+
+        std::vector<std::optional<RouteInfo>> routes;
+        routes.reserve(sources.size() * targets.size());
+        std::vector<Weight> best_weights(targets.size());
+        std::vector<VertexId> meeting_vertices(targets.size());
+        std::vector<EdgeId> hierarchy_edges;
+        for (const VertexId from : sources) {
+            std::fill(best_weights.begin(), best_weights.end(), INFINITE_WEIGHT);
+            std::fill(meeting_vertices.begin(), meeting_vertices.end(), vertex_count);
+            settled_count += SearchAll(scratch.forward, forward_graph_, from, [&](VertexId vertex, Weight weight) {
+                for (size_t i = bucket_offsets[vertex]; i < bucket_offsets[vertex + 1]; ++i) {
+                    const BucketItem& item = buckets[i];
+                    if (weight + item.weight < best_weights[item.target_index]) {
+                        best_weights[item.target_index] = weight + item.weight;
+                        meeting_vertices[item.target_index] = vertex;
+                    }
+                }
+            });
+
+            for (size_t target_index = 0; target_index < targets.size(); ++target_index) {
+                const VertexId meeting_vertex = meeting_vertices[target_index];
+                if (meeting_vertex == vertex_count) {
+                    routes.emplace_back(std::nullopt);
+                    continue;
+                }
+                hierarchy_edges.clear();
+                for (EdgeId edge_id = scratch.forward.prev_edges[meeting_vertex]; edge_id != NONE_EDGE;
+                     edge_id = scratch.forward.prev_edges[GetEdgeFrom(edge_id)]) {
+                    hierarchy_edges.push_back(edge_id);
+                }
+                std::reverse(hierarchy_edges.begin(), hierarchy_edges.end());
+                for (EdgeId edge_id = find_bucket_item(meeting_vertex, target_index)->next_edge; edge_id != NONE_EDGE;
+                     edge_id = find_bucket_item(GetEdgeTo(edge_id), target_index)->next_edge) {
+                    hierarchy_edges.push_back(edge_id);
+                }
+                routes.emplace_back(UnpackRoute(hierarchy_edges));
+            }
+            scratch.forward.Reset();
+        }
+
+        queries_count_.fetch_add(sources.size() + targets.size(), std::memory_order_relaxed);
+        settled_vertices_count_.fetch_add(settled_count, std::memory_order_relaxed);
+        return routes;
+    }
+}
@@ -4,7 +4,11 @@
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <iostream>
 #include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <string_view>
 #include <unordered_map>
 #include <variant>
@@ -39,7 +43,7 @@ namespace transport_catalogue::serialization /* DataConvertor implementation */
         bus_model.set_name(bus->name);
         bus_model.set_is_roundtrip(bus->is_roundtrip);
         std::for_each(bus->route.begin(), bus->route.end(), [&](data::StopRecord stop) {
-            bus_model.add_route(stop->name);
+            bus_model.add_route(stop->id);
         });
 
         return bus_model;
@@ -60,12 +64,27 @@ namespace transport_catalogue::serialization /* DataConvertor implementation */
     template <>
     auto DataConverter::ConvertToModel(DistanceBetweenStopsItem&& distance_item) const {
         DistancesBetweenStopsModel distance_item_model;
-        distance_item_model.set_from_stop(distance_item.from_stop->name);
-        distance_item_model.set_to_stop(distance_item.to_stop->name);
+        distance_item_model.set_from_stop(distance_item.from_stop->id);
+        distance_item_model.set_to_stop(distance_item.to_stop->id);
         distance_item_model.set_distance(distance_item.distance_between);
         return distance_item_model;
     }
 
+    template <>
+    auto DataConverter::ConvertToModel(const data::BusStat& bus_stat) const {
+        BusStatModel bus_stat_model;
+        bus_stat_model.set_total_stops(static_cast<uint32_t>(bus_stat.total_stops));
+        bus_stat_model.set_unique_stops(static_cast<uint32_t>(bus_stat.unique_stops));
+        bus_stat_model.set_route_length(bus_stat.route_length);
+        bus_stat_model.set_route_curvature(bus_stat.route_curvature);
+        return bus_stat_model;
+    }
+
+    template <>
+    auto DataConverter::ConvertFromModel(BusStatModel&& bus_stat_model) const {
+        return data::BusStat{bus_stat_model.total_stops(), bus_stat_model.unique_stops(), bus_stat_model.route_length(), bus_stat_model.route_curvature()};
+    }
+
     template <>
     auto DataConverter::ConvertToModel(const maps::Offset& offset) const {
         proto_schema::maps::Offset offset_model;
@@ -217,6 +236,10 @@ namespace transport_catalogue::serialization /* DataConvertor implementation */
         RoutingSettingsModel settings_model;
         settings_model.set_bus_velocity_kmh(settings.bus_velocity_kmh);
         settings_model.set_bus_wait_time_min(settings.bus_wait_time_min);
+        settings_model.set_router_type(static_cast<proto_schema::router::RouterType>(settings.router_type));
+        settings_model.set_collapse_parallel_edges(settings.collapse_parallel_edges);
+        settings_model.set_route_cache_capacity(settings.route_cache_capacity);
+        settings_model.set_vertex_order(static_cast<proto_schema::router::VertexOrder>(settings.vertex_order));
         return settings_model;
     }
 
@@ -225,6 +248,10 @@ namespace transport_catalogue::serialization /* DataConvertor implementation */
         router::RoutingSettings settings;
         settings.bus_velocity_kmh = settings_model.bus_velocity_kmh();
         settings.bus_wait_time_min = settings_model.bus_wait_time_min();
+        settings.router_type = static_cast<router::RouterType>(settings_model.router_type());
+        settings.collapse_parallel_edges = settings_model.collapse_parallel_edges();
+        settings.route_cache_capacity = static_cast<size_t>(settings_model.route_cache_capacity());
+        settings.vertex_order = static_cast<router::VertexOrder>(settings_model.vertex_order());
         return settings;
     }
 
@@ -281,36 +308,172 @@ namespace transport_catalogue::serialization /* DataConvertor implementation */
     }
 
     template <>
-    auto DataConverter::ConvertToModel(const router::RoutingItemInfo& route_item) const {
-        proto_schema::router::RoutingItemInfo route_item_model;
-        route_item_model.set_bus_name(std::string(route_item.bus_name));
-        route_item_model.set_stop_name(std::string(route_item.stop_name));
-        route_item_model.set_travel_items_count(route_item.travel_items_count);
-        route_item_model.set_bus_travel_time(route_item.bus_travel_time);
-        route_item_model.set_bus_wait_time_min(route_item.bus_wait_time_min);
+    auto DataConverter::ConvertToModel(const router::RoutingItems& routing_items) const {
+        RoutingItemsModel routing_items_model;
+        const auto copy_column = [](const auto& column, auto* column_model) {
+            column_model->Reserve(static_cast<int>(column.size()));
+            column_model->Add(column.begin(), column.end());
+        };
+        copy_column(routing_items.GetBusIds(), routing_items_model.mutable_bus_ids());
+        copy_column(routing_items.GetStopIds(), routing_items_model.mutable_stop_ids());
+        copy_column(routing_items.GetSpanCounts(), routing_items_model.mutable_span_counts());
+        copy_column(routing_items.GetTravelTimes(), routing_items_model.mutable_travel_times());
+        copy_column(routing_items.GetDistances(), routing_items_model.mutable_distances());
 
-        return route_item_model;
+        return routing_items_model;
     }
 
     template <>
-    auto DataConverter::ConvertFromModel(RoutingItemModel&& route_item_model, const data::ITransportDataReader& db_reader) const {
-        router::RoutingItemInfo route_item;
-        route_item.bus_name = db_reader.GetBus(route_item_model.bus_name())->name;
-        route_item.stop_name = db_reader.GetStop(route_item_model.stop_name())->name;
-        route_item.travel_items_count = route_item_model.travel_items_count();
-        route_item.bus_travel_time = route_item_model.bus_travel_time();
-        route_item.bus_wait_time_min = route_item_model.bus_wait_time_min();
+    auto DataConverter::ConvertFromModel(RoutingItemsModel&& routing_items_model, const data::ITransportDataReader& db_reader) const {
+        const int size = routing_items_model.bus_ids_size();
+        if (routing_items_model.stop_ids_size() != size || routing_items_model.span_counts_size() != size ||
+            routing_items_model.travel_times_size() != size || routing_items_model.distances_size() != size) {
+            throw std::invalid_argument("Routing items columns have different sizes");
+        }
+
+        const size_t stops_count = db_reader.GetStopsTable().size();
+        const size_t buses_count = db_reader.GetBusRoutesTable().size();
+        router::RoutingItems routing_items;
+        routing_items.Reserve(static_cast<size_t>(size));
+        for (int i = 0; i < size; ++i) {
+            router::RoutingItem item{
+                routing_items_model.bus_ids(i), routing_items_model.stop_ids(i), routing_items_model.span_counts(i),
+                routing_items_model.travel_times(i), routing_items_model.distances(i)};
+            if (item.bus_id >= buses_count || item.stop_id >= stops_count) {
+                throw std::invalid_argument("Routing item refers to an unknown bus or stop");
+            }
+            routing_items.PushBack(item);
+        }
+        return routing_items;
+    }
 
-        return route_item;
+    /// Every cell takes a float weight and a varint prev edge of at most 5 bytes, the message must fit into the protobuf size limit
+    bool IsStorableRoutesTable(size_t vertex_count) {
+        const size_t max_cells_count = static_cast<size_t>(std::numeric_limits<int>::max()) / (sizeof(float) + 5);
+        return vertex_count * vertex_count <= max_cells_count;
     }
 
     template <>
-    auto DataConverter::ConvertFromModel(RoutingItemsModel&& route_items_model, const data::ITransportDataReader& db_reader) const {
-        router::RoutingIncidentEdges route_items;
-        for (int i = 0; i < route_items_model.size(); ++i) {
-            route_items.emplace(i, ConvertFromModel<RoutingItemModel, const data::ITransportDataReader&>(std::move(route_items_model[i]), db_reader));
+    auto DataConverter::ConvertToModel(const router::RoutesInternalData& routes_data) const {
+        RouterStateModel state_model;
+        const size_t vertex_count = routes_data.GetVertexCount();
+        const size_t cells_count = vertex_count * vertex_count;
+        if (!IsStorableRoutesTable(vertex_count)) {
+            throw std::length_error(
+                "All-pairs routes table of " + std::to_string(vertex_count) + " vertices is too big to be stored in the database, use another router type");
         }
-        return route_items;
+        state_model.set_vertex_count(static_cast<uint32_t>(vertex_count));
+        state_model.mutable_weights()->Reserve(static_cast<int>(cells_count));
+        state_model.mutable_prev_edges()->Reserve(static_cast<int>(cells_count));
+
+        for (graph::VertexId from = 0; from < vertex_count; ++from) {
+            for (graph::VertexId to = 0; to < vertex_count; ++to) {
+                const bool has_route = routes_data.HasRoute(from, to);
+                const std::optional<graph::EdgeId> prev_edge = has_route ? routes_data.GetPrevEdge(from, to) : std::nullopt;
+                state_model.add_weights(has_route ? routes_data.GetWeight(from, to) : std::numeric_limits<float>::infinity());
+                state_model.add_prev_edges(prev_edge.has_value() ? static_cast<uint32_t>(*prev_edge + 1) : 0);
+            }
+        }
+        return state_model;
+    }
+
+    template <>
+    auto DataConverter::ConvertFromModel(RouterStateModel&& state_model) const {
+        const size_t vertex_count = state_model.vertex_count();
+        if (static_cast<size_t>(state_model.weights_size()) != vertex_count * vertex_count ||
+            static_cast<size_t>(state_model.prev_edges_size()) != vertex_count * vertex_count) {
+            throw std::invalid_argument("Invalid router state model");
+        }
+
+        router::RoutesInternalData routes_data(vertex_count);
+        size_t idx = 0;
+        for (graph::VertexId from = 0; from < vertex_count; ++from) {
+            for (graph::VertexId to = 0; to < vertex_count; ++to, ++idx) {
+                const float weight = state_model.weights(static_cast<int>(idx));
+                if (weight == std::numeric_limits<float>::infinity()) {
+                    continue;
+                }
+                const uint32_t prev_edge = state_model.prev_edges(static_cast<int>(idx));
+                routes_data.SetRoute(from, to, weight, prev_edge == 0 ? std::nullopt : std::optional<graph::EdgeId>(prev_edge - 1));
+            }
+        }
+        return routes_data;
+    }
+}
+
+namespace transport_catalogue::serialization /* DataConverter (contraction hierarchy) implementation */ {
+
+    template <>
+    auto DataConverter::ConvertToModel(const router::RoutingHierarchy& hierarchy) const {
+        RoutingHierarchyModel hierarchy_model;
+        hierarchy_model.mutable_ranks()->Reserve(static_cast<int>(hierarchy.ranks.size()));
+        for (const graph::VertexId rank : hierarchy.ranks) {
+            hierarchy_model.add_ranks(static_cast<uint32_t>(rank));
+        }
+        hierarchy_model.mutable_shortcuts()->Reserve(static_cast<int>(hierarchy.shortcuts.size()));
+        for (const auto& shortcut : hierarchy.shortcuts) {
+            ShortcutModel& shortcut_model = *hierarchy_model.add_shortcuts();
+            shortcut_model.set_from(static_cast<uint32_t>(shortcut.from));
+            shortcut_model.set_to(static_cast<uint32_t>(shortcut.to));
+            shortcut_model.set_weight(shortcut.weight);
+            shortcut_model.set_first_edge(static_cast<uint32_t>(shortcut.first_edge));
+            shortcut_model.set_second_edge(static_cast<uint32_t>(shortcut.second_edge));
+        }
+        return hierarchy_model;
+    }
+
+    template <>
+    auto DataConverter::ConvertFromModel(RoutingHierarchyModel&& hierarchy_model) const {
+        router::RoutingHierarchy hierarchy;
+        hierarchy.ranks.assign(hierarchy_model.ranks().begin(), hierarchy_model.ranks().end());
+        hierarchy.shortcuts.reserve(hierarchy_model.shortcuts_size());
+        for (const ShortcutModel& shortcut_model : hierarchy_model.shortcuts()) {
+            hierarchy.shortcuts.push_back(
+                {shortcut_model.from(), shortcut_model.to(), shortcut_model.weight(), shortcut_model.first_edge(), shortcut_model.second_edge()});
+        }
+        return hierarchy;
+    }
+}
+
+namespace transport_catalogue::serialization /* DataConverter (landmark tables) implementation */ {
+
+    template <>
+    auto DataConverter::ConvertToModel(const router::RoutingLandmarks& landmarks) const {
+        RoutingLandmarksModel landmarks_model;
+        for (const graph::VertexId landmark : landmarks.landmarks) {
+            landmarks_model.add_landmarks(static_cast<uint32_t>(landmark));
+        }
+        landmarks_model.mutable_from_landmarks()->Add(landmarks.from_landmarks.begin(), landmarks.from_landmarks.end());
+        landmarks_model.mutable_to_landmarks()->Add(landmarks.to_landmarks.begin(), landmarks.to_landmarks.end());
+        return landmarks_model;
+    }
+
+    template <>
+    auto DataConverter::ConvertFromModel(RoutingLandmarksModel&& landmarks_model) const {
+        router::RoutingLandmarks landmarks;
+        landmarks.landmarks.assign(landmarks_model.landmarks().begin(), landmarks_model.landmarks().end());
+        landmarks.from_landmarks.assign(landmarks_model.from_landmarks().begin(), landmarks_model.from_landmarks().end());
+        landmarks.to_landmarks.assign(landmarks_model.to_landmarks().begin(), landmarks_model.to_landmarks().end());
+        return landmarks;
+    }
+}
+
+namespace transport_catalogue::serialization /* DataConverter (reachability index) implementation */ {
+
+    template <>
+    auto DataConverter::ConvertToModel(const router::RoutingReachability& reachability) const {
+        RoutingReachabilityModel reachability_model;
+        reachability_model.mutable_components()->Add(reachability.components.begin(), reachability.components.end());
+        reachability_model.mutable_weak_components()->Add(reachability.weak_components.begin(), reachability.weak_components.end());
+        return reachability_model;
+    }
+
+    template <>
+    auto DataConverter::ConvertFromModel(RoutingReachabilityModel&& reachability_model) const {
+        router::RoutingReachability reachability;
+        reachability.components.assign(reachability_model.components().begin(), reachability_model.components().end());
+        reachability.weak_components.assign(reachability_model.weak_components().begin(), reachability_model.weak_components().end());
+        return reachability;
     }
 }
 
@@ -332,9 +495,11 @@ namespace transport_catalogue::serialization /* Store (serialize) implementation
 
     void Store::PrepareDistances(TransportDataModel& container) const {
         const data::DatabaseScheme::DistanceBetweenStopsTable& distances = db_reader_.GetDataReader().GetDistancesBetweenStops();
-        std::for_each(distances.begin(), distances.end(), [&](const data::DatabaseScheme::DistanceBetweenStopsTable::value_type& dist_item) {
-            *container.add_distances() = converter_.ConvertToModel(
-                DistanceBetweenStopsItem(dist_item.first.first, dist_item.first.second, dist_item.second.measured_distance));
+        const data::DatabaseScheme::StopsTable& stops = db_reader_.GetDataReader().GetStopsTable();
+        container.mutable_distances()->Reserve(static_cast<int>(distances.Size()));
+        distances.ForEach([&](data::StopId from_id, data::StopId to_id, const data::DistanceBetweenStopsRecord& distance) {
+            *container.add_distances() =
+                converter_.ConvertToModel(DistanceBetweenStopsItem(&stops[from_id], &stops[to_id], distance.measured_distance));
         });
     }
 
@@ -346,6 +511,28 @@ namespace transport_catalogue::serialization /* Store (serialize) implementation
         return data;
     }
 
+    StatsModel Store::BuildSerializableStats() const {
+        StatsModel stats_model;
+        const data::ITransportDataReader& db_reader = db_reader_.GetDataReader();
+        const data::DatabaseScheme::BusStatsView& bus_stats = db_reader.GetBusStatsView();
+        const data::DatabaseScheme::StopStatsView& stop_stats = db_reader.GetStopStatsView();
+        if (bus_stats.size() != db_reader.GetBusRoutesTable().size() || stop_stats.size() != db_reader.GetStopsTable().size()) {
+            return stats_model;
+        }
+
+        std::for_each(bus_stats.begin(), bus_stats.end(), [&](const data::BusStat& bus_stat) {
+            *stats_model.add_bus_stats() = converter_.ConvertToModel(bus_stat);
+        });
+        for (data::StopId stop_id = 0; stop_id < stop_stats.size(); ++stop_id) {
+            const data::StopStat stop_stat = stop_stats[stop_id];
+            StopStatModel& stop_stat_model = *stats_model.add_stop_stats();
+            std::for_each(stop_stat.buses.begin(), stop_stat.buses.end(), [&](const data::BusRecord bus) {
+                stop_stat_model.add_buses(bus->id);
+            });
+        }
+        return stats_model;
+    }
+
     void Store::PrepareRenderSettings(SettingsModel& settings) const {
         *settings.mutable_render_settings() = converter_.ConvertToModel(map_renderer_.GetRenderSettings());
     }
@@ -366,10 +553,48 @@ namespace transport_catalogue::serialization /* Store (serialize) implementation
     }
 
     void Store::PrepareRouterModel(RouterModel& router_model) const {
-        for (size_t i = 0; i < transport_router_.GetGraph().GetEdgeCount(); ++i) {  //! need edit
-            const router::RoutingItemInfo& route_item = transport_router_.GetRoutingItem(i);
-            proto_schema::router::RoutingItemInfo route_item_model = converter_.ConvertToModel(route_item);
-            *router_model.add_routing_items() = std::move(route_item_model);
+        *router_model.mutable_routing_items() = converter_.ConvertToModel(transport_router_.GetRoutingItems());
+        if (transport_router_.GetSettings().vertex_order != router::VertexOrder::STOPS_TABLE) {
+            const router::VertexIds& vertex_ids = transport_router_.GetVertexIds();
+            router_model.mutable_vertex_ids()->Reserve(static_cast<int>(vertex_ids.size()));
+            for (const graph::VertexId vertex : vertex_ids) {
+                router_model.add_vertex_ids(static_cast<uint32_t>(vertex));
+            }
+        }
+    }
+
+    void Store::PrepareRouterStateModel(RouterModel& router_model) const {
+        const router::RoutesInternalData* routes_data = transport_router_.GetRoutesInternalData();
+        if (routes_data == nullptr) {
+            return;
+        }
+        // The state section is optional, process_requests rebuilds the router without it
+        if (!IsStorableRoutesTable(routes_data->GetVertexCount())) {
+            std::cerr << "All-pairs routes table of " << routes_data->GetVertexCount()
+                      << " vertices is too big to be stored in the database, the router is rebuilt on loading" << std::endl;
+            return;
+        }
+        *router_model.mutable_state() = converter_.ConvertToModel(*routes_data);
+    }
+
+    void Store::PrepareRoutingHierarchyModel(RouterModel& router_model) const {
+        const router::RoutingHierarchy* hierarchy = transport_router_.GetRoutingHierarchy();
+        if (hierarchy != nullptr) {
+            *router_model.mutable_hierarchy() = converter_.ConvertToModel(*hierarchy);
+        }
+    }
+
+    void Store::PrepareRoutingLandmarksModel(RouterModel& router_model) const {
+        const router::RoutingLandmarks* landmarks = transport_router_.GetRoutingLandmarks();
+        if (landmarks != nullptr) {
+            *router_model.mutable_landmarks() = converter_.ConvertToModel(*landmarks);
+        }
+    }
+
+    void Store::PrepareRoutingReachabilityModel(RouterModel& router_model) const {
+        const router::RoutingReachability* reachability = transport_router_.GetRoutingReachability();
+        if (reachability != nullptr) {
+            *router_model.mutable_reachability() = converter_.ConvertToModel(*reachability);
         }
     }
 
@@ -377,6 +602,10 @@ namespace transport_catalogue::serialization /* Store (serialize) implementation
         RouterModel router_model;
         PrepareGraphModel(router_model);
         PrepareRouterModel(router_model);
+        PrepareRouterStateModel(router_model);
+        PrepareRoutingHierarchyModel(router_model);
+        PrepareRoutingLandmarksModel(router_model);
+        PrepareRoutingReachabilityModel(router_model);
 
         return router_model;
     }
@@ -392,6 +621,7 @@ namespace transport_catalogue::serialization /* Store (serialize) implementation
         *database_model.mutable_transport_data() = BuildSerializableTransportData();
         *database_model.mutable_settings() = BuildSerializableSettings();
         *database_model.mutable_router() = BuildSerializableRouterModel();
+        *database_model.mutable_stats() = BuildSerializableStats();
 
         const bool success = database_model.SerializeToOstream(&out);
         assert(success);
@@ -403,6 +633,13 @@ namespace transport_catalogue::serialization /* Store (serialize) implementation
 namespace transport_catalogue::serialization /* Store (deserialize) implementation */ {
 
     void Store::FillTransportData(TransportDataModel&& data) const {
+        // Stop ids of the model are the indexes of the stops in the model, the stops are appended to the stops table
+        const data::DatabaseScheme::StopsTable& stops_table = db_reader_.GetDataReader().GetStopsTable();
+        const size_t first_stop_id = stops_table.size();
+        const auto get_stop_name = [&stops_table, first_stop_id](uint32_t stop_id) -> std::string_view {
+            return stops_table.at(first_stop_id + stop_id).name;
+        };
+
         auto stops = std::move(*data.mutable_stops());
         std::for_each(std::move_iterator(stops.begin()), std::move_iterator(stops.end()), [&](StopModel&& stop) {
             db_writer_.AddStop(std::move(*stop.mutable_name()), {stop.coordinates().lat(), stop.coordinates().lng()});
@@ -410,22 +647,46 @@ namespace transport_catalogue::serialization /* Store (deserialize) implementati
 
         auto distances = std::move(*data.mutable_distances());
         std::for_each(std::move_iterator(distances.begin()), std::move_iterator(distances.end()), [&](DistancesBetweenStopsModel&& dist_item) {
-            db_writer_.SetMeasuredDistance(
-                data::MeasuredRoadDistance(std::move(*dist_item.mutable_from_stop()), std::move(*dist_item.mutable_to_stop()), dist_item.distance()));
+            db_writer_.SetMeasuredDistance(get_stop_name(dist_item.from_stop()), get_stop_name(dist_item.to_stop()), dist_item.distance());
         });
 
         auto buses = std::move(*data.mutable_buses());
         std::for_each(std::move_iterator(buses.begin()), std::move_iterator(buses.end()), [&](BusModel&& bus) {
             std::string name = std::move(*bus.mutable_name());
             bool is_roundtrip = bus.is_roundtrip();
-            std::vector<std::string> stops(bus.route_size());
-            std::transform(
-                std::move_iterator(bus.mutable_route()->begin()), std::move_iterator(bus.mutable_route()->end()), stops.begin(),
-                [](std::string&& name) {
-                    return std::move(name);
-                });
-            db_writer_.AddBus(std::move(name), std::move(stops), is_roundtrip);
+            std::vector<std::string_view> stops(bus.route_size());
+            std::transform(bus.route().begin(), bus.route().end(), stops.begin(), get_stop_name);
+            db_writer_.AddBus(std::move(name), stops, is_roundtrip);
+        });
+    }
+
+    void Store::FillStats(StatsModel&& stats_model) const {
+        const data::ITransportDataReader& db_reader = db_reader_.GetDataReader();
+        const data::DatabaseScheme::BusRoutesTable& buses = db_reader.GetBusRoutesTable();
+        // The stats are not built, or the database is loaded over other data and the stats ids do not match the tables
+        if (static_cast<size_t>(stats_model.bus_stats_size()) != buses.size() ||
+            static_cast<size_t>(stats_model.stop_stats_size()) != db_reader.GetStopsTable().size()) {
+            return;
+        }
+
+        data::DatabaseScheme::BusStatsView bus_stats;
+        bus_stats.reserve(buses.size());
+        std::for_each(std::move_iterator(stats_model.mutable_bus_stats()->begin()), std::move_iterator(stats_model.mutable_bus_stats()->end()),
+                      [&](BusStatModel&& bus_stat_model) {
+                          bus_stats.push_back(converter_.ConvertFromModel(std::move(bus_stat_model)));
+                      });
+
+        data::DatabaseScheme::StopStatsView stop_stats;
+        std::vector<data::BusRecord> stop_buses;
+        std::for_each(stats_model.stop_stats().begin(), stats_model.stop_stats().end(), [&](const StopStatModel& stop_stat_model) {
+            stop_buses.resize(stop_stat_model.buses_size());
+            std::transform(stop_stat_model.buses().begin(), stop_stat_model.buses().end(), stop_buses.begin(), [&buses](uint32_t bus_id) {
+                return &buses.at(bus_id);
+            });
+            stop_stats.PushBack(stop_buses);
         });
+
+        db_writer_.SetStats(std::move(bus_stats), std::move(stop_stats));
     }
 
     void Store::FillRenderSettings(RenderSettingsModel&& render_settings_model) const {
@@ -447,9 +708,29 @@ namespace transport_catalogue::serialization /* Store (deserialize) implementati
     void Store::FillRouter(RouterModel&& router_model) const {
         RoutingGraphModel graph_model = std::move(*router_model.mutable_graph());
         router::RoutingGraph graph = converter_.ConvertFromModel(std::move(graph_model));
-        transport_router_.SetGraph(
-            std::move(graph), converter_.ConvertFromModel<RoutingItemsModel, const data::ITransportDataReader&>(
-                                  std::move(*router_model.mutable_routing_items()), db_reader_.GetDataReader()));
+        router::RoutingItems routing_items = converter_.ConvertFromModel<RoutingItemsModel, const data::ITransportDataReader&>(
+            std::move(*router_model.mutable_routing_items()), db_reader_.GetDataReader());
+        if (routing_items.GetSize() != graph.GetEdgeCount()) {
+            throw std::invalid_argument("Routing items do not match the graph edges");
+        }
+        router::VertexIds vertex_ids(router_model.vertex_ids().begin(), router_model.vertex_ids().end());
+
+        if (router_model.has_state() && transport_router_.GetSettings().router_type == router::RouterType::ALL_PAIRS) {
+            RouterStateModel state_model = std::move(*router_model.mutable_state());
+            transport_router_.SetGraph(std::move(graph), std::move(routing_items), std::move(vertex_ids), converter_.ConvertFromModel(std::move(state_model)));
+        } else if (router_model.has_hierarchy() && transport_router_.GetSettings().router_type == router::RouterType::CONTRACTION_HIERARCHY) {
+            RoutingHierarchyModel hierarchy_model = std::move(*router_model.mutable_hierarchy());
+            transport_router_.SetGraph(std::move(graph), std::move(routing_items), std::move(vertex_ids), converter_.ConvertFromModel(std::move(hierarchy_model)));
+        } else if (router_model.has_landmarks() && transport_router_.GetSettings().router_type == router::RouterType::ALT) {
+            RoutingLandmarksModel landmarks_model = std::move(*router_model.mutable_landmarks());
+            transport_router_.SetGraph(std::move(graph), std::move(routing_items), std::move(vertex_ids), converter_.ConvertFromModel(std::move(landmarks_model)));
+        } else {
+            transport_router_.SetGraph(std::move(graph), std::move(routing_items), std::move(vertex_ids));
+        }
+
+        if (router_model.has_reachability()) {
+            transport_router_.SetRoutingReachability(converter_.ConvertFromModel(std::move(*router_model.mutable_reachability())));
+        }
     }
 
     bool Store::LoadDatabase() const {
@@ -469,6 +750,7 @@ namespace transport_catalogue::serialization /* Store (deserialize) implementati
         }
 
         FillTransportData(std::move(*db_model.mutable_transport_data()));
+        FillStats(std::move(*db_model.mutable_stats()));
         FillSettings(std::move(*db_model.mutable_settings()));
         FillRouter(std::move(*db_model.mutable_router()));
 
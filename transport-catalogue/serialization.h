@@ -26,6 +26,9 @@ namespace transport_catalogue::serialization /* Transport data model types alias
     using CoordinatesModel = proto_schema::transport::Coordinates;
     using DistancesBetweenStopsModel = proto_schema::transport::DistancesBetweenStops;
     using TransportDataModel = proto_schema::transport::TransportData;
+    using BusStatModel = proto_schema::transport::BusStat;
+    using StopStatModel = proto_schema::transport::StopStat;
+    using StatsModel = proto_schema::transport::Stats;
     struct DistanceBetweenStopsItem {
         DistanceBetweenStopsItem(data::StopRecord from_stop, data::StopRecord to_stop, double distance_between)
             : from_stop{from_stop}, to_stop{to_stop}, distance_between{distance_between} {}
@@ -45,9 +48,13 @@ namespace transport_catalogue::serialization /* Routings types aliases and defs
     using RoutingGraphModel = proto_schema::graph::RoutingGraph;
     using EdgeModel = proto_schema::graph::Edge;
     using IncidentEdgesModel = proto_schema::graph::IncidentEdges;
+    using ShortcutModel = proto_schema::graph::Shortcut;
+    using RoutingHierarchyModel = proto_schema::graph::ContractionHierarchy;
     using RouterModel = proto_schema::router::Router;
-    using RoutingItemModel = proto_schema::router::RoutingItemInfo;
-    using RoutingItemsModel = google::protobuf::RepeatedPtrField<RoutingItemModel>;
+    using RouterStateModel = proto_schema::router::RouterState;
+    using RoutingLandmarksModel = proto_schema::router::LandmarkTables;
+    using RoutingItemsModel = proto_schema::router::RoutingItems;
+    using RoutingReachabilityModel = proto_schema::router::ReachabilityIndex;
 }
 
 namespace transport_catalogue::serialization /* DataConvertor */ {
@@ -90,6 +97,8 @@ namespace transport_catalogue::serialization /* Store */ {
         void PrepareStops(TransportDataModel& data_model) const;
         void PrepareDistances(TransportDataModel& data_model) const;
         TransportDataModel BuildSerializableTransportData() const;
+        /// Materialized stats serialization, the stats are empty if they are not built
+        StatsModel BuildSerializableStats() const;
 
         /// App settings serialization
         void PrepareRenderSettings(SettingsModel& settings_model) const;
@@ -98,10 +107,15 @@ namespace transport_catalogue::serialization /* Store */ {
 
         void PrepareGraphModel(RouterModel& router_model) const;
         void PrepareRouterModel(RouterModel& router_model) const;
+        void PrepareRouterStateModel(RouterModel& router_model) const;
+        void PrepareRoutingHierarchyModel(RouterModel& router_model) const;
+        void PrepareRoutingLandmarksModel(RouterModel& router_model) const;
+        void PrepareRoutingReachabilityModel(RouterModel& router_model) const;
         RouterModel BuildSerializableRouterModel() const;
 
     private: /* deserialize methods */
         void FillTransportData(TransportDataModel&& data_model) const;
+        void FillStats(StatsModel&& stats_model) const;
         void FillRenderSettings(RenderSettingsModel&& render_settings_model) const;
         void FillRoutingSettings(RoutingSettingsModel&& routing_settings_model) const;
         void FillSettings(SettingsModel&& settings_model) const;
@@ -0,0 +1,726 @@
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../detail/min_plus.h"
+#include "../graph.h"
+#include "../router.h"
+
+namespace transport_catalogue::tests {
+
+    class GraphTester {
+    public:
+        using Graph = graph::DirectedWeightedGraph<double>;
+
+        static Graph MakeRandomGraph(size_t vertex_count, size_t edge_count, unsigned seed = 42) {
+            std::mt19937 generator(seed);
+            std::uniform_int_distribution<size_t> vertex_distribution(0, vertex_count - 1);
+            std::uniform_real_distribution<double> weight_distribution(1., 100.);
+
+            Graph graph(vertex_count);
+            for (size_t i = 0; i < edge_count; ++i) {
+                graph.AddEdge(Graph::EdgeType{vertex_distribution(generator), vertex_distribution(generator), weight_distribution(generator)});
+            }
+            return graph;
+        }
+
+        template <typename ExpectedRouter, typename TestedRouter>
+        static void CheckRoutersEqual(
+            const Graph& graph, const ExpectedRouter& expected_router, const TestedRouter& tested_router, double tolerance = 1e-9) {
+            for (graph::VertexId from = 0; from < graph.GetVertexCount(); ++from) {
+                for (graph::VertexId to = 0; to < graph.GetVertexCount(); ++to) {
+                    auto expected = expected_router.BuildRoute(from, to);
+                    auto tested = tested_router.BuildRoute(from, to);
+                    assert(expected.has_value() == tested.has_value());
+                    if (!expected.has_value()) {
+                        continue;
+                    }
+                    assert(std::abs(expected->weight - tested->weight) <= tolerance * std::max(1., expected->weight));
+
+                    [[maybe_unused]] double weight = 0.;
+                    [[maybe_unused]] graph::VertexId vertex = from;
+                    for (graph::EdgeId edge_id : tested->edges) {
+                        const auto& edge = graph.GetEdge(edge_id);
+                        assert(edge.from == vertex);
+                        weight += edge.weight;
+                        vertex = edge.to;
+                    }
+                    assert(vertex == to);
+                    assert(std::abs(weight - tested->weight) < 1e-9);
+                }
+            }
+        }
+
+        void TestFreeze() const {
+            Graph graph = MakeRandomGraph(50, 400);
+            std::vector<std::vector<graph::EdgeId>> incidence_lists;
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); ++vertex) {
+                [[maybe_unused]] auto range = graph.GetIncidentEdges(vertex);
+                incidence_lists.emplace_back(range.begin(), range.end());
+            }
+
+            graph.Freeze();
+            assert(graph.IsFrozen());
+            assert(graph.GetVertexCount() == 50 && graph.GetEdgeCount() == 400);
+
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); ++vertex) {
+                [[maybe_unused]] auto range = graph.GetIncidentEdges(vertex);
+                assert(std::equal(range.begin(), range.end(), incidence_lists[vertex].begin(), incidence_lists[vertex].end()));
+
+                auto arcs = graph.GetIncidentArcs(vertex);
+                assert(arcs.count == incidence_lists[vertex].size());
+                for (size_t i = 0; i < arcs.count; ++i) {
+                    [[maybe_unused]] const auto& edge = graph.GetEdge(arcs.edge_ids[i]);
+                    assert(edge.from == vertex && edge.to == arcs.targets[i] && edge.weight == arcs.weights[i]);
+                }
+            }
+
+            // Arc weights follow the edge weights
+            graph.SetEdgeWeight(5, 42.);
+            [[maybe_unused]] const auto arcs = graph.GetIncidentArcs(graph.GetEdge(5).from);
+            assert(arcs.weights[std::find(arcs.edge_ids, arcs.edge_ids + arcs.count, 5) - arcs.edge_ids] == 42.);
+
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                graph.AddEdge(Graph::EdgeType{0, 1, 1.});
+            } catch (const std::logic_error&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+
+            graph.Unfreeze();
+            assert(!graph.IsFrozen() && graph.GetVertexCount() == 50);
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); ++vertex) {
+                [[maybe_unused]] auto range = graph.GetIncidentEdges(vertex);
+                assert(std::equal(range.begin(), range.end(), incidence_lists[vertex].begin(), incidence_lists[vertex].end()));
+            }
+            [[maybe_unused]] const graph::EdgeId edge_id = graph.AddEdge(Graph::EdgeType{0, 1, 1.});
+            assert(edge_id == 400 && graph.GetIncidentEdges(0).end()[-1] == edge_id);
+        }
+
+        /// Check the all-pairs routes table updated in place against Dijkstra searches on the changed graph
+        void TestAllPairsUpdates() const {
+            using PackedRouter = graph::Router<double, graph::PackedRoutesStorage<float, uint32_t>>;
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{80, 300}, {300, 900}, {200, 4000}}) {
+                Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph.Freeze();
+                graph::Router<double> nested_router(graph);
+                PackedRouter packed_router(graph);
+
+                // New edges
+                const Graph new_edges = MakeRandomGraph(vertex_count, 30, 7);
+                std::vector<graph::EdgeId> added_edges;
+                graph.Unfreeze();
+                for (graph::EdgeId edge_id = 0; edge_id < new_edges.GetEdgeCount(); ++edge_id) {
+                    added_edges.push_back(graph.AddEdge(Graph::EdgeType{new_edges.GetEdge(edge_id)}));
+                }
+                graph.Freeze();
+                nested_router.RelaxEdges(added_edges);
+                packed_router.RelaxEdges(added_edges);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), nested_router);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), packed_router, 1e-6);
+
+                // As many new edges as vertices are relaxed by one pass over the whole table
+                const Graph many_new_edges = MakeRandomGraph(vertex_count, vertex_count * 2, 11);
+                added_edges.clear();
+                graph.Unfreeze();
+                for (graph::EdgeId edge_id = 0; edge_id < many_new_edges.GetEdgeCount(); ++edge_id) {
+                    Graph::EdgeType edge = many_new_edges.GetEdge(edge_id);
+                    edge.weight /= 4.;
+                    added_edges.push_back(graph.AddEdge(std::move(edge)));
+                }
+                graph.Freeze();
+                nested_router.RelaxEdges(added_edges);
+                packed_router.RelaxEdges(added_edges);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), nested_router);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), packed_router, 1e-6);
+
+                // Heavier and lighter edges
+                std::vector<graph::EdgeId> heavier_edges;
+                std::vector<graph::EdgeId> lighter_edges;
+                for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); edge_id += 7) {
+                    const double weight = graph.GetEdge(edge_id).weight;
+                    if (edge_id % 2 == 0) {
+                        graph.SetEdgeWeight(edge_id, weight * 3.);
+                        heavier_edges.push_back(edge_id);
+                    } else {
+                        graph.SetEdgeWeight(edge_id, weight / 3.);
+                        lighter_edges.push_back(edge_id);
+                    }
+                }
+                [[maybe_unused]] const size_t repaired_count = nested_router.RepairEdges(heavier_edges);
+                assert(repaired_count > 0 && repaired_count <= vertex_count);
+                nested_router.RelaxEdges(lighter_edges);
+                packed_router.RepairEdges(heavier_edges);
+                packed_router.RelaxEdges(lighter_edges);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), nested_router);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), packed_router, 1e-6);
+            }
+        }
+
+        /// Check the all-pairs routes table customized in place for new weights of all edges against Dijkstra searches
+        void TestAllPairsCustomizeWeights() const {
+            using PackedRouter = graph::Router<double, graph::PackedRoutesStorage<float, uint32_t>>;
+            for (const graph::AllPairsStrategy strategy : {graph::AllPairsStrategy::FLOYD_WARSHALL, graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES}) {
+                Graph graph = MakeRandomGraph(150, 900);
+                graph.Freeze();
+                graph::Router<double> nested_router(graph, strategy);
+                PackedRouter packed_router(graph, strategy);
+
+                // Weights linear in the settings as the transport ones: one boarding and a ride, both changed
+                std::mt19937 generator(7);
+                std::uniform_real_distribution<double> factor_distribution(0.1, 10.);
+                for (const double boarding_weight : {0., 30., 5.}) {
+                    std::vector<double> weights(graph.GetEdgeCount());
+                    for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                        weights[edge_id] = boarding_weight + graph.GetEdge(edge_id).weight * factor_distribution(generator);
+                    }
+                    graph.SetEdgeWeights(weights);
+                    nested_router.CustomizeWeights();
+                    packed_router.CustomizeWeights();
+                    CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), nested_router);
+                    CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), packed_router, 1e-6);
+                }
+
+                // A few changed edges are relaxed or repaired, the rest of the table is kept
+                for (const double factor : {3., 0.3}) {
+                    for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); edge_id += 61) {
+                        graph.SetEdgeWeight(edge_id, graph.GetEdge(edge_id).weight * (edge_id % 2 == 0 ? factor : 1. / factor));
+                    }
+                    nested_router.CustomizeWeights();
+                    packed_router.CustomizeWeights();
+                    CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), nested_router);
+                    CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), packed_router, 1e-6);
+                }
+            }
+
+            // Prev edges of an adopted table making a cycle are not followed, the row is relaxed from the single edges
+            Graph graph(3);
+            for (const auto& [from, to] : {std::pair<graph::VertexId, graph::VertexId>{0, 1}, {1, 2}, {2, 1}, {0, 2}, {2, 0}}) {
+                graph.AddEdge(Graph::EdgeType{from, to, 10.});
+            }
+            graph::Router<double>::RoutesInternalData routes_data(3);
+            for (graph::VertexId vertex = 0; vertex < 3; ++vertex) {
+                routes_data.SetRoute(vertex, vertex, 0., std::nullopt);
+            }
+            routes_data.SetRoute(0, 1, 10., 2);
+            routes_data.SetRoute(0, 2, 10., 1);
+            graph::Router<double> adopted_router(graph, std::move(routes_data));
+            graph.SetEdgeWeights({20., 1., 2., 3., 4.});
+            adopted_router.CustomizeWeights();
+            CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), adopted_router);
+        }
+
+        void TestHopLengthProfiles() const {
+            using PackedRouter = graph::Router<double, graph::PackedRoutesStorage<float, uint32_t>>;
+            Graph graph = MakeRandomGraph(150, 900);
+            graph.Freeze();
+            std::vector<double> lengths(graph.GetEdgeCount());
+            for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                lengths[edge_id] = graph.GetEdge(edge_id).weight;
+            }
+            const graph::HopLengthProfiles<double> profiles(graph, lengths);
+            assert(profiles.GetVertexCount() == graph.GetVertexCount() && profiles.GetProfilesSize() >= graph.GetVertexCount());
+
+            // The lightest route changes with the factors: more edges of a shorter length or fewer edges of a longer one
+            for (const auto& [hop_weight, length_factor] : {std::pair{0., 1.}, {300., 0.5}, {5., 3.}, {1e4, 1e-3}}) {
+                std::vector<double> weights(graph.GetEdgeCount());
+                std::transform(lengths.begin(), lengths.end(), weights.begin(), [hop_weight = hop_weight, length_factor = length_factor](double length) {
+                    return hop_weight + length_factor * length;
+                });
+                graph.SetEdgeWeights(weights);
+                const graph::Router<double> nested_router(graph, profiles.Customize<graph::Router<double>::RoutesInternalData>(hop_weight, length_factor));
+                const PackedRouter packed_router(graph, profiles.Customize<PackedRouter::RoutesInternalData>(hop_weight, length_factor));
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), nested_router);
+                CheckRoutersEqual(graph, graph::DijkstraRouter<double>(graph), packed_router, 1e-6);
+            }
+
+            // Routes of zero weight are chosen by the fewest edges, so the prev edges do not make a cycle
+            Graph zero_graph(3);
+            for (const auto& [from, to] : {std::pair<graph::VertexId, graph::VertexId>{0, 1}, {1, 2}, {2, 1}, {0, 2}}) {
+                zero_graph.AddEdge(Graph::EdgeType{from, to, 0.});
+            }
+            const graph::HopLengthProfiles<double> zero_profiles(zero_graph, {0., 0., 0., 0.});
+            const graph::Router<double> zero_router(zero_graph, zero_profiles.Customize<graph::Router<double>::RoutesInternalData>(0., 1.));
+            CheckRoutersEqual(zero_graph, graph::DijkstraRouter<double>(zero_graph), zero_router);
+            assert(zero_router.BuildRoute(0, 2)->edges.size() == 1);
+
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                [[maybe_unused]] const auto routes_data = profiles.Customize<graph::Router<double>::RoutesInternalData>(1., 0.);
+            } catch (const std::domain_error&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
+        void TestDijkstraRouter() const {
+            for (bool is_frozen : {false, true}) {
+                Graph graph = MakeRandomGraph(80, 300);
+                if (is_frozen) {
+                    graph.Freeze();
+                }
+                graph::Router<double> all_pairs_router(graph);
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+                CheckRoutersEqual(graph, all_pairs_router, dijkstra_router);
+            }
+        }
+
+        void TestPackedRoutesStorage() const {
+            using PackedRouter = graph::Router<double, graph::PackedRoutesStorage<float, uint32_t>>;
+
+            Graph graph = MakeRandomGraph(80, 300);
+            graph::Router<double> nested_router(graph);
+            PackedRouter packed_router(graph);
+            CheckRoutersEqual(graph, nested_router, packed_router, 1e-6);
+
+            PackedRouter::RoutesInternalData routes_data = packed_router.GetRoutesInternalData();
+            PackedRouter restored_router(graph, std::move(routes_data));
+            CheckRoutersEqual(graph, packed_router, restored_router);
+
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                PackedRouter invalid_router(graph, PackedRouter::RoutesInternalData(graph.GetVertexCount() + 1));
+            } catch (const std::invalid_argument&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
+        void TestBlockedFloydWarshall() const {
+            using Storage = graph::PackedRoutesStorage<float, uint32_t>;
+
+            // Integer weights keep float sums exact, so blocked and sequential tables should be equal
+            const Graph random_graph = MakeRandomGraph(3 * Storage::BLOCK_SIZE + 7, 3000);
+            Graph graph(random_graph.GetVertexCount());
+            for (graph::EdgeId edge_id = 0; edge_id < random_graph.GetEdgeCount(); ++edge_id) {
+                Graph::EdgeType edge = random_graph.GetEdge(edge_id);
+                edge.weight = std::round(edge.weight);
+                graph.AddEdge(edge);
+            }
+
+            graph::Router<double, Storage> blocked_router(graph, graph::AllPairsStrategy::FLOYD_WARSHALL);
+            [[maybe_unused]] const Storage& blocked_data = blocked_router.GetRoutesInternalData();
+
+            Storage sequential_data(graph.GetVertexCount());
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); ++vertex) {
+                sequential_data.SetRoute(vertex, vertex, 0., std::nullopt);
+            }
+            for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                const auto& edge = graph.GetEdge(edge_id);
+                if (!sequential_data.HasRoute(edge.from, edge.to) || sequential_data.GetWeight(edge.from, edge.to) > edge.weight) {
+                    sequential_data.SetRoute(edge.from, edge.to, edge.weight, edge_id);
+                }
+            }
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); ++vertex) {
+                sequential_data.RelaxThroughVertex(vertex);
+            }
+
+            for (graph::VertexId from = 0; from < graph.GetVertexCount(); ++from) {
+                for (graph::VertexId to = 0; to < graph.GetVertexCount(); ++to) {
+                    assert(blocked_data.HasRoute(from, to) == sequential_data.HasRoute(from, to));
+                    assert(!blocked_data.HasRoute(from, to) || blocked_data.GetWeight(from, to) == sequential_data.GetWeight(from, to));
+                }
+            }
+
+            graph::Router<double, Storage> sequential_router(graph, std::move(sequential_data));
+            CheckRoutersEqual(graph, sequential_router, blocked_router);
+        }
+
+        void TestAllPairsStrategies() const {
+            using PackedRouter = graph::Router<double, graph::PackedRoutesStorage<float, uint32_t>>;
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 300}, {300, 900}, {200, 4000}}) {
+                const Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+
+                graph::Router<double> nested_router(graph, graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES);
+                assert(nested_router.GetStrategy() == graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES);
+                CheckRoutersEqual(graph, dijkstra_router, nested_router);
+                PackedRouter packed_router(graph, graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES);
+                CheckRoutersEqual(graph, dijkstra_router, packed_router, 1e-6);
+
+                [[maybe_unused]] const PackedRouter auto_router(graph);
+                assert(auto_router.GetStrategy() == PackedRouter::ChooseStrategy(graph));
+            }
+
+            // Sparse graphs are routed by single-source searches, dense ones by Floyd-Warshall
+            assert(graph::Router<double>::ChooseStrategy(MakeRandomGraph(1000, 2000)) == graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES);
+            assert(graph::Router<double>::ChooseStrategy(MakeRandomGraph(100, 2000)) == graph::AllPairsStrategy::FLOYD_WARSHALL);
+        }
+
+        void TestContractionHierarchyRouter() const {
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 300}, {300, 900}, {200, 4000}}) {
+                const Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+                graph::ContractionHierarchyRouter<double> hierarchy_router(graph);
+                CheckRoutersEqual(graph, dijkstra_router, hierarchy_router);
+
+                graph::ContractionHierarchy<double> hierarchy = hierarchy_router.GetHierarchy();
+                graph::ContractionHierarchyRouter<double> restored_router(graph, std::move(hierarchy));
+                CheckRoutersEqual(graph, hierarchy_router, restored_router);
+            }
+
+            const Graph graph = MakeRandomGraph(10, 30);
+            graph::ContractionHierarchy<double> invalid_hierarchy = graph::ContractionHierarchyRouter<double>(graph).GetHierarchy();
+            invalid_hierarchy.ranks.pop_back();
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                graph::ContractionHierarchyRouter<double> invalid_router(graph, std::move(invalid_hierarchy));
+            } catch (const std::invalid_argument&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
+        void TestAStarRouter() const {
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 300}, {300, 900}, {200, 4000}}) {
+                Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph.Freeze();
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+
+                graph::AStarRouter<double> zero_heuristic_router(graph, [](graph::VertexId, graph::VertexId) {
+                    return 0.;
+                });
+                CheckRoutersEqual(graph, dijkstra_router, zero_heuristic_router);
+
+                const auto landmarks = graph::LandmarkTables<double>::Build(graph, 4);
+                assert(landmarks.landmarks.size() == std::min<size_t>(4, vertex_count));
+                graph::AStarRouter<double> alt_router(graph, [&landmarks](graph::VertexId vertex, graph::VertexId to) {
+                    return landmarks.GetLowerBound(vertex, to);
+                });
+                CheckRoutersEqual(graph, dijkstra_router, alt_router);
+
+                // Goal-directed search never settles more vertices than the plain one
+                assert(alt_router.GetSearchStats().queries_count == zero_heuristic_router.GetSearchStats().queries_count);
+                assert(alt_router.GetSearchStats().settled_vertices_count <= zero_heuristic_router.GetSearchStats().settled_vertices_count);
+            }
+
+            const Graph graph = MakeRandomGraph(10, 30);
+            graph::LandmarkTables<double> invalid_landmarks = graph::LandmarkTables<double>::Build(graph, 2);
+            invalid_landmarks.to_landmarks.pop_back();
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                invalid_landmarks.Validate(graph);
+            } catch (const std::invalid_argument&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
+        template <typename Router>
+        static void CheckBuildRoutes(const Graph& graph, const Router& router) {
+            std::vector<graph::VertexId> sources;
+            std::vector<graph::VertexId> targets;
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); vertex += 3) {
+                sources.push_back(vertex);
+            }
+            for (graph::VertexId vertex = 0; vertex < graph.GetVertexCount(); vertex += 2) {
+                targets.push_back(vertex);
+            }
+
+            const auto routes = router.BuildRoutes(sources, targets);
+            assert(routes.size() == sources.size() * targets.size());
+            for (size_t i = 0; i < sources.size(); ++i) {
+                for (size_t j = 0; j < targets.size(); ++j) {
+                    [[maybe_unused]] const auto expected = router.BuildRoute(sources[i], targets[j]);
+                    [[maybe_unused]] const auto& tested = routes[i * targets.size() + j];
+                    assert(expected.has_value() == tested.has_value());
+                    assert(!expected.has_value() || std::abs(expected->weight - tested->weight) <= 1e-9 * std::max(1., expected->weight));
+                    if (!tested.has_value()) {
+                        continue;
+                    }
+                    [[maybe_unused]] double weight = 0.;
+                    [[maybe_unused]] graph::VertexId vertex = sources[i];
+                    for (graph::EdgeId edge_id : tested->edges) {
+                        assert(graph.GetEdge(edge_id).from == vertex);
+                        weight += graph.GetEdge(edge_id).weight;
+                        vertex = graph.GetEdge(edge_id).to;
+                    }
+                    assert(vertex == targets[j]);
+                    assert(std::abs(weight - tested->weight) <= 1e-9 * std::max(1., weight));
+                }
+            }
+        }
+
+        void TestBuildRoutes() const {
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 300}, {300, 900}, {200, 4000}}) {
+                const Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                CheckBuildRoutes(graph, graph::DijkstraRouter<double>(graph));
+                CheckBuildRoutes(graph, graph::ContractionHierarchyRouter<double>(graph));
+
+                // One search tree per source instead of one search per pair
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+                const std::vector<graph::VertexId> sources{0};
+                std::vector<graph::VertexId> targets(vertex_count);
+                std::iota(targets.begin(), targets.end(), 0);
+                dijkstra_router.BuildRoutes(sources, targets);
+                assert(dijkstra_router.GetSearchStats().queries_count == 1);
+                assert(dijkstra_router.GetSearchStats().settled_vertices_count <= vertex_count);
+            }
+        }
+
+        template <typename Queue>
+        static void CheckQueue(Queue& queue, unsigned seed) {
+            std::mt19937 generator(seed);
+            std::uniform_real_distribution<double> key_distribution(0., 100.);
+            std::vector<std::pair<double, graph::VertexId>> expected_items;
+            double last_key = 0.;
+            for (graph::VertexId vertex = 0; vertex < 1000; ++vertex) {
+                // Monotone sequence: pushed keys are not less than the last popped key
+                const double key = last_key + key_distribution(generator);
+                queue.Push(key, vertex);
+                expected_items.emplace_back(key, vertex);
+                if (vertex % 3 == 0) {
+                    const auto min_it = std::min_element(expected_items.begin(), expected_items.end());
+                    [[maybe_unused]] const graph::VertexId popped_vertex = queue.Pop();
+                    assert(popped_vertex == min_it->second);
+                    last_key = min_it->first;
+                    expected_items.erase(min_it);
+                }
+            }
+            std::sort(expected_items.begin(), expected_items.end());
+            for ([[maybe_unused]] const auto& [key, vertex] : expected_items) {
+                assert(!queue.IsEmpty() && queue.Pop() == vertex);
+            }
+            assert(queue.IsEmpty());
+        }
+
+        void TestSearchQueues() const {
+            graph::BinaryHeapQueue<double> binary_heap;
+            graph::RadixHeapQueue<double> radix_heap;
+            CheckQueue(binary_heap, 42);
+            CheckQueue(radix_heap, 42);
+            radix_heap.Push(5., 1);
+            radix_heap.Clear();
+            assert(radix_heap.IsEmpty());
+            CheckQueue(radix_heap, 7);
+
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 300}, {300, 900}, {200, 4000}}) {
+                Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph.Freeze();
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+                graph::DijkstraRouter<double, graph::RadixHeapQueue<double>> radix_dijkstra_router(graph);
+                CheckRoutersEqual(graph, dijkstra_router, radix_dijkstra_router);
+
+                const auto landmarks = graph::LandmarkTables<double>::Build(graph, 4);
+                graph::AStarRouter<double, graph::RadixHeapQueue<double>> radix_alt_router(graph, [&landmarks](graph::VertexId vertex, graph::VertexId to) {
+                    return landmarks.GetLowerBound(vertex, to);
+                });
+                CheckRoutersEqual(graph, dijkstra_router, radix_alt_router);
+            }
+        }
+
+        void TestBuildReachable() const {
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 300}, {300, 900}, {200, 4000}}) {
+                const Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+                for (graph::VertexId from = 0; from < vertex_count; from += 7) {
+                    for (const double max_weight : {0., 50., 150., std::numeric_limits<double>::infinity()}) {
+                        const auto reachable = dijkstra_router.BuildReachable(from, max_weight);
+                        assert(!reachable.empty() && reachable.front().first == from && reachable.front().second == 0.);
+                        std::vector<bool> is_reachable(vertex_count, false);
+                        for (size_t i = 0; i < reachable.size(); ++i) {
+                            assert(i == 0 || reachable[i - 1].second <= reachable[i].second);
+                            is_reachable[reachable[i].first] = true;
+                        }
+                        for (graph::VertexId to = 0; to < vertex_count; ++to) {
+                            [[maybe_unused]] const auto route = dijkstra_router.BuildRoute(from, to);
+                            assert(is_reachable[to] == (route.has_value() && route->weight <= max_weight));
+                        }
+                    }
+                }
+            }
+        }
+
+        void TestReachabilityIndex() const {
+            for (const auto& [vertex_count, edge_count] : {std::pair<size_t, size_t>{1, 0}, {80, 60}, {80, 120}, {300, 400}, {200, 4000}}) {
+                const Graph graph = MakeRandomGraph(vertex_count, edge_count);
+                graph::DijkstraRouter<double> dijkstra_router(graph);
+                const graph::ReachabilityIndex index = graph::ReachabilityIndex::Build(graph);
+                index.Validate(graph);
+                for (graph::VertexId from = 0; from < vertex_count; ++from) {
+                    for (graph::VertexId to = 0; to < vertex_count; ++to) {
+                        [[maybe_unused]] const bool has_route = dijkstra_router.BuildRoute(from, to).has_value();
+                        [[maybe_unused]] const bool has_back_route = dijkstra_router.BuildRoute(to, from).has_value();
+                        assert(!has_route || index.MayReach(from, to));
+                        assert((has_route && has_back_route) == (index.components[from] == index.components[to]));
+                    }
+                }
+
+                // Labels in the reverse topological order are rejected if an edge joins different strong components
+                bool has_component_edges = false;
+                for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                    const auto& edge = graph.GetEdge(edge_id);
+                    has_component_edges = has_component_edges || index.components[edge.from] != index.components[edge.to];
+                }
+                if (has_component_edges) {
+                    graph::ReachabilityIndex reversed_index = index;
+                    std::for_each(reversed_index.components.begin(), reversed_index.components.end(), [vertex_count = vertex_count](uint32_t& component) {
+                        component = static_cast<uint32_t>(vertex_count) - component;
+                    });
+                    [[maybe_unused]] bool is_thrown = false;
+                    try {
+                        reversed_index.Validate(graph);
+                    } catch (const std::invalid_argument&) {
+                        is_thrown = true;
+                    }
+                    assert(is_thrown);
+                }
+            }
+        }
+
+        struct MinPlusRows {
+            std::vector<float> weights_through;
+            std::vector<uint32_t> prev_edges_through;
+            std::vector<float> weights_from;
+            std::vector<uint32_t> prev_edges_from;
+
+            static MinPlusRows MakeRandom(size_t count, unsigned seed = 42) {
+                constexpr float infinity = std::numeric_limits<float>::infinity();
+                constexpr uint32_t none_edge = std::numeric_limits<uint32_t>::max();
+                std::mt19937 generator(seed);
+                std::uniform_real_distribution<float> weight_distribution(0.f, 200.f);
+                std::uniform_int_distribution<uint32_t> edge_distribution(0, 1'000'000);
+                std::bernoulli_distribution is_missing(0.2);
+
+                MinPlusRows rows;
+                for (size_t i = 0; i < count; ++i) {
+                    rows.weights_through.push_back(is_missing(generator) ? infinity : weight_distribution(generator));
+                    rows.prev_edges_through.push_back(is_missing(generator) ? none_edge : edge_distribution(generator));
+                    rows.weights_from.push_back(is_missing(generator) ? infinity : weight_distribution(generator));
+                    rows.prev_edges_from.push_back(edge_distribution(generator));
+                }
+                return rows;
+            }
+
+            void Relax(graph::detail::RelaxRowFunction relax_row, float weight_from_through, uint32_t prev_edge_from_through) {
+                relax_row(
+                    weight_from_through, prev_edge_from_through, weights_through.data(), prev_edges_through.data(), weights_from.data(),
+                    prev_edges_from.data(), weights_from.size());
+            }
+
+            bool operator==(const MinPlusRows& rhs) const {
+                return weights_from == rhs.weights_from && prev_edges_from == rhs.prev_edges_from;
+            }
+        };
+
+        using NamedRelaxRowFunction = std::pair<std::string_view, graph::detail::RelaxRowFunction>;
+
+        static std::vector<NamedRelaxRowFunction> GetSupportedRelaxRowFunctions() {
+            std::vector<NamedRelaxRowFunction> functions{{"scalar", &graph::detail::RelaxRowScalar<float, uint32_t>}};
+#if GRAPH_MIN_PLUS_X86
+            if (__builtin_cpu_supports("sse4.1")) {
+                functions.emplace_back("sse4.1", &graph::detail::RelaxRowSse41);
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                functions.emplace_back("avx2", &graph::detail::RelaxRowAvx2);
+            }
+#endif
+            return functions;
+        }
+
+        void TestMinPlusKernels() const {
+            // Odd size leaves a scalar tail after vector iterations
+            const MinPlusRows rows = MinPlusRows::MakeRandom(1003);
+            MinPlusRows expected_rows = rows;
+            expected_rows.Relax(&graph::detail::RelaxRowScalar<float, uint32_t>, 50.f, 7);
+
+            for (const auto& [name, relax_row] : GetSupportedRelaxRowFunctions()) {
+                MinPlusRows tested_rows = rows;
+                tested_rows.Relax(relax_row, 50.f, 7);
+                assert(tested_rows == expected_rows);
+            }
+
+            MinPlusRows dispatched_rows = rows;
+            dispatched_rows.Relax(graph::detail::GetRelaxRowFunction(), 50.f, 7);
+            assert(dispatched_rows == expected_rows);
+        }
+
+        void BenchmarkMinPlusKernels() const {
+            using namespace std::string_view_literals;
+            constexpr size_t row_size = 4096;
+            constexpr size_t iterations_count = 20'000;
+            const MinPlusRows rows = MinPlusRows::MakeRandom(row_size);
+
+            for (const auto& [name, relax_row] : GetSupportedRelaxRowFunctions()) {
+                MinPlusRows tested_rows = rows;
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t iteration = 0; iteration < iterations_count; ++iteration) {
+                    // Decreasing weight through the vertex keeps improving some cells on every pass
+                    tested_rows.Relax(relax_row, 100.f - static_cast<float>(iteration) * 0.005f, static_cast<uint32_t>(iteration));
+                }
+                const auto duration = std::chrono::steady_clock::now() - start;
+                std::cerr << "Min-plus " << name << " kernel time (" << iterations_count << " x " << row_size
+                          << " cells): " << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count() << "ms"sv << std::endl;
+            }
+        }
+
+        void RunTests() const {
+            const std::string prefix = "[Graph] ";
+
+            TestFreeze();
+            std::cerr << prefix << "TestFreeze : Done." << std::endl;
+
+            TestDijkstraRouter();
+            std::cerr << prefix << "TestDijkstraRouter : Done." << std::endl;
+
+            TestPackedRoutesStorage();
+            std::cerr << prefix << "TestPackedRoutesStorage : Done." << std::endl;
+
+            TestBlockedFloydWarshall();
+            std::cerr << prefix << "TestBlockedFloydWarshall : Done." << std::endl;
+
+            TestAllPairsStrategies();
+            std::cerr << prefix << "TestAllPairsStrategies : Done." << std::endl;
+
+            TestAllPairsUpdates();
+            std::cerr << prefix << "TestAllPairsUpdates : Done." << std::endl;
+
+            TestAllPairsCustomizeWeights();
+            std::cerr << prefix << "TestAllPairsCustomizeWeights : Done." << std::endl;
+
+            TestHopLengthProfiles();
+            std::cerr << prefix << "TestHopLengthProfiles : Done." << std::endl;
+
+            TestContractionHierarchyRouter();
+            std::cerr << prefix << "TestContractionHierarchyRouter : Done." << std::endl;
+
+            TestAStarRouter();
+            std::cerr << prefix << "TestAStarRouter : Done." << std::endl;
+
+            TestBuildRoutes();
+            std::cerr << prefix << "TestBuildRoutes : Done." << std::endl;
+
+            TestBuildReachable();
+            std::cerr << prefix << "TestBuildReachable : Done." << std::endl;
+
+            TestSearchQueues();
+            std::cerr << prefix << "TestSearchQueues : Done." << std::endl;
+
+            TestReachabilityIndex();
+            std::cerr << prefix << "TestReachabilityIndex : Done." << std::endl;
+
+            TestMinPlusKernels();
+            std::cerr << prefix << "TestMinPlusKernels : Done." << std::endl;
+#if (!DEBUG)
+            BenchmarkMinPlusKernels();
+            std::cerr << prefix << "BenchmarkMinPlusKernels : Done." << std::endl;
+#endif
+
+            std::cerr << std::endl << "All Graph Tests : Done." << std::endl << std::endl;
+        }
+    };
+}
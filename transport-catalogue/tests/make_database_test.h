@@ -1,5 +1,10 @@
 #pragma once
 
+#include <chrono>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 #include "../json_reader.h"
 #include "../request_handler.h"
 #include "../transport_catalogue.h"
@@ -15,6 +20,13 @@ namespace transport_catalogue::tests {
         std::string ReadDocument(
             std::string json_file, io::RequestHandler::Mode mode = io::RequestHandler::Mode::MAKE_BASE,
             bool force_disable_build_graph = false) const {
+            TransportCatalogue catalog;
+            return ReadDocument(std::move(json_file), catalog, mode, force_disable_build_graph);
+        }
+
+        std::string ReadDocument(
+            std::string json_file, TransportCatalogue& catalog, io::RequestHandler::Mode mode = io::RequestHandler::Mode::MAKE_BASE,
+            bool force_disable_build_graph = false) const {
             using namespace transport_catalogue;
             using namespace transport_catalogue::io;
 
@@ -24,7 +36,6 @@ namespace transport_catalogue::tests {
             std::stringstream ostream;
             istream << data << std::endl;
 
-            TransportCatalogue catalog;
             JsonReader json_reader(istream);
             JsonResponseSender stat_sender(ostream);
 
@@ -118,6 +129,62 @@ namespace transport_catalogue::tests {
             //TestFromFile("s14_3_opentest_3", "process_requests", "answer", 1e-5);
         }
 
+        /// Compare the distances table lookups of the buses routes segments with the node based map lookups in both directions
+        void BenchmarkDistancesTable(std::string file_name = "s14_3_opentest_3", size_t repeat_count = 100) const {
+            using StopsPair = std::pair<data::StopRecord, data::StopRecord>;
+            struct StopsPairHasher {
+                size_t operator()(const StopsPair& stops) const {
+                    return std::hash<const void*>{}(stops.first) * 37 + std::hash<const void*>{}(stops.second);
+                }
+            };
+
+            TransportCatalogue catalog;
+            ReadDocument(DATA_PATH / (file_name + ".json"), catalog, io::RequestHandler::Mode::MAKE_BASE, true);
+            const data::ITransportDataReader& db_reader = catalog.GetDataReader();
+            const data::DatabaseScheme::StopsTable& stops = db_reader.GetStopsTable();
+
+            std::unordered_map<StopsPair, data::DistanceBetweenStopsRecord, StopsPairHasher> node_map;
+            db_reader.GetDistancesBetweenStops().ForEach([&](data::StopId from_id, data::StopId to_id, const data::DistanceBetweenStopsRecord& distance) {
+                node_map.emplace(StopsPair{&stops[from_id], &stops[to_id]}, distance);
+            });
+
+            std::vector<StopsPair> segments;
+            for (const data::Bus& bus : db_reader.GetBusRoutesTable()) {
+                for (size_t i = 1; i < bus.route.size(); ++i) {
+                    segments.emplace_back(bus.route[i - 1], bus.route[i]);
+                }
+            }
+
+            const data::DatabaseScheme::DistanceBetweenStopsTable& distances = db_reader.GetDistancesBetweenStops();
+            double flat_total = 0.;
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < repeat_count; ++i) {
+                for (const auto& [from, to] : segments) {
+                    flat_total += distances.Get(from, to).measured_distance;
+                }
+            }
+            const auto flat_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+            double node_total = 0.;
+            start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < repeat_count; ++i) {
+                for (const auto& [from, to] : segments) {
+                    auto ptr = node_map.find({from, to});
+                    if (ptr == node_map.end()) {
+                        ptr = node_map.find({to, from});
+                    }
+                    node_total += ptr == node_map.end() ? 0. : ptr->second.measured_distance;
+                }
+            }
+            const auto node_duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+
+            if (flat_total != node_total) {
+                std::cerr << "WARN Distances lookups mismatch: flat table - " << flat_total << ", unordered_map - " << node_total << std::endl;
+            }
+            std::cerr << "Distances lookups (" << file_name << ", " << segments.size() * repeat_count << " lookups): flat table - " << flat_duration
+                      << "us, unordered_map - " << node_duration << "us" << std::endl;
+        }
+
         void RunTests() const {
             const std::string prefix = "[MakeDatabase] ";
 
@@ -154,6 +221,11 @@ namespace transport_catalogue::tests {
             TestOnRandomDataStep3();
             std::cerr << prefix << "TestOnRandomDataStep3 : Done." << std::endl;
 
+#if (!DEBUG)
+            BenchmarkDistancesTable();
+            std::cerr << prefix << "BenchmarkDistancesTable : Done." << std::endl;
+#endif
+
             std::cerr << std::endl << "All MakeDatabase Tests : Done." << std::endl << std::endl;
         }
     };
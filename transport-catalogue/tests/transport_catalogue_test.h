@@ -2,9 +2,11 @@
 
 #include <algorithm>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
 #include <iostream>
 #include <limits>
+#include <stdexcept>
 #include <string>
 #include <string_view>
 
@@ -112,6 +114,174 @@ namespace transport_catalogue::tests {
             assert(result && expected_result == *result);
         }
 
+        void TestRecordIds() const {
+            TransportCatalogue catalog;
+            const auto &db_writer = catalog.GetDataWriter();
+            const auto &db_reader = catalog.GetDataReader();
+            db_writer.AddStop("Stop1"s, {55.60, 37.20});
+            db_writer.AddStop("Stop2"s, {55.59, 37.21});
+            db_writer.AddStop("Stop3"s, {55.58, 37.22});
+            db_writer.AddBus("256"s, std::vector<std::string>{"Stop1", "Stop2"}, false);
+            db_writer.AddBus("828"s, std::vector<std::string>{"Stop2", "Stop3", "Stop2"}, true);
+
+            [[maybe_unused]] const data::DatabaseScheme::StopsTable &stops = db_reader.GetStopsTable();
+            for ([[maybe_unused]] data::StopId stop_id = 0; stop_id < stops.size(); ++stop_id) {
+                assert(stops[stop_id].id == stop_id);
+            }
+            assert(db_reader.GetBus("256")->id == 0 && db_reader.GetBus("828")->id == 1);
+            assert(db_reader.GetBuses(db_reader.GetStop("Stop1")).size() == 1);
+            assert(db_reader.GetBuses(db_reader.GetStop("Stop2")).size() == 2);
+            assert(db_reader.GetBuses(db_reader.GetStop("Stop3")).size() == 1);
+        }
+
+        void TestStopToBusesView() const {
+            TransportCatalogue catalog;
+            const auto &db_writer = catalog.GetDataWriter();
+            const auto &db_reader = catalog.GetDataReader();
+            db_writer.AddStop("Stop1"s, {55.60, 37.20});
+            db_writer.AddStop("Stop2"s, {55.59, 37.21});
+            db_writer.AddBus("828"s, std::vector<std::string>{"Stop1", "Stop2", "Stop1"}, true);
+            db_writer.AddBus("14"s, std::vector<std::string>{"Stop2", "Stop1"}, false);
+
+            [[maybe_unused]] const auto get_names = [&db_reader](std::string_view stop_name) {
+                std::vector<std::string> names;
+                for (const data::BusRecord bus : db_reader.GetBuses(db_reader.GetStop(stop_name))) {
+                    names.push_back(bus->name);
+                }
+                return names;
+            };
+            assert(get_names("Stop1") == (std::vector<std::string>{"14", "828"}));
+
+            // The buses and stops added after the reading are merged by the next reading
+            db_writer.AddStop("Stop3"s, {55.58, 37.22});
+            assert(db_reader.GetBuses(db_reader.GetStop("Stop3")).empty());
+            db_writer.AddBus("256"s, std::vector<std::string>{"Stop3", "Stop1"}, false);
+            // The distance updates the routes of the pending buses too
+            db_writer.SetMeasuredDistance("Stop3", "Stop1", 2000.);
+            assert(db_reader.GetBus("256")->GetMeasuredLength() == 2000.);
+            assert(get_names("Stop1") == (std::vector<std::string>{"14", "256", "828"}));
+            assert(get_names("Stop2") == (std::vector<std::string>{"14", "828"}));
+            assert(get_names("Stop3") == std::vector<std::string>{"256"});
+            assert(db_reader.GetBuses("Unknown stop"sv).empty());
+        }
+
+        void TestDistancesTable() const {
+            TransportCatalogue catalog;
+            const auto &db_writer = catalog.GetDataWriter();
+            const auto &db_reader = catalog.GetDataReader();
+            db_writer.AddStop("Stop1"s, {55.60, 37.20});
+            db_writer.AddStop("Stop2"s, {55.59, 37.21});
+            db_writer.AddStop("Stop3"s, {55.58, 37.22});
+            [[maybe_unused]] const data::StopRecord stop1 = db_reader.GetStop("Stop1");
+            [[maybe_unused]] const data::StopRecord stop2 = db_reader.GetStop("Stop2");
+            [[maybe_unused]] const data::StopRecord stop3 = db_reader.GetStop("Stop3");
+
+            // The distance of the one direction is used for the opposite one until that one is set
+            db_writer.SetMeasuredDistance("Stop1", "Stop2", 1000.);
+            assert(db_reader.GetDistanceBetweenStops(stop1, stop2).measured_distance == 1000.);
+            assert(db_reader.GetDistanceBetweenStops(stop2, stop1).measured_distance == 1000.);
+            db_writer.SetMeasuredDistance("Stop2", "Stop1", 1500.);
+            db_writer.SetMeasuredDistance("Stop1", "Stop2", 1200.);
+            assert(db_reader.GetDistanceBetweenStops(stop1, stop2).measured_distance == 1200.);
+            assert(db_reader.GetDistanceBetweenStops(stop2, stop1).measured_distance == 1500.);
+            assert(db_reader.GetDistanceBetweenStops(stop1, stop3).measured_distance == 0.);
+            assert(!db_reader.GetDistancesBetweenStops().Contains(stop3, stop1));
+
+            // Only the set distances are listed
+            [[maybe_unused]] size_t count = 0;
+            db_reader.GetDistancesBetweenStops().ForEach([&count](data::StopId, data::StopId, const data::DistanceBetweenStopsRecord &) {
+                ++count;
+            });
+            assert(count == 2 && db_reader.GetDistancesBetweenStops().Size() == 2);
+
+            // The table grows over many distances
+            for (size_t i = 0; i < 1000; ++i) {
+                db_writer.AddStop("Stop_"s + std::to_string(i), {55.5, 37.5});
+                db_writer.SetMeasuredDistance("Stop1", "Stop_"s + std::to_string(i), static_cast<double>(i));
+            }
+            for (size_t i = 0; i < 1000; ++i) {
+                [[maybe_unused]] const data::StopRecord stop = db_reader.GetStop("Stop_"s + std::to_string(i));
+                assert(db_reader.GetDistanceBetweenStops(stop, stop1).measured_distance == static_cast<double>(i));
+            }
+            assert(db_reader.GetDistancesBetweenStops().Size() == 1002);
+        }
+
+        void TestRouteDistances() const {
+            TransportCatalogue catalog;
+            const auto &db_writer = catalog.GetDataWriter();
+            const auto &db_reader = catalog.GetDataReader();
+            db_writer.AddStop("Stop1"s, {55.60, 37.20});
+            db_writer.AddStop("Stop2"s, {55.59, 37.21});
+            db_writer.AddStop("Stop3"s, {55.58, 37.22});
+            db_writer.SetMeasuredDistance("Stop1", "Stop2", 1000.);
+            db_writer.AddBus("256"s, std::vector<std::string>{"Stop1", "Stop2", "Stop3", "Stop2", "Stop1"}, false);
+
+            [[maybe_unused]] const data::BusRecord bus = db_reader.GetBus("256");
+            assert(bus->distances.measured == (std::vector<double>{0., 1000., 1000., 1000., 2000.}));
+            // The hops without the distance record are not counted in the geographic length either
+            [[maybe_unused]] const double known_geographic_length =
+                geo::ComputeDistance(db_reader.GetStop("Stop1")->coordinates, db_reader.GetStop("Stop2")->coordinates) * 2.;
+            assert(std::abs(bus->GetGeographicLength() - known_geographic_length) < 1e-9);
+            assert(std::abs(catalog.GetBusInfo(bus).route_curvature - 2000. / known_geographic_length) < 1e-9);
+            // The cumulative distances are updated by the distances set after the bus, once the bus is read again
+            db_writer.SetMeasuredDistance("Stop2", "Stop3", 500.);
+            db_writer.SetMeasuredDistance("Stop3", "Stop2", 700.);
+            assert(db_reader.GetBus("256") == bus);
+            assert(bus->distances.measured == (std::vector<double>{0., 1000., 1500., 2200., 3200.}));
+            assert(bus->GetMeasuredDistance(1, 3) == 1200.);
+
+            [[maybe_unused]] const double geographic_length =
+                (geo::ComputeDistance(db_reader.GetStop("Stop1")->coordinates, db_reader.GetStop("Stop2")->coordinates) +
+                 geo::ComputeDistance(db_reader.GetStop("Stop2")->coordinates, db_reader.GetStop("Stop3")->coordinates)) *
+                2.;
+            [[maybe_unused]] const data::BusStat stat = catalog.GetBusInfo(bus);
+            assert(stat.route_length == 3200.);
+            assert(std::abs(stat.route_curvature - 3200. / geographic_length) < 1e-9);
+        }
+
+        void TestMaterializedStats() const {
+            TransportCatalogue catalog;
+            const auto &db_writer = catalog.GetDataWriter();
+            [[maybe_unused]] const auto &db_reader = catalog.GetDataReader();
+            const auto &stat_reader = catalog.GetStatDataReader();
+            db_writer.AddStop("Stop1"s, {55.60, 37.20});
+            db_writer.AddStop("Stop2"s, {55.59, 37.21});
+            db_writer.AddStop("Stop3"s, {55.58, 37.22});
+            db_writer.SetMeasuredDistance("Stop1", "Stop2", 1000.);
+            db_writer.SetMeasuredDistance("Stop2", "Stop3", 500.);
+            db_writer.AddBus("828"s, std::vector<std::string>{"Stop2", "Stop3", "Stop2"}, true);
+            db_writer.AddBus("256"s, std::vector<std::string>{"Stop1", "Stop2", "Stop3"}, false);
+
+            db_writer.SetStats(stat_reader.ComputeBusStats(), stat_reader.ComputeStopStats());
+            assert(db_reader.GetBusStatsView().size() == 2 && db_reader.GetStopStatsView().size() == 3);
+            [[maybe_unused]] const data::BusStat bus_stat = stat_reader.GetBusInfo("256").value();
+            assert(bus_stat.total_stops == 3 && bus_stat.unique_stops == 3 && bus_stat.route_length == 1500.);
+            // The stop stats keep the bus records, the names are read from them
+            [[maybe_unused]] const auto get_names = [](const data::StopStat &stat) {
+                std::vector<std::string> names;
+                std::transform(stat.buses.begin(), stat.buses.end(), std::back_inserter(names), [](const data::BusRecord bus) {
+                    return bus->name;
+                });
+                return names;
+            };
+            assert(get_names(stat_reader.GetStopInfo("Stop2").value()) == (std::vector<std::string>{"256", "828"}));
+            assert(get_names(stat_reader.GetStopInfo("Stop1").value()) == std::vector<std::string>{"256"});
+            assert(get_names(stat_reader.GetStopInfo("Stop3").value()) == (std::vector<std::string>{"256", "828"}));
+
+            // The stats are dropped by a change of the data and computed on request
+            db_writer.SetMeasuredDistance("Stop2", "Stop1", 2000.);
+            assert(db_reader.GetBusStatsView().empty() && db_reader.GetStopStatsView().empty());
+            assert(stat_reader.GetBusInfo("256")->route_length == 1500.);
+
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                db_writer.SetStats(data::DatabaseScheme::BusStatsView{}, stat_reader.ComputeStopStats());
+            } catch (const std::invalid_argument &) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
         json::Document TestWithJsonReader(std::istream &istream) const {
             io::JsonReader json_reader{istream};
 
@@ -339,6 +509,21 @@ namespace transport_catalogue::tests {
             TestAddStop();
             std::cerr << prefix << "TestAddStop : Done." << std::endl;
 
+            TestRecordIds();
+            std::cerr << prefix << "TestRecordIds : Done." << std::endl;
+
+            TestStopToBusesView();
+            std::cerr << prefix << "TestStopToBusesView : Done." << std::endl;
+
+            TestDistancesTable();
+            std::cerr << prefix << "TestDistancesTable : Done." << std::endl;
+
+            TestRouteDistances();
+            std::cerr << prefix << "TestRouteDistances : Done." << std::endl;
+
+            TestMaterializedStats();
+            std::cerr << prefix << "TestMaterializedStats : Done." << std::endl;
+
             TestWithJsonReader();
             std::cerr << prefix << "TestWithJsonReader : Done." << std::endl;
 
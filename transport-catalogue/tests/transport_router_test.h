@@ -2,13 +2,19 @@
 
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <cmath>
 #include <filesystem>
 #include <functional>
+#include <iomanip>
 #include <iostream>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <sstream>
 #include <stdexcept>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "../detail/type_traits.h"
@@ -24,7 +30,7 @@ namespace transport_catalogue::tests {
         inline static const std::filesystem::path DATA_PATH = std::filesystem::current_path() / "transport-catalogue/tests/data/router";
 
     public:
-        std::string ReadDocument(std::string json_file) const {
+        std::string ReadDocument(std::string json_file, std::optional<std::string> router_type = std::nullopt) const {
             using namespace transport_catalogue;
             using namespace transport_catalogue::io;
 
@@ -32,7 +38,15 @@ namespace transport_catalogue::tests {
 
             std::stringstream istream;
             std::stringstream ostream;
-            istream << data << std::endl;
+            if (router_type.has_value()) {
+                json::Node root = json::Node::LoadNode(std::stringstream{data});
+                root.AsMap().at("routing_settings").AsMap()["router_type"] = router_type.value();
+                // Numbers are printed exactly, so the document differs from the file by the router type only
+                istream << std::setprecision(std::numeric_limits<double>::max_digits10);
+                root.Print(istream);
+            } else {
+                istream << data << std::endl;
+            }
 
             TransportCatalogue catalog;
             JsonReader json_reader(istream);
@@ -48,8 +62,8 @@ namespace transport_catalogue::tests {
             return ostream.str();
         }
 
-        void TestFromExample(std::string file_name, std::string answer_suffix = "output") const {
-            std::string result = ReadDocument(DATA_PATH / (file_name + ".json"));
+        void TestFromExample(std::string file_name, std::string answer_suffix = "output", std::optional<std::string> router_type = std::nullopt) const {
+            std::string result = ReadDocument(DATA_PATH / (file_name + ".json"), router_type);
             std::string expected_str = transport_catalogue::detail::io::FileReader::Read(DATA_PATH / (file_name + "_" + answer_suffix + ".json"));
             assert(!result.empty());
 
@@ -119,6 +133,814 @@ namespace transport_catalogue::tests {
             TestFromExample("s12_final_opentest_3", "answer");
         }
 
+        /// Compare the route answers of the example with the expected answers as a whole: items, their times and total times
+        void TestSameRoutesAsExample(std::string file_name, std::string answer_suffix, std::string router_type) const {
+            const std::string result = ReadDocument(DATA_PATH / (file_name + ".json"), router_type);
+            const std::string expected_str = transport_catalogue::detail::io::FileReader::Read(DATA_PATH / (file_name + "_" + answer_suffix + ".json"));
+            const json::Array response = json::Node::LoadNode(std::stringstream{result}).AsArray();
+            const json::Array expected_response = json::Node::LoadNode(std::stringstream{expected_str}).AsArray();
+            assert(expected_response.size() == response.size());
+
+            for (auto result_it = response.begin(), expected_it = expected_response.begin(); result_it != response.end();
+                 ++result_it, ++expected_it) {
+                if (expected_it->IsMap() && expected_it->AsMap().count("items") && *result_it != *expected_it) {
+                    std::cerr << "Test result:" << std::endl;
+                    result_it->Print(std::cerr);
+                    std::cerr << std::endl << "Test expected result:" << std::endl;
+                    expected_it->Print(std::cerr);
+                    std::cerr << std::endl;
+                    assert(false);
+                }
+            }
+        }
+
+        /// Compare the routes of Dijkstra router with the routes of Floyd-Warshall over all vertices pairs of the routing graph,
+        /// the routes of the same weight should be chosen the same way too
+        void TestSameRoutesAsAllPairs(std::string file_name) const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            router::TransportRouter router({6, 40., router::RouterType::DIJKSTRA}, catalog.GetDataReader());
+            router.Build();
+            const router::RoutingGraph& graph = router.GetGraph();
+            const graph::Router<double> all_pairs_router(graph, graph::AllPairsStrategy::FLOYD_WARSHALL);
+            const graph::DijkstraRouter<double> dijkstra_router(graph);
+
+            for (graph::VertexId from = 0; from < graph.GetVertexCount(); ++from) {
+                for (graph::VertexId to = 0; to < graph.GetVertexCount(); ++to) {
+                    [[maybe_unused]] const auto expected = all_pairs_router.BuildRoute(from, to);
+                    [[maybe_unused]] const auto route = dijkstra_router.BuildRoute(from, to);
+                    assert(expected.has_value() == route.has_value());
+                    assert(!expected.has_value() || (expected->edges == route->edges && std::abs(expected->weight - route->weight) < 1e-9));
+                }
+            }
+        }
+
+        void TestDijkstraRouter() const {
+            // The reference answers of test4 and s12_final_opentest_3 choose other routes of the same time, so the routes of
+            // these examples are compared with Floyd-Warshall routes only
+            TestSameRoutesAsExample("test1", "output", "dijkstra");
+            TestSameRoutesAsExample("test2", "output", "dijkstra");
+            TestSameRoutesAsExample("test3", "output", "dijkstra");
+            TestSameRoutesAsExample("s12_final_opentest_1", "answer", "dijkstra");
+            TestSameRoutesAsExample("s12_final_opentest_2", "answer", "dijkstra");
+            for (std::string file_name : {"test1", "test2", "test3", "test4", "s12_final_opentest_1", "s12_final_opentest_2",
+                                          "s12_final_opentest_3"}) {
+                TestSameRoutesAsAllPairs(file_name);
+            }
+        }
+
+        void TestContractionHierarchyRouter() const {
+            TestFromExample("test1", "output", "contraction_hierarchy");
+            TestFromExample("test2", "output", "contraction_hierarchy");
+            TestFromExample("test3", "output", "contraction_hierarchy");
+            TestFromExample("test4", "output", "contraction_hierarchy");
+            TestFromExample("s12_final_opentest_1", "answer", "contraction_hierarchy");
+            TestFromExample("s12_final_opentest_2", "answer", "contraction_hierarchy");
+            TestFromExample("s12_final_opentest_3", "answer", "contraction_hierarchy");
+        }
+
+        void TestAStarRouter() const {
+            TestFromExample("test1", "output", "a_star");
+            TestFromExample("test2", "output", "a_star");
+            TestFromExample("test3", "output", "a_star");
+            TestFromExample("test4", "output", "a_star");
+            TestFromExample("s12_final_opentest_1", "answer", "a_star");
+            TestFromExample("s12_final_opentest_2", "answer", "a_star");
+            TestFromExample("s12_final_opentest_3", "answer", "a_star");
+        }
+
+        void TestAltRouter() const {
+            TestFromExample("test1", "output", "alt");
+            TestFromExample("test2", "output", "alt");
+            TestFromExample("test3", "output", "alt");
+            TestFromExample("test4", "output", "alt");
+            TestFromExample("s12_final_opentest_1", "answer", "alt");
+            TestFromExample("s12_final_opentest_2", "answer", "alt");
+            TestFromExample("s12_final_opentest_3", "answer", "alt");
+        }
+
+        /// Fill the catalog with the base requests of the example
+        void LoadCatalog(const std::string& file_name, TransportCatalogue& catalog) const {
+            using namespace transport_catalogue::io;
+
+            std::stringstream istream{transport_catalogue::detail::io::FileReader::Read(DATA_PATH / (file_name + ".json"))};
+            std::stringstream ostream;
+            JsonReader json_reader(istream);
+            JsonResponseSender stat_sender(ostream);
+            maps::MapRenderer renderer;
+            const auto request_handler_ptr =
+                std::make_shared<RequestHandler>(catalog.GetStatDataReader(), catalog.GetDataWriter(), stat_sender, renderer);
+            json_reader.AddObserver(request_handler_ptr);
+            json_reader.ReadDocument();
+        }
+
+        /// Compare settled vertices counts of on-demand routers over all stops pairs
+        void TestSearchStats(std::string file_name = "s12_final_opentest_3") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+            const auto calc_settled_count = [&](router::RouterType router_type) {
+                router::TransportRouter router({6, 40., router_type}, catalog.GetDataReader());
+                router.Build();
+                for (const data::Stop& from : stops) {
+                    for (const data::Stop& to : stops) {
+                        router.GetRouteInfo(from.name, to.name);
+                    }
+                }
+                [[maybe_unused]] const router::RoutingSearchStats stats = router.GetSearchStats();
+                assert(stats.queries_count == stops.size() * stops.size());
+                return stats.settled_vertices_count;
+            };
+
+            const size_t dijkstra_settled_count = calc_settled_count(router::RouterType::DIJKSTRA);
+            const size_t a_star_settled_count = calc_settled_count(router::RouterType::A_STAR);
+            const size_t alt_settled_count = calc_settled_count(router::RouterType::ALT);
+            std::cerr << "Settled vertices (" << file_name << ", " << stops.size() * stops.size() << " queries): Dijkstra - "
+                      << dijkstra_settled_count << ", A* - " << a_star_settled_count << ", ALT - " << alt_settled_count << std::endl;
+
+            assert(a_star_settled_count <= dijkstra_settled_count);
+            assert(alt_settled_count <= dijkstra_settled_count);
+        }
+
+        void TestRaptorRouter() const {
+            TestFromExample("test1", "output", "raptor");
+            TestFromExample("test2", "output", "raptor");
+            TestFromExample("test3", "output", "raptor");
+            TestFromExample("test4", "output", "raptor");
+            TestFromExample("s12_final_opentest_1", "answer", "raptor");
+            TestFromExample("s12_final_opentest_2", "answer", "raptor");
+            TestFromExample("s12_final_opentest_3", "answer", "raptor");
+        }
+
+        void TestRaptorParetoRoutes(std::string file_name = "s12_final_opentest_3") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            const router::RoutingSettings settings{6, 40., router::RouterType::RAPTOR};
+            router::TransportRouter raptor_router(settings, catalog.GetDataReader());
+            raptor_router.Build();
+            assert(raptor_router.GetGraph().GetEdgeCount() == 0);
+            router::TransportRouter dijkstra_router({settings.bus_wait_time_min, settings.bus_velocity_kmh, router::RouterType::DIJKSTRA}, catalog.GetDataReader());
+            dijkstra_router.Build();
+
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+            for (const data::Stop& from : stops) {
+                for (const data::Stop& to : stops) {
+                    const std::optional<router::RouteInfo> expected = dijkstra_router.GetRouteInfo(from.name, to.name);
+                    const std::vector<router::RouteInfo> pareto_routes = raptor_router.GetParetoRouteInfos(from.name, to.name);
+                    assert(expected.has_value() != pareto_routes.empty());
+                    if (!expected.has_value()) {
+                        continue;
+                    }
+                    assert(std::abs(pareto_routes.back().total_time - expected->total_time) < 1e-6);
+                    for (size_t i = 1; i < pareto_routes.size(); ++i) {
+                        assert(pareto_routes[i - 1].items.size() < pareto_routes[i].items.size());
+                        assert(pareto_routes[i - 1].total_time > pareto_routes[i].total_time);
+                    }
+                    for ([[maybe_unused]] const router::RouteInfo& route : pareto_routes) {
+                        assert(
+                            std::abs(route.total_time - std::accumulate(route.items.begin(), route.items.end(), 0., [](double time, const auto& item) {
+                                         return time + item.first.time + item.second.time;
+                                     })) < 1e-6);
+                    }
+                }
+            }
+
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                dijkstra_router.GetParetoRouteInfos(stops.front().name, stops.back().name);
+            } catch (const std::logic_error&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
+        void TestCollapseParallelEdges(std::string file_name = "s12_final_opentest_3") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            const router::RoutingSettings settings{6, 40., router::RouterType::DIJKSTRA};
+            router::TransportRouter router(settings, catalog.GetDataReader());
+            router.Build();
+            router::TransportRouter collapsed_router({settings.bus_wait_time_min, settings.bus_velocity_kmh, settings.router_type, true}, catalog.GetDataReader());
+            collapsed_router.Build();
+
+            [[maybe_unused]] const router::RoutingBuildStats& stats = router.GetBuildStats();
+            const router::RoutingBuildStats& collapsed_stats = collapsed_router.GetBuildStats();
+            assert(stats.generated_edges_count == stats.edges_count && stats.edges_count == router.GetGraph().GetEdgeCount());
+            assert(collapsed_stats.generated_edges_count == stats.generated_edges_count);
+            assert(collapsed_stats.edges_count == collapsed_router.GetGraph().GetEdgeCount());
+            assert(collapsed_stats.edges_count < collapsed_stats.generated_edges_count);
+            std::cerr << "Edges (" << file_name << "): generated - " << collapsed_stats.generated_edges_count << ", collapsed - "
+                      << collapsed_stats.edges_count << std::endl;
+
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+            for (const data::Stop& from : stops) {
+                for (const data::Stop& to : stops) {
+                    [[maybe_unused]] const std::optional<router::RouteInfo> expected = router.GetRouteInfo(from.name, to.name);
+                    [[maybe_unused]] const std::optional<router::RouteInfo> collapsed = collapsed_router.GetRouteInfo(from.name, to.name);
+                    assert(expected.has_value() == collapsed.has_value());
+                    assert(!expected.has_value() || std::abs(expected->total_time - collapsed->total_time) < 1e-9);
+                }
+            }
+        }
+
+        /// Check that every edge has the routing item of its bus ride, with and without collapsed parallel edges
+        void TestRoutingItems(std::string file_name = "s12_final_opentest_3") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+            [[maybe_unused]] const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+            const data::DatabaseScheme::BusRoutesTable& buses = catalog.GetDataReader().GetBusRoutesTable();
+
+            for (bool collapse_parallel_edges : {false, true}) {
+                const router::RoutingSettings settings{6, 40., router::RouterType::DIJKSTRA, collapse_parallel_edges};
+                router::TransportRouter router(settings, catalog.GetDataReader());
+                router.Build();
+
+                const router::RoutingGraph& graph = router.GetGraph();
+                const router::RoutingItems& items = router.GetRoutingItems();
+                assert(items.GetSize() == graph.GetEdgeCount());
+                for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                    [[maybe_unused]] const auto& edge = graph.GetEdge(edge_id);
+                    [[maybe_unused]] const router::RoutingItem item = items.Get(edge_id);
+                    assert(item.stop_id == edge.from && item.bus_id < buses.size() && item.span_count > 0);
+                    assert(std::abs(item.travel_time + settings.bus_wait_time_min - edge.weight) < 1e-9);
+
+                    // The boarding stop is on the bus route and the ride ends at the edge target
+                    [[maybe_unused]] const data::Route& route = buses[item.bus_id].route;
+                    assert(std::any_of(route.begin(), route.end(), [&](data::StopRecord stop) {
+                        return stop == &stops[item.stop_id];
+                    }));
+                    assert(std::any_of(route.begin(), route.end(), [&](data::StopRecord stop) {
+                        return stop == &stops[edge.to];
+                    }));
+                }
+
+                [[maybe_unused]] bool is_thrown = false;
+                try {
+                    items.Get(graph.GetEdgeCount());
+                } catch (const std::out_of_range&) {
+                    is_thrown = true;
+                }
+                assert(is_thrown);
+            }
+        }
+
+        /// Compare the cached Route answers with the uncached ones and check the cache counters and invalidation
+        void TestRouteCache(std::string file_name = "s12_final_opentest_2") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+
+            for (router::RouterType router_type : {router::RouterType::ALL_PAIRS, router::RouterType::DIJKSTRA, router::RouterType::RAPTOR}) {
+                const router::RoutingSettings settings{6, 40., router_type, false, stops.size()};
+                router::TransportRouter router({settings.bus_wait_time_min, settings.bus_velocity_kmh, router_type}, catalog.GetDataReader());
+                router.Build();
+                router::TransportRouter cached_router(settings, catalog.GetDataReader());
+                cached_router.Build();
+
+                // Every pair is asked twice in a row: the first answer is a miss, the second one is a hit.
+                // Pairs without a route by the components index are answered before the cache
+                const router::RoutingReachability* reachability = cached_router.GetRoutingReachability();
+                size_t cached_pairs_count = 0;
+                for (graph::VertexId from_vertex = 0; from_vertex < stops.size(); ++from_vertex) {
+                    for (graph::VertexId to_vertex = 0; to_vertex < stops.size(); ++to_vertex) {
+                        cached_pairs_count += reachability == nullptr || reachability->MayReach(from_vertex, to_vertex) ? 1 : 0;
+                    }
+                }
+                for (const data::Stop& from : stops) {
+                    for (const data::Stop& to : stops) {
+                        [[maybe_unused]] const std::optional<router::RouteInfo> expected = router.GetRouteInfo(from.name, to.name);
+                        for (int i = 0; i < 2; ++i) {
+                            [[maybe_unused]] const std::optional<router::RouteInfo> cached = cached_router.GetRouteInfo(from.name, to.name);
+                            assert(expected.has_value() == cached.has_value());
+                            assert(
+                                !expected.has_value() ||
+                                (expected->total_time == cached->total_time && expected->items.size() == cached->items.size()));
+                        }
+                    }
+                }
+                [[maybe_unused]] router::RouteCacheStats stats = cached_router.GetRouteCacheStats();
+                assert(stats.hits == cached_pairs_count && stats.misses == stats.hits);
+                assert(stats.size <= settings.route_cache_capacity);
+                assert(router.GetRouteCacheStats().hits == 0 && router.GetRouteCacheStats().misses == 0);
+
+                cached_router.SetSettings(settings);
+                stats = cached_router.GetRouteCacheStats();
+                assert(stats.hits == 0 && stats.misses == 0 && stats.size == 0);
+
+                cached_router.GetRouteInfo(stops.front().name, stops.back().name);
+                cached_router.ResetGraph();
+                cached_router.Build();
+                stats = cached_router.GetRouteCacheStats();
+                assert(stats.hits == 0 && stats.misses == 0 && stats.size == 0);
+            }
+
+            // The least recently used value of the shard is evicted first
+            transport_catalogue::detail::ShardedLruCache<int, int> cache(2, 1);
+            cache.Insert(1, 1);
+            cache.Insert(2, 2);
+            assert(cache.Find(1) == 1);
+            cache.Insert(3, 3);
+            assert(cache.Find(1) == 1 && !cache.Find(2).has_value() && cache.Find(3) == 3);
+            assert(cache.GetStats().size == 2 && cache.GetStats().hits == 3 && cache.GetStats().misses == 1);
+        }
+
+        /// Compare the router updated in place after the catalogue changes with the router built from scratch, for every router type
+        void TestIncrementalUpdates(std::string file_name = "s12_final_opentest_2") const {
+            const auto check_routers_equal = [](const TransportCatalogue& catalog, const router::TransportRouter& updated_router) {
+                router::TransportRouter expected_router(updated_router.GetSettings(), catalog.GetDataReader());
+                expected_router.Build();
+                assert(expected_router.GetGraph().GetEdgeCount() == updated_router.GetGraph().GetEdgeCount());
+
+                const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+                for (const data::Stop& from : stops) {
+                    for (const data::Stop& to : stops) {
+                        [[maybe_unused]] const std::optional<router::RouteInfo> expected = expected_router.GetRouteInfo(from.name, to.name);
+                        [[maybe_unused]] const std::optional<router::RouteInfo> updated = updated_router.GetRouteInfo(from.name, to.name);
+                        assert(expected.has_value() == updated.has_value());
+                        assert(
+                            !expected.has_value() ||
+                            std::abs(expected->total_time - updated->total_time) <= 1e-6 * std::max(1., expected->total_time));
+                    }
+                }
+            };
+
+            using router::RouterType;
+            for (auto [router_type, collapse_parallel_edges] :
+                 {std::pair{RouterType::ALL_PAIRS, false}, {RouterType::ALL_PAIRS, true}, {RouterType::DIJKSTRA, false},
+                  {RouterType::CONTRACTION_HIERARCHY, false}, {RouterType::ALT, false}, {RouterType::RAPTOR, false}}) {
+                TransportCatalogue catalog;
+                LoadCatalog(file_name, catalog);
+                const data::ITransportDataReader& db_reader = catalog.GetDataReader();
+                const data::DatabaseScheme::StopsTable& stops = db_reader.GetStopsTable();
+
+                // The answers cache keeps all pairs, so a stale answer would be found by the checks
+                router::TransportRouter router({6, 40., router_type, collapse_parallel_edges, stops.size() * stops.size()}, db_reader);
+                router.Build();
+                check_routers_equal(catalog, router);
+
+                // A fast bus over existing stops makes shortcuts
+                std::vector<std::string_view> bus_stops;
+                for (size_t i = 0; i < stops.size(); i += 3) {
+                    bus_stops.push_back(stops[i].name);
+                }
+                for (size_t i = 1; i < bus_stops.size(); ++i) {
+                    const data::StopRecord from = db_reader.GetStop(bus_stops[i - 1]);
+                    const data::StopRecord to = db_reader.GetStop(bus_stops[i]);
+                    if (!db_reader.GetDistancesBetweenStops().Contains(from, to)) {
+                        catalog.GetDataWriter().SetMeasuredDistance(from->name, to->name, 100.);
+                    }
+                }
+                catalog.GetDataWriter().AddBus(std::string("Incremental"), bus_stops, false);
+                [[maybe_unused]] const size_t edges_count = router.GetGraph().GetEdgeCount();
+                router.AddBus("Incremental");
+                // About L^2 rides of the bus are more than the vertices, the all-pairs table is relaxed by one full pass
+                assert(router_type == RouterType::RAPTOR || collapse_parallel_edges ||
+                       router.GetGraph().GetEdgeCount() - edges_count >= router.GetGraph().GetVertexCount());
+                check_routers_equal(catalog, router);
+
+                // The ride of an existing bus becomes slower, then faster
+                const data::Bus& bus = db_reader.GetBusRoutesTable().front();
+                const data::StopRecord from = bus.route[0];
+                const data::StopRecord to = bus.route[1];
+                const double distance = db_reader.GetDistanceBetweenStops(from, to).measured_distance;
+                for (double factor : {5., 0.1}) {
+                    catalog.GetDataWriter().SetMeasuredDistance(from->name, to->name, distance * factor);
+                    router.UpdateDistance(from->name, to->name);
+                    check_routers_equal(catalog, router);
+                }
+            }
+        }
+
+        /// A ride passing its boarding stop again counts neither the hop back to the boarding stop nor its span
+        void TestRevisitedStopRides() const {
+            using namespace std::string_literals;
+            TransportCatalogue catalog;
+            const data::ITransportDataWriter& db_writer = catalog.GetDataWriter();
+            db_writer.AddStop("A"s, {55.60, 37.20});
+            db_writer.AddStop("B"s, {55.61, 37.21});
+            db_writer.AddStop("C"s, {55.62, 37.22});
+            db_writer.SetMeasuredDistance("A", "B", 1000.);
+            db_writer.SetMeasuredDistance("B", "A", 1500.);
+            db_writer.SetMeasuredDistance("A", "C", 2000.);
+            db_writer.AddBus("1"s, std::vector<std::string>{"A", "B", "A", "C", "A"}, true);
+
+            router::TransportRouter router({6, 60., router::RouterType::DIJKSTRA}, catalog.GetDataReader());
+            router.Build();
+            const router::RoutingGraph& graph = router.GetGraph();
+            const data::StopRecord stop_a = catalog.GetDataReader().GetStop("A");
+            const data::StopRecord stop_c = catalog.GetDataReader().GetStop("C");
+
+            // From the first A to C: A-B is counted, B-A is skipped, A-C is counted
+            [[maybe_unused]] size_t checked_count = 0;
+            for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                const router::RoutingItem item = router.GetRoutingItems().Get(edge_id);
+                if (item.stop_id == stop_a->id && graph.GetEdge(edge_id).to == stop_c->id && item.span_count != 1) {
+                    assert(item.span_count == 2 && item.distance == 3000. && std::abs(item.travel_time - 3.) < 1e-9);
+                    ++checked_count;
+                }
+            }
+            assert(checked_count == 1);
+        }
+
+        /// Stop requests for the known stops after the routes are answered change the distances only, and the built router is updated for them
+        void TestDistanceRequests() const {
+            using namespace transport_catalogue::io;
+            const std::string base_requests = R"({
+                "base_requests": [
+                    {"type": "Stop", "name": "A", "latitude": 55.60, "longitude": 37.20, "road_distances": {"B": 3000, "C": 9000}},
+                    {"type": "Stop", "name": "B", "latitude": 55.61, "longitude": 37.21, "road_distances": {"C": 4000}},
+                    {"type": "Stop", "name": "C", "latitude": 55.62, "longitude": 37.22, "road_distances": {}},
+                    {"type": "Bus", "name": "1", "stops": ["A", "B", "C"], "is_roundtrip": false},
+                    {"type": "Bus", "name": "2", "stops": ["A", "C"], "is_roundtrip": false}
+                ],
+                "routing_settings": {"bus_wait_time": 2, "bus_velocity": 30, "router_type": "%"},
+                "stat_requests": [{"id": 1, "type": "Route", "from": "A", "to": "C"}]
+            })";
+            const std::string update_requests = R"({
+                "base_requests": [{"type": "Stop", "name": "B", "latitude": 55.61, "longitude": 37.21, "road_distances": {"C": 10000}}],
+                "stat_requests": [
+                    {"id": 2, "type": "Route", "from": "A", "to": "C"},
+                    {"id": 3, "type": "Route", "from": "C", "to": "A"},
+                    {"id": 4, "type": "Bus", "name": "1"}
+                ]
+            })";
+
+            for (const std::string& router_type :
+                 {RouterTypeValues::ALL_PAIRS, RouterTypeValues::DIJKSTRA, RouterTypeValues::CONTRACTION_HIERARCHY, RouterTypeValues::RAPTOR}) {
+                TransportCatalogue catalog;
+                std::stringstream ostream;
+                JsonResponseSender stat_sender(ostream);
+                maps::MapRenderer renderer;
+                const auto request_handler_ptr =
+                    std::make_shared<RequestHandler>(catalog.GetStatDataReader(), catalog.GetDataWriter(), stat_sender, renderer);
+
+                // Every document is answered by its own array
+                json::Array responses;
+                for (std::string document : {base_requests, update_requests}) {
+                    if (const size_t pos = document.find('%'); pos != std::string::npos) {
+                        document.replace(pos, 1, router_type);
+                    }
+                    std::stringstream istream{document};
+                    JsonReader json_reader(istream);
+                    json_reader.AddObserver(request_handler_ptr);
+                    json_reader.ReadDocument();
+
+                    json::Document result = json::Document::Load(std::stringstream{ostream.str()});
+                    for (json::Node& node : result.GetRoot().AsArray()) {
+                        responses.push_back(std::move(node));
+                    }
+                    ostream.str({});
+                }
+                assert(catalog.GetDataReader().GetStopsTable().size() == 3);
+
+                // A-B-C by bus 1 is 7 km before the update and 13 km after, A-C by bus 2 is 9 km
+                assert(responses.size() == 4);
+                assert(std::abs(responses[0].AsMap().at("total_time").AsDouble() - 16.) < 1e-9);
+                assert(std::abs(responses[1].AsMap().at("total_time").AsDouble() - 20.) < 1e-9);
+                assert(std::abs(responses[2].AsMap().at("total_time").AsDouble() - 20.) < 1e-9);
+                assert(responses[3].AsMap().at("route_length").AsDouble() == 26000.);
+            }
+        }
+
+        /// Compare the router customized by new wait time and velocity with the router built for them
+        void TestCustomizeWeights(std::string file_name = "s12_final_opentest_2") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+
+            using router::RouterType;
+            for (auto [router_type, collapse_parallel_edges] :
+                 {std::pair{RouterType::ALL_PAIRS, false}, {RouterType::ALL_PAIRS, true}, {RouterType::DIJKSTRA, false},
+                  {RouterType::CONTRACTION_HIERARCHY, false}, {RouterType::A_STAR, false}, {RouterType::ALT, false}, {RouterType::RAPTOR, false}}) {
+                router::TransportRouter router({6, 40., router_type, collapse_parallel_edges, stops.size() * stops.size()}, catalog.GetDataReader());
+                router.Build();
+                [[maybe_unused]] const size_t edges_count = router.GetGraph().GetEdgeCount();
+
+                for (auto [wait_time, velocity] : {std::pair{1., 40.}, {20., 15.}, {0., 80.}}) {
+                    router::RoutingSettings settings = router.GetSettings();
+                    settings.bus_wait_time_min = wait_time;
+                    settings.bus_velocity_kmh = velocity;
+                    router.GetRouteInfo(stops.front().name, stops.back().name);
+                    router.SetSettings(settings);
+                    assert(router.GetGraph().GetEdgeCount() == edges_count);
+
+                    router::TransportRouter expected_router(settings, catalog.GetDataReader());
+                    expected_router.Build();
+                    for (const data::Stop& from : stops) {
+                        for (const data::Stop& to : stops) {
+                            [[maybe_unused]] const std::optional<router::RouteInfo> expected = expected_router.GetRouteInfo(from.name, to.name);
+                            [[maybe_unused]] const std::optional<router::RouteInfo> customized = router.GetRouteInfo(from.name, to.name);
+                            assert(expected.has_value() == customized.has_value());
+                            assert(
+                                !expected.has_value() ||
+                                std::abs(expected->total_time - customized->total_time) <= 1e-6 * std::max(1., expected->total_time));
+                            assert(!customized.has_value() || customized->items.empty() || customized->items.front().second.time == wait_time);
+                        }
+                    }
+                }
+
+                // A new router type rebuilds the graph
+                router::RoutingSettings settings = router.GetSettings();
+                settings.router_type = router_type == RouterType::RAPTOR ? RouterType::DIJKSTRA : RouterType::RAPTOR;
+                router.SetSettings(settings);
+                assert(router.HasGraph() && (settings.router_type == RouterType::RAPTOR) == (router.GetGraph().GetEdgeCount() == 0));
+            }
+        }
+
+        /// Compare the routers with the vertices numbered along the Hilbert curve with the routers numbered in the stops table order
+        void TestVertexOrder(std::string file_name = "s12_final_opentest_2") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+
+            using router::RouterType;
+            for (const RouterType router_type :
+                 {RouterType::ALL_PAIRS, RouterType::DIJKSTRA, RouterType::CONTRACTION_HIERARCHY, RouterType::A_STAR, RouterType::ALT, RouterType::RAPTOR}) {
+                router::RoutingSettings settings{6, 40., router_type};
+                router::TransportRouter router(settings, catalog.GetDataReader());
+                router.Build();
+                settings.vertex_order = router::VertexOrder::HILBERT_CURVE;
+                router::TransportRouter reordered_router(settings, catalog.GetDataReader());
+                reordered_router.Build();
+
+                // Vertex ids are a permutation of the stops indexes, the routing items keep the stops indexes
+                router::VertexIds vertex_ids = reordered_router.GetVertexIds();
+                assert(vertex_ids.size() == stops.size() && !std::is_sorted(vertex_ids.begin(), vertex_ids.end()));
+                std::vector<bool> is_used(stops.size(), false);
+                std::for_each(vertex_ids.begin(), vertex_ids.end(), [&is_used](graph::VertexId vertex) {
+                    assert(!is_used.at(vertex));
+                    is_used[vertex] = true;
+                });
+                const router::RoutingGraph& graph = reordered_router.GetGraph();
+                for (graph::EdgeId edge_id = 0; edge_id < graph.GetEdgeCount(); ++edge_id) {
+                    assert(vertex_ids[reordered_router.GetRoutingItems().Get(edge_id).stop_id] == graph.GetEdge(edge_id).from);
+                }
+
+                // The router loaded from the database keeps the vertex ids of the stops
+                router::TransportRouter loaded_router(settings, catalog.GetDataReader());
+                if (router_type != RouterType::RAPTOR) {
+                    router::RoutingGraph graph_copy = graph;
+                    router::RoutingItems routing_items = reordered_router.GetRoutingItems();
+                    loaded_router.SetGraph(std::move(graph_copy), std::move(routing_items), std::move(vertex_ids));
+                    assert(loaded_router.GetVertexIds() == reordered_router.GetVertexIds());
+                }
+
+                for (const data::Stop& from : stops) {
+                    for (const data::Stop& to : stops) {
+                        [[maybe_unused]] const std::optional<router::RouteInfo> expected = router.GetRouteInfo(from.name, to.name);
+                        for (const router::TransportRouter* tested_router : {&reordered_router, &loaded_router}) {
+                            if (!tested_router->HasGraph()) {
+                                continue;
+                            }
+                            [[maybe_unused]] const std::optional<router::RouteInfo> tested = tested_router->GetRouteInfo(from.name, to.name);
+                            assert(expected.has_value() == tested.has_value());
+                            assert(!expected.has_value() || std::abs(expected->total_time - tested->total_time) < 1e-6);
+                            assert(!tested.has_value() || tested->items.empty() || tested->items.front().second.stop_name == from.name);
+                        }
+                    }
+                    [[maybe_unused]] const std::optional<router::ReachableStops> expected = router.GetReachableStops(from.name, 30.);
+                    [[maybe_unused]] const std::optional<router::ReachableStops> tested = reordered_router.GetReachableStops(from.name, 30.);
+                    assert(expected.has_value() && tested.has_value() && expected->size() == tested->size());
+                }
+            }
+
+            // Vertex ids which are not a permutation of the stops are rejected
+            router::TransportRouter router({6, 40., RouterType::DIJKSTRA}, catalog.GetDataReader());
+            [[maybe_unused]] bool is_thrown = false;
+            try {
+                router.SetGraph(router::RoutingGraph(stops.size()), router::RoutingItems{}, router::VertexIds(stops.size(), 0));
+            } catch (const std::invalid_argument&) {
+                is_thrown = true;
+            }
+            assert(is_thrown);
+        }
+
+        /// Check that the stops answered by the components index have no route, for every router type
+        void TestRoutingReachability(std::string file_name = "s12_final_opentest_2") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+            // The stops of a separate bus and a stop without buses are unreachable from the rest of the stops
+            catalog.GetDataWriter().AddStop("Separate stop 1", {55.6, 37.6});
+            catalog.GetDataWriter().AddStop("Separate stop 2", {55.61, 37.61});
+            catalog.GetDataWriter().AddStop("Stop without buses", {55.62, 37.62});
+            catalog.GetDataWriter().SetMeasuredDistance("Separate stop 1", "Separate stop 2", 1000.);
+            catalog.GetDataWriter().AddBus("Separate bus", std::vector<std::string>{"Separate stop 1", "Separate stop 2"}, false);
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+
+            using router::RouterType;
+            for (const RouterType router_type : {RouterType::ALL_PAIRS, RouterType::DIJKSTRA, RouterType::CONTRACTION_HIERARCHY, RouterType::RAPTOR}) {
+                router::TransportRouter router({6, 40., router_type}, catalog.GetDataReader());
+                router.Build();
+                const router::RoutingReachability* reachability = router.GetRoutingReachability();
+                assert((reachability == nullptr) == (router_type == RouterType::RAPTOR));
+                if (reachability == nullptr) {
+                    continue;
+                }
+
+                graph::DijkstraRouter<double> dijkstra_router(router.GetGraph());
+                size_t unreachable_count = 0;
+                for (graph::VertexId from = 0; from < stops.size(); ++from) {
+                    for (graph::VertexId to = 0; to < stops.size(); ++to) {
+                        [[maybe_unused]] const bool has_route = dijkstra_router.BuildRoute(from, to).has_value();
+                        assert(!has_route || reachability->MayReach(from, to));
+                        unreachable_count += reachability->MayReach(from, to) ? 0 : 1;
+                    }
+                }
+                // Vertices are numbered in the stops table order
+                for (graph::VertexId from = 0; from < stops.size(); ++from) {
+                    for (graph::VertexId to = 0; to < stops.size(); ++to) {
+                        [[maybe_unused]] const std::optional<router::RouteInfo> route = router.GetRouteInfo(stops[from].name, stops[to].name);
+                        assert(route.has_value() == dijkstra_router.BuildRoute(from, to).has_value());
+                    }
+                }
+                assert(unreachable_count > 0);
+                if (router_type == RouterType::ALL_PAIRS) {
+                    std::cerr << "Pairs without a route by the components index (" << file_name << "): " << unreachable_count << " of "
+                              << stops.size() * stops.size() << std::endl;
+                }
+
+                // The index of another graph is rejected
+                router::RoutingReachability invalid_reachability = *reachability;
+                invalid_reachability.components.pop_back();
+                [[maybe_unused]] bool is_thrown = false;
+                try {
+                    router.SetRoutingReachability(std::move(invalid_reachability));
+                } catch (const std::invalid_argument&) {
+                    is_thrown = true;
+                }
+                assert(is_thrown);
+            }
+        }
+
+        /// Compare the route matrix with the per-pair routes for every router type
+        void TestRouteMatrix(std::string file_name = "s12_final_opentest_2") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+            std::vector<std::string_view> sources;
+            std::vector<std::string_view> targets{"Unknown stop"};
+            std::for_each(stops.begin(), stops.end(), [&](const data::Stop& stop) {
+                sources.emplace_back(stop.name);
+                targets.emplace_back(stop.name);
+            });
+
+            for (const router::RouterType router_type :
+                 {router::RouterType::ALL_PAIRS, router::RouterType::DIJKSTRA, router::RouterType::CONTRACTION_HIERARCHY, router::RouterType::ALT,
+                  router::RouterType::RAPTOR}) {
+                router::TransportRouter router({6, 40., router_type}, catalog.GetDataReader());
+                router.Build();
+                const router::RouteMatrix matrix = router.GetRouteMatrix(sources, targets, true);
+                assert(matrix.sources_count == sources.size() && matrix.targets_count == targets.size());
+                for (size_t i = 0; i < sources.size(); ++i) {
+                    assert(!matrix.GetRoute(i, 0).has_value());
+                    for (size_t j = 1; j < targets.size(); ++j) {
+                        [[maybe_unused]] const std::optional<router::RouteInfo> expected = router.GetRouteInfo(sources[i], targets[j]);
+                        [[maybe_unused]] const std::optional<router::RouteInfo>& tested = matrix.GetRoute(i, j);
+                        assert(expected.has_value() == tested.has_value());
+                        assert(!expected.has_value() || std::abs(expected->total_time - tested->total_time) < 1e-6);
+                        assert(!expected.has_value() || expected->items.size() == tested->items.size());
+                    }
+                }
+
+                [[maybe_unused]] const router::RouteMatrix packed_matrix = router.GetRouteMatrix(sources, targets);
+                assert(std::all_of(packed_matrix.routes.begin(), packed_matrix.routes.end(), [](const auto& route) {
+                    return !route.has_value() || route->items.empty();
+                }));
+            }
+        }
+
+        /// Compare the reachable stops with the per-pair routes for every router type
+        void TestReachableStops(std::string file_name = "s12_final_opentest_2") const {
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            const data::DatabaseScheme::StopsTable& stops = catalog.GetDataReader().GetStopsTable();
+            for (const router::RouterType router_type :
+                 {router::RouterType::ALL_PAIRS, router::RouterType::DIJKSTRA, router::RouterType::CONTRACTION_HIERARCHY, router::RouterType::RAPTOR}) {
+                router::TransportRouter router({6, 40., router_type}, catalog.GetDataReader());
+                router.Build();
+                assert(!router.GetReachableStops("Unknown stop", 100.).has_value());
+
+                // The second pass searches the weights customized in place by the new settings
+                for (const auto& [wait_time, velocity] : {std::pair<double, double>{6., 40.}, {2., 25.}}) {
+                    router.SetSettings({wait_time, velocity, router_type});
+                    for (const data::Stop& from : stops) {
+                        for (const double max_time : {0., 20., 60.}) {
+                            const std::optional<router::ReachableStops> reachable = router.GetReachableStops(from.name, max_time);
+                            assert(reachable.has_value() && !reachable->empty());
+                            assert(reachable->front().stop_name == from.name && reachable->front().time == 0.);
+
+                            std::unordered_map<std::string_view, double> times;
+                            for (size_t i = 0; i < reachable->size(); ++i) {
+                                assert(i == 0 || (*reachable)[i - 1].time <= (*reachable)[i].time);
+                                times.emplace((*reachable)[i].stop_name, (*reachable)[i].time);
+                            }
+                            for (const data::Stop& to : stops) {
+                                const std::optional<router::RouteInfo> route = router.GetRouteInfo(from.name, to.name);
+                                [[maybe_unused]] const bool is_reachable = route.has_value() && route->total_time <= max_time + 1e-9;
+                                assert(times.count(to.name) == (is_reachable ? 1 : 0));
+                                assert(!is_reachable || std::abs(times.at(to.name) - route->total_time) < 1e-6);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /// Settled vertices per second of the single-pair Dijkstra search with the binary heap and the radix heap queues
+        void BenchmarkSearchQueues(std::string file_name = "test4", size_t repeat_count = 50) const {
+            using namespace std::string_view_literals;
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            router::TransportRouter router({6, 40., router::RouterType::DIJKSTRA}, catalog.GetDataReader());
+            router.Build();
+            const router::RoutingGraph& graph = router.GetGraph();
+
+            const auto benchmark = [&](std::string_view name, const router::RawRouter& raw_router) {
+                const auto start = std::chrono::steady_clock::now();
+                for (size_t i = 0; i < repeat_count; ++i) {
+                    for (graph::VertexId from = 0; from < graph.GetVertexCount(); ++from) {
+                        for (graph::VertexId to = 0; to < graph.GetVertexCount(); ++to) {
+                            raw_router.BuildRoute(from, to);
+                        }
+                    }
+                }
+                const std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+                const size_t settled_count = raw_router.GetSearchStats().settled_vertices_count;
+                std::cerr << "Dijkstra " << name << " (" << file_name << ", " << raw_router.GetSearchStats().queries_count
+                          << " queries): " << static_cast<size_t>(settled_count / duration.count()) << " settled vertices/s"sv << std::endl;
+                return settled_count;
+            };
+
+            [[maybe_unused]] const size_t binary_heap_settled_count = benchmark("binary heap", graph::DijkstraRouter<double>(graph));
+            [[maybe_unused]] const size_t radix_heap_settled_count =
+                benchmark("radix heap", graph::DijkstraRouter<double, graph::RadixHeapQueue<double>>(graph));
+            assert(binary_heap_settled_count == radix_heap_settled_count);
+        }
+
+        /// Build time of the all-pairs routes table by Floyd-Warshall and by single-source searches
+        void BenchmarkAllPairsStrategies(std::string file_name = "s12_final_opentest_3", bool collapse_parallel_edges = false) const {
+            using namespace std::string_view_literals;
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            router::TransportRouter router({6, 40., router::RouterType::DIJKSTRA, collapse_parallel_edges}, catalog.GetDataReader());
+            router.Build();
+            const router::RoutingGraph& graph = router.GetGraph();
+
+            const auto benchmark = [&graph](graph::AllPairsStrategy strategy) {
+                const auto start = std::chrono::steady_clock::now();
+                const router::AllPairsRouter all_pairs_router(graph, strategy);
+                return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+            };
+
+            const auto floyd_warshall_duration = benchmark(graph::AllPairsStrategy::FLOYD_WARSHALL);
+            const auto single_source_duration = benchmark(graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES);
+            const bool is_sparse = router::AllPairsRouter::ChooseStrategy(graph) == graph::AllPairsStrategy::SINGLE_SOURCE_SEARCHES;
+            std::cerr << "All-pairs build (" << file_name << ", V = " << graph.GetVertexCount() << ", E = " << graph.GetEdgeCount()
+                      << "): Floyd-Warshall - " << floyd_warshall_duration << "ms, single-source searches - " << single_source_duration
+                      << "ms, auto - "sv << (is_sparse ? "single-source searches"sv : "Floyd-Warshall"sv) << std::endl;
+        }
+
+        /// Time of the full build and of the customization by new wait time and velocity
+        void BenchmarkCustomizeWeights(std::string file_name = "s12_final_opentest_3") const {
+            using namespace std::string_view_literals;
+            TransportCatalogue catalog;
+            LoadCatalog(file_name, catalog);
+
+            using router::RouterType;
+            for (const RouterType router_type : {RouterType::ALL_PAIRS, RouterType::CONTRACTION_HIERARCHY, RouterType::ALT}) {
+                router::TransportRouter router({6, 40., router_type}, catalog.GetDataReader());
+                auto start = std::chrono::steady_clock::now();
+                router.Build();
+                const auto build_duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+                start = std::chrono::steady_clock::now();
+                router.SetSettings({2, 60., router_type});
+                const auto customize_duration =
+                    std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+
+                // The first change of the all-pairs router builds the routes profiles, the next ones only customize the table
+                constexpr size_t settings_count = 10;
+                start = std::chrono::steady_clock::now();
+                for (size_t index = 1; index <= settings_count; ++index) {
+                    router.SetSettings({static_cast<double>(index), 20. + static_cast<double>(index), router_type});
+                }
+                const auto next_customize_duration =
+                    std::chrono::duration_cast<std::chrono::microseconds>((std::chrono::steady_clock::now() - start) / settings_count).count();
+                std::cerr << "Router type " << static_cast<int>(router_type) << " (" << file_name << ", E = " << router.GetGraph().GetEdgeCount()
+                          << "): build - " << build_duration << "ms, customize - " << customize_duration << "ms, next customize - "
+                          << next_customize_duration << "us"sv << std::endl;
+                assert(router_type != RouterType::ALL_PAIRS || next_customize_duration * 2 < build_duration * 1000);
+            }
+        }
+
         void RunTests() const {
             const std::string prefix = "[TransportRouter] ";
 
@@ -137,6 +959,72 @@ namespace transport_catalogue::tests {
             TestOnRandomData();
             std::cerr << prefix << "TestOnRandomData : Done." << std::endl;
 
+            TestDijkstraRouter();
+            std::cerr << prefix << "TestDijkstraRouter : Done." << std::endl;
+
+            TestContractionHierarchyRouter();
+            std::cerr << prefix << "TestContractionHierarchyRouter : Done." << std::endl;
+
+            TestAStarRouter();
+            std::cerr << prefix << "TestAStarRouter : Done." << std::endl;
+
+            TestAltRouter();
+            std::cerr << prefix << "TestAltRouter : Done." << std::endl;
+
+            TestSearchStats();
+            std::cerr << prefix << "TestSearchStats : Done." << std::endl;
+
+            TestRaptorRouter();
+            std::cerr << prefix << "TestRaptorRouter : Done." << std::endl;
+
+            TestRaptorParetoRoutes();
+            std::cerr << prefix << "TestRaptorParetoRoutes : Done." << std::endl;
+
+            TestCollapseParallelEdges();
+            std::cerr << prefix << "TestCollapseParallelEdges : Done." << std::endl;
+
+            TestRoutingItems();
+            std::cerr << prefix << "TestRoutingItems : Done." << std::endl;
+
+            TestRouteCache();
+            std::cerr << prefix << "TestRouteCache : Done." << std::endl;
+
+            TestIncrementalUpdates();
+            std::cerr << prefix << "TestIncrementalUpdates : Done." << std::endl;
+
+            TestRevisitedStopRides();
+            std::cerr << prefix << "TestRevisitedStopRides : Done." << std::endl;
+
+            TestDistanceRequests();
+            std::cerr << prefix << "TestDistanceRequests : Done." << std::endl;
+
+            TestCustomizeWeights();
+            std::cerr << prefix << "TestCustomizeWeights : Done." << std::endl;
+
+            TestVertexOrder();
+            std::cerr << prefix << "TestVertexOrder : Done." << std::endl;
+
+            TestRoutingReachability();
+            std::cerr << prefix << "TestRoutingReachability : Done." << std::endl;
+
+            TestRouteMatrix();
+            std::cerr << prefix << "TestRouteMatrix : Done." << std::endl;
+
+            TestReachableStops();
+            std::cerr << prefix << "TestReachableStops : Done." << std::endl;
+#if (!DEBUG)
+            BenchmarkSearchQueues();
+            BenchmarkSearchQueues("s12_final_opentest_3", 1);
+            std::cerr << prefix << "BenchmarkSearchQueues : Done." << std::endl;
+
+            BenchmarkAllPairsStrategies();
+            BenchmarkAllPairsStrategies("s12_final_opentest_3", true);
+            std::cerr << prefix << "BenchmarkAllPairsStrategies : Done." << std::endl;
+
+            BenchmarkCustomizeWeights();
+            std::cerr << prefix << "BenchmarkCustomizeWeights : Done." << std::endl;
+#endif
+
             std::cerr << std::endl << "All TransportRouter Tests : Done." << std::endl << std::endl;
         }
     };
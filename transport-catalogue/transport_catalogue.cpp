@@ -1,5 +1,7 @@
 #include "transport_catalogue.h"
 
+#include <tbb/parallel_for.h>
+
 #include <algorithm>
 #include <string_view>
 #include <utility>
@@ -49,11 +51,11 @@ namespace transport_catalogue /* TransportCatalogue < ITransportDataReader imple
         return db_reader_.GetBuses();
     }
 
-    const data::BusRecordSet& TransportCatalogue::GetBuses(data::StopRecord stop) const {
+    data::BusRecordsView TransportCatalogue::GetBuses(data::StopRecord stop) const {
         return db_reader_.GetBuses(stop);
     }
 
-    const data::BusRecordSet& TransportCatalogue::GetBuses(const std::string_view bus_name) const {
+    data::BusRecordsView TransportCatalogue::GetBuses(const std::string_view bus_name) const {
         return db_reader_.GetBuses(bus_name);
     }
 
@@ -64,6 +66,14 @@ namespace transport_catalogue /* TransportCatalogue < ITransportDataReader imple
     const data::DatabaseScheme::DistanceBetweenStopsTable& TransportCatalogue::GetDistancesBetweenStops() const {
         return db_reader_.GetDistancesBetweenStops();
     }
+
+    const data::DatabaseScheme::BusStatsView& TransportCatalogue::GetBusStatsView() const {
+        return db_reader_.GetBusStatsView();
+    }
+
+    const data::DatabaseScheme::StopStatsView& TransportCatalogue::GetStopStatsView() const {
+        return db_reader_.GetStopStatsView();
+    }
 }
 
 namespace transport_catalogue /* TransportCatalogue < ITransportDataWriter implementation */ {
@@ -95,6 +105,10 @@ namespace transport_catalogue /* TransportCatalogue < ITransportDataWriter imple
     void TransportCatalogue::SetMeasuredDistance(data::MeasuredRoadDistance&& distance) const {
         db_writer_.SetMeasuredDistance(std::move(distance));
     }
+
+    void TransportCatalogue::SetStats(data::DatabaseScheme::BusStatsView&& bus_stats, data::DatabaseScheme::StopStatsView&& stop_stats) const {
+        db_writer_.SetStats(std::move(bus_stats), std::move(stop_stats));
+    }
 }
 
 namespace transport_catalogue /* TransportCatalogue < ITransportStatDataReader implementation */ {
@@ -114,30 +128,32 @@ namespace transport_catalogue /* TransportCatalogue < ITransportStatDataReader i
     std::optional<data::StopStat> TransportCatalogue::GetStopInfo(const std::string_view stop_name) const {
         return db_stat_reader_->GetStopInfo(stop_name);
     }
+
+    data::DatabaseScheme::BusStatsView TransportCatalogue::ComputeBusStats() const {
+        return db_stat_reader_->ComputeBusStats();
+    }
+
+    data::DatabaseScheme::StopStatsView TransportCatalogue::ComputeStopStats() const {
+        return db_stat_reader_->ComputeStopStats();
+    }
 }
 
 namespace transport_catalogue /* TransportCatalogue::StatReader implementation */ {
 
     data::BusStat TransportCatalogue::StatReader::GetBusInfo(const data::BusRecord bus) const {
+        const data::DatabaseScheme::BusStatsView& bus_stats = db_reader_.GetBusStatsView();
+        return bus->id < bus_stats.size() ? bus_stats[bus->id] : CalculateBusStat(*bus);
+    }
+
+    data::BusStat TransportCatalogue::StatReader::CalculateBusStat(const data::Bus& bus) const {
         data::BusStat info;
-        double route_length = 0;
-        double pseudo_length = 0;
-        const data::Route& route = bus->route;
-
-        for (size_t i = 0; i < route.size() - 1ul; ++i) {
-            data::StopRecord from_stop = db_reader_.GetStop(route[i]->name);
-            data::StopRecord to_stop = db_reader_.GetStop(route[i + 1]->name);
-            assert(from_stop && from_stop);
-
-            const auto& dist_btw = db_reader_.GetDistanceBetweenStops(from_stop, to_stop);
-            route_length += dist_btw.measured_distance;
-            pseudo_length += dist_btw.distance;
-        }
+        const data::Route& route = bus.route;
+        const double route_length = bus.GetMeasuredLength();
 
         info.total_stops = route.size();
         info.unique_stops = CalculateUniqueStops(route.begin(), route.end());
         info.route_length = route_length;
-        info.route_curvature = route_length / std::max(pseudo_length, 1.);
+        info.route_curvature = route_length / std::max(bus.GetGeographicLength(), 1.);
 
         return info;
     }
@@ -148,12 +164,12 @@ namespace transport_catalogue /* TransportCatalogue::StatReader implementation *
     }
 
     data::StopStat TransportCatalogue::StatReader::GetStopInfo(const data::StopRecord stop) const {
-        const data::BusRecordSet& buses = db_reader_.GetBuses(stop);
-        std::vector<std::string> buses_names(buses.size());
-        std::transform(buses.begin(), buses.end(), buses_names.begin(), [](const auto& bus) {
-            return bus->name;
-        });
-        return data::StopStat{std::move(buses_names)};
+        const data::DatabaseScheme::StopStatsView& stop_stats = db_reader_.GetStopStatsView();
+        return stop->id < stop_stats.size() ? stop_stats[stop->id] : CalculateStopStat(*stop);
+    }
+
+    data::StopStat TransportCatalogue::StatReader::CalculateStopStat(const data::Stop& stop) const {
+        return data::StopStat{db_reader_.GetBuses(&stop)};
     }
 
     std::optional<data::StopStat> TransportCatalogue::StatReader::GetStopInfo(const std::string_view stop_name) const {
@@ -164,6 +180,26 @@ namespace transport_catalogue /* TransportCatalogue::StatReader implementation *
         return std::optional<data::StopStat>{GetStopInfo(stop)};
     }
 
+    data::DatabaseScheme::BusStatsView TransportCatalogue::StatReader::ComputeBusStats() const {
+        const data::DatabaseScheme::BusRoutesTable& buses = db_reader_.GetBusRoutesTable();
+        data::DatabaseScheme::BusStatsView bus_stats;
+        bus_stats.resize(buses.size());
+        tbb::parallel_for(size_t{0}, buses.size(), [this, &buses, &bus_stats](size_t bus_id) {
+            bus_stats[bus_id] = CalculateBusStat(buses[bus_id]);
+        });
+        return bus_stats;
+    }
+
+    data::DatabaseScheme::StopStatsView TransportCatalogue::StatReader::ComputeStopStats() const {
+        const data::DatabaseScheme::StopsTable& stops = db_reader_.GetStopsTable();
+        data::DatabaseScheme::StopStatsView stop_stats;
+        // The rows are copied from the stop to buses view, so the stops are filled in order
+        std::for_each(stops.begin(), stops.end(), [this, &stop_stats](const data::Stop& stop) {
+            stop_stats.PushBack(CalculateStopStat(stop).buses);
+        });
+        return stop_stats;
+    }
+
     const data::ITransportDataReader& TransportCatalogue::StatReader::GetDataReader() const {
         return db_reader_;
     }
@@ -37,6 +37,7 @@ namespace transport_catalogue /* TransportCatalogue */ {
         void AddBus(std::string&& name, std::vector<std::string>&& stops, bool is_roundtrip) const override;
         void SetMeasuredDistance(const std::string_view from_stop_name, const std::string_view to_stop_name, double distance) const override;
         void SetMeasuredDistance(data::MeasuredRoadDistance&& distance) const override;
+        void SetStats(data::DatabaseScheme::BusStatsView&& bus_stats, data::DatabaseScheme::StopStatsView&& stop_stats) const override;
 
     public: /* ITransportDataReader interface */
         data::BusRecord GetBus(const std::string_view name) const override;
@@ -44,16 +45,20 @@ namespace transport_catalogue /* TransportCatalogue */ {
         const data::DatabaseScheme::StopsTable& GetStopsTable() const override;
         const data::DatabaseScheme::BusRoutesTable& GetBusRoutesTable() const override;
         std::vector<data::BusRecord> GetBuses() const override;
-        const data::BusRecordSet& GetBuses(data::StopRecord stop) const override;
-        const data::BusRecordSet& GetBuses(const std::string_view bus_name) const override;
+        data::BusRecordsView GetBuses(data::StopRecord stop) const override;
+        data::BusRecordsView GetBuses(const std::string_view bus_name) const override;
         const data::DatabaseScheme::DistanceBetweenStopsTable& GetDistancesBetweenStops() const override;
         data::DistanceBetweenStopsRecord GetDistanceBetweenStops(data::StopRecord from, data::StopRecord to) const override;
+        const data::DatabaseScheme::BusStatsView& GetBusStatsView() const override;
+        const data::DatabaseScheme::StopStatsView& GetStopStatsView() const override;
 
     public: /* ITransportStatDataReader interface */
         data::BusStat GetBusInfo(data::BusRecord bus) const override;
         std::optional<data::BusStat> GetBusInfo(const std::string_view bus_name) const override;
         data::StopStat GetStopInfo(const data::StopRecord stop) const override;
         std::optional<data::StopStat> GetStopInfo(const std::string_view stop_name) const override;
+        data::DatabaseScheme::BusStatsView ComputeBusStats() const override;
+        data::DatabaseScheme::StopStatsView ComputeStopStats() const override;
 
     private:
         class StatReader;
@@ -71,6 +76,7 @@ namespace transport_catalogue /* TransportCatalogue::StatReader */ {
     public:
         StatReader(const data::ITransportDataReader& db_reader) : db_reader_{db_reader} {}
 
+        /// The materialized stats are used if they are built
         data::BusStat GetBusInfo(const data::BusRecord bus) const override;
 
         std::optional<data::BusStat> GetBusInfo(const std::string_view bus_name) const override;
@@ -79,11 +85,19 @@ namespace transport_catalogue /* TransportCatalogue::StatReader */ {
 
         std::optional<data::StopStat> GetStopInfo(const std::string_view stop_name) const override;
 
+        data::DatabaseScheme::BusStatsView ComputeBusStats() const override;
+
+        data::DatabaseScheme::StopStatsView ComputeStopStats() const override;
+
         const data::ITransportDataReader& GetDataReader() const override;
 
     private:
         const data::ITransportDataReader& db_reader_;
 
+        data::BusStat CalculateBusStat(const data::Bus& bus) const;
+
+        data::StopStat CalculateStopStat(const data::Stop& stop) const;
+
         template <typename Iterator>
         static size_t CalculateUniqueStops(Iterator begin, Iterator end);
     };
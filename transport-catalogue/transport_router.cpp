@@ -1,20 +1,44 @@
 #include "transport_router.h"
 
 #include <algorithm>
+#include <array>
 #include <cassert>
+#include <cmath>
 #include <cstddef>
+#include <iterator>
+#include <limits>
 #include <memory>
+#include <numeric>
 #include <optional>
+#include <stdexcept>
 #include <string_view>
+#include <tuple>
 #include <unordered_map>
 #include <vector>
 
 #include "domain.h"
+#include "geo.h"
 
 namespace transport_catalogue::router /* TransportRouter implementation */ {
 
     void TransportRouter::SetSettings(RoutingSettings settings) {
+        const RoutingSettings previous_settings = settings_;
         settings_ = settings;
+        route_cache_ = RouteCache(settings_.route_cache_capacity);
+        if (!is_builded_) {
+            return;
+        }
+
+        if (settings_.router_type != previous_settings.router_type ||
+            settings_.collapse_parallel_edges != previous_settings.collapse_parallel_edges ||
+            settings_.vertex_order != previous_settings.vertex_order) {
+            // The routing graph itself depends on the router type, on the edges collapsing and on the vertex order
+            ResetGraph();
+            Build();
+        } else if (settings_.bus_wait_time_min != previous_settings.bus_wait_time_min ||
+                   settings_.bus_velocity_kmh != previous_settings.bus_velocity_kmh) {
+            CustomizeWeights_();
+        }
     }
 
     const RoutingSettings& TransportRouter::GetSettings() const {
@@ -25,43 +49,272 @@ namespace transport_catalogue::router /* TransportRouter implementation */ {
         return graph_;
     }
 
-    void TransportRouter::SetGraph(RoutingGraph&& graph, RoutingIncidentEdges&& route_edges) {
+    void TransportRouter::SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids) {
+        SetGraph_(std::move(graph), std::move(routing_items), std::move(vertex_ids));
+        raw_router_ptr_ = MakeRawRouter_();
+        is_builded_ = true;
+    }
+
+    void TransportRouter::SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutesInternalData&& routes_data) {
+        assert(settings_.router_type == RouterType::ALL_PAIRS);
+
+        SetGraph_(std::move(graph), std::move(routing_items), std::move(vertex_ids));
+        raw_router_ptr_ = std::make_unique<AllPairsRouter>(graph_, std::move(routes_data));
+        is_builded_ = true;
+    }
+
+    void TransportRouter::SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutingHierarchy&& hierarchy) {
+        assert(settings_.router_type == RouterType::CONTRACTION_HIERARCHY);
+
+        SetGraph_(std::move(graph), std::move(routing_items), std::move(vertex_ids));
+        raw_router_ptr_ = std::make_unique<ContractionHierarchyRouter>(graph_, std::move(hierarchy));
+        is_builded_ = true;
+    }
+
+    void TransportRouter::SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutingLandmarks&& landmarks) {
+        assert(settings_.router_type == RouterType::ALT);
+
+        SetGraph_(std::move(graph), std::move(routing_items), std::move(vertex_ids));
+        landmarks.Validate(graph_);
+        landmarks_ = std::move(landmarks);
+        raw_router_ptr_ = MakeRawRouter_();
+        is_builded_ = true;
+    }
+
+    void TransportRouter::SetGraph_(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids) {
         ResetGraph();
         graph_ = std::move(graph);
-        index_mapper_ = IndexMapper(db_reader_.GetStopsTable());
-        edges_ = std::move(route_edges);
-        raw_router_ptr_ = std::make_unique<graph::Router<double>>(graph_);
-        is_builded_ = true;
+        graph_.Freeze();
+        index_mapper_ = IndexMapper(db_reader_.GetStopsTable(), std::move(vertex_ids));
+        routing_items_ = std::move(routing_items);
+    }
+
+    const VertexIds& TransportRouter::GetVertexIds() const {
+        return index_mapper_.GetVertexIds();
+    }
+
+    const RoutesInternalData* TransportRouter::GetRoutesInternalData() const {
+        const auto* all_pairs_router = dynamic_cast<const AllPairsRouter*>(raw_router_ptr_.get());
+        return all_pairs_router == nullptr ? nullptr : &all_pairs_router->GetRoutesInternalData();
+    }
+
+    const RoutingHierarchy* TransportRouter::GetRoutingHierarchy() const {
+        const auto* hierarchy_router = dynamic_cast<const ContractionHierarchyRouter*>(raw_router_ptr_.get());
+        return hierarchy_router == nullptr ? nullptr : &hierarchy_router->GetHierarchy();
+    }
+
+    const RoutingLandmarks* TransportRouter::GetRoutingLandmarks() const {
+        return landmarks_.has_value() ? &landmarks_.value() : nullptr;
+    }
+
+    const RoutingReachability* TransportRouter::GetRoutingReachability() const {
+        return reachability_.has_value() ? &reachability_.value() : nullptr;
+    }
+
+    void TransportRouter::SetRoutingReachability(RoutingReachability&& reachability) {
+        reachability.Validate(graph_);
+        reachability_ = std::move(reachability);
+    }
+
+    RoutingSearchStats TransportRouter::GetSearchStats() const {
+        return raw_router_ptr_ == nullptr ? RoutingSearchStats{} : raw_router_ptr_->GetSearchStats();
+    }
+
+    const RoutingBuildStats& TransportRouter::GetBuildStats() const {
+        return build_stats_;
+    }
+
+    RouteCacheStats TransportRouter::GetRouteCacheStats() const {
+        return route_cache_.GetStats();
     }
 
     bool TransportRouter::HasGraph() const {
         return is_builded_;
     }
 
-    const RoutingItemInfo& TransportRouter::GetRoutingItem(graph::EdgeId edge_id) const {
-        return edges_.at(edge_id);
+    const RoutingItems& TransportRouter::GetRoutingItems() const {
+        return routing_items_;
     }
 
     std::optional<RouteInfo> TransportRouter::GetRouteInfo(std::string_view from_stop, std::string_view to_stop) const {
-        assert(is_builded_ && raw_router_ptr_ != nullptr);
+        assert(is_builded_ && (raw_router_ptr_ != nullptr || raptor_router_ptr_ != nullptr));
 
         const data::StopRecord from_stop_record = db_reader_.GetStop(from_stop);
         const data::StopRecord to_stop_record = db_reader_.GetStop(to_stop);
         assert(from_stop_record != nullptr && to_stop_record != nullptr);
 
-        auto edge_info = raw_router_ptr_->BuildRoute(index_mapper_.GetAt(from_stop_record), index_mapper_.GetAt(to_stop_record));
-        if (!edge_info.has_value()) {
+        const graph::VertexId from = index_mapper_.GetAt(from_stop_record);
+        const graph::VertexId to = index_mapper_.GetAt(to_stop_record);
+        if (reachability_.has_value() && !reachability_->MayReach(from, to)) {
+            return std::nullopt;
+        }
+        const uint64_t cache_key = (static_cast<uint64_t>(from) << 32) | static_cast<uint64_t>(to);
+        if (std::optional<std::optional<RouteInfo>> cached = route_cache_.Find(cache_key); cached.has_value()) {
+            return std::move(cached.value());
+        }
+
+        std::optional<RouteInfo> route_info;
+        if (raptor_router_ptr_ != nullptr) {
+            std::optional<RaptorRouter::Journey> journey = raptor_router_ptr_->BuildRoute(from_stop_record, to_stop_record);
+            if (journey.has_value()) {
+                route_info = MakeRouteInfo_(std::move(journey.value()));
+            }
+        } else if (auto edge_info = raw_router_ptr_->BuildRoute(from, to); edge_info.has_value()) {
+            route_info = MakeRouteInfo_(std::move(edge_info.value()));
+        }
+        route_cache_.Insert(cache_key, route_info);
+        return route_info;
+    }
+
+    RouteMatrix TransportRouter::GetRouteMatrix(
+        const std::vector<std::string_view>& source_stops, const std::vector<std::string_view>& target_stops, bool unpack_routes) const {
+        assert(is_builded_ && (raw_router_ptr_ != nullptr || raptor_router_ptr_ != nullptr));
+
+        // Every stop name is resolved once, unknown stops are skipped
+        const auto resolve_stops = [this](const std::vector<std::string_view>& stop_names) {
+            std::vector<data::StopRecord> stops;
+            std::vector<size_t> indexes;
+            for (size_t i = 0; i < stop_names.size(); ++i) {
+                const data::StopRecord stop = db_reader_.GetStop(stop_names[i]);
+                if (stop != nullptr) {
+                    stops.push_back(stop);
+                    indexes.push_back(i);
+                }
+            }
+            return std::pair{std::move(stops), std::move(indexes)};
+        };
+        const auto [sources, source_indexes] = resolve_stops(source_stops);
+        const auto [targets, target_indexes] = resolve_stops(target_stops);
+
+        RouteMatrix matrix{source_stops.size(), target_stops.size(), unpack_routes, {}};
+        matrix.routes.resize(matrix.sources_count * matrix.targets_count);
+        const auto set_route = [&matrix, &source_indexes = source_indexes, &target_indexes = target_indexes](
+                                   size_t source_index, size_t target_index, std::optional<RouteInfo>&& route) {
+            matrix.routes[source_indexes[source_index] * matrix.targets_count + target_indexes[target_index]] = std::move(route);
+        };
+
+        if (raptor_router_ptr_ != nullptr) {
+            // One search per source, the journeys to all the targets are read from its labels
+            for (size_t i = 0; i < sources.size(); ++i) {
+                std::vector<std::optional<RaptorRouter::Journey>> journeys = raptor_router_ptr_->BuildRoutes(sources[i], targets);
+                for (size_t j = 0; j < targets.size(); ++j) {
+                    std::optional<RaptorRouter::Journey>& journey = journeys[j];
+                    set_route(i, j, journey.has_value() ? std::optional{MakeRouteInfo_(std::move(journey.value()))} : std::nullopt);
+                }
+            }
+            if (!unpack_routes) {
+                std::for_each(matrix.routes.begin(), matrix.routes.end(), [](std::optional<RouteInfo>& route) {
+                    if (route.has_value()) {
+                        route->items.clear();
+                    }
+                });
+            }
+            return matrix;
+        }
+
+        const auto to_vertices = [this](const std::vector<data::StopRecord>& stops) {
+            std::vector<graph::VertexId> vertices(stops.size());
+            std::transform(stops.begin(), stops.end(), vertices.begin(), [this](data::StopRecord stop) {
+                return index_mapper_.GetAt(stop);
+            });
+            return vertices;
+        };
+        std::vector<std::optional<RawRouter::RouteInfo>> routes = raw_router_ptr_->BuildRoutes(to_vertices(sources), to_vertices(targets));
+        for (size_t i = 0; i < sources.size(); ++i) {
+            for (size_t j = 0; j < targets.size(); ++j) {
+                std::optional<RawRouter::RouteInfo>& route = routes[i * targets.size() + j];
+                set_route(i, j, route.has_value() ? std::optional{MakeRouteInfo_(std::move(route.value()), unpack_routes)} : std::nullopt);
+            }
+        }
+        return matrix;
+    }
+
+    std::optional<ReachableStops> TransportRouter::GetReachableStops(std::string_view from_stop, double max_time) const {
+        assert(is_builded_ && (raw_router_ptr_ != nullptr || raptor_router_ptr_ != nullptr));
+
+        const data::StopRecord from_stop_record = db_reader_.GetStop(from_stop);
+        if (from_stop_record == nullptr) {
             return std::nullopt;
         }
+
+        ReachableStops reachable_stops;
+        if (raptor_router_ptr_ != nullptr) {
+            const auto reachable = raptor_router_ptr_->BuildReachable(from_stop_record, max_time);
+            reachable_stops.reserve(reachable.size());
+            for (const auto& [stop, time] : reachable) {
+                reachable_stops.push_back({stop->name, time});
+            }
+        } else {
+            // Precomputed routers have no bounded search, so the routing graph is searched directly
+            const data::DatabaseScheme::StopsTable& stops = db_reader_.GetStopsTable();
+            const auto reachable = GetGraphRouter_().BuildReachable(index_mapper_.GetAt(from_stop_record), max_time);
+            reachable_stops.reserve(reachable.size());
+            for (const auto& [vertex, time] : reachable) {
+                reachable_stops.push_back({stops[index_mapper_.GetStopIndex(vertex)].name, time});
+            }
+        }
+
+        std::sort(reachable_stops.begin(), reachable_stops.end(), [](const ReachableStop& lhs, const ReachableStop& rhs) {
+            return std::tie(lhs.time, lhs.stop_name) < std::tie(rhs.time, rhs.stop_name);
+        });
+        return reachable_stops;
+    }
+
+    const graph::DijkstraRouter<double>& TransportRouter::GetGraphRouter_() const {
+        if (const auto* dijkstra_router = dynamic_cast<const graph::DijkstraRouter<double>*>(raw_router_ptr_.get()); dijkstra_router != nullptr) {
+            return *dijkstra_router;
+        }
+        // The router keeps a reference to the graph member only, so the weights updated in place are searched as well
+        if (graph_router_ptr_ == nullptr) {
+            graph_router_ptr_ = std::make_unique<graph::DijkstraRouter<double>>(graph_);
+        }
+        return *graph_router_ptr_;
+    }
+
+    RouteInfo TransportRouter::MakeRouteInfo_(RawRouter::RouteInfo&& route, bool unpack_route) const {
         RouteInfo::ItemsCollection items;
-        items.reserve(edge_info->edges.size());
-        for (graph::EdgeId edge_id : edge_info->edges) {
-            RoutingItemInfo raw_info = edges_.at(edge_id);
-            RouteInfo::WaitInfo wait_info{raw_info.stop_name, raw_info.bus_wait_time_min};
-            RouteInfo::BusInfo bus_info{raw_info.bus_name, raw_info.travel_items_count, raw_info.bus_travel_time};
+        if (unpack_route) {
+            const data::DatabaseScheme::StopsTable& stops = db_reader_.GetStopsTable();
+            const data::DatabaseScheme::BusRoutesTable& buses = db_reader_.GetBusRoutesTable();
+            items.reserve(route.edges.size());
+            for (graph::EdgeId edge_id : route.edges) {
+                const RoutingItem item = routing_items_.Get(edge_id);
+                RouteInfo::WaitInfo wait_info{stops[item.stop_id].name, settings_.bus_wait_time_min};
+                RouteInfo::BusInfo bus_info{buses[item.bus_id].name, item.span_count, item.travel_time};
+                items.emplace_back(std::move(bus_info), std::move(wait_info));
+            }
+        }
+        return RouteInfo{route.weight, std::move(items)};
+    }
+
+    std::vector<RouteInfo> TransportRouter::GetParetoRouteInfos(std::string_view from_stop, std::string_view to_stop) const {
+        assert(is_builded_);
+        if (raptor_router_ptr_ == nullptr) {
+            throw std::logic_error("Pareto routes are available for the RAPTOR router only");
+        }
+
+        const data::StopRecord from_stop_record = db_reader_.GetStop(from_stop);
+        const data::StopRecord to_stop_record = db_reader_.GetStop(to_stop);
+        assert(from_stop_record != nullptr && to_stop_record != nullptr);
+
+        std::vector<RaptorRouter::Journey> journeys = raptor_router_ptr_->BuildParetoRoutes(from_stop_record, to_stop_record);
+        std::vector<RouteInfo> result;
+        result.reserve(journeys.size());
+        std::for_each(std::make_move_iterator(journeys.begin()), std::make_move_iterator(journeys.end()), [this, &result](auto&& journey) {
+            result.push_back(MakeRouteInfo_(std::move(journey)));
+        });
+        return result;
+    }
+
+    RouteInfo TransportRouter::MakeRouteInfo_(RaptorRouter::Journey&& journey) const {
+        RouteInfo::ItemsCollection items;
+        items.reserve(journey.legs.size());
+        for (const RaptorRouter::Leg& leg : journey.legs) {
+            RouteInfo::WaitInfo wait_info{leg.board_stop->name, settings_.bus_wait_time_min};
+            RouteInfo::BusInfo bus_info{leg.bus->name, leg.span_count, leg.travel_time};
             items.emplace_back(std::move(bus_info), std::move(wait_info));
         }
-        return RouteInfo{edge_info->weight, std::move(items)};
+        return RouteInfo{journey.total_time, std::move(items)};
     }
 
     void TransportRouter::Build() {
@@ -70,79 +323,494 @@ namespace transport_catalogue::router /* TransportRouter implementation */ {
         const auto& buses_table = db_reader_.GetBusRoutesTable();
 
         graph_ = RoutingGraph(db_reader_.GetStopsTable().size());
-        index_mapper_ = IndexMapper(db_reader_.GetStopsTable());
+        index_mapper_ = IndexMapper(db_reader_.GetStopsTable(), MakeVertexIds_());
 
-        std::for_each(buses_table.begin(), buses_table.end(), [this](const auto& bus) {
-            AddRouteEdges_(bus);
-        });
+        build_stats_ = RoutingBuildStats{};
+        routing_items_.Clear();
+        // RAPTOR scans the buses routes directly, the pairwise edges are not needed
+        if (settings_.router_type != RouterType::RAPTOR) {
+            std::optional<CollapsedEdges> collapsed_edges = settings_.collapse_parallel_edges ? std::optional{CollapsedEdges{}} : std::nullopt;
+            std::for_each(buses_table.begin(), buses_table.end(), [this, &collapsed_edges](const auto& bus) {
+                AddRouteEdges_(bus, bus.id, collapsed_edges.has_value() ? &collapsed_edges.value() : nullptr);
+            });
+            if (collapsed_edges.has_value()) {
+                routing_items_.Reserve(collapsed_edges->edges.size());
+                for (auto& [edge, item] : collapsed_edges->edges) {
+                    graph_.AddEdge(std::move(edge));
+                    routing_items_.PushBack(item);
+                }
+            }
+        }
+        build_stats_.edges_count = graph_.GetEdgeCount();
+        graph_.Freeze();
+        if (settings_.router_type != RouterType::RAPTOR) {
+            reachability_ = RoutingReachability::Build(graph_);
+        }
 
-        raw_router_ptr_ = std::make_unique<graph::Router<double>>(graph_);
+        raw_router_ptr_ = MakeRawRouter_();
 
         is_builded_ = true;
     }
 
-    void TransportRouter::AddRouteEdges_(const data::Bus& bus) {
+    void TransportRouter::AddRouteEdge_(RoutingGraph::EdgeType&& edge, const RoutingItem& item, CollapsedEdges* collapsed_edges) {
+        ++build_stats_.generated_edges_count;
+        if (collapsed_edges == nullptr) {
+            graph_.AddEdge(std::move(edge));
+            routing_items_.PushBack(item);
+            return;
+        }
+
+        const uint64_t key = (static_cast<uint64_t>(edge.from) << 32) | static_cast<uint64_t>(edge.to);
+        const auto [it, is_inserted] = collapsed_edges->indexes.emplace(key, collapsed_edges->edges.size());
+        if (is_inserted) {
+            collapsed_edges->edges.emplace_back(std::move(edge), item);
+        } else if (edge.weight < collapsed_edges->edges[it->second].first.weight) {
+            collapsed_edges->edges[it->second] = {std::move(edge), item};
+        }
+    }
+
+    template <typename OnEdge>
+    void TransportRouter::ForEachRouteEdge_(const data::Bus& bus, uint32_t bus_id, OnEdge&& on_edge) const {
         if (bus.route.size() < 2) {
             return;
         }
 
         const data::Route& route = bus.route;
 
+        // The distances of the route parts are the differences of the cumulative route distances. A hop back to the boarding stop
+        // makes no edge and is not counted in the distance and in the span of the farther rides
         for (size_t i = 0; i < route.size() - 1ul; ++i) {
-            size_t span = 1;
-            double total_travel_time = settings_.bus_wait_time_min;
             const data::StopRecord& from_stop_ptr = route[i];
+            const graph::VertexId from_vertex = index_mapper_.GetAt(from_stop_ptr);
+            double skipped_distance = 0.;
+            size_t skipped_count = 0;
             for (size_t j = i + 1; j < route.size(); ++j) {
-                const data::StopRecord& current_stop_ptr = route[j - 1];
                 const data::StopRecord& next_stop_ptr = route[j];
                 if (from_stop_ptr == next_stop_ptr) {
+                    skipped_distance += bus.GetMeasuredDistance(j - 1, j);
+                    ++skipped_count;
+                    continue;
+                }
+
+                const double total_distance = bus.GetMeasuredDistance(i, j) - skipped_distance;
+                const double travel_time = total_distance / 1000.0 / settings_.bus_velocity_kmh * 60.0;
+
+                RoutingGraph::EdgeType edge{from_vertex, index_mapper_.GetAt(next_stop_ptr), settings_.bus_wait_time_min + travel_time};
+                RoutingItem item{bus_id, from_stop_ptr->id, static_cast<uint32_t>(j - i - skipped_count), travel_time, total_distance};
+
+                on_edge(std::move(edge), item);
+            }
+        }
+    }
+
+    void TransportRouter::AddRouteEdges_(const data::Bus& bus, uint32_t bus_id, CollapsedEdges* collapsed_edges) {
+        ForEachRouteEdge_(bus, bus_id, [this, collapsed_edges](RoutingGraph::EdgeType&& edge, const RoutingItem& item) {
+            AddRouteEdge_(std::move(edge), item, collapsed_edges);
+        });
+    }
+
+    void TransportRouter::AddBus(std::string_view bus_name) {
+        if (!is_builded_) {
+            return;
+        }
+
+        const data::BusRecord bus = db_reader_.GetBus(bus_name);
+        if (bus == nullptr) {
+            throw std::invalid_argument("Unknown bus: " + std::string(bus_name));
+        }
+        if (db_reader_.GetStopsTable().size() != graph_.GetVertexCount()) {
+            // New stops are new vertices, the routing data of all routers is sized by the vertex count
+            ResetGraph();
+            Build();
+            return;
+        }
+
+        std::vector<graph::EdgeId> lighter_edges;
+        if (settings_.router_type != RouterType::RAPTOR) {
+            graph_.Unfreeze();
+            ForEachRouteEdge_(*bus, bus->id, [this, &lighter_edges](RoutingGraph::EdgeType&& edge, const RoutingItem& item) {
+                ++build_stats_.generated_edges_count;
+                if (settings_.collapse_parallel_edges) {
+                    // Only the lightest of parallel edges is kept, so the edge between the same stops is replaced if the new one is lighter
+                    const auto incident_edges = graph_.GetIncidentEdges(edge.from);
+                    const auto parallel_edge_it = std::find_if(incident_edges.begin(), incident_edges.end(), [this, &edge](graph::EdgeId edge_id) {
+                        return graph_.GetEdge(edge_id).to == edge.to;
+                    });
+                    if (parallel_edge_it != incident_edges.end()) {
+                        if (edge.weight < graph_.GetEdge(*parallel_edge_it).weight) {
+                            graph_.SetEdgeWeight(*parallel_edge_it, edge.weight);
+                            routing_items_.Set(*parallel_edge_it, item);
+                            lighter_edges.push_back(*parallel_edge_it);
+                        }
+                        return;
+                    }
+                }
+                lighter_edges.push_back(graph_.AddEdge(std::move(edge)));
+                routing_items_.PushBack(item);
+            });
+            build_stats_.edges_count = graph_.GetEdgeCount();
+            graph_.Freeze();
+            // New edges may join the components
+            reachability_ = RoutingReachability::Build(graph_);
+        }
+
+        UpdateRawRouter_({}, lighter_edges);
+    }
+
+    void TransportRouter::UpdateDistance(std::string_view from_stop, std::string_view to_stop) {
+        if (!is_builded_) {
+            return;
+        }
+
+        const data::StopRecord from_stop_record = db_reader_.GetStop(from_stop);
+        const data::StopRecord to_stop_record = db_reader_.GetStop(to_stop);
+        if (from_stop_record == nullptr || to_stop_record == nullptr) {
+            throw std::invalid_argument("Unknown stop: " + std::string(from_stop_record == nullptr ? from_stop : to_stop));
+        }
+        if (db_reader_.GetStopsTable().size() != graph_.GetVertexCount() || settings_.collapse_parallel_edges) {
+            // The parallel edges dropped by collapsing are not kept, so the lightest ones can be chosen again only by the full build
+            ResetGraph();
+            Build();
+            return;
+        }
+
+        // The distance in one direction is used for the other one if it is not measured, so rides in both directions are affected
+        const data::DatabaseScheme::BusRoutesTable& buses = db_reader_.GetBusRoutesTable();
+        std::vector<bool> is_affected_bus(buses.size(), false);
+        for (const data::Bus& bus : buses) {
+            for (size_t i = 1; i < bus.route.size() && !is_affected_bus[bus.id]; ++i) {
+                is_affected_bus[bus.id] = (bus.route[i - 1] == from_stop_record && bus.route[i] == to_stop_record) ||
+                                          (bus.route[i - 1] == to_stop_record && bus.route[i] == from_stop_record);
+            }
+        }
+
+        std::vector<graph::EdgeId> heavier_edges;
+        std::vector<graph::EdgeId> lighter_edges;
+        if (settings_.router_type != RouterType::RAPTOR) {
+            // Edges of a bus are in the order of their generation, so the regenerated edges match them one by one
+            std::vector<std::vector<graph::EdgeId>> bus_edges(buses.size());
+            const std::vector<uint32_t>& bus_ids = routing_items_.GetBusIds();
+            for (graph::EdgeId edge_id = 0; edge_id < bus_ids.size(); ++edge_id) {
+                if (is_affected_bus[bus_ids[edge_id]]) {
+                    bus_edges[bus_ids[edge_id]].push_back(edge_id);
+                }
+            }
+
+            for (data::BusId bus_id = 0; bus_id < buses.size(); ++bus_id) {
+                if (!is_affected_bus[bus_id]) {
                     continue;
                 }
+                auto edge_it = bus_edges[bus_id].begin();
+                ForEachRouteEdge_(
+                    buses[bus_id], bus_id, [this, &edge_it, &heavier_edges, &lighter_edges](RoutingGraph::EdgeType&& edge, const RoutingItem& item) {
+                        const graph::EdgeId edge_id = *edge_it++;
+                        const double weight = graph_.GetEdge(edge_id).weight;
+                        assert(graph_.GetEdge(edge_id).from == edge.from && graph_.GetEdge(edge_id).to == edge.to);
+                        if (edge.weight != weight) {
+                            graph_.SetEdgeWeight(edge_id, edge.weight);
+                            routing_items_.Set(edge_id, item);
+                            (edge.weight > weight ? heavier_edges : lighter_edges).push_back(edge_id);
+                        }
+                    });
+                assert(edge_it == bus_edges[bus_id].end());
+            }
+            if (heavier_edges.empty() && lighter_edges.empty()) {
+                return;
+            }
+        }
+
+        UpdateRawRouter_(heavier_edges, lighter_edges);
+    }
+
+    void TransportRouter::UpdateRawRouter_(const std::vector<graph::EdgeId>& heavier_edges, const std::vector<graph::EdgeId>& lighter_edges) {
+        route_cache_.Clear();
+        routing_profiles_.reset();
+
+        if (auto* all_pairs_router = dynamic_cast<AllPairsRouter*>(raw_router_ptr_.get()); all_pairs_router != nullptr) {
+            // Heavier edges are repaired first: the recalculated rows are exact, the rest of the rows are relaxed by the lighter edges
+            all_pairs_router->RepairEdges(heavier_edges);
+            all_pairs_router->RelaxEdges(lighter_edges);
+            return;
+        }
+
+        // Other routers depend on the whole graph (the hierarchy, the landmarks, the heuristic calibration) or on the catalogue
+        raw_router_ptr_ = nullptr;
+        raptor_router_ptr_ = nullptr;
+        landmarks_.reset();
+        raw_router_ptr_ = MakeRawRouter_();
+    }
+
+    void TransportRouter::CustomizeWeights_() {
+        route_cache_.Clear();
+
+        if (settings_.router_type == RouterType::RAPTOR) {
+            raptor_router_ptr_ = nullptr;
+            raw_router_ptr_ = MakeRawRouter_();
+            return;
+        }
+        if (routing_items_.GetSize() != graph_.GetEdgeCount()) {
+            throw std::logic_error("Routing items do not match the graph edges");
+        }
+
+        // Every edge is one boarding and a ride of the stored distance, so the weights are linear in the settings.
+        // The lightest of the parallel edges is the shortest one for any settings, so the collapsed graph is kept as well
+        routing_items_.SetVelocity(settings_.bus_velocity_kmh);
+        const std::vector<double>& travel_times = routing_items_.GetTravelTimes();
+        std::vector<double> weights(travel_times.size());
+        std::transform(travel_times.begin(), travel_times.end(), weights.begin(), [wait_time = settings_.bus_wait_time_min](double travel_time) {
+            return wait_time + travel_time;
+        });
+        graph_.SetEdgeWeights(weights);
+
+        // The all-pairs table is made from the routes profiles by the new wait time and the minutes per meter, without a search.
+        // The profiles do not depend on the settings, they are built on the first change and kept until the graph is changed
+        if (settings_.router_type == RouterType::ALL_PAIRS) {
+            if (!routing_profiles_.has_value()) {
+                routing_profiles_.emplace(graph_, routing_items_.GetDistances());
+            }
+            RoutesInternalData routes_data = routing_profiles_->Customize<RoutesInternalData>(
+                settings_.bus_wait_time_min, 1. / 1000.0 / settings_.bus_velocity_kmh * 60.0);
+            raw_router_ptr_ = nullptr;
+            raw_router_ptr_ = std::make_unique<AllPairsRouter>(graph_, std::move(routes_data));
+            return;
+        }
+
+        // Other routers are remade over the new weights. The contraction order is kept, but all shortcuts are recalculated
+        std::optional<std::vector<graph::VertexId>> ranks;
+        if (const RoutingHierarchy* hierarchy = GetRoutingHierarchy(); hierarchy != nullptr) {
+            ranks = hierarchy->ranks;
+        }
+        raw_router_ptr_ = nullptr;
+        landmarks_.reset();
+        raw_router_ptr_ = ranks.has_value() ? std::make_unique<ContractionHierarchyRouter>(
+                                                  graph_, graph::ContractionHierarchyBuilder<double>(graph_).Build(ranks.value()))
+                                            : MakeRawRouter_();
+    }
 
-                auto it = db_reader_.GetDistanceBetweenStops(current_stop_ptr, next_stop_ptr);
-                total_travel_time += it.measured_distance / 1000.0 / settings_.bus_velocity_kmh * 60.0;
+    std::unique_ptr<RawRouter> TransportRouter::MakeRawRouter_() {
+        switch (settings_.router_type) {
+        case RouterType::DIJKSTRA:
+            return std::make_unique<graph::DijkstraRouter<double>>(graph_);
+        case RouterType::CONTRACTION_HIERARCHY:
+            return std::make_unique<ContractionHierarchyRouter>(graph_);
+        case RouterType::A_STAR:
+            return std::make_unique<AStarRouter>(graph_, MakeGeoHeuristic_());
+        case RouterType::ALT: {
+            if (!landmarks_.has_value()) {
+                landmarks_ = RoutingLandmarks::Build(graph_, LANDMARKS_COUNT);
+            }
+            return std::make_unique<AStarRouter>(
+                graph_, [geo_heuristic = MakeGeoHeuristic_(), landmarks = &landmarks_.value()](graph::VertexId vertex, graph::VertexId to) {
+                    return std::max(geo_heuristic(vertex, to), landmarks->GetLowerBound(vertex, to));
+                });
+        }
+        case RouterType::RAPTOR:
+            raptor_router_ptr_ = std::make_unique<RaptorRouter>(db_reader_, settings_.bus_wait_time_min, settings_.bus_velocity_kmh);
+            return nullptr;
+        case RouterType::ALL_PAIRS:
+        default:
+            return std::make_unique<AllPairsRouter>(graph_);
+        }
+    }
 
-                auto ege_id =
-                    graph_.AddEdge(RoutingGraph::EdgeType{index_mapper_.GetAt(from_stop_ptr), index_mapper_.GetAt(next_stop_ptr), total_travel_time});
+    AStarRouter::Heuristic TransportRouter::MakeGeoHeuristic_() const {
+        const data::DatabaseScheme::StopsTable& stops = db_reader_.GetStopsTable();
+        if (stops.size() != graph_.GetVertexCount()) {
+            return [](graph::VertexId, graph::VertexId) {
+                return 0.;
+            };
+        }
 
-                const RoutingItemInfo info{
-                    bus.name, settings_.bus_wait_time_min, total_travel_time - settings_.bus_wait_time_min, span, from_stop_ptr->name,
-                };
+        // Stops as points on the unit sphere: the chord length is a metric and never exceeds the arc length
+        using Point = std::array<double, 3>;
+        std::vector<Point> points(stops.size());
+        for (graph::VertexId vertex = 0; vertex < points.size(); ++vertex) {
+            const data::Stop& stop = stops[index_mapper_.GetStopIndex(vertex)];
+            const double lat = geo::ToRadians(stop.coordinates.lat);
+            const double lng = geo::ToRadians(stop.coordinates.lng);
+            points[vertex] = {std::cos(lat) * std::cos(lng), std::cos(lat) * std::sin(lng), std::sin(lat)};
+        }
+        const auto chord = [](const Point& lhs, const Point& rhs) {
+            return std::hypot(lhs[0] - rhs[0], lhs[1] - rhs[1], lhs[2] - rhs[2]);
+        };
 
-                edges_.emplace(std::move(ege_id), std::move(info));
-                ++span;
+        // The bus velocity alone does not give a lower bound, since measured road distances may be shorter than geo distances.
+        // So the time per chord unit is calibrated by the edges: no edge is faster, hence no route is faster too.
+        double time_per_chord = std::numeric_limits<double>::infinity();
+        for (graph::EdgeId edge_id = 0; edge_id < graph_.GetEdgeCount(); ++edge_id) {
+            const auto& edge = graph_.GetEdge(edge_id);
+            const double edge_chord = chord(points[edge.from], points[edge.to]);
+            if (edge_chord > 0.) {
+                time_per_chord = std::min(time_per_chord, edge.weight / edge_chord);
             }
         }
+        // Keep a margin for rounding errors, the heuristic must not overestimate
+        time_per_chord = std::isfinite(time_per_chord) ? time_per_chord * (1. - 1e-9) : 0.;
+
+        return [points = std::move(points), chord, time_per_chord](graph::VertexId vertex, graph::VertexId to) {
+            return time_per_chord * chord(points[vertex], points[to]);
+        };
+    }
+
+    VertexIds TransportRouter::MakeVertexIds_() const {
+        const data::DatabaseScheme::StopsTable& stops = db_reader_.GetStopsTable();
+        if (settings_.vertex_order != VertexOrder::HILBERT_CURVE || stops.empty()) {
+            return {};
+        }
+
+        geo::Coordinates min{stops.front().coordinates};
+        geo::Coordinates max{stops.front().coordinates};
+        std::for_each(stops.begin(), stops.end(), [&min, &max](const data::Stop& stop) {
+            min = {std::min(min.lat, stop.coordinates.lat), std::min(min.lng, stop.coordinates.lng)};
+            max = {std::max(max.lat, stop.coordinates.lat), std::max(max.lng, stop.coordinates.lng)};
+        });
+
+        // Stops are sorted by the curve position, the stops table order breaks ties, so the order is deterministic
+        std::vector<std::pair<uint64_t, size_t>> positions;
+        positions.reserve(stops.size());
+        size_t stop_index = 0;
+        std::for_each(stops.begin(), stops.end(), [&](const data::Stop& stop) {
+            positions.emplace_back(geo::ComputeHilbertIndex(stop.coordinates, min, max), stop_index++);
+        });
+        std::sort(positions.begin(), positions.end());
+
+        VertexIds vertex_ids(stops.size());
+        for (graph::VertexId vertex = 0; vertex < positions.size(); ++vertex) {
+            vertex_ids[positions[vertex].second] = vertex;
+        }
+        return vertex_ids;
     }
 
     void TransportRouter::ResetGraph() {
         raw_router_ptr_ = nullptr;
+        graph_router_ptr_ = nullptr;
+        raptor_router_ptr_ = nullptr;
+        landmarks_.reset();
+        routing_profiles_.reset();
+        reachability_.reset();
         is_builded_ = false;
         graph_ = RoutingGraph();
+        routing_items_.Clear();
+        route_cache_.Clear();
+    }
+}
+
+namespace transport_catalogue::router /* RoutingItems implementation */ {
+    void RoutingItems::PushBack(const RoutingItem& item) {
+        bus_ids_.push_back(item.bus_id);
+        stop_ids_.push_back(item.stop_id);
+        span_counts_.push_back(item.span_count);
+        travel_times_.push_back(item.travel_time);
+        distances_.push_back(item.distance);
+    }
+
+    void RoutingItems::Reserve(size_t count) {
+        bus_ids_.reserve(count);
+        stop_ids_.reserve(count);
+        span_counts_.reserve(count);
+        travel_times_.reserve(count);
+        distances_.reserve(count);
+    }
+
+    void RoutingItems::Clear() {
+        bus_ids_.clear();
+        stop_ids_.clear();
+        span_counts_.clear();
+        travel_times_.clear();
+        distances_.clear();
+    }
+
+    RoutingItem RoutingItems::Get(graph::EdgeId edge_id) const {
+        if (edge_id >= GetSize()) {
+            throw std::out_of_range("Routing item of the edge is not found");
+        }
+        return RoutingItem{bus_ids_[edge_id], stop_ids_[edge_id], span_counts_[edge_id], travel_times_[edge_id], distances_[edge_id]};
+    }
+
+    void RoutingItems::Set(graph::EdgeId edge_id, const RoutingItem& item) {
+        if (edge_id >= GetSize()) {
+            throw std::out_of_range("Routing item of the edge is not found");
+        }
+        bus_ids_[edge_id] = item.bus_id;
+        stop_ids_[edge_id] = item.stop_id;
+        span_counts_[edge_id] = item.span_count;
+        travel_times_[edge_id] = item.travel_time;
+        distances_[edge_id] = item.distance;
+    }
+
+    size_t RoutingItems::GetSize() const {
+        return bus_ids_.size();
+    }
+
+    const std::vector<uint32_t>& RoutingItems::GetBusIds() const {
+        return bus_ids_;
+    }
+
+    const std::vector<uint32_t>& RoutingItems::GetStopIds() const {
+        return stop_ids_;
+    }
+
+    const std::vector<uint32_t>& RoutingItems::GetSpanCounts() const {
+        return span_counts_;
+    }
+
+    const std::vector<double>& RoutingItems::GetTravelTimes() const {
+        return travel_times_;
+    }
+
+    const std::vector<double>& RoutingItems::GetDistances() const {
+        return distances_;
+    }
+
+    void RoutingItems::SetVelocity(double bus_velocity_kmh) {
+        std::transform(distances_.begin(), distances_.end(), travel_times_.begin(), [bus_velocity_kmh](double distance) {
+            return distance / 1000.0 / bus_velocity_kmh * 60.0;
+        });
     }
 }
 
 namespace transport_catalogue::router /* TransportRouter::IndexMapper implementation */ {
-    TransportRouter::IndexMapper::IndexMapper(const data::DatabaseScheme::StopsTable& stops) {
-        Init_(stops);
+    TransportRouter::IndexMapper::IndexMapper(const data::DatabaseScheme::StopsTable& stops, VertexIds vertex_ids) {
+        Init_(stops, std::move(vertex_ids));
     }
 
     graph::VertexId TransportRouter::IndexMapper::GetAt(const data::Stop* stop_ptr) const {
-        return indexes_.at(stop_ptr);
+        return vertex_ids_.at(stop_ptr->id);
+    }
+
+    size_t TransportRouter::IndexMapper::GetStopIndex(graph::VertexId vertex) const {
+        return stop_indexes_.at(vertex);
+    }
+
+    const VertexIds& TransportRouter::IndexMapper::GetVertexIds() const {
+        return vertex_ids_;
     }
 
     size_t TransportRouter::IndexMapper::IndexesCount() const {
-        return indexes_.size();
+        return vertex_ids_.size();
     }
 
     bool TransportRouter::IndexMapper::IsEmpty() const {
-        return indexes_.empty();
+        return vertex_ids_.empty();
     }
 
-    void TransportRouter::IndexMapper::Init_(const data::DatabaseScheme::StopsTable& stops) {
-        size_t idx = 0;
-        std::for_each(stops.begin(), stops.end(), [this, &idx](const data::Stop& stop) {
-            indexes_.emplace(&stop, idx++);
-        });
+    void TransportRouter::IndexMapper::Init_(const data::DatabaseScheme::StopsTable& stops, VertexIds&& vertex_ids) {
+        if (vertex_ids.empty()) {
+            vertex_ids.resize(stops.size());
+            std::iota(vertex_ids.begin(), vertex_ids.end(), graph::VertexId{0});
+        }
+        if (vertex_ids.size() != stops.size()) {
+            throw std::invalid_argument("Vertex ids do not match the stops count");
+        }
+
+        stop_indexes_.assign(stops.size(), stops.size());
+        for (size_t stop_index = 0; stop_index < vertex_ids.size(); ++stop_index) {
+            const graph::VertexId vertex = vertex_ids[stop_index];
+            if (vertex >= stops.size() || stop_indexes_[vertex] != stops.size()) {
+                throw std::invalid_argument("Vertex ids are not a permutation of the stops indexes");
+            }
+            stop_indexes_[vertex] = stop_index;
+        }
+        vertex_ids_ = std::move(vertex_ids);
     }
-}
\ No newline at end of file
+}
@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <string_view>
@@ -10,8 +11,10 @@
 #include <variant>
 #include <vector>
 
+#include "detail/lru_cache.h"
 #include "domain.h"
 #include "graph.h"
+#include "raptor_router.h"
 #include "router.h"
 #include "transport_catalogue.h"
 
@@ -39,22 +42,118 @@ namespace transport_catalogue::router /* RouteInfo */ {
         ItemsCollection items;
     };
 
-    struct RoutingItemInfo {
-        std::string_view bus_name;
-        double bus_wait_time_min = 0.;
-        double bus_travel_time = 0.;
-        size_t travel_items_count = 0;
+    /// Routes between every source and every target stop (row-major, sources x targets)
+    struct RouteMatrix {
+        size_t sources_count = 0;
+        size_t targets_count = 0;
+        bool is_unpacked = false;
+        /// Route is nullopt if it does not exist. Items are empty unless the routes are unpacked
+        std::vector<std::optional<RouteInfo>> routes;
+
+        const std::optional<RouteInfo>& GetRoute(size_t source_index, size_t target_index) const {
+            return routes.at(source_index * targets_count + target_index);
+        }
+    };
+
+    /// Stop reachable within a time budget and the earliest arrival time to it
+    struct ReachableStop {
         std::string_view stop_name;
+        double time = 0.;
     };
 
+    using ReachableStops = std::vector<ReachableStop>;
+
+    /// Bus ride of a routing graph edge: boarding at the stop and riding `span_count` spans of `distance` meters for `travel_time` minutes.
+    /// Ids are indexes in the buses and the stops tables (the stop of the edge start, which is not its vertex id if the vertices are reordered)
+    struct RoutingItem {
+        uint32_t bus_id = 0;
+        uint32_t stop_id = 0;
+        uint32_t span_count = 0;
+        double travel_time = 0.;
+        /// Measured distance of the ride, it does not depend on the routing settings
+        double distance = 0.;
+    };
+
+    /// Routing items of the graph edges stored column by column and indexed by the edge id
+    class RoutingItems {
+    public:
+        /// Append the item of the next edge id
+        void PushBack(const RoutingItem& item);
+        void Reserve(size_t count);
+        void Clear();
+
+        /// Throw std::out_of_range if there is no item of the edge
+        RoutingItem Get(graph::EdgeId edge_id) const;
+        void Set(graph::EdgeId edge_id, const RoutingItem& item);
+        size_t GetSize() const;
+
+        const std::vector<uint32_t>& GetBusIds() const;
+        const std::vector<uint32_t>& GetStopIds() const;
+        const std::vector<uint32_t>& GetSpanCounts() const;
+        const std::vector<double>& GetTravelTimes() const;
+        const std::vector<double>& GetDistances() const;
+
+        /// Recalculate the travel times of all items by the bus velocity
+        void SetVelocity(double bus_velocity_kmh);
+
+    private:
+        std::vector<uint32_t> bus_ids_;
+        std::vector<uint32_t> stop_ids_;
+        std::vector<uint32_t> span_counts_;
+        std::vector<double> travel_times_;
+        std::vector<double> distances_;
+    };
+
+    /// Routing engine used to answer route queries
+    /// ALL_PAIRS - precompute all routes on build (Floyd-Warshall), O(1) queries
+    /// DIJKSTRA - no precompute, single-pair search on each query
+    /// CONTRACTION_HIERARCHY - contract vertices and add shortcuts on build, bidirectional upward search on each query
+    /// A_STAR - no precompute, search directed to the target by the stops coordinates on each query
+    /// ALT - landmark tables precomputed on build, search directed by landmarks and stops coordinates on each query
+    /// RAPTOR - no routing graph, round-based scan of the buses routes on each query (one round per boarding)
+    enum class RouterType : uint8_t { ALL_PAIRS, DIJKSTRA, CONTRACTION_HIERARCHY, A_STAR, ALT, RAPTOR };
+
+    /// Numbering of the routing graph vertices
+    /// STOPS_TABLE - the vertex id is the index of the stop in the stops table
+    /// HILBERT_CURVE - stops are numbered along the Hilbert curve over their coordinates, so close stops have close vertex ids
+    /// and the routing data of the neighbouring vertices shares cache lines
+    enum class VertexOrder : uint8_t { STOPS_TABLE, HILBERT_CURVE };
+
     struct RoutingSettings {
         double bus_wait_time_min = 0;
         double bus_velocity_kmh = 0.0;
+        RouterType router_type = RouterType::ALL_PAIRS;
+        /// Keep only the lightest edge (and its routing item) of parallel edges between the same stops
+        bool collapse_parallel_edges = false;
+        /// Count of the last used Route answers kept by the router, zero disables the cache
+        size_t route_cache_capacity = 0;
+        VertexOrder vertex_order = VertexOrder::STOPS_TABLE;
+    };
+
+    /// Statistics of the last TransportRouter::Build
+    struct RoutingBuildStats {
+        /// Edges generated from the buses routes
+        size_t generated_edges_count = 0;
+        /// Edges added to the routing graph (less than generated if parallel edges are collapsed)
+        size_t edges_count = 0;
     };
 }
 namespace transport_catalogue::router /* Types aliases */ {
     using RoutingGraph = graph::DirectedWeightedGraph<double>;
-    using RoutingIncidentEdges = std::unordered_map<graph::EdgeId, RoutingItemInfo>;
+    using RawRouter = graph::IRouter<double>;
+    using AllPairsRouter = graph::Router<double, graph::PackedRoutesStorage<float, uint32_t>>;
+    using RoutesInternalData = AllPairsRouter::RoutesInternalData;
+    using RoutingProfiles = graph::HopLengthProfiles<double>;
+    using ContractionHierarchyRouter = graph::ContractionHierarchyRouter<double>;
+    using RoutingHierarchy = ContractionHierarchyRouter::Hierarchy;
+    using AStarRouter = graph::AStarRouter<double>;
+    using RoutingLandmarks = graph::LandmarkTables<double>;
+    using RoutingReachability = graph::ReachabilityIndex;
+    using RoutingSearchStats = RawRouter::SearchStats;
+    /// Route answers keyed by the (from, to) vertices pair, nullopt answer is cached for unreachable stops too
+    using RouteCache = detail::ShardedLruCache<uint64_t, std::optional<RouteInfo>>;
+    using RouteCacheStats = RouteCache::Stats;
+    using VertexIds = std::vector<graph::VertexId>;
 } 
 
 namespace transport_catalogue::router /* TransportRouter interface */ {
@@ -64,10 +163,27 @@ namespace transport_catalogue::router /* TransportRouter interface */ {
         virtual const RoutingSettings& GetSettings() const = 0;
 
         virtual const RoutingGraph& GetGraph() const = 0;
-        virtual void SetGraph(RoutingGraph&& graph, RoutingIncidentEdges&& route_edges) = 0;
+        /// Vertex ids are the vertex ids of the stops in the stops table order, the stops table order is used if they are empty
+        virtual void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids) = 0;
+        virtual void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutesInternalData&& routes_data) = 0;
+        virtual void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutingHierarchy&& hierarchy) = 0;
+        virtual void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutingLandmarks&& landmarks) = 0;
+
+        /// Return precomputed routes data of all-pairs router, or nullptr if another router type is used
+        virtual const RoutesInternalData* GetRoutesInternalData() const = 0;
+        /// Return preprocessed hierarchy of contraction hierarchy router, or nullptr if another router type is used
+        virtual const RoutingHierarchy* GetRoutingHierarchy() const = 0;
+        /// Return precomputed landmark tables of ALT router, or nullptr if another router type is used
+        virtual const RoutingLandmarks* GetRoutingLandmarks() const = 0;
+        /// Return the components index of the routing graph, or nullptr if it is not built (RAPTOR router has no routing graph)
+        virtual const RoutingReachability* GetRoutingReachability() const = 0;
+        /// Set the components index of the graph set before, throw std::invalid_argument if it does not match the graph
+        virtual void SetRoutingReachability(RoutingReachability&& reachability) = 0;
 
         virtual bool HasGraph() const = 0;
-        virtual const RoutingItemInfo& GetRoutingItem(graph::EdgeId edge_id) const = 0;
+        virtual const RoutingItems& GetRoutingItems() const = 0;
+        /// Vertex ids of the stops in the stops table order
+        virtual const VertexIds& GetVertexIds() const = 0;
     };
 }
 
@@ -79,46 +195,130 @@ namespace transport_catalogue::router /* TransportRouter */ {
         class IndexMapper {
         public:
             IndexMapper() = default;
-            IndexMapper(const data::DatabaseScheme::StopsTable& stops);
+            /// Vertex ids are the vertex ids of the stops in the stops table order, the stops table order is used if they are empty.
+            /// Throw std::invalid_argument if the vertex ids are not a permutation of the stops indexes
+            IndexMapper(const data::DatabaseScheme::StopsTable& stops, VertexIds vertex_ids = {});
 
             graph::VertexId GetAt(const data::Stop* stop_ptr) const;
+            /// Index of the vertex stop in the stops table
+            size_t GetStopIndex(graph::VertexId vertex) const;
+            const VertexIds& GetVertexIds() const;
             size_t IndexesCount() const;
             bool IsEmpty() const;
 
         private:
-            std::unordered_map<const data::Stop*, size_t> indexes_;
+            /// Indexed by StopId
+            VertexIds vertex_ids_;
+            std::vector<size_t> stop_indexes_;
 
         private:
-            void Init_(const data::DatabaseScheme::StopsTable& stops);
+            void Init_(const data::DatabaseScheme::StopsTable& stops, VertexIds&& vertex_ids);
         };
 
     public:
-        TransportRouter(RoutingSettings settings, const data::ITransportDataReader& db_reader) : settings_{settings}, db_reader_(db_reader) {}
+        TransportRouter(RoutingSettings settings, const data::ITransportDataReader& db_reader)
+            : settings_{settings}, db_reader_(db_reader), route_cache_(settings.route_cache_capacity) {}
 
+        /// Apply the settings to the built router too: a new router type, edges collapsing or vertex order rebuilds the router.
+        /// A new wait time or velocity re-derives the edge weights from the stored distances, keeping the graph. The all-pairs router
+        /// customizes its table from the settings-independent routes profiles (built by the first change) in O(V^2) without a search.
+        /// Other routers are remade over the new weights: the contraction hierarchy keeps the contraction order only
+        /// and recalculates all shortcuts, the landmark tables are recalculated
         void SetSettings(RoutingSettings settings) override;
 
         const RoutingSettings& GetSettings() const override;
 
+        /// Stops in the different components of the routing graph get nullopt without a search
         std::optional<RouteInfo> GetRouteInfo(std::string_view from_stop, std::string_view to_stop) const;
+        /// Build routes from every source to every target stop, sharing the search work between the pairs.
+        /// Unknown stops have no routes. Route items are filled if `unpack_routes` is true
+        RouteMatrix GetRouteMatrix(
+            const std::vector<std::string_view>& source_stops, const std::vector<std::string_view>& target_stops, bool unpack_routes = false) const;
+        /// Return stops reachable from the stop within `max_time` ordered by the arrival time (the stop itself is first),
+        /// or nullopt if the stop is unknown. Runs a one-to-all search pruned by the time budget for any router type
+        std::optional<ReachableStops> GetReachableStops(std::string_view from_stop, double max_time) const;
+        /// Return the Pareto set of (total time, transfers) routes ordered by transfers count, every next route is faster.
+        /// Available for the RAPTOR router type only
+        std::vector<RouteInfo> GetParetoRouteInfos(std::string_view from_stop, std::string_view to_stop) const;
         void Build();
 
-        const RoutingItemInfo& GetRoutingItem(graph::EdgeId edge_id) const override;
+        /// Add the edges of the bus added to the catalogue after the build and update the routing data in place.
+        /// The router is rebuilt if stops are added to the catalogue after the build too
+        void AddBus(std::string_view bus_name);
+        /// Update the weights of the edges riding between the stops (in any direction) after the measured distance between them
+        /// is changed in the catalogue. Falls back to the full rebuild if stops are added to the catalogue after the build,
+        /// or if the parallel edges are collapsed (the dropped parallel edges are not kept to be chosen again)
+        void UpdateDistance(std::string_view from_stop, std::string_view to_stop);
+
+        const RoutingItems& GetRoutingItems() const override;
         const RoutingGraph& GetGraph() const override;
-        void SetGraph(RoutingGraph&& graph, RoutingIncidentEdges&& route_edges) override;
+        void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids) override;
+        void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutesInternalData&& routes_data) override;
+        void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutingHierarchy&& hierarchy) override;
+        void SetGraph(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids, RoutingLandmarks&& landmarks) override;
+        const VertexIds& GetVertexIds() const override;
         virtual bool HasGraph() const override;
+        const RoutesInternalData* GetRoutesInternalData() const override;
+        const RoutingHierarchy* GetRoutingHierarchy() const override;
+        const RoutingLandmarks* GetRoutingLandmarks() const override;
+        const RoutingReachability* GetRoutingReachability() const override;
+        void SetRoutingReachability(RoutingReachability&& reachability) override;
+
+        /// Debug counters of the on-demand search (settled vertices per query), zero for the all-pairs router
+        RoutingSearchStats GetSearchStats() const;
+        const RoutingBuildStats& GetBuildStats() const;
+        /// Hits and misses of the Route answers cache since the last invalidation (the graph or the settings change)
+        RouteCacheStats GetRouteCacheStats() const;
 
         void ResetGraph();
 
+    public:
+        static constexpr size_t LANDMARKS_COUNT = 8;
+
     private:
         RoutingSettings settings_;
         const data::ITransportDataReader& db_reader_;
-        RoutingIncidentEdges edges_;
-        std::unique_ptr<graph::Router<double>> raw_router_ptr_;
+        RoutingItems routing_items_;
+        std::unique_ptr<RawRouter> raw_router_ptr_;
+        /// Bounded searches of the precomputed routers, made on the first one and kept until the graph is reset
+        mutable std::unique_ptr<graph::DijkstraRouter<double>> graph_router_ptr_;
+        std::unique_ptr<RaptorRouter> raptor_router_ptr_;
         RoutingGraph graph_;
         IndexMapper index_mapper_;
+        std::optional<RoutingLandmarks> landmarks_;
+        /// Routes profiles of the all-pairs router, built on the first wait time or velocity change and kept until the graph is changed.
+        /// They take 24 bytes per Pareto route, at least one per connected vertices pair
+        std::optional<RoutingProfiles> routing_profiles_;
+        std::optional<RoutingReachability> reachability_;
+        RoutingBuildStats build_stats_;
+        mutable RouteCache route_cache_;
         bool is_builded_ = false;
 
     private:
-        void AddRouteEdges_(const data::Bus& bus);
+        /// Edges of the lightest parallel edges collected while building, keyed by (from, to) vertices
+        struct CollapsedEdges {
+            std::unordered_map<uint64_t, size_t> indexes;
+            std::vector<std::pair<RoutingGraph::EdgeType, RoutingItem>> edges;
+        };
+
+        /// Call `on_edge(edge, routing_item)` for every ride of the bus, in the same order for the same bus
+        template <typename OnEdge>
+        void ForEachRouteEdge_(const data::Bus& bus, uint32_t bus_id, OnEdge&& on_edge) const;
+        void AddRouteEdges_(const data::Bus& bus, uint32_t bus_id, CollapsedEdges* collapsed_edges);
+        /// Dijkstra router searching the routing graph: the raw router itself if it is one, or the cached router over the graph
+        const graph::DijkstraRouter<double>& GetGraphRouter_() const;
+        /// Replace the graph and the routing items loaded from the database, the raw router is not made
+        void SetGraph_(RoutingGraph&& graph, RoutingItems&& routing_items, VertexIds&& vertex_ids);
+        /// Vertex ids of the stops by the vertex order of the settings
+        VertexIds MakeVertexIds_() const;
+        void AddRouteEdge_(RoutingGraph::EdgeType&& edge, const RoutingItem& item, CollapsedEdges* collapsed_edges);
+        std::unique_ptr<RawRouter> MakeRawRouter_();
+        /// Update the routing data after the edges weights are changed or edges are added (lighter edges)
+        void UpdateRawRouter_(const std::vector<graph::EdgeId>& heavier_edges, const std::vector<graph::EdgeId>& lighter_edges);
+        /// Re-derive the edges weights and the routing items by the current settings, keeping the graph topology
+        void CustomizeWeights_();
+        AStarRouter::Heuristic MakeGeoHeuristic_() const;
+        RouteInfo MakeRouteInfo_(RaptorRouter::Journey&& journey) const;
+        RouteInfo MakeRouteInfo_(RawRouter::RouteInfo&& route, bool unpack_route = true) const;
     };
 }
\ No newline at end of file